@@ -169,6 +169,20 @@ generated-files: $(KEYMAP_OUTPUT)/src/config.h $(KEYMAP_OUTPUT)/src/keymap.c
 
 endif
 
+# Scan the keymap source for RGB mode keycodes so the lighting headers can
+# trim the effect tables down to the modes the keymap can actually reach.
+# Only works on a plain keymap.c (keymap.json keymaps are generated after
+# make parses this file) and only sees keycodes spelled out in the keymap,
+# so modes reached exclusively through VIA or custom code should be kept
+# alive with explicit RGBLIGHT_EFFECT_* defines in config.h.
+ifeq ($(strip $(KEYMAP_STRIP_UNUSED)), yes)
+    ifneq ("$(wildcard $(KEYMAP_C))", "")
+        OPT_DEFS += -DKEYMAP_STRIP_UNUSED
+        KEYMAP_USED_KEYCODES := $(sort $(shell grep -ohE 'RGB_(MODE_[A-Z]+|M_[A-Z]+)' $(KEYMAP_C) 2>/dev/null))
+        OPT_DEFS += $(patsubst %,-DKEYMAP_USES_%,$(KEYMAP_USED_KEYCODES))
+    endif
+endif
+
 ifeq ($(strip $(CTPC)), yes)
   CONVERT_TO_PROTON_C=yes
 endif
@@ -435,6 +449,9 @@ $(KEYBOARD_OUTPUT)_CONFIG := $(PROJECT_CONFIG)
 # Default target.
 ifeq ($(SKIP_COMPILE),no)
 all: build check-size
+ifeq ($(strip $(SIZE_REPORT_ENABLE)), yes)
+all: size-report
+endif
 else
 all:
 	echo "skipped" >&2
@@ -444,6 +461,7 @@ build: elf cpfirmware
 check-size: build
 check-md5: build
 objs-size: build
+size-report: build
 
 include show_options.mk
 include $(TMK_PATH)/rules.mk
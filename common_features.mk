@@ -127,7 +127,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/pointing_device.c
 endif
 
-VALID_EEPROM_DRIVER_TYPES := vendor custom transient i2c spi
+VALID_EEPROM_DRIVER_TYPES := vendor custom transient i2c spi journal
 EEPROM_DRIVER ?= vendor
 ifeq ($(filter $(EEPROM_DRIVER),$(VALID_EEPROM_DRIVER_TYPES)),)
   $(error EEPROM_DRIVER="$(EEPROM_DRIVER)" is not a valid EEPROM driver)
@@ -151,6 +151,23 @@ else
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_TRANSIENT
     COMMON_VPATH += $(DRIVER_PATH)/eeprom
     SRC += eeprom_driver.c eeprom_transient.c
+  else ifeq ($(strip $(EEPROM_DRIVER)), journal)
+    # Flash-journal emulation: append-only write log with boot replay and
+    # compaction, shared with the vendor STM32 implementation
+    OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_JOURNAL
+    COMMON_VPATH += $(DRIVER_PATH)/eeprom
+    SRC += eeprom_driver.c eeprom_journal.c
+    SRC += $(PLATFORM_COMMON_DIR)/eeprom_stm32.c
+    SRC += $(PLATFORM_COMMON_DIR)/flash_stm32.c
+    ifeq ($(MCU_SERIES), STM32F3xx)
+      OPT_DEFS += -DEEPROM_EMU_STM32F303xC
+    else ifeq ($(MCU_SERIES), STM32F1xx)
+      OPT_DEFS += -DEEPROM_EMU_STM32F103xB
+    else ifeq ($(MCU_SERIES)_$(MCU_LDSCRIPT), STM32F0xx_STM32F072xB)
+      OPT_DEFS += -DEEPROM_EMU_STM32F072xB
+    else ifeq ($(MCU_SERIES)_$(MCU_LDSCRIPT), STM32F0xx_STM32F042x6)
+      OPT_DEFS += -DEEPROM_EMU_STM32F042x6
+    endif
   else ifeq ($(strip $(EEPROM_DRIVER)), vendor)
     OPT_DEFS += -DEEPROM_VENDOR
     ifeq ($(PLATFORM),AVR)
@@ -361,6 +378,11 @@ ifeq ($(strip $(SERIAL_LINK_ENABLE)), yes)
     VAPTH += $(SERIAL_PATH)
 endif
 
+TRACE_PROBE_ENABLE ?= no
+ifeq ($(strip $(TRACE_PROBE_ENABLE)), yes)
+    OPT_DEFS += -DTRACE_PROBE_ENABLE
+endif
+
 VARIABLE_TRACE ?= no
 ifneq ($(strip $(VARIABLE_TRACE)),no)
     SRC += $(QUANTUM_DIR)/variable_trace.c
@@ -477,6 +499,10 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     BOOTMAGIC_ENABLE := lite
     SRC += $(QUANTUM_DIR)/via.c
     OPT_DEFS += -DVIA_ENABLE
+    ifeq ($(strip $(VIA_BULK_TRANSFER_ENABLE)), yes)
+        OPT_DEFS += -DVIA_BULK_TRANSFER
+        CRC_ENABLE := yes
+    endif
 endif
 
 ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
@@ -489,6 +515,11 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/dip_switch.c
 endif
 
+ifeq ($(strip $(PIN_CHANGE_NOTIFY_ENABLE)), yes)
+    OPT_DEFS += -DPIN_CHANGE_NOTIFY_ENABLE
+    SRC += $(QUANTUM_DIR)/pin_change.c
+endif
+
 VALID_MAGIC_TYPES := yes lite
 BOOTMAGIC_ENABLE ?= no
 ifneq ($(strip $(BOOTMAGIC_ENABLE)), no)
@@ -563,9 +594,65 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     COMMON_VPATH += $(QUANTUM_PATH)/split_common
 endif
 
+ifeq ($(strip $(LATENCY_TRACE_ENABLE)), yes)
+    OPT_DEFS += -DLATENCY_TRACE
+    SRC += $(QUANTUM_DIR)/latency_trace.c
+endif
+
+ifeq ($(strip $(TAPPING_TRACE_ENABLE)), yes)
+    OPT_DEFS += -DTAPPING_TRACE_ENABLE
+    SRC += $(QUANTUM_DIR)/tapping_trace.c
+endif
+
+ifeq ($(strip $(PERF_COUNTER_ENABLE)), yes)
+    OPT_DEFS += -DPERF_COUNTER_ENABLE
+    SRC += $(QUANTUM_DIR)/perf_counter.c
+endif
+
+ifeq ($(strip $(MATRIX_INJECT_ENABLE)), yes)
+    OPT_DEFS += -DMATRIX_INJECT_ENABLE
+    SRC += $(QUANTUM_DIR)/matrix_inject.c
+endif
+
+ifeq ($(strip $(TELEMETRY_ENABLE)), yes)
+    OPT_DEFS += -DTELEMETRY_ENABLE
+    SRC += $(QUANTUM_DIR)/logging/telemetry.c
+endif
+
+ifeq ($(strip $(TIMEOUT_WHEEL_ENABLE)), yes)
+    OPT_DEFS += -DTIMEOUT_WHEEL_ENABLE
+    SRC += $(QUANTUM_DIR)/timeout_wheel.c
+endif
+
+ifeq ($(strip $(WATCHDOG_ENABLE)), yes)
+    OPT_DEFS += -DWATCHDOG_ENABLE
+    SRC += $(QUANTUM_DIR)/watchdog.c
+endif
+
+ifeq ($(strip $(KEYEVENT_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DKEYEVENT_QUEUE_ENABLE
+    SRC += $(QUANTUM_DIR)/keyevent_queue.c
+endif
+
+ifeq ($(strip $(KEYCODE_NAMES_ENABLE)), yes)
+    OPT_DEFS += -DKEYCODE_NAMES_ENABLE
+    SRC += $(QUANTUM_DIR)/keycode_names.c
+endif
+
+ifeq ($(strip $(TASK_EXECUTOR_ENABLE)), yes)
+    OPT_DEFS += -DTASK_EXECUTOR_ENABLE
+    SRC += $(QUANTUM_DIR)/task_executor.c
+endif
+
 ifeq ($(strip $(CRC_ENABLE)), yes)
     OPT_DEFS += -DCRC_ENABLE
-    SRC += crc.c
+    CRC_DRIVER ?= software
+    ifeq ($(strip $(CRC_DRIVER)), software)
+        SRC += crc.c
+    else
+        OPT_DEFS += -DCRC_DRIVER_$(strip $(shell echo $(CRC_DRIVER) | tr '[:lower:]' '[:upper:]'))
+        SRC += crc_$(strip $(CRC_DRIVER)).c
+    endif
 endif
 
 HAPTIC_ENABLE ?= no
@@ -679,6 +766,11 @@ ifeq ($(strip $(TAP_DANCE_ENABLE)), yes)
     OPT_DEFS += -DTAP_DANCE_ENABLE
 endif
 
+ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
+    SRC += $(QUANTUM_DIR)/process_keycode/process_autocorrect.c
+    OPT_DEFS += -DAUTOCORRECT_ENABLE
+endif
+
 ifeq ($(strip $(KEY_LOCK_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_key_lock.c
     OPT_DEFS += -DKEY_LOCK_ENABLE
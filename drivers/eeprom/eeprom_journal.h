@@ -0,0 +1,31 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+    Flash-journal EEPROM emulation exposed through the pluggable driver
+    framework. Writes are appended as compact (address, value) records to a
+    write log in MCU flash and replayed into a RAM cache on boot; the log is
+    compacted into a fresh snapshot only when full, so the frequent small
+    writes from dynamic keymaps cost one halfword program each instead of a
+    page erase.
+
+    The journal engine itself lives in tmk_core/common/chibios/eeprom_stm32.c
+    and is shared with the vendor STM32 implementation; flash geometry is
+    derived there (or overridden with FEE_PAGE_SIZE / FEE_PAGE_COUNT /
+    FEE_MCU_FLASH_SIZE in config.h).
+*/
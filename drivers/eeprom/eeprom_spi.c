@@ -153,18 +153,29 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         }
 
         //-------------------------------------------------
-        // Wait for the write-in-progress bit to be cleared
-        res = spi_eeprom_start();
-        if (!res) {
-            dprint("failed to start SPI for WIP check\n");
-            return;
+        // Trim the chunk to the span that actually differs -- a read at bus
+        // speed costs far less than an EEPROM program cycle, and the read
+        // path's WIP check doubles as the wait for the previous page program,
+        // which by now has run concurrently with preparing this chunk
+        uint8_t current[EXTERNAL_EEPROM_PAGE_SIZE];
+        eeprom_read_block(current, (const void *)target_addr, write_length);
+
+        int span_start = 0;
+        while (span_start < write_length && current[span_start] == read_buf[span_start]) {
+            ++span_start;
         }
 
-        spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
-        spi_stop();
-        if (response == SPI_STATUS_TIMEOUT) {
-            dprint("SPI timeout for WIP check\n");
-            return;
+        if (span_start == write_length) {
+            // Page already holds this data; skip the program cycle entirely
+            read_buf += write_length;
+            target_addr += write_length;
+            len -= write_length;
+            continue;
+        }
+
+        int span_end = write_length;
+        while (span_end > span_start && current[span_end - 1] == read_buf[span_end - 1]) {
+            --span_end;
         }
 
         //-------------------------------------------------
@@ -187,16 +198,16 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%08lX: ", ((uint32_t)(uintptr_t)target_addr));
-        for (size_t i = 0; i < write_length; i++) {
+        dprintf("[EEPROM W] 0x%08lX: ", ((uint32_t)(uintptr_t)(target_addr + span_start)));
+        for (int i = span_start; i < span_end; i++) {
             dprintf(" %02X", (int)(uint8_t)(read_buf[i]));
         }
         dprintf("\n");
 #endif  // DEBUG_EEPROM_OUTPUT
 
         spi_write(CMD_WRITE);
-        spi_eeprom_transmit_address(target_addr);
-        spi_transmit(read_buf, write_length);
+        spi_eeprom_transmit_address(target_addr + span_start);
+        spi_transmit(&read_buf[span_start], span_end - span_start);
         spi_stop();
 
         read_buf += write_length;
@@ -20,8 +20,30 @@
 #include "eeprom_driver.h"
 #include "eeprom_transient.h"
 
+#ifdef TRANSIENT_EEPROM_SYNC
+#    include "raw_hid.h"
+#    include "timer.h"
+#endif
+
 __attribute__((aligned(4))) static uint8_t transientBuffer[TRANSIENT_EEPROM_SIZE] = {0};
 
+#ifdef TRANSIENT_EEPROM_SYNC
+#    define TRANSIENT_EEPROM_PAGE_COUNT ((TRANSIENT_EEPROM_SIZE + TRANSIENT_EEPROM_PAGE_SIZE - 1) / TRANSIENT_EEPROM_PAGE_SIZE)
+
+// Per-page dirty bits; eeprom_transient_sync_task() pushes one dirty page
+// per interval to the host, which persists the image off-device
+static uint8_t  transientDirty[(TRANSIENT_EEPROM_PAGE_COUNT + 7) / 8];
+static uint16_t transientSyncTimer;
+
+static void transient_mark_dirty(intptr_t offset, size_t len) {
+    uint16_t first = offset / TRANSIENT_EEPROM_PAGE_SIZE;
+    uint16_t last  = (offset + len - 1) / TRANSIENT_EEPROM_PAGE_SIZE;
+    for (uint16_t page = first; page <= last; page++) {
+        transientDirty[page >> 3] |= 1 << (page & 7);
+    }
+}
+#endif
+
 size_t clamp_length(intptr_t offset, size_t len) {
     if (offset + len > TRANSIENT_EEPROM_SIZE) {
         len = TRANSIENT_EEPROM_SIZE - offset;
@@ -47,6 +69,63 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     intptr_t offset = (intptr_t)addr;
     len             = clamp_length(offset, len);
     if (len > 0) {
+#ifdef TRANSIENT_EEPROM_SYNC
+        if (memcmp(&transientBuffer[offset], buf, len) != 0) {
+            transient_mark_dirty(offset, len);
+        }
+#endif
         memcpy(&transientBuffer[offset], buf, len);
     }
 }
+
+#ifdef TRANSIENT_EEPROM_SYNC
+// Push one dirty page to the host per interval. The report layout is
+//   data[0]  TRANSIENT_EEPROM_SYNC_ID
+//   data[1]  sub-command (id_transient_sync_page)
+//   data[2]  page index
+//   data[3]  page length
+//   data[4+] page contents
+// The host service acknowledges nothing; pages are idempotent and a lost
+// report is re-sent because the dirty bit is only cleared after raw_hid_send
+// returns. Restores from the host arrive through the same layout.
+void eeprom_transient_sync_task(void) {
+    if (timer_elapsed(transientSyncTimer) < TRANSIENT_EEPROM_SYNC_INTERVAL) {
+        return;
+    }
+    transientSyncTimer = timer_read();
+
+    for (uint16_t page = 0; page < TRANSIENT_EEPROM_PAGE_COUNT; page++) {
+        if (transientDirty[page >> 3] & (1 << (page & 7))) {
+            uint8_t  report[TRANSIENT_EEPROM_SYNC_EPSIZE] = {0};
+            intptr_t offset                               = (intptr_t)page * TRANSIENT_EEPROM_PAGE_SIZE;
+            uint8_t  page_length                          = clamp_length(offset, TRANSIENT_EEPROM_PAGE_SIZE);
+
+            report[0] = TRANSIENT_EEPROM_SYNC_ID;
+            report[1] = id_transient_sync_page;
+            report[2] = page;
+            report[3] = page_length;
+            memcpy(&report[4], &transientBuffer[offset], page_length);
+            raw_hid_send(report, sizeof(report));
+            transientDirty[page >> 3] &= ~(1 << (page & 7));
+            return;  // one page per pass, keeping the scan loop unblocked
+        }
+    }
+}
+
+bool eeprom_transient_sync_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != TRANSIENT_EEPROM_SYNC_ID || data[1] != id_transient_sync_page) {
+        return false;
+    }
+
+    uint16_t page        = data[2];
+    intptr_t offset      = (intptr_t)page * TRANSIENT_EEPROM_PAGE_SIZE;
+    size_t   page_length = data[3];
+
+    if (page >= TRANSIENT_EEPROM_PAGE_COUNT || page_length > (size_t)(length - 4)) {
+        return true;  // malformed, but addressed to us: swallow it
+    }
+    // Restore without marking dirty, so the page is not echoed back
+    memcpy(&transientBuffer[offset], &data[4], clamp_length(offset, page_length));
+    return true;
+}
+#endif  // TRANSIENT_EEPROM_SYNC
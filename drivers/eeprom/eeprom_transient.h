@@ -23,3 +23,45 @@
 #    include "eeconfig.h"
 #    define TRANSIENT_EEPROM_SIZE (((EECONFIG_SIZE + 3) / 4) * 4)  // based off eeconfig's current usage, aligned to 4-byte sizes, to deal with LTO
 #endif
+
+/*
+    Optional host-side persistence: with TRANSIENT_EEPROM_SYNC defined (and
+    RAW_ENABLE), dirty pages of the RAM buffer are pushed to the host over
+    raw HID, and a host service pushes the saved image back on connect. This
+    gives EEPROM-less MCUs a full-size, instant-latency "EEPROM" whose
+    contents survive power loss off-device.
+*/
+#ifdef TRANSIENT_EEPROM_SYNC
+#    include <stdint.h>
+#    include <stdbool.h>
+#    include <stddef.h>
+
+#    ifndef TRANSIENT_EEPROM_PAGE_SIZE
+#        define TRANSIENT_EEPROM_PAGE_SIZE 16
+#    endif
+/* Minimum ms between page pushes, so a settings burst does not flood the endpoint */
+#    ifndef TRANSIENT_EEPROM_SYNC_INTERVAL
+#        define TRANSIENT_EEPROM_SYNC_INTERVAL 50
+#    endif
+/* Must match the raw HID endpoint size (RAW_EPSIZE) */
+#    ifndef TRANSIENT_EEPROM_SYNC_EPSIZE
+#        define TRANSIENT_EEPROM_SYNC_EPSIZE 32
+#    endif
+/* First report byte identifying sync traffic; override on collision with
+   other raw HID usage */
+#    ifndef TRANSIENT_EEPROM_SYNC_ID
+#        define TRANSIENT_EEPROM_SYNC_ID 0xEE
+#    endif
+
+enum transient_sync_id {
+    id_transient_sync_page = 0x01,
+};
+
+/* Called from keyboard_task(); pushes at most one dirty page per interval */
+void eeprom_transient_sync_task(void);
+
+/* Call from raw_hid_receive() (or raw_hid_receive_kb() under VIA) to let the
+   host restore pages. Returns true if the report was sync traffic and has
+   been consumed. */
+bool eeprom_transient_sync_receive(uint8_t *data, uint8_t length);
+#endif
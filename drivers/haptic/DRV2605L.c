@@ -16,6 +16,7 @@
  */
 #include "DRV2605L.h"
 #include "print.h"
+#include "progmem.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
@@ -23,6 +24,10 @@
 uint8_t DRV2605L_transfer_buffer[2];
 uint8_t DRV2605L_read_register;
 
+#ifdef DRV2605L_PATTERN_SLOTS
+static void DRV_patterns_init(void);
+#endif
+
 void DRV_write(uint8_t drv_register, uint8_t settings) {
     DRV2605L_transfer_buffer[0] = drv_register;
     DRV2605L_transfer_buffer[1] = settings;
@@ -98,12 +103,54 @@ void DRV_init(void) {
      * 0x01 sets DRV2605 out of standby and to use external trigger */
     DRV_write(DRV_MODE, 0x00);
 
+#ifdef DRV2605L_PATTERN_SLOTS
+    DRV_patterns_init();
+#endif
+
     // Play greeting sequence
     DRV_write(DRV_GO, 0x00);
     DRV_write(DRV_WAVEFORM_SEQ_1, DRV_GREETING);
     DRV_write(DRV_GO, 0x01);
 }
 
+#ifdef DRV2605L_PATTERN_SLOTS
+/* Each slot holds a full waveform sequencer image: up to eight ROM library
+ * effects, zero-terminated when shorter. Keyboards and users can override
+ * the table to define their own slots. */
+__attribute__((weak)) const uint8_t drv_patterns[DRV2605L_PATTERN_COUNT][8] PROGMEM = {
+    {strong_click, 0, 0, 0, 0, 0, 0, 0},
+    {sharp_tick1, 0, 0, 0, 0, 0, 0, 0},
+    {soft_bump, 0, 0, 0, 0, 0, 0, 0},
+    {dbl_click, 0, 0, 0, 0, 0, 0, 0},
+};
+
+/* Bursts prebuilt at init - register address, eight sequencer bytes and GO -
+ * so firing a slot is a single transfer with no runtime assembly. */
+static uint8_t DRV2605L_pattern_buffers[DRV2605L_PATTERN_COUNT][10];
+
+static void DRV_patterns_init(void) {
+    for (uint8_t slot = 0; slot < DRV2605L_PATTERN_COUNT; slot++) {
+        DRV2605L_pattern_buffers[slot][0] = DRV_WAVEFORM_SEQ_1;
+        for (uint8_t i = 0; i < 8; i++) {
+            DRV2605L_pattern_buffers[slot][1 + i] = pgm_read_byte(&drv_patterns[slot][i]);
+        }
+        DRV2605L_pattern_buffers[slot][9] = 0x01;
+    }
+}
+
+void DRV_pulse_pattern(uint8_t slot) {
+    if (slot >= DRV2605L_PATTERN_COUNT) {
+        slot = 0;
+    }
+#    ifdef I2C_MASTER_ASYNC
+    if (i2c_transmit_async(DRV2605L_BASE_ADDRESS << 1, DRV2605L_pattern_buffers[slot], 10) == I2C_STATUS_SUCCESS) {
+        return;
+    }
+#    endif
+    i2c_transmit(DRV2605L_BASE_ADDRESS << 1, DRV2605L_pattern_buffers[slot], 10, 100);
+}
+#endif
+
 void DRV_rtp_init(void) {
     DRV_write(DRV_GO, 0x00);
     DRV_write(DRV_RTP_INPUT, 20);  // 20 is the lowest value I've found where haptics can still be felt.
@@ -113,8 +160,27 @@ void DRV_rtp_init(void) {
 
 void DRV_amplitude(uint8_t amplitude) { DRV_write(DRV_RTP_INPUT, amplitude); }
 
+#ifdef I2C_MASTER_ASYNC
+/* The waveform sequencer registers (0x04..0x0B) and the GO register (0x0C)
+ * are contiguous, so one auto-incrementing burst can set the sequence,
+ * terminate it and fire GO in a single transaction. The interrupt-driven
+ * engine clocks it out in the background, so the keystroke path only pays
+ * for the START condition. */
+static uint8_t DRV2605L_pulse_buffer[10] = {DRV_WAVEFORM_SEQ_1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+void DRV_pulse(uint8_t sequence) {
+    DRV2605L_pulse_buffer[1] = sequence;
+    if (i2c_transmit_async(DRV2605L_BASE_ADDRESS << 1, DRV2605L_pulse_buffer, sizeof(DRV2605L_pulse_buffer)) != I2C_STATUS_SUCCESS) {
+        /* engine busy with a previous transfer - fall back to the blocking sequence */
+        DRV_write(DRV_GO, 0x00);
+        DRV_write(DRV_WAVEFORM_SEQ_1, sequence);
+        DRV_write(DRV_GO, 0x01);
+    }
+}
+#else
 void DRV_pulse(uint8_t sequence) {
     DRV_write(DRV_GO, 0x00);
     DRV_write(DRV_WAVEFORM_SEQ_1, sequence);
     DRV_write(DRV_GO, 0x01);
 }
+#endif
@@ -174,6 +174,13 @@ void    DRV_rtp_init(void);
 void    DRV_amplitude(const uint8_t amplitude);
 void    DRV_pulse(const uint8_t sequence);
 
+#ifdef DRV2605L_PATTERN_SLOTS
+#    ifndef DRV2605L_PATTERN_COUNT
+#        define DRV2605L_PATTERN_COUNT 4
+#    endif
+void DRV_pulse_pattern(uint8_t slot);
+#endif
+
 typedef enum DRV_EFFECT {
     clear_sequence                       = 0,
     strong_click                         = 1,
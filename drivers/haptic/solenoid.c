@@ -27,6 +27,31 @@ uint8_t  solenoid_dwell   = SOLENOID_DEFAULT_DWELL;
 
 extern haptic_config_t haptic_config;
 
+#ifdef SOLENOID_QUEUE
+#    ifndef SOLENOID_QUEUE_MAX
+#        define SOLENOID_QUEUE_MAX 2
+#    endif
+#    ifndef SOLENOID_QUEUE_GAP
+#        define SOLENOID_QUEUE_GAP SOLENOID_MIN_DWELL
+#    endif
+/* Actuations requested while a click cycle is in flight are queued (up to
+ * SOLENOID_QUEUE_MAX; anything beyond is coalesced into the waiting ones,
+ * since a plunger cannot physically resolve them) and replayed back to back
+ * with SOLENOID_QUEUE_GAP of off-time in between so the plunger can return.
+ * Without the queue a fast roll simply drops every fire that lands inside
+ * the previous dwell. */
+static uint8_t  solenoid_pending      = 0;
+static uint8_t  solenoid_pending_peak = 0;
+static bool     solenoid_in_gap       = false;
+static uint16_t solenoid_gap_start    = 0;
+
+uint8_t solenoid_queue_depth(void) { return solenoid_pending; }
+
+uint8_t solenoid_queue_peak(void) { return solenoid_pending_peak; }
+
+void solenoid_queue_clear_stats(void) { solenoid_pending_peak = 0; }
+#endif
+
 void solenoid_buzz_on(void) { haptic_set_buzz(1); }
 
 void solenoid_buzz_off(void) { haptic_set_buzz(0); }
@@ -42,6 +67,17 @@ void solenoid_stop(void) {
 }
 
 void solenoid_fire(void) {
+#ifdef SOLENOID_QUEUE
+    if (!haptic_config.buzz && (solenoid_on || solenoid_in_gap)) {
+        if (solenoid_pending < SOLENOID_QUEUE_MAX) {
+            solenoid_pending++;
+            if (solenoid_pending > solenoid_pending_peak) {
+                solenoid_pending_peak = solenoid_pending;
+            }
+        }
+        return;
+    }
+#endif
     if (!haptic_config.buzz && solenoid_on) return;
     if (haptic_config.buzz && solenoid_buzzing) return;
 
@@ -54,6 +90,20 @@ void solenoid_fire(void) {
 void solenoid_check(void) {
     uint16_t elapsed = 0;
 
+#ifdef SOLENOID_QUEUE
+    if (solenoid_in_gap) {
+        // Off-time between queued actuations, so the plunger can return
+        if (timer_elapsed(solenoid_gap_start) >= SOLENOID_QUEUE_GAP) {
+            solenoid_in_gap = false;
+            if (solenoid_pending > 0) {
+                solenoid_pending--;
+                solenoid_fire();
+            }
+        }
+        return;
+    }
+#endif
+
     if (!solenoid_on) return;
 
     elapsed = timer_elapsed(solenoid_start);
@@ -61,6 +111,12 @@ void solenoid_check(void) {
     // Check if it's time to finish this solenoid click cycle
     if (elapsed > solenoid_dwell) {
         solenoid_stop();
+#ifdef SOLENOID_QUEUE
+        if (solenoid_pending > 0) {
+            solenoid_in_gap    = true;
+            solenoid_gap_start = timer_read();
+        }
+#endif
         return;
     }
 
@@ -58,6 +58,14 @@ void solenoid_set_dwell(uint8_t dwell);
 void solenoid_stop(void);
 void solenoid_fire(void);
 
+#ifdef SOLENOID_QUEUE
+// Actuations waiting for the current click cycle, and the high-water mark
+// since the stats were last cleared (e.g. for a raw HID query handler)
+uint8_t solenoid_queue_depth(void);
+uint8_t solenoid_queue_peak(void);
+void    solenoid_queue_clear_stats(void);
+#endif
+
 void solenoid_check(void);
 
 void solenoid_setup(void);
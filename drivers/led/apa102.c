@@ -18,43 +18,91 @@
 #include "apa102.h"
 #include "quantum.h"
 
-#ifndef APA102_NOPS
-#    if defined(__AVR__)
-#        define APA102_NOPS 0  // AVR at 16 MHz already spends 62.5 ns per clock, so no extra delay is needed
-#    elif defined(PROTOCOL_CHIBIOS)
-
-#        include "hal.h"
-#        if defined(STM32F0XX) || defined(STM32F1XX) || defined(STM32F3XX) || defined(STM32F4XX) || defined(STM32L0XX)
-#            define APA102_NOPS (100 / (1000000000L / (STM32_SYSCLK / 4)))  // This calculates how many loops of 4 nops to run to delay 100 ns
-#        else
-#            error("APA102_NOPS configuration required")
-#            define APA102_NOPS 0  // this just pleases the compile so the above error is easier to spot
+#ifdef APA102_SPI
+#    include "spi_master.h"
+
+#    ifndef APA102_SPI_DIVISOR
+#        define APA102_SPI_DIVISOR 2
+#    endif
+#else
+#    ifndef APA102_NOPS
+#        if defined(__AVR__)
+#            define APA102_NOPS 0  // AVR at 16 MHz already spends 62.5 ns per clock, so no extra delay is needed
+#        elif defined(PROTOCOL_CHIBIOS)
+
+#            include "hal.h"
+#            if defined(STM32F0XX) || defined(STM32F1XX) || defined(STM32F3XX) || defined(STM32F4XX) || defined(STM32L0XX)
+#                define APA102_NOPS (100 / (1000000000L / (STM32_SYSCLK / 4)))  // This calculates how many loops of 4 nops to run to delay 100 ns
+#            else
+#                error("APA102_NOPS configuration required")
+#                define APA102_NOPS 0  // this just pleases the compile so the above error is easier to spot
+#            endif
 #        endif
 #    endif
-#endif
 
-#define io_wait                                 \
-    do {                                        \
-        for (int i = 0; i < APA102_NOPS; i++) { \
-            __asm__ volatile("nop\n\t"          \
-                             "nop\n\t"          \
-                             "nop\n\t"          \
-                             "nop\n\t");        \
-        }                                       \
-    } while (0)
-
-#define APA102_SEND_BIT(byte, bit)               \
-    do {                                         \
-        writePin(RGB_DI_PIN, (byte >> bit) & 1); \
-        io_wait;                                 \
-        writePinHigh(RGB_CI_PIN);                \
-        io_wait;                                 \
-        writePinLow(RGB_CI_PIN);                 \
-        io_wait;                                 \
-    } while (0)
+#    define io_wait                                 \
+        do {                                        \
+            for (int i = 0; i < APA102_NOPS; i++) { \
+                __asm__ volatile("nop\n\t"          \
+                                 "nop\n\t"          \
+                                 "nop\n\t"          \
+                                 "nop\n\t");        \
+            }                                       \
+        } while (0)
+
+#    define APA102_SEND_BIT(byte, bit)               \
+        do {                                         \
+            writePin(RGB_DI_PIN, (byte >> bit) & 1); \
+            io_wait;                                 \
+            writePinHigh(RGB_CI_PIN);                \
+            io_wait;                                 \
+            writePinLow(RGB_CI_PIN);                 \
+            io_wait;                                 \
+        } while (0)
+#endif
 
 uint8_t apa102_led_brightness = APA102_DEFAULT_BRIGHTNESS;
 
+#ifdef APA102_SPI
+
+// Start frame: 32 zero bits. End frame: one extra clock edge per LED in the
+// chain, in groups of 16 (see the end-frame discussion in the bit-bang path
+// below for why this is not 4x 0xFF as the datasheet claims).
+#    define APA102_START_BYTES 4
+#    define APA102_END_BYTES(count) (((count) + 14) / 16)
+
+static uint8_t apa102_spi_buffer[APA102_START_BYTES + RGBLED_NUM * 4 + APA102_END_BYTES(RGBLED_NUM)];
+
+void apa102_setleds(LED_TYPE *start_led, uint16_t num_leds) {
+    LED_TYPE *end  = start_led + num_leds;
+    uint8_t * data = apa102_spi_buffer;
+
+    for (uint8_t i = 0; i < APA102_START_BYTES; i++) {
+        *data++ = 0;
+    }
+
+    for (LED_TYPE *led = start_led; led < end; led++) {
+        *data++ = 0b11100000 | apa102_led_brightness;
+        *data++ = led->b;
+        *data++ = led->g;
+        *data++ = led->r;
+    }
+
+    for (uint16_t i = 0; i < APA102_END_BYTES(num_leds); i++) {
+        *data++ = 0;
+    }
+
+    spi_init();
+    // The APA102 has no chip select and samples on the rising clock edge, so
+    // the whole frame goes out in one mode 0 transfer with no slave pin
+    if (spi_start(NO_PIN, false, 0, APA102_SPI_DIVISOR)) {
+        spi_transmit(apa102_spi_buffer, data - apa102_spi_buffer);
+        spi_stop();
+    }
+}
+
+#else
+
 void static apa102_start_frame(void);
 void static apa102_end_frame(uint16_t num_leds);
 
@@ -71,9 +119,12 @@ void apa102_setleds(LED_TYPE *start_led, uint16_t num_leds) {
     apa102_end_frame(num_leds);
 }
 
+#endif
+
 // Overwrite the default rgblight_call_driver to use apa102 driver
 void rgblight_call_driver(LED_TYPE *start_led, uint8_t num_leds) { apa102_setleds(start_led, num_leds); }
 
+#ifndef APA102_SPI
 void static apa102_init(void) {
     setPinOutput(RGB_DI_PIN);
     setPinOutput(RGB_CI_PIN);
@@ -81,6 +132,7 @@ void static apa102_init(void) {
     writePinLow(RGB_DI_PIN);
     writePinLow(RGB_CI_PIN);
 }
+#endif
 
 void apa102_set_brightness(uint8_t brightness) {
     if (brightness > APA102_MAX_BRIGHTNESS) {
@@ -92,6 +144,7 @@ void apa102_set_brightness(uint8_t brightness) {
     }
 }
 
+#ifndef APA102_SPI
 void static apa102_send_frame(uint8_t red, uint8_t green, uint8_t blue, uint8_t brightness) {
     apa102_send_byte(0b11100000 | brightness);
     apa102_send_byte(blue);
@@ -149,3 +202,4 @@ void static apa102_send_byte(uint8_t byte) {
     APA102_SEND_BIT(byte, 1);
     APA102_SEND_BIT(byte, 0);
 }
+#endif
@@ -14,6 +14,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "aw20216.h"
 #include "spi_master.h"
 
@@ -91,10 +93,12 @@ static inline bool AW20216_write_register(pin_t cs_pin, uint8_t page, uint8_t re
 }
 
 static void AW20216_init_scaling(pin_t cs_pin) {
-    // Set constant current to the max, control brightness with PWM
-    for (uint8_t i = 0; i < AW_PWM_REGISTER_COUNT; i++) {
-        AW20216_write_register(cs_pin, AW_PAGE_SCALING, i, AW_SCALING_MAX);
-    }
+    // Set constant current to the max, control brightness with PWM. The
+    // register address auto-increments, so the whole page goes out in one
+    // transaction instead of one per register.
+    uint8_t scaling[AW_PWM_REGISTER_COUNT];
+    memset(scaling, AW_SCALING_MAX, AW_PWM_REGISTER_COUNT);
+    AW20216_write(cs_pin, AW_PAGE_SCALING, 0, scaling, AW_PWM_REGISTER_COUNT);
 }
 
 static inline void AW20216_init_current_limit(pin_t cs_pin) {
@@ -220,18 +220,116 @@ void IS31FL3731_set_led_control_register(uint8_t index, bool red, bool green, bo
     g_led_control_registers_update_required[led.driver] = true;
 }
 
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+#    ifndef ISSI_FLUSH_SEGMENTS_PER_CALL
+#        define ISSI_FLUSH_SEGMENTS_PER_CALL 3
+#    endif
+
+// Next 16-byte PWM segment to transmit, per driver
+static uint8_t g_pwm_flush_segment[DRIVER_COUNT] = {0};
+
+bool IS31FL3731_flush_pending(void) {
+    for (uint8_t i = 0; i < DRIVER_COUNT; i++) {
+        if (g_pwm_buffer_update_required[i]) return true;
+    }
+    return false;
+}
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
+
 void IS31FL3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+    // Send a few 16-byte segments per call and pick up where we left off on
+    // the next one, spreading a frame's flush over several task passes
+    // instead of stalling the scan loop with one long burst of I2C traffic
+    if (!g_pwm_buffer_update_required[index]) return;
+    for (uint8_t segment = 0; segment < ISSI_FLUSH_SEGMENTS_PER_CALL; segment++) {
+        uint8_t offset           = g_pwm_flush_segment[index] * 16;
+        g_twi_transfer_buffer[0] = 0x24 + offset;
+        for (uint8_t j = 0; j < 16; j++) {
+            g_twi_transfer_buffer[1 + j] = g_pwm_buffer[index][offset + j];
+        }
+
+#    if ISSI_PERSISTENCE > 0
+        for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) == 0) break;
+        }
+#    else
+        i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT);
+#    endif
+
+        if (++g_pwm_flush_segment[index] >= 144 / 16) {
+            g_pwm_flush_segment[index]          = 0;
+            g_pwm_buffer_update_required[index] = false;
+            break;
+        }
+    }
+#else
     if (g_pwm_buffer_update_required[index]) {
         IS31FL3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
     }
     g_pwm_buffer_update_required[index] = false;
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
 }
 
+#ifdef ISSI_CONTROL_DIRTY_BYTES
+// Image of the control registers as last written to each controller, so a
+// flush only retransmits the bytes that actually changed. The first flush
+// after power-on always writes the full bank.
+static uint8_t g_led_control_registers_written[DRIVER_COUNT][18];
+static bool    g_led_control_registers_synced[DRIVER_COUNT] = {false};
+#endif
+
 void IS31FL3731_update_led_control_registers(uint8_t addr, uint8_t index) {
     if (g_led_control_registers_update_required[index]) {
+#ifdef ISSI_CONTROL_DIRTY_BYTES
+        if (g_led_control_registers_synced[index]) {
+            // Transmit only the changed bytes, coalesced into
+            // auto-incrementing address-window transfers. A single unchanged
+            // byte between two changed ones is cheaper to resend than the
+            // framing of a second transaction, so it is bridged.
+            uint8_t i = 0;
+            while (i < 18) {
+                if (g_led_control_registers[index][i] == g_led_control_registers_written[index][i]) {
+                    i++;
+                    continue;
+                }
+                uint8_t run = 1;
+                while (i + run < 18) {
+                    if (g_led_control_registers[index][i + run] != g_led_control_registers_written[index][i + run]) {
+                        run++;
+                    } else if (i + run + 1 < 18 && g_led_control_registers[index][i + run + 1] != g_led_control_registers_written[index][i + run + 1]) {
+                        run += 2;
+                    } else {
+                        break;
+                    }
+                }
+                g_twi_transfer_buffer[0] = i;
+                for (uint8_t j = 0; j < run; j++) {
+                    g_twi_transfer_buffer[1 + j] = g_led_control_registers[index][i + j];
+                }
+#    if ISSI_PERSISTENCE > 0
+                for (uint8_t p = 0; p < ISSI_PERSISTENCE; p++) {
+                    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, run + 1, ISSI_TIMEOUT) == 0) break;
+                }
+#    else
+                i2c_transmit(addr << 1, g_twi_transfer_buffer, run + 1, ISSI_TIMEOUT);
+#    endif
+                i += run;
+            }
+        } else {
+            for (int i = 0; i < 18; i++) {
+                IS31FL3731_write_register(addr, i, g_led_control_registers[index][i]);
+            }
+            g_led_control_registers_synced[index] = true;
+        }
+        for (uint8_t i = 0; i < 18; i++) {
+            g_led_control_registers_written[index][i] = g_led_control_registers[index][i];
+        }
+#else
         for (int i = 0; i < 18; i++) {
             IS31FL3731_write_register(addr, i, g_led_control_registers[index][i]);
         }
+#endif  // ISSI_CONTROL_DIRTY_BYTES
     }
     g_led_control_registers_update_required[index] = false;
 }
@@ -44,6 +44,10 @@ void IS31FL3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void IS31FL3731_update_pwm_buffers(uint8_t addr, uint8_t index);
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+// true while some driver still has unsent PWM segments
+bool IS31FL3731_flush_pending(void);
+#endif
 void IS31FL3731_update_led_control_registers(uint8_t addr, uint8_t index);
 
 #define C1_1 0x24
@@ -71,6 +71,12 @@ bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
+#ifdef ISSI_FLUSH_DIRTY_PAGES
+// Bitmask of dirty 16-byte PWM pages per driver; bit n covers PWM registers
+// [16n, 16n+15]. Only dirty pages are transmitted on a flush.
+static uint16_t g_pwm_dirty_pages[DRIVER_COUNT] = {0};
+#endif
+
 bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     // If the transaction fails function returns false.
     g_twi_transfer_buffer[0] = reg;
@@ -121,6 +127,49 @@ bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     return true;
 }
 
+#ifdef ISSI_FLUSH_DIRTY_PAGES
+bool IS31FL3733_write_pwm_pages(uint8_t addr, uint8_t *pwm_buffer, uint16_t dirty_pages) {
+    // Like IS31FL3733_write_pwm_buffer, but only transmits the 16-byte pages
+    // that changed since the last flush. Assumes PG1 is already selected.
+    for (int i = 0; i < 192; i += 16) {
+        if (!(dirty_pages & (1 << (i / 16)))) {
+            continue;
+        }
+        g_twi_transfer_buffer[0] = i;
+        for (int j = 0; j < 16; j++) {
+            g_twi_transfer_buffer[1 + j] = pwm_buffer[i + j];
+        }
+
+#    if ISSI_PERSISTENCE > 0
+        for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) != 0) {
+                return false;
+            }
+        }
+#    else
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) != 0) {
+            return false;
+        }
+#    endif
+    }
+    return true;
+}
+#endif  // ISSI_FLUSH_DIRTY_PAGES
+
+#ifdef RGB_MATRIX_FAST_SUSPEND
+void IS31FL3733_set_global_current(uint8_t addr, uint8_t value) {
+    // One register write blanks (0x00) or restores (0xFF) the whole
+    // controller without touching the PWM state it is holding.
+
+    // Unlock the command register.
+    IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+
+    // Select PG3
+    IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_FUNCTION);
+    IS31FL3733_write_register(addr, ISSI_REG_GLOBALCURRENT, value);
+}
+#endif  // RGB_MATRIX_FAST_SUSPEND
+
 void IS31FL3733_init(uint8_t addr, uint8_t sync) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
@@ -171,6 +220,9 @@ void IS31FL3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         g_pwm_buffer[led.driver][led.g]          = green;
         g_pwm_buffer[led.driver][led.b]          = blue;
         g_pwm_buffer_update_required[led.driver] = true;
+#ifdef ISSI_FLUSH_DIRTY_PAGES
+        g_pwm_dirty_pages[led.driver] |= (1 << (led.r / 16)) | (1 << (led.g / 16)) | (1 << (led.b / 16));
+#endif
     }
 }
 
@@ -209,7 +261,94 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool red, bool green, bo
     g_led_control_registers_update_required[led.driver] = true;
 }
 
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+#    ifndef ISSI_FLUSH_SEGMENTS_PER_CALL
+#        define ISSI_FLUSH_SEGMENTS_PER_CALL 3
+#    endif
+
+// Next 16-byte PWM segment to transmit, per driver
+static uint8_t g_pwm_flush_segment[DRIVER_COUNT] = {0};
+
+bool IS31FL3733_flush_pending(void) {
+    for (uint8_t i = 0; i < DRIVER_COUNT; i++) {
+        if (g_pwm_buffer_update_required[i]) return true;
+    }
+    return false;
+}
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
+
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+    // Send a few 16-byte segments per call and pick up where we left off on
+    // the next one, spreading a frame's flush over several task passes
+    // instead of stalling the scan loop with one long burst of I2C traffic
+    if (!g_pwm_buffer_update_required[index]) return;
+
+#    ifdef I2C_MASTER_ASYNC
+    // The previous segment may still be clocking out under interrupt control
+    if (i2c_transmit_async_pending()) return;
+    if (i2c_transmit_async_result() != I2C_STATUS_SUCCESS) {
+        g_led_control_registers_update_required[index] = true;
+    }
+#    endif
+
+    // Unlock the command register and select PG1; other register accesses may
+    // have changed the page in between calls.
+    IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+    IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM);
+
+    for (uint8_t segment = 0; segment < ISSI_FLUSH_SEGMENTS_PER_CALL; segment++) {
+#    ifdef ISSI_FLUSH_DIRTY_PAGES
+        // Skip over pages that didn't change since the last flush
+        while (g_pwm_flush_segment[index] < 192 / 16 && !(g_pwm_dirty_pages[index] & (1 << g_pwm_flush_segment[index]))) {
+            g_pwm_flush_segment[index]++;
+        }
+        if (g_pwm_flush_segment[index] >= 192 / 16) {
+            g_pwm_flush_segment[index]          = 0;
+            g_pwm_dirty_pages[index]            = 0;
+            g_pwm_buffer_update_required[index] = false;
+            break;
+        }
+#    endif
+        uint8_t offset           = g_pwm_flush_segment[index] * 16;
+        g_twi_transfer_buffer[0] = offset;
+        for (uint8_t j = 0; j < 16; j++) {
+            g_twi_transfer_buffer[1 + j] = g_pwm_buffer[index][offset + j];
+        }
+
+        // If any of the transactions fail we risk writing dirty PG0,
+        // refresh page 0 just in case.
+#    ifdef I2C_MASTER_ASYNC
+        // Safe to hand the shared transfer buffer to the interrupt engine:
+        // nothing touches it again until the pending check above passes
+        if (i2c_transmit_async(addr << 1, g_twi_transfer_buffer, 17) != I2C_STATUS_SUCCESS) {
+            g_led_control_registers_update_required[index] = true;
+        }
+#    elif ISSI_PERSISTENCE > 0
+        for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) != 0) {
+                g_led_control_registers_update_required[index] = true;
+            }
+        }
+#    else
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) != 0) {
+            g_led_control_registers_update_required[index] = true;
+        }
+#    endif
+
+        if (++g_pwm_flush_segment[index] >= 192 / 16) {
+            g_pwm_flush_segment[index]          = 0;
+#    ifdef ISSI_FLUSH_DIRTY_PAGES
+            g_pwm_dirty_pages[index]            = 0;
+#    endif
+            g_pwm_buffer_update_required[index] = false;
+            break;
+        }
+#    ifdef I2C_MASTER_ASYNC
+        break;  // one segment per call; the wire is busy until it completes
+#    endif
+    }
+#else
     if (g_pwm_buffer_update_required[index]) {
         // Firstly we need to unlock the command register and select PG1.
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
@@ -217,21 +356,94 @@ void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
 
         // If any of the transactions fail we risk writing dirty PG0,
         // refresh page 0 just in case.
+#    ifdef ISSI_FLUSH_DIRTY_PAGES
+        if (!IS31FL3733_write_pwm_pages(addr, g_pwm_buffer[index], g_pwm_dirty_pages[index])) {
+            g_led_control_registers_update_required[index] = true;
+        }
+        g_pwm_dirty_pages[index] = 0;
+#    else
         if (!IS31FL3733_write_pwm_buffer(addr, g_pwm_buffer[index])) {
             g_led_control_registers_update_required[index] = true;
         }
+#    endif
     }
     g_pwm_buffer_update_required[index] = false;
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
 }
 
+#ifdef ISSI_CONTROL_DIRTY_BYTES
+// Image of the control registers as last written to each controller, so a
+// flush only retransmits the bytes that actually changed. The first flush
+// after power-on always writes the full bank.
+static uint8_t g_led_control_registers_written[DRIVER_COUNT][24];
+static bool    g_led_control_registers_synced[DRIVER_COUNT] = {false};
+#endif
+
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index) {
     if (g_led_control_registers_update_required[index]) {
         // Firstly we need to unlock the command register and select PG0
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_LEDCONTROL);
+#ifdef ISSI_CONTROL_DIRTY_BYTES
+        bool ok = true;
+        if (g_led_control_registers_synced[index]) {
+            // Transmit only the changed bytes, coalesced into
+            // auto-incrementing address-window transfers. A single unchanged
+            // byte between two changed ones is cheaper to resend than the
+            // framing of a second transaction, so it is bridged.
+            uint8_t i = 0;
+            while (i < 24) {
+                if (g_led_control_registers[index][i] == g_led_control_registers_written[index][i]) {
+                    i++;
+                    continue;
+                }
+                uint8_t run = 1;
+                while (i + run < 24 && run < 18) {
+                    if (g_led_control_registers[index][i + run] != g_led_control_registers_written[index][i + run]) {
+                        run++;
+                    } else if (i + run + 1 < 24 && g_led_control_registers[index][i + run + 1] != g_led_control_registers_written[index][i + run + 1]) {
+                        run += 2;
+                    } else {
+                        break;
+                    }
+                }
+                g_twi_transfer_buffer[0] = i;
+                for (uint8_t j = 0; j < run; j++) {
+                    g_twi_transfer_buffer[1 + j] = g_led_control_registers[index][i + j];
+                }
+                bool sent = true;
+#    if ISSI_PERSISTENCE > 0
+                for (uint8_t p = 0; p < ISSI_PERSISTENCE; p++) {
+                    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, run + 1, ISSI_TIMEOUT) != 0) {
+                        sent = false;
+                        break;
+                    }
+                }
+#    else
+                sent = i2c_transmit(addr << 1, g_twi_transfer_buffer, run + 1, ISSI_TIMEOUT) == 0;
+#    endif
+                ok = ok && sent;
+                i += run;
+            }
+        } else {
+            for (int i = 0; i < 24; i++) {
+                ok = IS31FL3733_write_register(addr, i, g_led_control_registers[index][i]) && ok;
+            }
+        }
+        if (ok) {
+            for (uint8_t i = 0; i < 24; i++) {
+                g_led_control_registers_written[index][i] = g_led_control_registers[index][i];
+            }
+            g_led_control_registers_synced[index] = true;
+        } else {
+            // The controller's state is unknown; rewrite everything next time
+            g_led_control_registers_synced[index] = false;
+        }
+#else
         for (int i = 0; i < 24; i++) {
             IS31FL3733_write_register(addr, i, g_led_control_registers[index][i]);
         }
+#endif  // ISSI_CONTROL_DIRTY_BYTES
     }
     g_led_control_registers_update_required[index] = false;
 }
@@ -34,6 +34,9 @@ extern const is31_led __flash g_is31_leds[DRIVER_LED_TOTAL];
 void IS31FL3733_init(uint8_t addr, uint8_t sync);
 bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data);
 bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer);
+#ifdef ISSI_FLUSH_DIRTY_PAGES
+bool IS31FL3733_write_pwm_pages(uint8_t addr, uint8_t *pwm_buffer, uint16_t dirty_pages);
+#endif
 
 void IS31FL3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void IS31FL3733_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
@@ -45,6 +48,15 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index);
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+// true while some driver still has unsent PWM segments
+bool IS31FL3733_flush_pending(void);
+#endif
+#ifdef RGB_MATRIX_FAST_SUSPEND
+// single-register blanking: 0x00 turns every LED off, 0xFF restores them,
+// without disturbing the PWM registers
+void IS31FL3733_set_global_current(uint8_t addr, uint8_t value);
+#endif
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index);
 
 #define A_1 0x00
@@ -225,6 +225,16 @@ void oled_write(const char *data, bool invert);
 // Advances the cursor to the next page, wiring ' ' to the remainder of the current page
 void oled_write_ln(const char *data, bool invert);
 
+// Writes a single character to the buffer at current cursor position,
+// integer-scaled to `scale` times the font size (2 or 3)
+// Advances the cursor while writing, inverts the pixels if true
+void oled_write_char_scaled(const char data, uint8_t scale, bool invert);
+
+// Writes a string to the buffer at current cursor position,
+// integer-scaled to `scale` times the font size (2 or 3)
+// Advances the cursor while writing, inverts the pixels if true
+void oled_write_scaled(const char *data, uint8_t scale, bool invert);
+
 // Pans the buffer to the right (or left by passing true) by moving contents of the buffer
 // Useful for moving the screen in preparation for new drawing
 void oled_pan(bool left);
@@ -243,6 +253,16 @@ void oled_write_raw_byte(const char data, uint16_t index);
 // Coordinates start at top-left and go right and down for positive x and y
 void oled_write_pixel(uint8_t x, uint8_t y, bool on);
 
+#ifdef SPLIT_OLED_MIRROR
+// Bitmap of buffer blocks changed since they were last mirrored to the
+// other half of a split; consumed by split_common/transactions.c
+extern OLED_BLOCK_TYPE oled_mirror_dirty;
+
+// Applies a mirrored block received from the master: length 0 means a raw
+// OLED_BLOCK_SIZE payload, otherwise length bytes of (run, value) RLE pairs
+void oled_mirror_write_block(uint8_t block, const uint8_t *data, uint8_t length);
+#endif
+
 #if defined(__AVR__)
 // Writes a PROGMEM string to the buffer at current cursor position
 // Advances the cursor while writing, inverts the pixels if true
@@ -257,10 +277,16 @@ void oled_write_ln_P(const char *data, bool invert);
 
 // Writes a PROGMEM string to the buffer at current cursor position
 void oled_write_raw_P(const char *data, uint16_t size);
+
+// Writes a PROGMEM string to the buffer at current cursor position,
+// integer-scaled to `scale` times the font size (2 or 3)
+// Remapped to call 'void oled_write_scaled(const char *data, uint8_t scale, bool invert);' on ARM
+void oled_write_scaled_P(const char *data, uint8_t scale, bool invert);
 #else
 #    define oled_write_P(data, invert) oled_write(data, invert)
 #    define oled_write_ln_P(data, invert) oled_write(data, invert)
 #    define oled_write_raw_P(data, size) oled_write_raw(data, size)
+#    define oled_write_scaled_P(data, scale, invert) oled_write_scaled(data, scale, invert)
 #endif  // defined(__AVR__)
 
 // Can be used to manually turn on the screen if it is off
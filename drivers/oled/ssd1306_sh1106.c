@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "progmem.h"
 
 #include "keyboard.h"
+#include "suspend.h"
 
 // Used commands from spec sheet: https://cdn-shop.adafruit.com/datasheets/SSD1306.pdf
 // for SH1106: https://www.velleman.eu/downloads/29/infosheets/sh1106_datasheet.pdf
@@ -109,7 +110,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // this is so we don't end up with rounding errors with
 // parts of the display unusable or don't get cleared correctly
 // and also allows for drawing & inverting
-uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+uint8_t SUSPEND_EXPENDABLE_BSS oled_buffer[OLED_MATRIX_SIZE];
 uint8_t *       oled_cursor;
 OLED_BLOCK_TYPE oled_dirty          = 0;
 bool            oled_initialized    = false;
@@ -131,6 +132,83 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#if OLED_FRAME_INTERVAL > 0
+uint16_t oled_frame_timeout;
+#endif
+
+#ifdef I2C_MASTER_ASYNC
+// Staging buffer handed to the interrupt-driven i2c engine: the I2C_DATA
+// control byte followed by one render chunk. Must not be touched again until
+// the transfer completes.
+#    ifdef OLED_DIRTY_SPANS
+static uint8_t oled_async_buffer[1 + (OLED_DISPLAY_WIDTH > OLED_BLOCK_SIZE ? OLED_DISPLAY_WIDTH : OLED_BLOCK_SIZE)];
+#    else
+static uint8_t oled_async_buffer[1 + OLED_BLOCK_SIZE];
+#    endif
+static uint16_t oled_async_index;   // first buffer index of the chunk in flight
+static uint16_t oled_async_length;  // size of the chunk in flight
+static bool     oled_async_inflight = false;
+#endif
+
+#ifdef OLED_DIRTY_SPANS
+// Fine-grained dirty tracking: one bit per 8-byte slice of the buffer, so a
+// render pass transmits only the columns that actually changed. Adjacent
+// dirty slices on the same page are coalesced into a single transaction.
+#    define OLED_SLICE_SIZE 8
+#    define OLED_SLICE_COUNT (OLED_MATRIX_SIZE / OLED_SLICE_SIZE)
+static uint8_t oled_dirty_spans[(OLED_SLICE_COUNT + 7) / 8];
+#endif
+
+#ifdef SPLIT_OLED_MIRROR
+// Blocks changed since the split mirror sync last shipped them to the other
+// half. Kept separate from the render dirty state, which is cleared as the
+// blocks are flushed to the local panel.
+OLED_BLOCK_TYPE oled_mirror_dirty = 0;
+#endif
+
+// Mark the buffer range [start_index, end_index] as needing a redraw
+static void oled_dirty_mark(uint16_t start_index, uint16_t end_index) {
+#ifdef SPLIT_OLED_MIRROR
+    oled_mirror_dirty |= ((OLED_BLOCK_TYPE)1 << (start_index / OLED_BLOCK_SIZE));
+    oled_mirror_dirty |= ((OLED_BLOCK_TYPE)1 << (end_index / OLED_BLOCK_SIZE));
+#endif
+#ifdef OLED_DIRTY_SPANS
+    for (uint16_t slice = start_index / OLED_SLICE_SIZE; slice <= end_index / OLED_SLICE_SIZE; slice++) {
+        oled_dirty_spans[slice >> 3] |= (1 << (slice & 7));
+    }
+#else
+    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (start_index / OLED_BLOCK_SIZE));
+    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (end_index / OLED_BLOCK_SIZE));
+#endif
+}
+
+static void oled_dirty_mark_all(void) {
+#ifdef SPLIT_OLED_MIRROR
+    oled_mirror_dirty = OLED_ALL_BLOCKS_MASK;
+#endif
+#ifdef OLED_DIRTY_SPANS
+    memset(oled_dirty_spans, 0xFF, sizeof(oled_dirty_spans));
+#    if (OLED_SLICE_COUNT % 8)
+    // keep bits past the last slice clear so the render scan always terminates
+    oled_dirty_spans[sizeof(oled_dirty_spans) - 1] = (1 << (OLED_SLICE_COUNT % 8)) - 1;
+#    endif
+#else
+    oled_dirty = OLED_ALL_BLOCKS_MASK;
+#endif
+}
+
+static bool oled_dirty_any(void) {
+#ifdef OLED_DIRTY_SPANS
+    for (uint8_t i = 0; i < sizeof(oled_dirty_spans); i++) {
+        if (oled_dirty_spans[i]) {
+            return true;
+        }
+    }
+    return false;
+#else
+    return oled_dirty != 0;
+#endif
+}
 
 // Internal variables to reduce math instructions
 
@@ -237,9 +315,10 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
     oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+    oled_dirty_mark_all();
 }
 
+#ifndef OLED_DIRTY_SPANS
 static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
     uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
@@ -261,6 +340,28 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1;
 #endif
 }
+#endif
+
+#ifdef OLED_DIRTY_SPANS
+static void calc_bounds_span(uint16_t start_slice, uint16_t end_slice, uint8_t *cmd_array) {
+    // Address window for a coalesced run of dirty slices within one page
+    uint8_t start_page   = start_slice * OLED_SLICE_SIZE / OLED_DISPLAY_WIDTH;
+    uint8_t start_column = start_slice * OLED_SLICE_SIZE % OLED_DISPLAY_WIDTH;
+#    if (OLED_IC == OLED_IC_SH1106)
+    cmd_array[0] = PAM_PAGE_ADDR | start_page;
+    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
+    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+    cmd_array[3] = NOP;
+    cmd_array[4] = NOP;
+    cmd_array[5] = NOP;
+#    else
+    cmd_array[1] = start_column;
+    cmd_array[2] = start_column + (end_slice - start_slice + 1) * OLED_SLICE_SIZE - 1;
+    cmd_array[4] = start_page;
+    cmd_array[5] = start_page;
+#    endif
+}
+#endif
 
 static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[1] = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
@@ -290,7 +391,56 @@ void oled_render(void) {
         return;
     }
 
+#ifdef I2C_MASTER_ASYNC
+    // Is the previous chunk still on the wire?
+    if (oled_async_inflight) {
+        if (i2c_transmit_async_pending()) {
+            return;
+        }
+        oled_async_inflight = false;
+        if (i2c_transmit_async_result() != I2C_STATUS_SUCCESS) {
+            // Transfer failed; queue the chunk for another attempt
+            oled_dirty_mark(oled_async_index, oled_async_index + oled_async_length - 1);
+        }
+    }
+#endif
+
+#if OLED_FRAME_INTERVAL > 0
+    // Pace chunk transfers so render traffic never monopolizes the bus
+    if (timer_elapsed(oled_frame_timeout) < OLED_FRAME_INTERVAL) {
+        return;
+    }
+#endif
+
     // Do we have work to do?
+#ifdef OLED_DIRTY_SPANS
+    if (!oled_dirty_any() || oled_scrolling) {
+        return;
+    }
+
+    // Find first dirty slice
+    uint16_t update_start = 0;
+    while (!(oled_dirty_spans[update_start >> 3] & (1 << (update_start & 7)))) {
+        ++update_start;
+    }
+
+    // Span end, inclusive. The 90 rotation render works on whole blocks (the
+    // rotation maps are block-shaped), so there the span becomes the block
+    // containing the first dirty slice.
+    uint16_t update_end;
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // Coalesce adjacent dirty slices, stopping at the page boundary so
+        // the address window stays a single rectangle
+        uint16_t page_last_slice = (update_start * OLED_SLICE_SIZE / OLED_DISPLAY_WIDTH + 1) * (OLED_DISPLAY_WIDTH / OLED_SLICE_SIZE) - 1;
+        update_end               = update_start;
+        while (update_end < page_last_slice && (oled_dirty_spans[(update_end + 1) >> 3] & (1 << ((update_end + 1) & 7)))) {
+            ++update_end;
+        }
+    } else {
+        update_start = update_start / (OLED_BLOCK_SIZE / OLED_SLICE_SIZE) * (OLED_BLOCK_SIZE / OLED_SLICE_SIZE);
+        update_end   = update_start + (OLED_BLOCK_SIZE / OLED_SLICE_SIZE) - 1;
+    }
+#else
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
     if (!oled_dirty || oled_scrolling) {
         return;
@@ -301,13 +451,22 @@ void oled_render(void) {
     while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
         ++update_start;
     }
+#endif
 
     // Set column & page position
     static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
     if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#ifdef OLED_DIRTY_SPANS
+        calc_bounds_span(update_start, update_end, &display_start[1]);  // Offset from I2C_CMD byte at the start
+#else
         calc_bounds(update_start, &display_start[1]);  // Offset from I2C_CMD byte at the start
+#endif
     } else {
+#ifdef OLED_DIRTY_SPANS
+        calc_bounds_90(update_start / (OLED_BLOCK_SIZE / OLED_SLICE_SIZE), &display_start[1]);
+#else
         calc_bounds_90(update_start, &display_start[1]);  // Offset from I2C_CMD byte at the start
+#endif
     }
 
     // Send column & page position
@@ -317,11 +476,33 @@ void oled_render(void) {
     }
 
     if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#ifdef OLED_DIRTY_SPANS
+        const uint8_t *chunk        = &oled_buffer[update_start * OLED_SLICE_SIZE];
+        uint16_t       chunk_length = (update_end - update_start + 1) * OLED_SLICE_SIZE;
+#else
+        const uint8_t *chunk        = &oled_buffer[OLED_BLOCK_SIZE * update_start];
+        uint16_t       chunk_length = OLED_BLOCK_SIZE;
+#endif
         // Send render data chunk as is
-        if (I2C_WRITE_REG(I2C_DATA, &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
+#ifdef I2C_MASTER_ASYNC
+        // Panel-on command has to go out before the wire is handed to the
+        // interrupt engine
+        oled_on();
+        oled_async_index     = chunk - &oled_buffer[0];
+        oled_async_length    = chunk_length;
+        oled_async_buffer[0] = I2C_DATA;
+        memcpy(&oled_async_buffer[1], chunk, chunk_length);
+        if (i2c_transmit_async((OLED_DISPLAY_ADDRESS << 1), oled_async_buffer, chunk_length + 1) != I2C_STATUS_SUCCESS) {
             print("oled_render data failed\n");
             return;
         }
+        oled_async_inflight = true;
+#else
+        if (I2C_WRITE_REG(I2C_DATA, chunk, chunk_length) != I2C_STATUS_SUCCESS) {
+            print("oled_render data failed\n");
+            return;
+        }
+#endif
     } else {
         // Rotate the render chunks
         const static uint8_t source_map[] = OLED_SOURCE_MAP;
@@ -330,21 +511,54 @@ void oled_render(void) {
         static uint8_t temp_buffer[OLED_BLOCK_SIZE];
         memset(temp_buffer, 0, sizeof(temp_buffer));
         for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+#ifdef OLED_DIRTY_SPANS
+            rotate_90(&oled_buffer[update_start * OLED_SLICE_SIZE + source_map[i]], &temp_buffer[target_map[i]]);
+#else
             rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+#endif
         }
 
         // Send render data chunk after rotating
+#ifdef I2C_MASTER_ASYNC
+        oled_on();
+#    ifdef OLED_DIRTY_SPANS
+        oled_async_index = update_start * OLED_SLICE_SIZE;
+#    else
+        oled_async_index = OLED_BLOCK_SIZE * update_start;
+#    endif
+        oled_async_length    = OLED_BLOCK_SIZE;
+        oled_async_buffer[0] = I2C_DATA;
+        memcpy(&oled_async_buffer[1], temp_buffer, OLED_BLOCK_SIZE);
+        if (i2c_transmit_async((OLED_DISPLAY_ADDRESS << 1), oled_async_buffer, OLED_BLOCK_SIZE + 1) != I2C_STATUS_SUCCESS) {
+            print("oled_render90 data failed\n");
+            return;
+        }
+        oled_async_inflight = true;
+#else
         if (I2C_WRITE_REG(I2C_DATA, &temp_buffer[0], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
             print("oled_render90 data failed\n");
             return;
         }
+#endif
     }
 
+#ifndef I2C_MASTER_ASYNC
     // Turn on display if it is off
     oled_on();
+#endif
+
+#if OLED_FRAME_INTERVAL > 0
+    oled_frame_timeout = timer_read();
+#endif
 
     // Clear dirty flag
+#ifdef OLED_DIRTY_SPANS
+    for (uint16_t slice = update_start; slice <= update_end; slice++) {
+        oled_dirty_spans[slice >> 3] &= ~(1 << (slice & 7));
+    }
+#else
     oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
 }
 
 void oled_set_cursor(uint8_t col, uint8_t line) {
@@ -434,9 +648,8 @@ void oled_write_char(const char data, bool invert) {
     // Dirty check
     if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
         uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+        // Mark both ends in case the written data spans 2 chunks
+        oled_dirty_mark(index, index + OLED_FONT_WIDTH - 1);
     }
 
     // Finally move to the next char
@@ -456,6 +669,108 @@ void oled_write_ln(const char *data, bool invert) {
     oled_advance_page(true);
 }
 
+// Bit-stretch table for 2x scaling: each bit of the low nibble doubled into a byte
+static const uint8_t PROGMEM oled_stretch_2x[16] = {0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+
+// Expand the 8 source rows of one glyph column into `scale` output pages
+static void oled_stretch_column(uint8_t src, uint8_t scale, uint8_t *out) {
+    if (scale == 2) {
+        out[0] = pgm_read_byte(&oled_stretch_2x[src & 0x0F]);
+        out[1] = pgm_read_byte(&oled_stretch_2x[src >> 4]);
+        return;
+    }
+    for (uint8_t page = 0; page < scale; page++) {
+        uint8_t stretched = 0;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (src & (1 << ((page * 8 + bit) / scale))) {
+                stretched |= (1 << bit);
+            }
+        }
+        out[page] = stretched;
+    }
+}
+
+void oled_write_char_scaled(const char data, uint8_t scale, bool invert) {
+    if (scale <= 1) {
+        oled_write_char(data, invert);
+        return;
+    }
+    if (scale > 3) {
+        scale = 3;
+    }
+
+    uint16_t index       = oled_cursor - &oled_buffer[0];
+    uint8_t  glyph_width = OLED_FONT_WIDTH * scale;
+
+    // Newlines advance a whole scaled line
+    if (data == '\n' || data == '\r') {
+        index = (index / oled_rotation_width + scale) * oled_rotation_width;
+        if (index >= OLED_MATRIX_SIZE) {
+            index = 0;
+        }
+        oled_cursor = &oled_buffer[index];
+        return;
+    }
+
+    // Wrap to the next scaled line if the glyph does not fit
+    if (index % oled_rotation_width + glyph_width > oled_rotation_width) {
+        index = (index / oled_rotation_width + scale) * oled_rotation_width;
+    }
+
+    // Did we go out of bounds (also catches fewer than `scale` pages remaining)
+    if (index + (scale - 1) * oled_rotation_width + glyph_width > OLED_MATRIX_SIZE) {
+        index = 0;
+    }
+
+    // Fetch the whole glyph in one pass
+    uint8_t glyph[OLED_FONT_WIDTH];
+    uint8_t cast_data = (uint8_t)data;  // font based on unsigned type for index
+    if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
+        memset(glyph, 0x00, sizeof(glyph));
+    } else {
+        memcpy_P(glyph, &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH], OLED_FONT_WIDTH);
+    }
+
+    // Blit: stretch each column vertically, then repeat it horizontally
+    bool changed = false;
+    for (uint8_t col = 0; col < OLED_FONT_WIDTH; col++) {
+        uint8_t stretched[3];
+        oled_stretch_column(glyph[col], scale, stretched);
+        for (uint8_t page = 0; page < scale; page++) {
+            uint8_t  out = invert ? ~stretched[page] : stretched[page];
+            uint16_t dst = index + page * oled_rotation_width + col * scale;
+            for (uint8_t rep = 0; rep < scale; rep++) {
+                if (oled_buffer[dst + rep] != out) {
+                    oled_buffer[dst + rep] = out;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // Dirty check, one mark per covered page
+    if (changed) {
+        for (uint8_t page = 0; page < scale; page++) {
+            oled_dirty_mark(index + page * oled_rotation_width, index + page * oled_rotation_width + glyph_width - 1);
+        }
+    }
+
+    // Finally move to the next char; the cursor stays on the top page of the scaled line
+    uint16_t next_index = index + glyph_width;
+    if (next_index >= OLED_MATRIX_SIZE) {
+        next_index = 0;
+    }
+    oled_cursor = &oled_buffer[next_index];
+}
+
+void oled_write_scaled(const char *data, uint8_t scale, bool invert) {
+    const char *end = data + strlen(data);
+    while (data < end) {
+        oled_write_char_scaled(*data, scale, invert);
+        data++;
+    }
+}
+
 void oled_pan(bool left) {
     uint16_t i = 0;
     for (uint16_t y = 0; y < OLED_DISPLAY_HEIGHT / 8; y++) {
@@ -471,7 +786,7 @@ void oled_pan(bool left) {
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    oled_dirty_mark_all();
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
@@ -486,7 +801,7 @@ void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
     if (oled_buffer[index] == data) return;
     oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    oled_dirty_mark(index, index);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
@@ -496,9 +811,34 @@ void oled_write_raw(const char *data, uint16_t size) {
         uint8_t c = *data++;
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_dirty_mark(i, i);
+    }
+}
+
+#ifdef SPLIT_OLED_MIRROR
+void oled_mirror_write_block(uint8_t block, const uint8_t *data, uint8_t length) {
+    if (block >= OLED_BLOCK_COUNT) {
+        return;
+    }
+    uint16_t start = block * OLED_BLOCK_SIZE;
+    if (length == 0) {
+        // raw, uncompressed block
+        memcpy(&oled_buffer[start], data, OLED_BLOCK_SIZE);
+    } else {
+        // (run, value) RLE pairs; a truncated or corrupt payload can at
+        // worst leave part of the block stale, never write past it
+        uint16_t out = 0;
+        for (uint8_t in = 0; in + 1 < length && out < OLED_BLOCK_SIZE; in += 2) {
+            uint8_t run   = data[in];
+            uint8_t value = data[in + 1];
+            while (run-- && out < OLED_BLOCK_SIZE) {
+                oled_buffer[start + out++] = value;
+            }
+        }
     }
+    oled_dirty_mark(start, start + OLED_BLOCK_SIZE - 1);
 }
+#endif
 
 void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     if (x >= oled_rotation_width) {
@@ -516,7 +856,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
     if (oled_buffer[index] != data) {
         oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_dirty_mark(index, index);
     }
 }
 
@@ -541,7 +881,15 @@ void oled_write_raw_P(const char *data, uint16_t size) {
         uint8_t c = pgm_read_byte(data++);
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_dirty_mark(i, i);
+    }
+}
+
+void oled_write_scaled_P(const char *data, uint8_t scale, bool invert) {
+    uint8_t c = pgm_read_byte(data);
+    while (c != 0) {
+        oled_write_char_scaled(c, scale, invert);
+        c = pgm_read_byte(++data);
     }
 }
 #endif  // defined(__AVR__)
@@ -646,7 +994,7 @@ bool oled_scroll_right(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty_any() && !oled_scrolling) {
         uint8_t display_scroll_right[] = {I2C_CMD, SCROLL_RIGHT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (I2C_TRANSMIT(display_scroll_right) != I2C_STATUS_SUCCESS) {
             print("oled_scroll_right cmd failed\n");
@@ -664,7 +1012,7 @@ bool oled_scroll_left(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty_any() && !oled_scrolling) {
         uint8_t display_scroll_left[] = {I2C_CMD, SCROLL_LEFT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (I2C_TRANSMIT(display_scroll_left) != I2C_STATUS_SUCCESS) {
             print("oled_scroll_left cmd failed\n");
@@ -687,7 +1035,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_dirty_mark_all();
     }
     return !oled_scrolling;
 }
@@ -749,7 +1097,7 @@ void oled_task(void) {
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
-    if (oled_dirty && oled_scrolling) {
+    if (oled_dirty_any() && oled_scrolling) {
         oled_scroll_timeout = timer_read32() + OLED_SCROLL_TIMEOUT;
         oled_scroll_off();
     }
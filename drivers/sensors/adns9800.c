@@ -104,24 +104,10 @@ uint8_t adns_read(uint8_t reg_addr){
     return data;
 }
 
-void adns_init() {
-
-    setPinOutput(SPI_SS_PIN);
-
-    spi_init();
-
-    // reboot
-    adns_write(REG_Power_Up_Reset, 0x5a);
-    wait_ms(50);
-
-    // read registers and discard
-    adns_read(REG_Motion);
-    adns_read(REG_Delta_X_L);
-    adns_read(REG_Delta_X_H);
-    adns_read(REG_Delta_Y_L);
-    adns_read(REG_Delta_Y_H);
+// set once the SROM has been uploaded and the laser enabled
+static bool srom_loaded = false;
 
-    // upload firmware
+static void adns_upload_firmware(void) {
 
     // 3k firmware mode
     adns_write(REG_Configuration_IV, 0x02);
@@ -142,12 +128,18 @@ void adns_init() {
     spi_write(REG_SROM_Load_Burst | 0x80);
     wait_us(15);
 
-    // send all bytes of the firmware
-    unsigned char c;
-    for(int i = 0; i < FIRMWARE_LENGTH; i++){
-        c = (unsigned char)pgm_read_byte(firmware_data + i);
-        spi_write(c);
-        wait_us(15);
+    // send all bytes of the firmware; pull the PROGMEM data a chunk at a
+    // time so the datasheet's 15us gap between burst bytes is the only
+    // per-byte cost
+    uint8_t chunk[32];
+    for (uint16_t i = 0; i < FIRMWARE_LENGTH; i += sizeof(chunk)) {
+        uint16_t n = FIRMWARE_LENGTH - i;
+        if (n > sizeof(chunk)) n = sizeof(chunk);
+        memcpy_P(chunk, firmware_data + i, n);
+        for (uint16_t j = 0; j < n; j++) {
+            spi_write(chunk[j]);
+            wait_us(15);
+        }
     }
 
     spi_stop();
@@ -157,6 +149,34 @@ void adns_init() {
     // enable laser
     uint8_t laser_ctrl0 = adns_read(REG_LASER_CTRL0);
     adns_write(REG_LASER_CTRL0, laser_ctrl0 & 0xf0);
+
+    srom_loaded = true;
+}
+
+void adns_init() {
+
+    setPinOutput(SPI_SS_PIN);
+
+    spi_init();
+
+    // reboot
+    adns_write(REG_Power_Up_Reset, 0x5a);
+    wait_ms(50);
+
+    // read registers and discard
+    adns_read(REG_Motion);
+    adns_read(REG_Delta_X_L);
+    adns_read(REG_Delta_X_H);
+    adns_read(REG_Delta_Y_L);
+    adns_read(REG_Delta_Y_H);
+
+#ifdef ADNS9800_LAZY_INIT
+    // defer the ~50ms SROM upload out of the boot path; the first
+    // adns_get_report() poll -- after USB is already up -- performs it
+    srom_loaded = false;
+#else
+    adns_upload_firmware();
+#endif
 }
 
 config_adns_t adns_get_config(void) {
@@ -169,6 +189,67 @@ void adns_set_config(config_adns_t config) {
     adns_write(REG_Configuration_I, config_1);
 }
 
+// Profile slots compiled to register-write scripts, applied one register per
+// adns_get_report() poll so a layer-linked profile swap is spread over a few
+// scan passes instead of blocking one of them for the whole sequence
+#define ADNS_PROFILE_SCRIPT_LENGTH 2
+
+typedef struct {
+    uint8_t reg[ADNS_PROFILE_SCRIPT_LENGTH];
+    uint8_t value[ADNS_PROFILE_SCRIPT_LENGTH];
+    bool    compiled;
+} adns_profile_script_t;
+
+#define ADNS_PROFILE_NONE 0xFF
+
+static adns_profile_script_t adns_profile_scripts[ADNS9800_PROFILE_COUNT];
+static uint8_t               adns_profile_active = ADNS_PROFILE_NONE;
+static uint8_t               adns_profile_staged = ADNS_PROFILE_NONE;
+static uint8_t               adns_profile_step   = 0;
+
+bool adns_profile_set(uint8_t slot, adns_profile_t profile) {
+    if (slot >= ADNS9800_PROFILE_COUNT) {
+        return false;
+    }
+    adns_profile_script_t *script = &adns_profile_scripts[slot];
+
+    script->reg[0]   = REG_Configuration_I;
+    script->value[0] = (CLAMP_CPI(profile.cpi) / CPI_STEP) & 0xFF;
+    script->reg[1]   = REG_Lift_Detection_Thr;
+    script->value[1] = profile.lift_threshold;
+    script->compiled = true;
+    return true;
+}
+
+bool adns_profile_select(uint8_t slot) {
+    if (slot >= ADNS9800_PROFILE_COUNT || !adns_profile_scripts[slot].compiled) {
+        return false;
+    }
+    if (slot == adns_profile_active && adns_profile_staged == ADNS_PROFILE_NONE) {
+        return true;  // already applied
+    }
+    // latest selection wins; a half-applied older swap restarts as the new script
+    adns_profile_staged = slot;
+    adns_profile_step   = 0;
+    return true;
+}
+
+uint8_t adns_profile_current(void) { return adns_profile_active; }
+
+bool adns_profile_pending(void) { return adns_profile_staged != ADNS_PROFILE_NONE; }
+
+static void adns_profile_pump(void) {
+    if (adns_profile_staged == ADNS_PROFILE_NONE) {
+        return;
+    }
+    adns_profile_script_t *script = &adns_profile_scripts[adns_profile_staged];
+    adns_write(script->reg[adns_profile_step], script->value[adns_profile_step]);
+    if (++adns_profile_step >= ADNS_PROFILE_SCRIPT_LENGTH) {
+        adns_profile_active = adns_profile_staged;
+        adns_profile_staged = ADNS_PROFILE_NONE;
+    }
+}
+
 static int16_t convertDeltaToInt(uint8_t high, uint8_t low){
 
     // join bytes into twos compliment
@@ -185,6 +266,13 @@ report_adns_t adns_get_report(void) {
 
     report_adns_t report = {0, 0};
 
+    if (!srom_loaded) {
+        adns_upload_firmware();
+    }
+
+    // advance any staged profile swap by one register before this poll's read
+    adns_profile_pump();
+
     adns_spi_start();
 
     // start burst mode
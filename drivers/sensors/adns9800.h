@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef struct {
@@ -28,8 +29,28 @@ typedef struct {
     int16_t y;
 } report_adns_t;
 
+#ifndef ADNS9800_PROFILE_COUNT
+#    define ADNS9800_PROFILE_COUNT 4
+#endif
+
+/* One tuning profile. adns_profile_set() compiles it into a register-write
+ * script; adns_profile_select() arms that script and adns_get_report()
+ * applies one register per poll pass, so a layer-linked DPI swap never
+ * stalls the scan loop behind a run of blocking SPI writes. */
+typedef struct {
+    uint16_t cpi;             /* 200 - 8200, in steps of 200 */
+    uint8_t  lift_threshold;  /* REG_Lift_Detection_Thr encoding (0x10 default) */
+} adns_profile_t;
+
+/* With ADNS9800_LAZY_INIT defined, adns_init() only resets the sensor and
+ * the ~50ms SROM upload is deferred to the first adns_get_report() call,
+ * so boot (and USB enumeration) is not serialized behind it. */
 void adns_init(void);
 config_adns_t adns_get_config(void);
 void adns_set_config(config_adns_t);
 /* Reads and clears the current delta values on the ADNS sensor */
 report_adns_t adns_get_report(void);
+bool adns_profile_set(uint8_t slot, adns_profile_t profile);
+bool adns_profile_select(uint8_t slot);
+uint8_t adns_profile_current(void);
+bool adns_profile_pending(void);
@@ -57,10 +57,15 @@ static int16_t        v_offset    = 0;
 static uint16_t       precision   = 128;
 static uint8_t        error_count = 0;
 
-float trackball_get_precision(void) { return ((float)precision / 128); }
-void  trackball_set_precision(float floatprecision) { precision = (floatprecision * 128); }
-bool  trackball_is_scrolling(void) { return scrolling; }
-void  trackball_set_scrolling(bool scroll) { scrolling = scroll; }
+/* Precision is 1.7 fixed point: 128 = 1.0. The fixed-point accessors avoid
+ * pulling soft-FP into the build on Cortex-M0; the float ones are kept as
+ * thin wrappers for existing keyboard code. */
+uint16_t trackball_get_precision_fixed(void) { return precision; }
+void     trackball_set_precision_fixed(uint16_t fixedprecision) { precision = fixedprecision; }
+float    trackball_get_precision(void) { return ((float)precision / 128); }
+void     trackball_set_precision(float floatprecision) { precision = (floatprecision * 128); }
+bool     trackball_is_scrolling(void) { return scrolling; }
+void     trackball_set_scrolling(bool scroll) { scrolling = scroll; }
 
 void trackball_set_rgbw(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     uint8_t                              data[4] = {r, g, b, w};
@@ -126,7 +131,24 @@ __attribute__((weak)) void pointing_device_task() {
     static uint16_t     debounce = 0;
 
     if (error_count < PIMORONI_TRACKBALL_ERROR_COUNT && timer_elapsed_fast(throttle) >= PIMORONI_TRACKBALL_INTERVAL_MS) {
+#ifdef I2C_MASTER_ASYNC
+        /* The interrupt-driven engine clocks the 5 bytes between task
+         * passes: kick a read off on one pass, consume it on a later one,
+         * instead of blocking here for the whole transfer. */
+        static bool  read_in_flight = false;
+        i2c_status_t status;
+        if (read_in_flight && !i2c_readReg_async_pending()) {
+            status         = i2c_readReg_async_result();
+            read_in_flight = false;
+        } else {
+            if (!read_in_flight && i2c_readReg_async(PIMORONI_TRACKBALL_ADDRESS << 1, TRACKBALL_REG_LEFT, (uint8_t*)&current_pimoroni_data, sizeof(current_pimoroni_data)) == I2C_STATUS_SUCCESS) {
+                read_in_flight = true;
+            }
+            return;
+        }
+#else
         i2c_status_t status = read_pimoroni_trackball(&current_pimoroni_data);
+#endif
 
         if (status == I2C_STATUS_SUCCESS) {
             error_count = 0;
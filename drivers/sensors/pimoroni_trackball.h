@@ -33,5 +33,8 @@ int16_t trackball_get_offsets(uint8_t negative_dir, uint8_t positive_dir, uint8_
 void    trackball_adapt_values(int8_t* mouse, int16_t* offset);
 float   trackball_get_precision(void);
 void    trackball_set_precision(float precision);
+/* 1.7 fixed point, 128 = 1.0; avoids soft-FP entirely */
+uint16_t trackball_get_precision_fixed(void);
+void     trackball_set_precision_fixed(uint16_t precision);
 bool    trackball_is_scrolling(void);
 void    trackball_set_scrolling(bool scroll);
@@ -137,8 +137,77 @@ uint16_t pmw_get_cpi(void) {
     return (uint16_t)(cpival & 0xFF) * 100;
 }
 
+// Profile slots compiled to register-write scripts. A select only flips an
+// index; pmw_profile_pump() retires one script entry per pmw_read_burst()
+// call, so a swap costs each scan pass a single ~140us register write
+// instead of the full sequence at once.
+#define PMW_PROFILE_SCRIPT_LENGTH 3
+
+typedef struct {
+    uint8_t reg[PMW_PROFILE_SCRIPT_LENGTH];
+    uint8_t value[PMW_PROFILE_SCRIPT_LENGTH];
+    bool    compiled;
+} pmw_profile_script_t;
+
+#define PMW_PROFILE_NONE 0xFF
+
+static pmw_profile_script_t pmw_profile_scripts[PMW3360_PROFILE_COUNT];
+static uint8_t              pmw_profile_active  = PMW_PROFILE_NONE;
+static uint8_t              pmw_profile_staged  = PMW_PROFILE_NONE;
+static uint8_t              pmw_profile_step    = 0;
+
+bool pmw_profile_set(uint8_t slot, pmw_profile_t profile) {
+    if (slot >= PMW3360_PROFILE_COUNT) {
+        return false;
+    }
+    pmw_profile_script_t *script = &pmw_profile_scripts[slot];
+
+    script->reg[0]   = REG_Config1;
+    script->value[0] = constrain((profile.cpi / 100) - 1, 0, 0x77);
+    script->reg[1]   = REG_Angle_Tune;
+    script->value[1] = (uint8_t)constrain(profile.angle_tune, -30, 30);
+    script->reg[2]   = REG_Lift_Config;
+    script->value[2] = profile.lift_config;
+    script->compiled = true;
+    return true;
+}
+
+bool pmw_profile_select(uint8_t slot) {
+    if (slot >= PMW3360_PROFILE_COUNT || !pmw_profile_scripts[slot].compiled) {
+        return false;
+    }
+    if (slot == pmw_profile_active && pmw_profile_staged == PMW_PROFILE_NONE) {
+        return true;  // already applied
+    }
+    // latest selection wins: a half-applied older swap is abandoned and the
+    // new script starts from its first register, so whichever profile is in
+    // flight, the sensor always converges on the most recent request
+    pmw_profile_staged = slot;
+    pmw_profile_step   = 0;
+    return true;
+}
+
+uint8_t pmw_profile_current(void) { return pmw_profile_active; }
+
+bool pmw_profile_pending(void) { return pmw_profile_staged != PMW_PROFILE_NONE; }
+
+static void pmw_profile_pump(void) {
+    if (pmw_profile_staged == PMW_PROFILE_NONE) {
+        return;
+    }
+    pmw_profile_script_t *script = &pmw_profile_scripts[pmw_profile_staged];
+    spi_write_adv(script->reg[pmw_profile_step], script->value[pmw_profile_step]);
+    if (++pmw_profile_step >= PMW_PROFILE_SCRIPT_LENGTH) {
+        pmw_profile_active = pmw_profile_staged;
+        pmw_profile_staged = PMW_PROFILE_NONE;
+    }
+}
+
 bool pmw_spi_init(void) {
     setPinOutput(PMW3360_CS_PIN);
+#ifdef PMW3360_MOTION_PIN
+    setPinInputHigh(PMW3360_MOTION_PIN);
+#endif
 
     spi_init();
     _inBurst = false;
@@ -218,7 +287,30 @@ bool pmw_check_signature(void) {
     return (pid == 0x42 && iv_pid == 0xBD && SROM_ver == 0x04);  // signature for SROM 0x04
 }
 
+#ifdef PMW3360_MOTION_PIN
+bool pmw_motion_pending(void) {
+    // MOTION is active-low while the sensor has unread deltas
+    return !readPin(PMW3360_MOTION_PIN);
+}
+#endif
+
 report_pmw_t pmw_read_burst(void) {
+    report_pmw_t data = {0};
+
+    // advance any staged profile swap by one register; runs before the
+    // motion-pin gate so a swap started while the sensor is idle still
+    // completes within a few polls
+    pmw_profile_pump();
+
+#ifdef PMW3360_MOTION_PIN
+    // nothing latched since the last read: skip the SPI transaction
+    // entirely, so an idle sensor costs one pin read per poll
+    if (!pmw_motion_pending()) {
+        data.isOnSurface = true;
+        return data;
+    }
+#endif
+
     if (!_inBurst) {
         dprintf("burst on");
         spi_write_adv(REG_Motion_Burst, 0x00);
@@ -229,22 +321,21 @@ report_pmw_t pmw_read_burst(void) {
     spi_write(REG_Motion_Burst);
     wait_us(35);  // waits for tSRAD
 
-    report_pmw_t data;
-    data.motion = 0;
-    data.dx     = 0;
-    data.mdx    = 0;
-    data.dy     = 0;
-    data.mdx    = 0;
-
-    data.motion = spi_read();
-    spi_write(0x00);  // skip Observation
-    data.dx  = spi_read();
-    data.mdx = spi_read();
-    data.dy  = spi_read();
-    data.mdy = spi_read();
+    // clock Motion..Delta_Y_H out as one block transfer instead of polled
+    // single-byte reads; on ARM spi_receive() runs through the SPI
+    // driver's DMA engine, so the scan loop is not stalled per byte
+    uint8_t burst[6];
+    spi_receive(burst, sizeof(burst));
 
     spi_stop();
 
+    data.motion = burst[0];
+    // burst[1] is Observation, unused
+    data.dx  = burst[2];
+    data.mdx = burst[3];
+    data.dy  = burst[4];
+    data.mdy = burst[5];
+
     if (debug_mouse) {
         print_byte(data.motion);
         print_byte(data.dx);
@@ -261,8 +352,6 @@ report_pmw_t pmw_read_burst(void) {
     data.dy |= (data.mdy << 8);
     data.dy = data.dy * -1;
 
-    spi_stop();
-
     if (data.motion & 0b111) {  // panic recovery, sometimes burst mode works weird.
         _inBurst = false;
     }
@@ -52,6 +52,10 @@
 #    error "No chip select pin defined -- missing PMW3360_CS_PIN"
 #endif
 
+/* Optionally wire the sensor's MOTION output (active-low) to a GPIO and
+ * define PMW3360_MOTION_PIN: pmw_read_burst() then skips the SPI
+ * transaction entirely while no motion is latched. */
+
 #ifdef CONSOLE_ENABLE
 void print_byte(uint8_t byte);
 #endif
@@ -66,6 +70,20 @@ typedef struct {
     int8_t  mdy;
 } report_pmw_t;
 
+#ifndef PMW3360_PROFILE_COUNT
+#    define PMW3360_PROFILE_COUNT 4
+#endif
+
+/* One tuning profile. pmw_profile_set() compiles it into a register-write
+ * script; pmw_profile_select() arms that script and pmw_read_burst() then
+ * applies one register per poll pass, so a layer-linked DPI/liftoff swap
+ * never stalls the scan loop behind a run of blocking SPI writes. */
+typedef struct {
+    uint16_t cpi;          // 100-12000 in increments of 100
+    int8_t   angle_tune;   // rotation trim in degrees, -30 to 30
+    uint8_t  lift_config;  // liftoff distance, REG_Lift_Config encoding (0x02 = 2mm default)
+} pmw_profile_t;
+
 
 
 bool spi_start_adv(void);
@@ -77,7 +95,14 @@ void pmw_set_cpi(uint16_t cpi);
 uint16_t pmw_get_cpi(void);
 void pmw_upload_firmware(void);
 bool pmw_check_signature(void);
+#ifdef PMW3360_MOTION_PIN
+bool pmw_motion_pending(void);
+#endif
 report_pmw_t pmw_read_burst(void);
+bool pmw_profile_set(uint8_t slot, pmw_profile_t profile);
+bool pmw_profile_select(uint8_t slot);
+uint8_t pmw_profile_current(void);
+bool pmw_profile_pending(void);
 
 
 #define degToRad(angleInDegrees) ((angleInDegrees)*M_PI / 180.0)
@@ -25,7 +25,7 @@
 
 #define TAPPING_TOGGLE 3
 
-#define WPM_SMOOTHING 0.1
+#define WPM_SMOOTHING_SHIFT 3
 
 // this is for macOS so keyboard can work after sleep
 #define NO_USB_STARTUP_CHECK
@@ -23,6 +23,7 @@
 #include "i2c_master.h"
 #include "timer.h"
 #include "wait.h"
+#include "perf_counter.h"
 
 #ifndef F_SCL
 #    define F_SCL 400000UL  // SCL frequency
@@ -92,7 +93,20 @@ static i2c_status_t i2c_start_impl(uint8_t address, uint16_t timeout) {
     return I2C_STATUS_SUCCESS;
 }
 
+#ifdef I2C_MASTER_ASYNC
+static volatile bool async_active = false;
+#endif
+
 i2c_status_t i2c_start(uint8_t address, uint16_t timeout) {
+#ifdef I2C_MASTER_ASYNC
+    // Let any in-flight interrupt-driven transfer finish before touching the bus
+    uint16_t async_timer = timer_read();
+    while (async_active) {
+        if ((timeout != I2C_TIMEOUT_INFINITE) && (timer_elapsed(async_timer) >= timeout)) {
+            return I2C_STATUS_TIMEOUT;
+        }
+    }
+#endif
     // Retry i2c_start_impl a bunch times in case the remote side has interrupts disabled.
     uint16_t     timeout_timer = timer_read();
     uint16_t     time_slice    = MAX(1, (timeout == (I2C_TIMEOUT_INFINITE)) ? 5 : (timeout / (I2C_START_RETRY_COUNT)));  // if it's infinite, wait 1ms between attempts, otherwise split up the entire timeout into the number of retries
@@ -154,6 +168,7 @@ int16_t i2c_read_nack(uint16_t timeout) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    PERF_COUNT(PERF_I2C_TRANSFERS);
     i2c_status_t status = i2c_start(address | I2C_WRITE, timeout);
 
     for (uint16_t i = 0; i < length && status >= 0; i++) {
@@ -162,10 +177,14 @@ i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length,
 
     i2c_stop();
 
+    if (status < 0) {
+        PERF_COUNT(PERF_I2C_ERRORS);
+    }
     return status;
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    PERF_COUNT(PERF_I2C_TRANSFERS);
     i2c_status_t status = i2c_start(address | I2C_READ, timeout);
 
     for (uint16_t i = 0; i < (length - 1) && status >= 0; i++) {
@@ -184,6 +203,9 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 
     i2c_stop();
 
+    if (status < 0) {
+        PERF_COUNT(PERF_I2C_ERRORS);
+    }
     return (status < 0) ? status : I2C_STATUS_SUCCESS;
 }
 
@@ -239,3 +261,117 @@ void i2c_stop(void) {
     // transmit STOP condition
     TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
 }
+
+#ifdef I2C_MASTER_ASYNC
+#    include <avr/interrupt.h>
+
+// One in-flight interrupt-driven transfer; the TWI interrupt moves it along
+// one byte at a time so the scan loop never spins on the bus. A register
+// read runs in three phases: address the device for write, clock out the
+// register address, then repeated-START and read the payload.
+enum {
+    ASYNC_PHASE_WRITE,  // plain transmit
+    ASYNC_PHASE_REG,    // readReg: clocking out the register address
+    ASYNC_PHASE_READ,   // readReg: receiving the payload
+};
+static const uint8_t* volatile async_data;
+static uint8_t* volatile     async_rx_data;
+static volatile uint16_t     async_length;
+static volatile uint16_t     async_pos;
+static volatile uint8_t      async_address;
+static volatile uint8_t      async_regaddr;
+static volatile uint8_t      async_phase;
+static volatile i2c_status_t async_result = I2C_STATUS_SUCCESS;
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length) {
+    if (async_active) {
+        return I2C_STATUS_ERROR;
+    }
+    async_address = address | I2C_WRITE;
+    async_data    = data;
+    async_length  = length;
+    async_pos     = 0;
+    async_phase   = ASYNC_PHASE_WRITE;
+    async_active  = true;
+    // transmit START and let the TWI interrupt drive the rest
+    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTA) | (1 << TWIE);
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_transmit_async_pending(void) { return async_active; }
+
+i2c_status_t i2c_transmit_async_result(void) { return async_result; }
+
+i2c_status_t i2c_readReg_async(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length) {
+    if (async_active || length == 0) {
+        return I2C_STATUS_ERROR;
+    }
+    async_address = devaddr | I2C_WRITE;
+    async_regaddr = regaddr;
+    async_rx_data = data;
+    async_length  = length;
+    async_pos     = 0;
+    async_phase   = ASYNC_PHASE_REG;
+    async_active  = true;
+    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTA) | (1 << TWIE);
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_readReg_async_pending(void) { return async_active; }
+
+i2c_status_t i2c_readReg_async_result(void) { return async_result; }
+
+ISR(TWI_vect) {
+    switch (TW_STATUS & 0xF8) {
+        case TW_START:
+            TWDR = async_address;
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            break;
+        case TW_REP_START:
+            // only issued by the readReg flow, to turn the bus around
+            TWDR = async_address | I2C_READ;
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            break;
+        case TW_MT_SLA_ACK:
+        case TW_MT_DATA_ACK:
+            if (async_phase == ASYNC_PHASE_REG) {
+                if ((TW_STATUS & 0xF8) == TW_MT_SLA_ACK) {
+                    TWDR = async_regaddr;
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                } else {
+                    // register address is out; repeated START, then read
+                    async_phase = ASYNC_PHASE_READ;
+                    TWCR        = (1 << TWINT) | (1 << TWEN) | (1 << TWSTA) | (1 << TWIE);
+                }
+            } else if (async_pos < async_length) {
+                TWDR = async_data[async_pos++];
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            } else {
+                async_result = I2C_STATUS_SUCCESS;
+                async_active = false;
+                TWCR         = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            }
+            break;
+        case TW_MR_SLA_ACK:
+            // ACK all but the final byte
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | ((async_length > 1) ? (1 << TWEA) : 0);
+            break;
+        case TW_MR_DATA_ACK:
+            async_rx_data[async_pos++] = TWDR;
+            TWCR                       = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | ((async_pos < async_length - 1) ? (1 << TWEA) : 0);
+            break;
+        case TW_MR_DATA_NACK:
+            async_rx_data[async_pos++] = TWDR;
+            async_result               = I2C_STATUS_SUCCESS;
+            async_active               = false;
+            TWCR                       = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            break;
+        default:
+            // NACK, arbitration loss or bus error: release the bus
+            async_result = I2C_STATUS_ERROR;
+            async_active = false;
+            TWCR         = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            break;
+    }
+}
+#endif  // I2C_MASTER_ASYNC
@@ -41,3 +41,18 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 void         i2c_stop(void);
+
+#ifdef I2C_MASTER_ASYNC
+// Interrupt-driven write: returns as soon as the START is on the wire and the
+// TWI interrupt clocks out the rest. The data buffer must stay valid until
+// i2c_transmit_async_pending() reads false; i2c_transmit_async_result() then
+// holds the status of the completed transfer.
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length);
+bool         i2c_transmit_async_pending(void);
+i2c_status_t i2c_transmit_async_result(void);
+// Interrupt-driven register read with the same contract: the buffer must stay
+// valid (and untouched) until i2c_readReg_async_pending() reads false.
+i2c_status_t i2c_readReg_async(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length);
+bool         i2c_readReg_async_pending(void);
+i2c_status_t i2c_readReg_async_result(void);
+#endif
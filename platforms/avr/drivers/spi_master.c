@@ -17,6 +17,7 @@
 #include "spi_master.h"
 
 #include "timer.h"
+#include "perf_counter.h"
 
 #if defined(__AVR_AT90USB162__) || defined(__AVR_ATmega16U2__) || defined(__AVR_ATmega32U2__) || defined(__AVR_ATmega16U4__) || defined(__AVR_ATmega32U4__) || defined(__AVR_AT90USB646__) || defined(__AVR_AT90USB647__) || defined(__AVR_AT90USB1286__) || defined(__AVR_AT90USB1287__)
 #    define SPI_SCK_PIN B1
@@ -36,6 +37,7 @@
 #    define SPI_TIMEOUT 100
 #endif
 
+static bool    spiStarted         = false;
 static pin_t   currentSlavePin    = NO_PIN;
 static uint8_t currentSlaveConfig = 0;
 static bool    currentSlave2X     = false;
@@ -50,7 +52,7 @@ void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
-    if (currentSlavePin != NO_PIN || slavePin == NO_PIN) {
+    if (spiStarted) {
         return false;
     }
 
@@ -104,9 +106,13 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     if (currentSlave2X) {
         SPSR |= _BV(SPI2X);
     }
+    spiStarted      = true;
     currentSlavePin = slavePin;
-    setPinOutput(currentSlavePin);
-    writePinLow(currentSlavePin);
+    // NO_PIN is a valid slave pin for devices without a chip select
+    if (currentSlavePin != NO_PIN) {
+        setPinOutput(currentSlavePin);
+        writePinLow(currentSlavePin);
+    }
 
     return true;
 }
@@ -140,6 +146,7 @@ spi_status_t spi_read() {
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     spi_status_t status;
 
+    PERF_COUNT(PERF_SPI_TRANSFERS);
     for (uint16_t i = 0; i < length; i++) {
         status = spi_write(data[i]);
 
@@ -154,6 +161,7 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
+    PERF_COUNT(PERF_SPI_TRANSFERS);
     for (uint16_t i = 0; i < length; i++) {
         status = spi_read();
 
@@ -168,13 +176,16 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
 }
 
 void spi_stop(void) {
-    if (currentSlavePin != NO_PIN) {
-        setPinOutput(currentSlavePin);
-        writePinHigh(currentSlavePin);
+    if (spiStarted) {
+        if (currentSlavePin != NO_PIN) {
+            setPinOutput(currentSlavePin);
+            writePinHigh(currentSlavePin);
+        }
         currentSlavePin = NO_PIN;
         SPSR &= ~(_BV(SPI2X));
         SPCR &= ~(currentSlaveConfig);
         currentSlaveConfig = 0;
         currentSlave2X     = false;
+        spiStarted         = false;
     }
 }
@@ -104,8 +104,17 @@ void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds) {
 #define w_nop8 w_nop4 w_nop4
 #define w_nop16 w_nop8 w_nop8
 
+#ifdef WS2812_ALLOW_INTERRUPTS
+#    ifndef WS2812_INTERRUPT_WINDOW_LEDS
+#        define WS2812_INTERRUPT_WINDOW_LEDS 8
+#    endif
+#endif
+
 static inline void ws2812_sendarray_mask(uint8_t *data, uint16_t datlen, uint8_t masklo, uint8_t maskhi) {
     uint8_t curbyte, ctr, sreg_prev;
+#ifdef WS2812_ALLOW_INTERRUPTS
+    uint8_t window = 0;
+#endif
 
     sreg_prev = SREG;
     cli();
@@ -170,6 +179,18 @@ static inline void ws2812_sendarray_mask(uint8_t *data, uint16_t datlen, uint8_t
                      "       brne  loop%=\n\t"  //  '1' [+3] '0' [+4]
                      : "=&d"(ctr)
                      : "r"(curbyte), "I"(_SFR_IO_ADDR(PORTx_ADDRESS(RGB_DI_PIN))), "r"(maskhi), "r"(masklo));
+
+#ifdef WS2812_ALLOW_INTERRUPTS
+        // Between LEDs the line may idle low far longer than within a bit, so
+        // periodically reopen interrupts for a single pending handler. The
+        // window must stay below the ~50us latch threshold of the chain, so
+        // this is only safe with short ISRs.
+        if (++window >= WS2812_INTERRUPT_WINDOW_LEDS * sizeof(LED_TYPE) && datlen) {
+            window = 0;
+            SREG   = sreg_prev;  // one instruction executes before a pending
+            cli();               // interrupt is taken, one more after its reti
+        }
+#endif
     }
 
     SREG = sreg_prev;
@@ -15,6 +15,24 @@
  */
 #pragma once
 
+// Every setting in the common chconf.h is wrapped in #if !defined(...), so a
+// keyboard-level copy of this file only needs to define the values it wants
+// to change before the #include_next -- there is no need to carry a patched
+// copy of the whole file.
+
 // #define CH_CFG_OPTIMIZE_SPEED TRUE
 
+// Tickless idle. With CH_CFG_ST_TIMEDELTA > 0 (the default) the kernel only
+// programs a timer alarm when a timeout is actually pending instead of taking
+// a periodic tick interrupt, which keeps the scan loop free of tick overhead
+// and lets the idle thread sleep the core between events. Raise the frequency
+// for finer-grained thread sleeps, or set CH_CFG_ST_TIMEDELTA to 0 to fall
+// back to a classic periodic tick (required by some low-end parts).
+// #define CH_CFG_ST_FREQUENCY 100000
+// #define CH_CFG_ST_TIMEDELTA 2
+
+// Round-robin interval in ticks for threads at the same priority; 0 disables
+// preemptive time slicing, which QMK wants since its threads cooperate.
+// #define CH_CFG_TIME_QUANTUM 0
+
 #include_next <chconf.h>
@@ -19,3 +19,11 @@
 
 // #undef STM32_HSE_ENABLED
 // #define STM32_HSE_ENABLED FALSE
+
+// USB interrupt priority (lower number = higher priority). Raising it above
+// the default keeps endpoint servicing prompt even while lower-priority
+// interrupts are busy; the exact macro name depends on the MCU's USB
+// peripheral -- STM32_USB_USB1_{HP,LP}_IRQ_PRIORITY on device-only parts,
+// STM32_USB_OTG1_IRQ_PRIORITY on OTG parts.
+// #undef STM32_USB_USB1_LP_IRQ_PRIORITY
+// #define STM32_USB_USB1_LP_IRQ_PRIORITY 8
@@ -0,0 +1,55 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "crc.h"
+
+#include <hal.h>
+
+/* The fixed-function CRC-32 unit on older STM32 families cannot compute the
+ * CRC8 used by QMK; the programmable polynomial support of the newer CRC
+ * blocks (F0/F3/F7/L4/G4/H7 and friends) is required. */
+#if !defined(CRC_POL_POL)
+#    error "CRC_DRIVER = hardware requires an STM32 CRC unit with a programmable polynomial, use the software driver instead"
+#endif
+
+void crc_init(void) {
+#if defined(RCC_AHBENR_CRCEN)
+    RCC->AHBENR |= RCC_AHBENR_CRCEN;
+#elif defined(RCC_AHB1ENR_CRCEN)
+    RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+#elif defined(RCC_AHB4ENR_CRCEN)
+    RCC->AHB4ENR |= RCC_AHB4ENR_CRCEN;
+#else
+#    error "Unknown CRC clock enable register for this STM32 family"
+#endif
+}
+
+uint8_t crc8(const void *data, size_t data_len) {
+    const uint8_t *d = (const uint8_t *)data;
+
+    /* Same parameters as the software implementation: polynomial 0x31,
+     * initial value 0xFF, no reflection, no final xor. */
+    CRC->INIT = 0xFF;
+    CRC->POL  = 0x31;
+    CRC->CR   = CRC_CR_POLYSIZE_1 | CRC_CR_RESET;  // 8 bit polynomial
+
+    while (data_len--) {
+        /* A byte-wide write feeds a single byte through the engine. */
+        *(volatile uint8_t *)&CRC->DR = *d++;
+    }
+
+    return (uint8_t)CRC->DR;
+}
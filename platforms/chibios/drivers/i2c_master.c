@@ -26,6 +26,7 @@
  */
 #include "quantum.h"
 #include "i2c_master.h"
+#include "perf_counter.h"
 #include <string.h>
 #include <hal.h>
 
@@ -84,17 +85,27 @@ i2c_status_t i2c_start(uint8_t address) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    PERF_COUNT(PERF_I2C_TRANSFERS);
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
-    return chibios_to_qmk(&status);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t result = chibios_to_qmk(&status);
+    if (result < 0) {
+        PERF_COUNT(PERF_I2C_ERRORS);
+    }
+    return result;
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    PERF_COUNT(PERF_I2C_TRANSFERS);
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
-    return chibios_to_qmk(&status);
+    msg_t        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
+    i2c_status_t result = chibios_to_qmk(&status);
+    if (result < 0) {
+        PERF_COUNT(PERF_I2C_ERRORS);
+    }
+    return result;
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
@@ -119,3 +130,29 @@ i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16
 }
 
 void i2c_stop(void) { i2cStop(&I2C_DRIVER); }
+
+#ifdef I2C_MASTER_ASYNC
+#    ifndef I2C_ASYNC_TIMEOUT
+#        define I2C_ASYNC_TIMEOUT 100
+#    endif
+
+static i2c_status_t async_result = I2C_STATUS_SUCCESS;
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length) {
+    async_result = i2c_transmit(address, data, length, I2C_ASYNC_TIMEOUT);
+    return async_result;
+}
+
+bool i2c_transmit_async_pending(void) { return false; }
+
+i2c_status_t i2c_transmit_async_result(void) { return async_result; }
+
+i2c_status_t i2c_readReg_async(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length) {
+    async_result = i2c_readReg(devaddr, regaddr, data, length, I2C_ASYNC_TIMEOUT);
+    return async_result;
+}
+
+bool i2c_readReg_async_pending(void) { return false; }
+
+i2c_status_t i2c_readReg_async_result(void) { return async_result; }
+#endif  // I2C_MASTER_ASYNC
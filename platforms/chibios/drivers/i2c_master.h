@@ -111,3 +111,16 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 void         i2c_stop(void);
+
+#ifdef I2C_MASTER_ASYNC
+// Portability shim for the AVR interrupt-driven write API. The ChibiOS HAL
+// drives transfers from interrupts/DMA but suspends the calling thread and
+// exposes no completion callback, so here the call completes synchronously
+// and pending never reads true.
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length);
+bool         i2c_transmit_async_pending(void);
+i2c_status_t i2c_transmit_async_result(void);
+i2c_status_t i2c_readReg_async(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length);
+bool         i2c_readReg_async_pending(void);
+i2c_status_t i2c_readReg_async_result(void);
+#endif
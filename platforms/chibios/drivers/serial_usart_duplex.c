@@ -0,0 +1,378 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "serial.h"
+#include "printf.h"
+
+#include <ch.h>
+#include <hal.h>
+
+#if !defined(HAL_USE_UART) || HAL_USE_UART != TRUE
+#    error "The usart_duplex driver requires the ChibiOS UART subsystem, please enable HAL_USE_UART in your halconf.h"
+#endif
+
+#if !defined(UART_USE_WAIT) || UART_USE_WAIT != TRUE
+#    error "The usart_duplex driver requires the synchronous UART API, please enable UART_USE_WAIT in your halconf.h"
+#endif
+
+#if !defined(SERIAL_USART_DRIVER)
+#    define SERIAL_USART_DRIVER UARTD1
+#endif
+
+#if !defined(USE_GPIOV1)
+/* The default PAL alternate modes are used to signal that the pins are used for USART. */
+#    if !defined(SERIAL_USART_TX_PAL_MODE)
+#        define SERIAL_USART_TX_PAL_MODE 7
+#    endif
+#    if !defined(SERIAL_USART_RX_PAL_MODE)
+#        define SERIAL_USART_RX_PAL_MODE 7
+#    endif
+#endif
+
+#if !defined(SERIAL_USART_TX_PIN)
+#    define SERIAL_USART_TX_PIN A9
+#endif
+
+#if !defined(SERIAL_USART_RX_PIN)
+#    define SERIAL_USART_RX_PIN A10
+#endif
+
+#if !defined(USART_CR1_M0)
+#    define USART_CR1_M0 USART_CR1_M  // some platforms (f1xx) dont have this so
+#endif
+
+#if !defined(SERIAL_USART_CR1)
+#    define SERIAL_USART_CR1 (USART_CR1_PCE | USART_CR1_PS | USART_CR1_M0)  // parity enable, odd parity, 9 bit length
+#endif
+
+#if !defined(SERIAL_USART_CR2)
+#    define SERIAL_USART_CR2 (USART_CR2_STOP_1)  // 2 stop bits
+#endif
+
+#if !defined(SERIAL_USART_CR3)
+#    define SERIAL_USART_CR3 0
+#endif
+
+#if !defined(SELECT_SOFT_SERIAL_SPEED)
+#    define SELECT_SOFT_SERIAL_SPEED 1
+#endif
+
+#if defined(SERIAL_USART_SPEED)
+// Allow advanced users to directly set SERIAL_USART_SPEED
+#elif SELECT_SOFT_SERIAL_SPEED == 0
+#    define SERIAL_USART_SPEED 460800
+#elif SELECT_SOFT_SERIAL_SPEED == 1
+#    define SERIAL_USART_SPEED 230400
+#elif SELECT_SOFT_SERIAL_SPEED == 2
+#    define SERIAL_USART_SPEED 115200
+#elif SELECT_SOFT_SERIAL_SPEED == 3
+#    define SERIAL_USART_SPEED 57600
+#elif SELECT_SOFT_SERIAL_SPEED == 4
+#    define SERIAL_USART_SPEED 38400
+#elif SELECT_SOFT_SERIAL_SPEED == 5
+#    define SERIAL_USART_SPEED 19200
+#else
+#    error invalid SELECT_SOFT_SERIAL_SPEED value
+#endif
+
+#if !defined(SERIAL_USART_TIMEOUT)
+#    define SERIAL_USART_TIMEOUT 20
+#endif
+
+#define HANDSHAKE_MAGIC 7
+
+static void receive_end_callback(UARTDriver* uartp);
+
+static UARTConfig uart_config = {
+    .txend1_cb = NULL,
+    .txend2_cb = NULL,
+    .rxend_cb  = receive_end_callback,
+    .rxchar_cb = NULL,
+    .rxerr_cb  = NULL,
+    .speed     = (SERIAL_USART_SPEED),
+    .cr1       = (SERIAL_USART_CR1),
+    .cr2       = (SERIAL_USART_CR2),
+    .cr3       = (SERIAL_USART_CR3),
+};
+
+static UARTDriver* serial_driver = &SERIAL_USART_DRIVER;
+
+/* Signalled from the DMA receive complete interrupt. */
+static binary_semaphore_t receive_semaphore;
+
+static inline bool react_to_transactions(void);
+static inline void __attribute__((nonnull)) receive_start(uint8_t* destination, const size_t size);
+static inline bool receive_await(sysinterval_t timeout);
+static inline bool __attribute__((nonnull)) send(const uint8_t* source, const size_t size);
+static inline int  initiate_transaction(uint8_t sstd_index);
+
+/**
+ * @brief DMA receive complete callback, wakes the thread waiting on the
+ * posted receive operation.
+ */
+static void receive_end_callback(UARTDriver* uartp) {
+    (void)uartp;
+    chSysLockFromISR();
+    chBSemSignalI(&receive_semaphore);
+    chSysUnlockFromISR();
+}
+
+/**
+ * @brief Post a DMA receive operation. The operation completes in the
+ * background, arming the receive before triggering the peer to transmit
+ * guarantees that no bytes are lost while this side is still busy.
+ */
+static inline void receive_start(uint8_t* destination, const size_t size) {
+    chBSemReset(&receive_semaphore, true);
+    uartStartReceive(serial_driver, size, destination);
+}
+
+/**
+ * @brief Wait for a posted receive operation to complete.
+ *
+ * @return true Receive success.
+ * @return false Receive failed due to timeout, the operation is aborted.
+ */
+static inline bool receive_await(sysinterval_t timeout) {
+    if (chBSemWaitTimeout(&receive_semaphore, timeout) != MSG_OK) {
+        uartStopReceive(serial_driver);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Blocking DMA send of buffer with timeout. The calling thread sleeps
+ * until the transfer finished, it is never spinning.
+ *
+ * @return true Send success.
+ * @return false Send failed.
+ */
+static inline bool send(const uint8_t* source, const size_t size) {
+    size_t length = size;
+    return uartSendFullTimeout(serial_driver, &length, source, TIME_MS2I(SERIAL_USART_TIMEOUT)) == MSG_OK;
+}
+
+/**
+ * @brief Initiate pins for USART peripheral. Full-duplex configuration.
+ */
+__attribute__((weak)) void usart_init(void) {
+#if defined(MCU_STM32)
+#    if defined(USE_GPIOV1)
+    palSetLineMode(SERIAL_USART_TX_PIN, PAL_MODE_STM32_ALTERNATE_PUSHPULL);
+    palSetLineMode(SERIAL_USART_RX_PIN, PAL_MODE_INPUT);
+#    else
+    palSetLineMode(SERIAL_USART_TX_PIN, PAL_MODE_ALTERNATE(SERIAL_USART_TX_PAL_MODE) | PAL_STM32_OTYPE_PUSHPULL | PAL_STM32_OSPEED_HIGHEST);
+    palSetLineMode(SERIAL_USART_RX_PIN, PAL_MODE_ALTERNATE(SERIAL_USART_RX_PAL_MODE) | PAL_STM32_OTYPE_PUSHPULL | PAL_STM32_OSPEED_HIGHEST);
+#    endif
+
+#    if defined(USART_REMAP)
+    USART_REMAP;
+#    endif
+#else
+#    pragma message "usart_init: MCU Familiy not supported by default, please supply your own init code by implementing usart_init() in your keyboard files."
+#endif
+}
+
+/**
+ * @brief Overridable master specific initializations.
+ */
+__attribute__((weak, nonnull)) void usart_master_init(UARTDriver** driver) {
+    (void)driver;
+    usart_init();
+}
+
+/**
+ * @brief Overridable slave specific initializations.
+ */
+__attribute__((weak, nonnull)) void usart_slave_init(UARTDriver** driver) {
+    (void)driver;
+    usart_init();
+}
+
+/**
+ * @brief This thread runs on the slave and responds to transactions initiated
+ * by the master. All transfers are handled by DMA, the thread only wakes on
+ * transfer boundaries.
+ */
+static THD_WORKING_AREA(waSlaveThread, 1024);
+static THD_FUNCTION(SlaveThread, arg) {
+    (void)arg;
+    chRegSetThreadName("usart_tx_rx");
+
+    while (true) {
+        react_to_transactions();
+    }
+}
+
+/**
+ * @brief Slave specific initializations.
+ */
+void soft_serial_target_init(void) {
+    usart_slave_init(&serial_driver);
+
+    chBSemObjectInit(&receive_semaphore, true);
+    uartStart(serial_driver, &uart_config);
+
+    /* Start transport thread. */
+    chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
+}
+
+/**
+ * @brief React to transactions started by the master.
+ */
+static inline bool react_to_transactions(void) {
+    /* Wait until there is a transaction for us. */
+    uint8_t sstd_index = 0xFF;
+    receive_start(&sstd_index, sizeof(sstd_index));
+    if (!receive_await(TIME_INFINITE)) {
+        return false;
+    }
+
+    /* Sanity check that we are actually responding to a valid transaction. */
+    if (sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t* trans = &split_transaction_table[sstd_index];
+
+    /* Arm the receive for the transaction buffer before signaling readiness,
+     * so the DMA catches the master's transmission even if this thread is
+     * preempted afterwards. */
+    if (trans->initiator2target_buffer_size) {
+        receive_start(split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    }
+
+    /* Send back the handshake which is XORed as a simple checksum,
+     to signal that the slave is ready to receive possible transaction buffers  */
+    sstd_index ^= HANDSHAKE_MAGIC;
+    if (!send(&sstd_index, sizeof(sstd_index))) {
+        *trans->status = TRANSACTION_DATA_ERROR;
+        return false;
+    }
+
+    /* Receive transaction buffer from the master. If this transaction requires it.*/
+    if (trans->initiator2target_buffer_size) {
+        if (!receive_await(TIME_MS2I(SERIAL_USART_TIMEOUT))) {
+            *trans->status = TRANSACTION_DATA_ERROR;
+            return false;
+        }
+    }
+
+    /* Allow any slave processing to occur. */
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+
+    /* Send transaction buffer to the master. If this transaction requires it. */
+    if (trans->target2initiator_buffer_size) {
+        if (!send(split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size)) {
+            *trans->status = TRANSACTION_DATA_ERROR;
+            return false;
+        }
+    }
+
+    *trans->status = TRANSACTION_ACCEPTED;
+    return true;
+}
+
+/**
+ * @brief Master specific initializations.
+ */
+void soft_serial_initiator_init(void) {
+    usart_master_init(&serial_driver);
+
+#if defined(MCU_STM32) && defined(SERIAL_USART_PIN_SWAP)
+    uart_config.cr2 |= USART_CR2_SWAP;  // master has swapped TX/RX pins
+#endif
+
+    chBSemObjectInit(&receive_semaphore, true);
+    uartStart(serial_driver, &uart_config);
+}
+
+/**
+ * @brief Start transaction from the master half to the slave half.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return int TRANSACTION_NO_RESPONSE in case of Timeout.
+ *             TRANSACTION_TYPE_ERROR in case of invalid transaction index.
+ *             TRANSACTION_END in case of success.
+ */
+int soft_serial_transaction(int index) { return initiate_transaction((uint8_t)index); }
+
+/**
+ * @brief Initiate transaction to slave half.
+ */
+static inline int initiate_transaction(uint8_t sstd_index) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        dprintln("USART: Illegal transaction Id.");
+        return TRANSACTION_TYPE_ERROR;
+    }
+
+    split_transaction_desc_t* trans = &split_transaction_table[sstd_index];
+
+    /* Transaction is not registered. Abort. */
+    if (!trans->status) {
+        dprintln("USART: Transaction not registered.");
+        return TRANSACTION_TYPE_ERROR;
+    }
+
+    /* Arm the handshake receive before transmitting, full-duplex operation
+     * allows the response to arrive while we are still busy. */
+    uint8_t sstd_index_shake = 0xFF;
+    receive_start(&sstd_index_shake, sizeof(sstd_index_shake));
+
+    /* Send transaction table index to the slave, which doubles as basic handshake token. */
+    uint8_t sstd_index_token = sstd_index;
+    if (!send(&sstd_index_token, sizeof(sstd_index_token))) {
+        dprintln("USART: Send Handshake failed.");
+        return TRANSACTION_TYPE_ERROR;
+    }
+
+    /* Which we always read back first so that we can error out correctly.
+     *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
+     */
+    if (!receive_await(TIME_MS2I(SERIAL_USART_TIMEOUT)) || (sstd_index_shake != (sstd_index ^ HANDSHAKE_MAGIC))) {
+        dprintln("USART: Handshake failed.");
+        return TRANSACTION_NO_RESPONSE;
+    }
+
+    /* Arm the receive for the slave's answer ahead of our own transmission
+     * for the same reason as above. */
+    if (trans->target2initiator_buffer_size) {
+        receive_start(split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+    }
+
+    /* Send transaction buffer to the slave. If this transaction requires it. */
+    if (trans->initiator2target_buffer_size) {
+        if (!send(split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size)) {
+            dprintln("USART: Send failed.");
+            return TRANSACTION_NO_RESPONSE;
+        }
+    }
+
+    /* Receive transaction buffer from the slave. If this transaction requires it. */
+    if (trans->target2initiator_buffer_size) {
+        if (!receive_await(TIME_MS2I(SERIAL_USART_TIMEOUT))) {
+            dprintln("USART: Receive failed.");
+            return TRANSACTION_NO_RESPONSE;
+        }
+    }
+
+    return TRANSACTION_END;
+}
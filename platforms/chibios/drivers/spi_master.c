@@ -17,7 +17,9 @@
 #include "spi_master.h"
 
 #include "timer.h"
+#include "perf_counter.h"
 
+static bool  spiStarted      = false;
 static pin_t currentSlavePin = NO_PIN;
 
 #if defined(K20x) || defined(KL2x)
@@ -50,7 +52,7 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
-    if (currentSlavePin != NO_PIN || slavePin == NO_PIN) {
+    if (spiStarted) {
         return false;
     }
 
@@ -158,13 +160,20 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     }
 #endif
 
-    currentSlavePin  = slavePin;
-    spiConfig.ssport = PAL_PORT(slavePin);
-    spiConfig.sspad  = PAL_PAD(slavePin);
+    spiStarted      = true;
+    currentSlavePin = slavePin;
 
-    setPinOutput(slavePin);
+    // NO_PIN is a valid slave pin for devices without a chip select
+    if (slavePin != NO_PIN) {
+        spiConfig.ssport = PAL_PORT(slavePin);
+        spiConfig.sspad  = PAL_PAD(slavePin);
+
+        setPinOutput(slavePin);
+    }
     spiStart(&SPI_DRIVER, &spiConfig);
-    spiSelect(&SPI_DRIVER);
+    if (slavePin != NO_PIN) {
+        spiSelect(&SPI_DRIVER);
+    }
 
     return true;
 }
@@ -184,19 +193,24 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    PERF_COUNT(PERF_SPI_TRANSFERS);
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    PERF_COUNT(PERF_SPI_TRANSFERS);
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
-    if (currentSlavePin != NO_PIN) {
-        spiUnselect(&SPI_DRIVER);
+    if (spiStarted) {
+        if (currentSlavePin != NO_PIN) {
+            spiUnselect(&SPI_DRIVER);
+        }
         spiStop(&SPI_DRIVER);
         currentSlavePin = NO_PIN;
+        spiStarted      = false;
     }
 }
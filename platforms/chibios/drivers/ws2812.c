@@ -53,6 +53,11 @@
 // to values like 600000 ns. If it is too small, the pixels will show nothing most of the time.
 #define RES (1000 * WS2812_TRST_US)  // Width of the low gap between bits to cause a frame to latch
 
+// data pin resolved once in ws2812_init(); the edges below are timed by
+// counted nops, so the per-write line decode would otherwise eat into the
+// high/low windows
+static pin_fast_t ws2812_pin_fast;
+
 void sendByte(uint8_t byte) {
     // WS2812 protocol wants most significant bits first
     for (unsigned char bit = 0; bit < 8; bit++) {
@@ -60,21 +65,24 @@ void sendByte(uint8_t byte) {
         // using something like wait_ns(is_one ? T1L : T0L) here throws off timings
         if (is_one) {
             // 1
-            writePinHigh(RGB_DI_PIN);
+            writePinFastHigh(ws2812_pin_fast);
             wait_ns(T1H);
-            writePinLow(RGB_DI_PIN);
+            writePinFastLow(ws2812_pin_fast);
             wait_ns(T1L);
         } else {
             // 0
-            writePinHigh(RGB_DI_PIN);
+            writePinFastHigh(ws2812_pin_fast);
             wait_ns(T0H);
-            writePinLow(RGB_DI_PIN);
+            writePinFastLow(ws2812_pin_fast);
             wait_ns(T0L);
         }
     }
 }
 
-void ws2812_init(void) { palSetLineMode(RGB_DI_PIN, WS2812_OUTPUT_MODE); }
+void ws2812_init(void) {
+    palSetLineMode(RGB_DI_PIN, WS2812_OUTPUT_MODE);
+    ws2812_pin_fast = pinFastResolve(RGB_DI_PIN);
+}
 
 // Setleds for standard RGB
 void ws2812_setleds(LED_TYPE *ledarray, uint16_t leds) {
@@ -27,6 +27,39 @@
 #    error "please consult your MCU's datasheet and specify in your config.h: #define WS2812_DMAMUX_ID STM32_DMAMUX1_TIM?_UP"
 #endif
 
+/*
+ * Optionally drive one logical chain as two physical strips on separate pins,
+ * each clocked out by its own timer and DMA stream in parallel. LEDs at index
+ * WS2812_PWM_SPLIT and above go out on RGB_DI_PIN_2, halving the wire time of
+ * long chains.
+ */
+#ifdef WS2812_PWM_DUAL
+#    ifndef RGB_DI_PIN_2
+#        error "WS2812_PWM_DUAL requires RGB_DI_PIN_2 for the second strip"
+#    endif
+#    ifndef WS2812_PWM_DRIVER_2
+#        define WS2812_PWM_DRIVER_2 PWMD3  // TIMx, must differ from WS2812_PWM_DRIVER
+#    endif
+#    ifndef WS2812_PWM_CHANNEL_2
+#        define WS2812_PWM_CHANNEL_2 2  // Channel
+#    endif
+#    ifndef WS2812_PWM_PAL_MODE_2
+#        define WS2812_PWM_PAL_MODE_2 WS2812_PWM_PAL_MODE  // DI Pin 2's alternate function value
+#    endif
+#    ifndef WS2812_DMA_STREAM_2
+#        error "WS2812_PWM_DUAL requires WS2812_DMA_STREAM_2 for the second timer's TIMx_UP"
+#    endif
+#    ifndef WS2812_DMA_CHANNEL_2
+#        define WS2812_DMA_CHANNEL_2 2  // DMA Channel for TIMx_UP
+#    endif
+#    if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && !defined(WS2812_DMAMUX_ID_2)
+#        error "please consult your MCU's datasheet and specify in your config.h: #define WS2812_DMAMUX_ID_2 STM32_DMAMUX1_TIM?_UP"
+#    endif
+#    ifndef WS2812_PWM_SPLIT
+#        define WS2812_PWM_SPLIT (RGBLED_NUM / 2)  // First LED index sent to the second strip
+#    endif
+#endif
+
 #ifndef WS2812_PWM_COMPLEMENTARY_OUTPUT
 #    define WS2812_PWM_OUTPUT_MODE PWM_OUTPUT_ACTIVE_HIGH
 #else
@@ -52,6 +85,16 @@
 #    endif
 #endif
 
+#ifdef WS2812_PWM_DUAL
+#    if defined(USE_GPIOV1)
+#        define WS2812_OUTPUT_MODE_2 WS2812_OUTPUT_MODE
+#    elif !defined(WS2812_EXTERNAL_PULLUP)
+#        define WS2812_OUTPUT_MODE_2 PAL_MODE_ALTERNATE(WS2812_PWM_PAL_MODE_2) | PAL_STM32_OTYPE_PUSHPULL | PAL_STM32_OSPEED_HIGHEST | PAL_STM32_PUPDR_FLOATING
+#    else
+#        define WS2812_OUTPUT_MODE_2 PAL_MODE_ALTERNATE(WS2812_PWM_PAL_MODE_2) | PAL_STM32_OTYPE_OPENDRAIN | PAL_STM32_OSPEED_HIGHEST | PAL_STM32_PUPDR_FLOATING
+#    endif
+#endif
+
 #ifndef WS2812_PWM_TARGET_PERIOD
 //#    define WS2812_PWM_TARGET_PERIOD 800000 // Original code is 800k...?
 #    define WS2812_PWM_TARGET_PERIOD 80000  // TODO: work out why 10x less on f303/f4x1
@@ -69,7 +112,15 @@
  * Calculate the number of zeroes to add at the end assuming 1.25 uS/bit:
  */
 #define WS2812_RESET_BIT_N (1000 * WS2812_TRST_US / 1250)
-#define WS2812_COLOR_BIT_N (RGBLED_NUM * 24)                   /**< Number of data bits */
+#ifdef WS2812_PWM_DUAL
+#    define WS2812_LED_N WS2812_PWM_SPLIT                            /**< LEDs on the first strip */
+#    define WS2812_LED_N_2 (RGBLED_NUM - WS2812_PWM_SPLIT)           /**< LEDs on the second strip */
+#    define WS2812_COLOR_BIT_N_2 (WS2812_LED_N_2 * 24)               /**< Number of data bits, second strip */
+#    define WS2812_BIT_N_2 (WS2812_COLOR_BIT_N_2 + WS2812_RESET_BIT_N) /**< Total number of bits in a frame, second strip */
+#else
+#    define WS2812_LED_N RGBLED_NUM
+#endif
+#define WS2812_COLOR_BIT_N (WS2812_LED_N * 24)                 /**< Number of data bits */
 #define WS2812_BIT_N (WS2812_COLOR_BIT_N + WS2812_RESET_BIT_N) /**< Total number of bits in a frame */
 
 /**
@@ -231,6 +282,9 @@
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 
 static uint32_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+#ifdef WS2812_PWM_DUAL
+static uint32_t ws2812_frame_buffer_2[WS2812_BIT_N_2 + 1]; /**< Buffer for a frame, second strip */
+#endif
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
@@ -286,14 +340,58 @@ void ws2812_init(void) {
     // disable counting, enable the channel, and then make whatever configuration changes we need.
     pwmStart(&WS2812_PWM_DRIVER, &ws2812_pwm_config);
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0);  // Initial period is 0; output will be low until first duty cycle is DMA'd in
+
+#ifdef WS2812_PWM_DUAL
+    // Second strip: own timer, own DMA stream, same clocking - both halves of
+    // the chain shift out in parallel
+    for (i = 0; i < WS2812_COLOR_BIT_N_2; i++) ws2812_frame_buffer_2[i] = WS2812_DUTYCYCLE_0;
+    for (i = 0; i < WS2812_RESET_BIT_N; i++) ws2812_frame_buffer_2[i + WS2812_COLOR_BIT_N_2] = 0;
+
+    palSetLineMode(RGB_DI_PIN_2, WS2812_OUTPUT_MODE_2);
+
+    static const PWMConfig ws2812_pwm_config_2 = {
+        .frequency = WS2812_PWM_FREQUENCY,
+        .period    = WS2812_PWM_PERIOD,
+        .callback  = NULL,
+        .channels =
+            {
+                [0 ... 3]                  = {.mode = PWM_OUTPUT_DISABLED, .callback = NULL},     // Channels default to disabled
+                [WS2812_PWM_CHANNEL_2 - 1] = {.mode = WS2812_PWM_OUTPUT_MODE, .callback = NULL},  // Turn on the channel we care about
+            },
+        .cr2  = 0,
+        .dier = TIM_DIER_UDE,  // DMA on update event for next period
+    };
+
+    dmaStreamAlloc(WS2812_DMA_STREAM_2 - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamSetPeripheral(WS2812_DMA_STREAM_2, &(WS2812_PWM_DRIVER_2.tim->CCR[WS2812_PWM_CHANNEL_2 - 1]));
+    dmaStreamSetMemory0(WS2812_DMA_STREAM_2, ws2812_frame_buffer_2);
+    dmaStreamSetTransactionSize(WS2812_DMA_STREAM_2, WS2812_BIT_N_2);
+    dmaStreamSetMode(WS2812_DMA_STREAM_2, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL_2) | STM32_DMA_CR_DIR_M2P | STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+
+#    if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
+    dmaSetRequestSource(WS2812_DMA_STREAM_2, WS2812_DMAMUX_ID_2);
+#    endif
+
+    dmaStreamEnable(WS2812_DMA_STREAM_2);
+
+    pwmStart(&WS2812_PWM_DRIVER_2, &ws2812_pwm_config_2);
+    pwmEnableChannel(&WS2812_PWM_DRIVER_2, WS2812_PWM_CHANNEL_2 - 1, 0);
+#endif
 }
 
 void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
     // Write color to frame buffer
+    uint32_t *frame_buffer = ws2812_frame_buffer;
+#ifdef WS2812_PWM_DUAL
+    if (led_number >= WS2812_PWM_SPLIT) {
+        frame_buffer = ws2812_frame_buffer_2;
+        led_number -= WS2812_PWM_SPLIT;
+    }
+#endif
     for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
     }
 }
 
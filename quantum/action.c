@@ -37,6 +37,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "nodebug.h"
 #endif
 
+#ifdef LATENCY_TRACE
+#    include "latency_trace.h"
+#endif
+
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -85,25 +89,12 @@ void action_exec(keyevent_t event) {
 
     keyrecord_t record = {.event = event};
 
-#ifndef NO_ACTION_ONESHOT
-#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
-    if (has_oneshot_layer_timed_out()) {
-        clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
-    }
-    if (has_oneshot_mods_timed_out()) {
-        clear_oneshot_mods();
-    }
-#        ifdef SWAP_HANDS_ENABLE
-    if (has_oneshot_swaphands_timed_out()) {
-        clear_oneshot_swaphands();
-    }
-#        endif
-#    endif
-#endif
+    /* one shot timeouts are handled by oneshot_expiry_task(), called once
+     * per keyboard_task() pass behind a single armed deadline */
 
 #ifndef NO_ACTION_TAPPING
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
-        action_tapping_process(record);
+        action_tapping_process(&record);
     }
 #else
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
@@ -121,6 +112,9 @@ void action_exec(keyevent_t event) {
 bool swap_hands = false;
 bool swap_held  = false;
 
+// the table must stay a dense row-major block for the flat addressing below
+_Static_assert(sizeof(hand_swap_config) == MATRIX_ROWS * MATRIX_COLS * sizeof(keypos_t), "hand_swap_config must cover the full matrix");
+
 /** \brief Process Hand Swap
  *
  * FIXME: Needs documentation.
@@ -133,8 +127,10 @@ void process_hand_swap(keyevent_t *event) {
     bool             do_swap = event->pressed ? swap_hands : swap_state[pos.row] & (col_bit);
 
     if (do_swap) {
-        event->key.row = pgm_read_byte(&hand_swap_config[pos.row][pos.col].row);
-        event->key.col = pgm_read_byte(&hand_swap_config[pos.row][pos.col].col);
+        // one flat index into the PROGMEM table instead of two 2D lookups
+        const keypos_t *entry = &hand_swap_config[0][0] + ((uint16_t)pos.row * MATRIX_COLS + pos.col);
+        event->key.row        = pgm_read_byte(&entry->row);
+        event->key.col        = pgm_read_byte(&entry->col);
         swap_state[pos.row] |= col_bit;
     } else {
         swap_state[pos.row] &= ~(col_bit);
@@ -192,6 +188,10 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
+#ifdef LATENCY_TRACE
+    latency_trace_process();
+#endif
+
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed) {
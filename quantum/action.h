@@ -86,6 +86,12 @@ bool process_record_quantum(keyrecord_t *record);
 extern bool disable_action_cache;
 #endif
 
+#ifdef ACTION_RESOLUTION_CACHE
+void action_cache_clear(void);
+#else
+#    define action_cache_clear()
+#endif
+
 /* Code for handling one-handed key modifiers. */
 #ifdef SWAP_HANDS_ENABLE
 extern bool                   swap_hands;
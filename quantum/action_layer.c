@@ -1,9 +1,15 @@
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "action.h"
 #include "util.h"
 #include "action_layer.h"
 
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_CACHE) && !defined(NO_ACTION_LAYER)
+#    include "dynamic_keymap.h"
+#    define DYNAMIC_KEYMAP_PREFETCH
+#endif
+
 #ifdef DEBUG_ACTION
 #    include "debug.h"
 #else
@@ -18,6 +24,18 @@ layer_state_t default_layer_state = 0;
  *
  * Run user code on default layer state change
  */
+#if !defined(NO_ACTION_LAYER) && defined(ACTION_LAYER_CACHE)
+/* Per-key resolved-layer cache: entry is (layer + 1), 0 means not cached.
+ * Flushed whenever the layer stack changes, so repeated events on an
+ * unchanged stack resolve with a single array read instead of walking
+ * every active layer through the keymap. */
+static uint8_t resolved_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+
+static void resolved_layer_cache_clear(void) { memset(resolved_layer_cache, 0, sizeof(resolved_layer_cache)); }
+#else
+static inline void resolved_layer_cache_clear(void) {}
+#endif
+
 __attribute__((weak)) layer_state_t default_layer_state_set_user(layer_state_t state) { return state; }
 
 /** \brief Default Layer State Set At Keyboard Level
@@ -38,6 +56,10 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     debug("\n");
+    resolved_layer_cache_clear();
+#ifdef DYNAMIC_KEYMAP_PREFETCH
+    dynamic_keymap_prefetch();
+#endif
 #ifdef STRICT_LAYER_RELEASE
     clear_keyboard_but_mods();  // To avoid stuck keys
 #else
@@ -92,6 +114,60 @@ __attribute__((weak)) layer_state_t layer_state_set_user(layer_state_t state) {
  */
 __attribute__((weak)) layer_state_t layer_state_set_kb(layer_state_t state) { return layer_state_set_user(state); }
 
+#    ifdef LAYER_STATE_COALESCE
+static bool          layer_notify_pending = false;
+static layer_state_t layer_notified_state = 0;
+
+/** \brief Layer state set
+ *
+ * Sets the layer to match the specifed state (a bitmask). The new state is
+ * visible immediately so keymap lookups stay correct, but the kb/user
+ * callbacks and stuck-key clearing are deferred to layer_state_flush() at
+ * the end of the current keyboard_task pass, coalescing repeated changes.
+ */
+void layer_state_set(layer_state_t state) {
+    layer_state = state;
+    resolved_layer_cache_clear();
+#        ifdef DYNAMIC_KEYMAP_PREFETCH
+    dynamic_keymap_prefetch();
+#        endif
+    layer_notify_pending = true;
+}
+
+/** \brief Layer state flush
+ *
+ * Delivers the coalesced notification for all layer changes made during the
+ * current pass. A transient on/off pair that cancelled out produces no
+ * downstream work at all.
+ */
+void layer_state_flush(void) {
+    if (!layer_notify_pending) {
+        return;
+    }
+    layer_notify_pending = false;
+
+    layer_state_t state = layer_state_set_kb(layer_state);
+    if (state != layer_state) {
+        layer_state = state;
+        resolved_layer_cache_clear();
+#        ifdef DYNAMIC_KEYMAP_PREFETCH
+        dynamic_keymap_prefetch();
+#        endif
+    }
+    if (layer_state == layer_notified_state) {
+        return;
+    }
+    layer_notified_state = layer_state;
+    dprint("layer_state: ");
+    layer_debug();
+    dprintln();
+#        ifdef STRICT_LAYER_RELEASE
+    clear_keyboard_but_mods();  // To avoid stuck keys
+#        else
+    clear_keyboard_but_mods_and_keys();  // Don't reset held keys
+#        endif
+}
+#    else
 /** \brief Layer state set
  *
  * Sets the layer to match the specifed state (a bitmask)
@@ -104,12 +180,17 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     dprintln();
-#    ifdef STRICT_LAYER_RELEASE
+    resolved_layer_cache_clear();
+#        ifdef DYNAMIC_KEYMAP_PREFETCH
+    dynamic_keymap_prefetch();
+#        endif
+#        ifdef STRICT_LAYER_RELEASE
     clear_keyboard_but_mods();  // To avoid stuck keys
-#    else
+#        else
     clear_keyboard_but_mods_and_keys();  // Don't reset held keys
-#    endif
+#        endif
 }
+#    endif
 
 /** \brief Layer clear
  *
@@ -252,21 +333,35 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
+#    ifdef ACTION_LAYER_CACHE
+    const bool cacheable = key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+    if (cacheable && resolved_layer_cache[key.row][key.col] != 0) {
+        return resolved_layer_cache[key.row][key.col] - 1;
+    }
+#    endif
+
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
+    uint8_t       resolved = 0;
+    layer_state_t layers   = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
-                return i;
+                resolved = i;
+                break;
             }
         }
     }
-    /* fall back to layer 0 */
-    return 0;
+    /* layer 0 is the fall back when everything was transparent */
+#    ifdef ACTION_LAYER_CACHE
+    if (cacheable) {
+        resolved_layer_cache[key.row][key.col] = resolved + 1;
+    }
+#    endif
+    return resolved;
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -112,6 +112,11 @@ void          layer_and(layer_state_t state);
 void          layer_xor(layer_state_t state);
 layer_state_t layer_state_set_user(layer_state_t state);
 layer_state_t layer_state_set_kb(layer_state_t state);
+#    ifdef LAYER_STATE_COALESCE
+void layer_state_flush(void);
+#    else
+#        define layer_state_flush()
+#    endif
 #else
 #    define layer_state 0
 
@@ -130,6 +135,7 @@ layer_state_t layer_state_set_kb(layer_state_t state);
 #    define layer_xor(state) (void)state
 #    define layer_state_set_kb(state) (void)state
 #    define layer_state_set_user(state) (void)state
+#    define layer_state_flush()
 #endif
 
 /* pressed actions cache */
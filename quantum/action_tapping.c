@@ -24,7 +24,53 @@
 #    define IS_TAPPING_RECORD(r) (IS_TAPPING() && KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #endif
 
+#    ifdef TAPPING_TERM_PER_KEY_TABLE
+#        include "progmem.h"
+
+#        ifndef TAPPING_TERM_CACHE_SIZE
+#            define TAPPING_TERM_CACHE_SIZE 8
+#        endif
+
+/* Binary search over the sorted flash table, with a small direct-mapped
+ * cache in front so repeated taps on the same keys skip the search. */
+__attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+#        if TAPPING_TERM_CACHE_SIZE > 0
+    static struct {
+        uint16_t keycode;
+        uint16_t term;
+    } cache[TAPPING_TERM_CACHE_SIZE];
+
+    uint8_t slot = keycode % TAPPING_TERM_CACHE_SIZE;
+    if (cache[slot].keycode == keycode && cache[slot].term != 0) {
+        return cache[slot].term;
+    }
+#        endif
+
+    uint16_t term = TAPPING_TERM;
+    uint16_t lo   = 0;
+    uint16_t hi   = tapping_term_table_count;
+    while (lo < hi) {
+        uint16_t mid         = lo + (hi - lo) / 2;
+        uint16_t mid_keycode = pgm_read_word(&tapping_term_table[mid].keycode);
+        if (mid_keycode == keycode) {
+            term = pgm_read_word(&tapping_term_table[mid].term);
+            break;
+        } else if (mid_keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+#        if TAPPING_TERM_CACHE_SIZE > 0
+    cache[slot].keycode = keycode;
+    cache[slot].term    = term;
+#        endif
+    return term;
+}
+#    else
 __attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) { return TAPPING_TERM; }
+#    endif
 
 #    ifdef TAPPING_TERM_PER_KEY
 #        define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < get_tapping_term(get_record_keycode(&tapping_key, false), &tapping_key))
@@ -49,8 +95,12 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+#    ifdef TAPPING_TRACE_ENABLE
+#        include "tapping_trace.h"
+#    endif
+
 static bool process_tapping(keyrecord_t *record);
-static bool waiting_buffer_enq(keyrecord_t record);
+static bool waiting_buffer_enq(const keyrecord_t *record);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -58,15 +108,37 @@ static void waiting_buffer_scan_tap(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
+#    ifdef TAPPING_TRACE_ENABLE
+/* record how the in-flight tapping key settled, before its state is consumed */
+static void tapping_trace_decision(uint8_t outcome, uint16_t event_time) {
+    uint8_t buffered = (uint8_t)(waiting_buffer_head + WAITING_BUFFER_SIZE - waiting_buffer_tail) % WAITING_BUFFER_SIZE;
+    tapping_trace_record(get_record_keycode(&tapping_key, false), outcome, TIMER_DIFF_16(event_time, tapping_key.event.time), buffered);
+}
+#    else
+#        define tapping_trace_decision(outcome, event_time)
+#    endif
+
 /** \brief Action Tapping Process
  *
  * FIXME: Needs doc
  */
-void action_tapping_process(keyrecord_t record) {
-    if (process_tapping(&record)) {
-        if (!IS_NOEVENT(record.event)) {
+/* The record is only written once: events processed immediately are handled
+ * through the caller's storage, and deferred events are copied straight into
+ * their waiting_buffer slot and referenced in place from then on. */
+void action_tapping_process(keyrecord_t *record) {
+    /* Idle ticks only matter once the tapping term deadline has passed:
+     * every time-dependent decision below compares the current time against
+     * tapping_key's term, and the buffered events' own times are fixed, so
+     * until the deadline expires a tick cannot change any state. Settle for
+     * a single comparison instead of replaying the waiting buffer. */
+    if (IS_NOEVENT(record->event) && IS_TAPPING() && WITHIN_TAPPING_TERM(record->event)) {
+        return;
+    }
+
+    if (process_tapping(record)) {
+        if (!IS_NOEVENT(record->event)) {
             debug("processed: ");
-            debug_record(record);
+            debug_record(*record);
             debug("\n");
         }
     } else {
@@ -80,7 +152,7 @@ void action_tapping_process(keyrecord_t record) {
     }
 
     // process waiting_buffer
-    if (!IS_NOEVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
+    if (!IS_NOEVENT(record->event) && waiting_buffer_head != waiting_buffer_tail) {
         debug("---- action_exec: process waiting_buffer -----\n");
     }
     for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
@@ -94,7 +166,7 @@ void action_tapping_process(keyrecord_t record) {
             break;
         }
     }
-    if (!IS_NOEVENT(record.event)) {
+    if (!IS_NOEVENT(record->event)) {
         debug("\n");
     }
 }
@@ -115,6 +187,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 if (IS_TAPPING_RECORD(keyp) && !event.pressed) {
                     // first tap!
                     debug("Tapping: First tap(0->1).\n");
+                    tapping_trace_decision(TAPPING_TRACE_TAP, event.time);
                     tapping_key.tap.count = 1;
                     debug_tapping_key();
                     process_record(&tapping_key);
@@ -145,6 +218,7 @@ bool process_tapping(keyrecord_t *keyp) {
                               ) &&
                          IS_RELEASED(event) && waiting_buffer_typed(event)) {
                     debug("Tapping: End. No tap. Interfered by typing key\n");
+                    tapping_trace_decision(TAPPING_TRACE_HOLD_PERMISSIVE, event.time);
                     process_record(&tapping_key);
                     tapping_key = (keyrecord_t){};
                     debug_tapping_key();
@@ -185,6 +259,7 @@ bool process_tapping(keyrecord_t *keyp) {
 #        endif
                         {
                             debug("Tapping: End. No tap. Interfered by pressed key\n");
+                            tapping_trace_decision(TAPPING_TRACE_HOLD_INTERRUPT, event.time);
                             process_record(&tapping_key);
                             tapping_key = (keyrecord_t){};
                             debug_tapping_key();
@@ -239,6 +314,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 debug("Tapping: End. Timeout. Not tap(0): ");
                 debug_event(event);
                 debug("\n");
+                tapping_trace_decision(TAPPING_TRACE_HOLD_TIMEOUT, event.time);
                 process_record(&tapping_key);
                 tapping_key = (keyrecord_t){};
                 debug_tapping_key();
@@ -351,8 +427,8 @@ bool process_tapping(keyrecord_t *keyp) {
  *
  * FIXME: Needs docs
  */
-bool waiting_buffer_enq(keyrecord_t record) {
-    if (IS_NOEVENT(record.event)) {
+bool waiting_buffer_enq(const keyrecord_t *record) {
+    if (IS_NOEVENT(record->event)) {
         return true;
     }
 
@@ -361,7 +437,7 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
+    waiting_buffer[waiting_buffer_head] = *record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
     debug("waiting_buffer_enq: ");
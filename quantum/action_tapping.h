@@ -32,9 +32,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef NO_ACTION_TAPPING
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
-void     action_tapping_process(keyrecord_t record);
+void     action_tapping_process(keyrecord_t *record);
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
+
+#    ifdef TAPPING_TERM_PER_KEY_TABLE
+/* Sorted (by keycode, ascending) keycode->term table in flash, consulted by
+ * the default get_tapping_term() with a binary search instead of a
+ * user-written switch. Keycodes not in the table get TAPPING_TERM. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t term;
+} tapping_term_entry_t;
+
+extern const tapping_term_entry_t tapping_term_table[];
+extern const uint16_t             tapping_term_table_count;
+#    endif
 bool     get_permissive_hold(uint16_t keycode, keyrecord_t *record);
 bool     get_ignore_mod_tap_interrupt(uint16_t keycode, keyrecord_t *record);
 bool     get_tapping_force_hold(uint16_t keycode, keyrecord_t *record);
@@ -59,6 +59,19 @@ void clear_oneshot_locked_mods(void) {
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
 static uint16_t oneshot_time = 0;
 bool            has_oneshot_mods_timed_out(void) { return TIMER_DIFF_16(timer_read(), oneshot_time) >= ONESHOT_TIMEOUT; }
+
+/* Single deadline shared by every one shot timeout source. Because they all
+ * count the same ONESHOT_TIMEOUT, an already-armed deadline is always the
+ * earlier one, so arming is only needed from idle. */
+static uint16_t oneshot_next_deadline  = 0;
+static bool     oneshot_deadline_armed = false;
+
+static void oneshot_arm_deadline(uint16_t timestamp) {
+    if (!oneshot_deadline_armed) {
+        oneshot_deadline_armed = true;
+        oneshot_next_deadline  = timestamp + ONESHOT_TIMEOUT;
+    }
+}
 #    else
 bool has_oneshot_mods_timed_out(void) { return false; }
 #    endif
@@ -105,6 +118,7 @@ void set_oneshot_swaphands(void) {
     if (oneshot_layer_time != 0) {
         oneshot_layer_time = oneshot_swaphands_time;
     }
+    oneshot_arm_deadline(oneshot_swaphands_time);
 #        endif
 }
 
@@ -146,6 +160,7 @@ void set_oneshot_layer(uint8_t layer, uint8_t state) {
         layer_on(layer);
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_layer_time = timer_read();
+        oneshot_arm_deadline(oneshot_layer_time);
 #    endif
         oneshot_layer_changed_kb(get_oneshot_layer());
     } else {
@@ -213,6 +228,87 @@ void oneshot_disable(void) { oneshot_set(false); }
 
 bool is_oneshot_enabled(void) { return keymap_config.oneshot_disable; }
 
+#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+/** \brief One shot expiry task
+ *
+ * Runs every one shot timeout behind the shared deadline: until it passes
+ * this is a single compare, so the per-event timeout polling that used to
+ * sit in the action path goes away. Called once per keyboard_task() pass.
+ */
+void oneshot_expiry_task(void) {
+    uint16_t now = timer_read();
+    if (!oneshot_deadline_armed || !timer_expired(now, oneshot_next_deadline)) {
+        return;
+    }
+
+    if (has_oneshot_layer_timed_out()) {
+        clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
+    }
+    if (oneshot_mods && has_oneshot_mods_timed_out()) {
+        dprintf("Oneshot: timeout\n");
+        clear_oneshot_mods();
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (has_oneshot_swaphands_timed_out()) {
+        clear_oneshot_swaphands();
+    }
+#        endif
+
+    // re-arm on the source that has been counting down the longest
+    oneshot_deadline_armed = false;
+    uint16_t max_elapsed   = 0;
+    bool     pending       = false;
+    if (oneshot_mods) {
+        max_elapsed = TIMER_DIFF_16(now, oneshot_time);
+        pending     = true;
+    }
+    if (get_oneshot_layer_state() && !(get_oneshot_layer_state() & ONESHOT_TOGGLED)) {
+        uint16_t elapsed = TIMER_DIFF_16(now, oneshot_layer_time);
+        if (!pending || elapsed > max_elapsed) {
+            max_elapsed = elapsed;
+        }
+        pending = true;
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot != SHO_OFF) {
+        uint16_t elapsed = TIMER_DIFF_16(now, oneshot_swaphands_time);
+        if (!pending || elapsed > max_elapsed) {
+            max_elapsed = elapsed;
+        }
+        pending = true;
+    }
+#        endif
+    if (pending) {
+        oneshot_deadline_armed = true;
+        oneshot_next_deadline  = now - max_elapsed + ONESHOT_TIMEOUT;
+    }
+}
+#    endif
+
+#endif
+
+#ifdef COMBO_BATCH_FLUSH
+static uint8_t report_defer_depth   = 0;
+static bool    report_defer_pending = false;
+
+/** \brief Defer keyboard reports
+ *
+ * Holds back reports while a batch of events is processed; nests, so each
+ * call must be paired with flush_keyboard_report().
+ */
+void defer_keyboard_report(void) { report_defer_depth++; }
+
+/** \brief Flush keyboard report
+ *
+ * Ends a deferral started with defer_keyboard_report() and, once the
+ * outermost deferral ends, sends the accumulated report in one go.
+ */
+void flush_keyboard_report(void) {
+    if (report_defer_depth && --report_defer_depth == 0 && report_defer_pending) {
+        report_defer_pending = false;
+        send_keyboard_report();
+    }
+}
 #endif
 
 /** \brief Send keyboard report
@@ -220,18 +316,19 @@ bool is_oneshot_enabled(void) { return keymap_config.oneshot_disable; }
  * FIXME: needs doc
  */
 void send_keyboard_report(void) {
+#ifdef COMBO_BATCH_FLUSH
+    if (report_defer_depth) {
+        report_defer_pending = true;
+        return;
+    }
+#endif
     keyboard_report->mods = real_mods;
     keyboard_report->mods |= weak_mods;
     keyboard_report->mods |= macro_mods;
 
 #ifndef NO_ACTION_ONESHOT
+    /* timeouts are applied by oneshot_expiry_task(), so this stays a load */
     if (oneshot_mods) {
-#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
-        if (has_oneshot_mods_timed_out()) {
-            dprintf("Oneshot: timeout\n");
-            clear_oneshot_mods();
-        }
-#    endif
         keyboard_report->mods |= oneshot_mods;
         if (has_anykey(keyboard_report)) {
             clear_oneshot_mods();
@@ -355,6 +452,7 @@ void add_oneshot_mods(uint8_t mods) {
     if ((oneshot_mods & mods) != mods) {
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = timer_read();
+        oneshot_arm_deadline(oneshot_time);
 #    endif
         oneshot_mods |= mods;
         oneshot_mods_changed_kb(mods);
@@ -366,6 +464,9 @@ void del_oneshot_mods(uint8_t mods) {
         oneshot_mods &= ~mods;
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = oneshot_mods ? timer_read() : 0;
+        if (oneshot_mods) {
+            oneshot_arm_deadline(oneshot_time);
+        }
 #    endif
         oneshot_mods_changed_kb(oneshot_mods);
     }
@@ -380,6 +481,7 @@ void set_oneshot_mods(uint8_t mods) {
         if (oneshot_mods != mods) {
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
             oneshot_time = timer_read();
+            oneshot_arm_deadline(oneshot_time);
 #    endif
             oneshot_mods = mods;
             oneshot_mods_changed_kb(mods);
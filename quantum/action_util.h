@@ -27,6 +27,10 @@ extern "C" {
 extern report_keyboard_t *keyboard_report;
 
 void send_keyboard_report(void);
+#ifdef COMBO_BATCH_FLUSH
+void defer_keyboard_report(void);
+void flush_keyboard_report(void);
+#endif
 
 /* key */
 inline void add_key(uint8_t key) { add_key_to_report(keyboard_report, key); }
@@ -78,6 +82,12 @@ uint8_t get_oneshot_layer_state(void);
 bool    has_oneshot_layer_timed_out(void);
 bool    has_oneshot_swaphands_timed_out(void);
 
+#if !defined(NO_ACTION_ONESHOT) && (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+void oneshot_expiry_task(void);
+#else
+#    define oneshot_expiry_task()
+#endif
+
 void oneshot_locked_mods_changed_user(uint8_t mods);
 void oneshot_locked_mods_changed_kb(uint8_t mods);
 void oneshot_mods_changed_user(uint8_t mods);
@@ -81,12 +81,21 @@ static const dacsample_t dac_buffer_trapezoid[AUDIO_DAC_BUFFER_SIZE] = {0x0,   0
 
 static dacsample_t dac_buffer_empty[AUDIO_DAC_BUFFER_SIZE] = {AUDIO_DAC_OFF_VALUE};
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+/* keep track of the sample position for for each frequency, as a 16.16
+ * fixed-point phase accumulator; the per-sample increment is precomputed
+ * whenever the set of active tones changes, so the DAC callback itself is
+ * add/shift/lookup work only - no float math and no fmod at sample rate */
+static uint32_t dac_if[AUDIO_MAX_SIMULTANEOUS_TONES]        = {0};
+static uint32_t dac_if_step[AUDIO_MAX_SIMULTANEOUS_TONES]   = {0};
+#define DAC_PHASE_WRAP ((uint32_t)AUDIO_DAC_BUFFER_SIZE << 16)
 
 static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0, 0};
 static uint8_t active_tones_snapshot_length                        = 0;
 
+/* 16.16 fixed-point reciprocal of the active voice count, so mixing scales
+ * the accumulated sum with one multiply instead of a division per voice */
+static uint32_t dac_mix_scale = 0;
+
 typedef enum {
     OUTPUT_SHOULD_START,
     OUTPUT_RUN_NORMALLY,
@@ -114,48 +123,40 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable samples for each frequency, then scaling the sum by the
+     * precomputed reciprocal of the number of active tones
      */
-    uint16_t value     = 0;
-    float    frequency = 0.0f;
+    uint32_t sum = 0;
 
     for (uint8_t i = 0; i < active_tones_snapshot_length; i++) {
         /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
          * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        dac_if[i] = dac_if[i] + ((frequency * AUDIO_DAC_BUFFER_SIZE) / AUDIO_DAC_SAMPLE_RATE) * 2 / 3;
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        dac_if[i] = fmod(dac_if[i], AUDIO_DAC_BUFFER_SIZE);
+        dac_if[i] += dac_if_step[i];
+        if (dac_if[i] >= DAC_PHASE_WRAP) {
+            dac_if[i] -= DAC_PHASE_WRAP;
+        }
 
         // Wavetable generation/lookup
-        uint16_t dac_i = (uint16_t)dac_if[i];
+        uint16_t dac_i = dac_if[i] >> 16;
 
 #if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
+        sum += dac_buffer_sine[dac_i];
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
+        sum += dac_buffer_triangle[dac_i];
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
+        sum += dac_buffer_trapezoid[dac_i];
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
+        sum += dac_buffer_square[dac_i];
 #endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
 
         // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
+        // sum += dac_buffer_staircase[dac_i];
+    }
+
+    uint32_t value = (sum * dac_mix_scale) >> 16;
+    // saturate, should rounding in the mix scale ever push the sum past full scale
+    if (value > AUDIO_DAC_SAMPLE_MAX) {
+        value = AUDIO_DAC_SAMPLE_MAX;
     }
 
     return value;
@@ -221,9 +222,19 @@ static void dac_end(DACDriver *dacp) {
             for (uint8_t i = 0; i < active_tones; i++) {
                 float freq = audio_get_processed_frequency(i);
                 if (freq > 0) {  // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
+                    active_tones_snapshot[active_tones_snapshot_length] = freq;
+                    /* phase increment per generated sample, in 16.16 table positions.
+                     *Note: the 2/3 are necessary to get the correct frequencies on the
+                     *      DAC output (as measured with an oscilloscope), since the gpt
+                     *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
+                     *      is called twice per conversion.*/
+                    dac_if_step[active_tones_snapshot_length] = (uint32_t)(freq * ((65536.0f * AUDIO_DAC_BUFFER_SIZE * 2) / (3.0f * AUDIO_DAC_SAMPLE_RATE)));
+                    active_tones_snapshot_length++;
                 }
             }
+            if (active_tones_snapshot_length > 0) {
+                dac_mix_scale = 65536UL / active_tones_snapshot_length;
+            }
 
             if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
                 state = OUTPUT_OFF;
@@ -327,9 +338,11 @@ void audio_driver_start(void) {
     gptStartContinuous(&GPTD6, 2U);
 
     for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
+        dac_if[i]                = 0;
+        dac_if_step[i]           = 0;
         active_tones_snapshot[i] = 0.0f;
     }
     active_tones_snapshot_length = 0;
+    dac_mix_scale                = 0;
     state                        = OUTPUT_SHOULD_START;
 }
@@ -23,6 +23,14 @@ the duty-cycle is always kept at 50%, and the pwm-period is adjusted to match th
 this driver uses the chibios-PWM system to produce a square-wave on any given output pin in software
 - a pwm callback is used to set/clear the configured pin.
 
+the pin edges are generated from the PWM timer's own interrupts, and the
+period/compare registers are only rewritten when the pitch actually changes
+(latched through the hardware preload registers at the next update event),
+so pitch stability depends on the timer ISR alone rather than on main-loop
+latency. If other interrupt load (e.g. I2C) still audibly delays the edges,
+raise the PWM timer's interrupt priority in mcuconf.h
+(STM32_PWM_TIMx_IRQ_PRIORITY for the timer behind AUDIO_PWM_DRIVER).
+
  */
 #include "audio.h"
 #include "ch.h"
@@ -53,19 +61,34 @@ static PWMConfig pwmCFG = {
         },
 };
 
-static float channel_1_frequency = 0.0f;
-void         channel_1_set_frequency(float freq) {
+static float    channel_1_frequency = 0.0f;
+static pwmcnt_t channel_1_period    = 0;
+
+/* called from the state-timer ISR (gpt_callback) */
+void channel_1_set_frequency(float freq) {
     channel_1_frequency = freq;
 
     if (freq <= 0.0)  // a pause/rest has freq=0
         return;
 
     pwmcnt_t period = (pwmCFG.frequency / freq);
-    pwmChangePeriod(&AUDIO_PWM_DRIVER, period);
-
-    pwmEnableChannel(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1,
-                     // adjust the duty-cycle so that the output is for 'note_timbre' duration HIGH
-                     PWM_PERCENTAGE_TO_WIDTH(&AUDIO_PWM_DRIVER, (100 - note_timbre) * 100));
+    if (period == channel_1_period) {
+        // same pitch as the ongoing note: leave the timer registers alone,
+        // rewriting them every state-timer tick would restart the period in
+        // flight and wobble the pitch
+        return;
+    }
+    channel_1_period = period;
+
+    // i-class calls, since this runs from the GPT ISR; the timer's preload
+    // registers latch the new period and compare value at the next update
+    // event, so the cycle in progress completes cleanly
+    chSysLockFromISR();
+    pwmChangePeriodI(&AUDIO_PWM_DRIVER, period);
+    pwmEnableChannelI(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1,
+                      // adjust the duty-cycle so that the output is for 'note_timbre' duration HIGH
+                      PWM_PERCENTAGE_TO_WIDTH(&AUDIO_PWM_DRIVER, (100 - note_timbre) * 100));
+    chSysUnlockFromISR();
 }
 
 float channel_1_get_frequency(void) { return channel_1_frequency; }
@@ -74,6 +97,10 @@ void channel_1_start(void) {
     pwmStop(&AUDIO_PWM_DRIVER);
     pwmStart(&AUDIO_PWM_DRIVER, &pwmCFG);
 
+    // the restart reset the timer to the config defaults; force the first
+    // channel_1_set_frequency() to program the registers again
+    channel_1_period = 0;
+
     pwmEnablePeriodicNotification(&AUDIO_PWM_DRIVER);
     pwmEnableChannelNotification(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1);
 }
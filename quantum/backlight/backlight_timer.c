@@ -106,7 +106,73 @@ void breathing_pulse(void) {
 }
 #endif
 
-#ifdef PROTOCOL_CHIBIOS
+#if defined(__AVR__)
+// Use a spare 16-bit timer in Fast PWM mode counting up to 0xFFFF: the
+// overflow interrupt turns the LEDs on and the compare match interrupt turns
+// them off, so the duty cycle is jitter-free and costs nothing in the main
+// loop. Unlike the pwm driver this works with any GPIO (including
+// BACKLIGHT_PINS), but the timer must not be claimed by Audio.
+#    ifndef BACKLIGHT_TIMER
+#        define BACKLIGHT_TIMER 1
+#    endif
+
+#    if BACKLIGHT_TIMER == 1
+#        define ICRx ICR1
+#        define TCCRxA TCCR1A
+#        define TCCRxB TCCR1B
+#        define TIMERx_COMPA_vect TIMER1_COMPA_vect
+#        define TIMERx_OVF_vect TIMER1_OVF_vect
+#        if defined(__AVR_ATmega32A__)  // This MCU has only one TIMSK register
+#            define TIMSKx TIMSK
+#        else
+#            define TIMSKx TIMSK1
+#        endif
+#        define TOIEx TOIE1
+#        define OCIExA OCIE1A
+#        define OCRxx OCR1A
+#    elif BACKLIGHT_TIMER == 3
+#        define ICRx ICR3
+#        define TCCRxA TCCR3A
+#        define TCCRxB TCCR3B
+#        define TIMERx_COMPA_vect TIMER3_COMPA_vect
+#        define TIMERx_OVF_vect TIMER3_OVF_vect
+#        define TIMSKx TIMSK3
+#        define TOIEx TOIE3
+#        define OCIExA OCIE3A
+#        define OCRxx OCR3A
+#    else
+#        error "BACKLIGHT_TIMER must be 1 or 3"
+#    endif
+
+// Triggered when the counter reaches the OCRx value
+ISR(TIMERx_COMPA_vect) { backlight_timer_cmp(); }
+
+// Triggered when the counter rolls over to 0, at F_CPU / 65536 =~ 244 Hz
+ISR(TIMERx_OVF_vect) { backlight_timer_top(); }
+
+static void backlight_timer_set_duty(uint16_t duty) { OCRxx = duty; }
+
+static uint16_t backlight_timer_get_duty(void) { return OCRxx; }
+
+static void backlight_timer_configure(bool enable) {
+    static bool s_init = false;
+    if (!s_init) {
+        // TimerX setup, Fast PWM mode count to TOP set in ICRx
+        TCCRxA = _BV(WGM11);
+        // clock select clk/1
+        TCCRxB = _BV(WGM13) | _BV(WGM12) | _BV(CS10);
+        // Use full 16-bit resolution
+        ICRx   = 0xFFFFU;
+        s_init = true;
+    }
+
+    if (enable) {
+        TIMSKx |= _BV(OCIExA) | _BV(TOIEx);
+    } else {
+        TIMSKx &= ~(_BV(OCIExA) | _BV(TOIEx));
+    }
+}
+#elif defined(PROTOCOL_CHIBIOS)
 // On Platforms where timers fire every tick and have no capture/top events
 //   - fake event in the normal timer callback
 uint16_t s_duty = 0;
@@ -38,6 +38,13 @@ void magic(void) {
     if (!eeconfig_is_enabled()) {
         eeconfig_init();
     }
+#ifdef EECONFIG_VERSIONED
+    else {
+        /* magic matched: re-initialize only feature blocks whose stored
+         * format version changed in this build */
+        eeconfig_sync();
+    }
+#endif
 
     /* init globals */
     debug_config.raw  = eeconfig_read_debug();
@@ -6,6 +6,18 @@
 // changed is true if raw has changed since the last call
 void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
 
+// like debounce(), but changed_rows is a bitmap of the rows whose raw state
+// changed since the last call (bit N = row N). Engines with per-row state
+// use it to skip clean rows; the weak default falls back to debounce().
+void debounce_dirty(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows);
+
+#ifdef DEBOUNCE_PER_KEY
+// override to give individual keys their own debounce time (in ms); sampled
+// once at init. Supported engines clamp the result to DEBOUNCE_PER_KEY_BASE
+// .. DEBOUNCE_PER_KEY_BASE + 15; a key that resolves to 0 is not debounced.
+uint8_t debounce_time_for_key(uint8_t row, uint8_t col);
+#endif
+
 bool debounce_active(void);
 
 void debounce_init(uint8_t num_rows);
@@ -23,6 +23,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 
 #include "matrix.h"
+#include "debounce.h"
 #include "timer.h"
 #include "quantum.h"
 #include <stdlib.h>
@@ -58,6 +59,28 @@ static bool matrix_need_update;
 
 #define DEBOUNCE_ELAPSED 0
 
+#ifdef DEBOUNCE_PER_KEY
+/* Per-key debounce times, stored as 4-bit deltas from DEBOUNCE_PER_KEY_BASE
+ * (half a byte of RAM per key). Keys resolve to base..base+15 milliseconds;
+ * a key that resolves to 0 is not debounced at all. */
+#    ifndef DEBOUNCE_PER_KEY_BASE
+#        define DEBOUNCE_PER_KEY_BASE 0
+#    endif
+#    if DEBOUNCE_PER_KEY_BASE + 15 > 127
+#        error DEBOUNCE_PER_KEY_BASE: per-key debounce times must fit in the 7-bit counters (base + 15 <= 127)
+#    endif
+static uint8_t *debounce_deltas; // two 4-bit deltas per byte, low nibble first
+
+__attribute__((weak)) uint8_t debounce_time_for_key(uint8_t row, uint8_t col) { return DEBOUNCE; }
+
+static uint8_t get_key_debounce(uint16_t index) {
+    uint8_t packed = debounce_deltas[index >> 1];
+    return DEBOUNCE_PER_KEY_BASE + ((index & 1) ? (packed >> 4) : (packed & 0x0F));
+}
+#else
+static inline uint8_t get_key_debounce(uint16_t index) { return DEBOUNCE; }
+#endif
+
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
@@ -65,8 +88,17 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 void debounce_init(uint8_t num_rows) {
     debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
     int i = 0;
+#ifdef DEBOUNCE_PER_KEY
+    debounce_deltas = calloc((num_rows * MATRIX_COLS + 1) / 2, sizeof(uint8_t));
+#endif
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+#ifdef DEBOUNCE_PER_KEY
+            uint8_t time = debounce_time_for_key(r, c);
+            if (time < DEBOUNCE_PER_KEY_BASE) time = DEBOUNCE_PER_KEY_BASE;
+            if (time > DEBOUNCE_PER_KEY_BASE + 15) time = DEBOUNCE_PER_KEY_BASE + 15;
+            debounce_deltas[i >> 1] |= (time - DEBOUNCE_PER_KEY_BASE) << ((i & 1) ? 4 : 0);
+#endif
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
         }
     }
@@ -75,6 +107,10 @@ void debounce_init(uint8_t num_rows) {
 void debounce_free(void) {
     free(debounce_counters);
     debounce_counters = NULL;
+#ifdef DEBOUNCE_PER_KEY
+    free(debounce_deltas);
+    debounce_deltas = NULL;
+#endif
 }
 
 void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -145,13 +181,20 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
             if (delta & col_mask) {
                 if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time = DEBOUNCE;
-                    counters_need_update = true;
+                    uint8_t key_time = get_key_debounce(debounce_pointer - debounce_counters);
 
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        cooked[row] ^= col_mask;
+                    if (key_time == DEBOUNCE_ELAPSED) {
+                        // this key is not debounced at all
+                        cooked[row] = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                    } else {
+                        debounce_pointer->pressed = (raw[row] & col_mask);
+                        debounce_pointer->time = key_time;
+                        counters_need_update = true;
+
+                        if (debounce_pointer->pressed) {
+                            // key-down: eager
+                            cooked[row] ^= col_mask;
+                        }
                     }
                 }
             } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
@@ -20,6 +20,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 
 #include "matrix.h"
+#include "debounce.h"
 #include "timer.h"
 #include "quantum.h"
 #include <stdlib.h>
@@ -52,7 +53,7 @@ static bool                counters_need_update;
 #define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
-static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
@@ -70,7 +71,9 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
-void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) { debounce_dirty(raw, cooked, num_rows, changed ? ~(uint32_t)0 : 0); }
+
+void debounce_dirty(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
     bool updated_last = false;
 
     if (counters_need_update) {
@@ -88,12 +91,12 @@ void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
     }
 
-    if (changed) {
+    if (changed_rows) {
         if (!updated_last) {
             last_time = timer_read_fast();
         }
 
-        start_debounce_counters(raw, cooked, num_rows);
+        start_debounce_counters(raw, cooked, num_rows, changed_rows);
     }
 }
 
@@ -116,9 +119,14 @@ static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[],
     }
 }
 
-static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
     debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
+        if (!(changed_rows & ((uint32_t)1 << row))) {
+            // raw didn't change on this row, so no counters start or reset
+            debounce_pointer += MATRIX_COLS;
+            continue;
+        }
         matrix_row_t delta = raw[row] ^ cooked[row];
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             if (delta & (ROW_SHIFTER << col)) {
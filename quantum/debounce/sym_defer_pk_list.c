@@ -0,0 +1,148 @@
+/*
+Copyright 2021 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm, behaviorally identical to sym_defer_pk, but
+tracking only the keys that are currently bouncing in a small fixed-size
+list instead of keeping a counter per matrix position. The per-scan cost
+is O(bouncing keys) - typically zero to three entries - independent of
+the matrix size, which matters at high scan rates on large matrices.
+
+If more than DEBOUNCE_EVENT_CAPACITY keys bounce at once, the overflowing
+key is committed immediately (no deferral) rather than dropped.
+*/
+
+#include "matrix.h"
+#include "debounce.h"
+#include "timer.h"
+#include "quantum.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+/* Maximum number of keys that can be mid-bounce at the same time. */
+#ifndef DEBOUNCE_EVENT_CAPACITY
+#    define DEBOUNCE_EVENT_CAPACITY 8
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+#if DEBOUNCE > 0
+
+typedef struct {
+    uint8_t row;
+    uint8_t col;
+    uint8_t remaining;
+} debounce_event_t;
+
+static debounce_event_t events[DEBOUNCE_EVENT_CAPACITY];
+static uint8_t          event_count;
+static fast_timer_t     last_time;
+
+void debounce_init(uint8_t num_rows) { event_count = 0; }
+
+void debounce_free(void) { event_count = 0; }
+
+static void remove_event(uint8_t index) {
+    // order is irrelevant, so fill the hole with the last entry
+    events[index] = events[--event_count];
+}
+
+static void update_events(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
+    for (uint8_t i = 0; i < event_count;) {
+        debounce_event_t *event = &events[i];
+        matrix_row_t      mask  = ROW_SHIFTER << event->col;
+
+        if (!((raw[event->row] ^ cooked[event->row]) & mask)) {
+            // key bounced back to its debounced state; cancel
+            remove_event(i);
+        } else if (event->remaining <= elapsed_time) {
+            cooked[event->row] ^= mask;
+            remove_event(i);
+        } else {
+            event->remaining -= elapsed_time;
+            i++;
+        }
+    }
+}
+
+static bool event_exists(uint8_t row, uint8_t col) {
+    for (uint8_t i = 0; i < event_count; i++) {
+        if (events[i].row == row && events[i].col == col) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void start_events(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (!(changed_rows & ((uint32_t)1 << row))) {
+            continue;
+        }
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        for (uint8_t col = 0; delta; col++, delta >>= 1) {
+            if (!(delta & 1)) {
+                continue;
+            }
+            if (event_exists(row, col)) {
+                continue;
+            }
+            if (event_count < DEBOUNCE_EVENT_CAPACITY) {
+                events[event_count].row       = row;
+                events[event_count].col       = col;
+                events[event_count].remaining = DEBOUNCE;
+                event_count++;
+            } else {
+                // list full; commit immediately rather than losing the key
+                cooked[row] ^= ROW_SHIFTER << col;
+            }
+        }
+    }
+}
+
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) { debounce_dirty(raw, cooked, num_rows, changed ? ~(uint32_t)0 : 0); }
+
+void debounce_dirty(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
+    bool updated_last = false;
+
+    if (event_count) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_events(raw, cooked, elapsed_time);
+        }
+    }
+
+    if (changed_rows) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_events(raw, cooked, num_rows, changed_rows);
+    }
+}
+
+bool debounce_active(void) { return true; }
+#else
+#    include "none.c"
+#endif
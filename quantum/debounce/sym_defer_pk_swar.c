@@ -0,0 +1,182 @@
+/*
+Copyright 2021 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with word-packed counters, behaviorally
+identical to sym_defer_pk. Four 8-bit counters are packed per 32-bit word
+and updated with SWAR (SIMD-within-a-register) arithmetic; an occupancy
+bitmap lets wholly idle words be skipped, so the per-scan cost tracks the
+number of bouncing keys instead of the matrix size.
+*/
+
+#include "matrix.h"
+#include "debounce.h"
+#include "timer.h"
+#include "quantum.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// The guard-bit subtraction below needs the top bit of every counter byte
+// free, so counters (and thus the debounce time) are limited to 127ms.
+#if DEBOUNCE > 127
+#    undef DEBOUNCE
+#    define DEBOUNCE 127
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+#if DEBOUNCE > 0
+
+#define COUNTERS_PER_WORD 4
+#define SWAR_HIGH_BITS ((uint32_t)0x80808080)
+#define SWAR_LOW_BITS ((uint32_t)0x01010101)
+
+// 0x80 set in every byte of v that is zero (exact for bytes <= 0x7F; the
+// guard bits keep the per-byte subtraction from borrowing across bytes)
+static inline uint32_t swar_zero_bytes(uint32_t v) { return ~((v | SWAR_HIGH_BITS) - SWAR_LOW_BITS) & SWAR_HIGH_BITS; }
+
+static uint32_t *counter_words;
+static uint32_t *occupancy;  // bit N set while counter word N has any live counter
+static uint16_t  num_words;
+static fast_timer_t last_time;
+static bool         counters_need_update;
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    num_words      = (num_rows * MATRIX_COLS + COUNTERS_PER_WORD - 1) / COUNTERS_PER_WORD;
+    counter_words  = (uint32_t *)calloc(num_words, sizeof(uint32_t));
+    occupancy      = (uint32_t *)calloc((num_words + 31) / 32, sizeof(uint32_t));
+}
+
+void debounce_free(void) {
+    free(counter_words);
+    counter_words = NULL;
+    free(occupancy);
+    occupancy = NULL;
+}
+
+static void update_counter_words_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
+    counters_need_update = false;
+
+    uint32_t broadcast = (uint32_t)elapsed_time * SWAR_LOW_BITS;
+    for (uint16_t word = 0; word < num_words; word++) {
+        if (!(occupancy[word / 32] & ((uint32_t)1 << (word % 32)))) {
+            continue;
+        }
+        uint32_t counters = counter_words[word];
+
+        // Guard-bit saturating subtract: with all bytes <= 0x7F, setting
+        // the top bit of each byte prevents borrows from crossing byte
+        // boundaries. Bytes that kept their guard bit did not underflow.
+        uint32_t diff         = (counters | SWAR_HIGH_BITS) - (broadcast & ~SWAR_HIGH_BITS);
+        uint32_t no_underflow = ((diff & SWAR_HIGH_BITS) >> 7) * 0xFF;
+        uint32_t updated      = diff & no_underflow & ~SWAR_HIGH_BITS;
+
+        // Expired counters: live before the subtraction, zero after it
+        uint32_t expired = (swar_zero_bytes(updated) | ~no_underflow) & ~swar_zero_bytes(counters) & SWAR_HIGH_BITS;
+
+        counter_words[word] = updated;
+
+        while (expired) {
+            uint8_t  byte  = __builtin_ctzl(expired) / 8;
+            uint16_t index = word * COUNTERS_PER_WORD + byte;
+            uint8_t  row   = index / MATRIX_COLS;
+            uint8_t  col   = index % MATRIX_COLS;
+            cooked[row] = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
+            expired &= expired - 1;
+        }
+
+        if (updated) {
+            counters_need_update = true;
+        } else {
+            occupancy[word / 32] &= ~((uint32_t)1 << (word % 32));
+        }
+    }
+}
+
+static inline void set_counter(uint16_t index, uint8_t value) {
+    uint16_t word  = index / COUNTERS_PER_WORD;
+    uint8_t  shift = (index % COUNTERS_PER_WORD) * 8;
+    counter_words[word] = (counter_words[word] & ~((uint32_t)0xFF << shift)) | ((uint32_t)value << shift);
+    if (counter_words[word]) {
+        occupancy[word / 32] |= (uint32_t)1 << (word % 32);
+    } else {
+        occupancy[word / 32] &= ~((uint32_t)1 << (word % 32));
+    }
+}
+
+static inline uint8_t get_counter(uint16_t index) { return (counter_words[index / COUNTERS_PER_WORD] >> ((index % COUNTERS_PER_WORD) * 8)) & 0xFF; }
+
+static void start_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (!(changed_rows & ((uint32_t)1 << row))) {
+            continue;
+        }
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t index = row * MATRIX_COLS + col;
+            if (delta & (ROW_SHIFTER << col)) {
+                if (get_counter(index) == 0) {
+                    set_counter(index, DEBOUNCE);
+                    counters_need_update = true;
+                }
+            } else {
+                set_counter(index, 0);
+            }
+        }
+    }
+}
+
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) { debounce_dirty(raw, cooked, num_rows, changed ? ~(uint32_t)0 : 0); }
+
+void debounce_dirty(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) {
+    bool updated_last = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > 127) {
+            elapsed_time = 127;
+        }
+
+        if (elapsed_time > 0) {
+            update_counter_words_and_transfer_if_expired(raw, cooked, elapsed_time);
+        }
+    }
+
+    if (changed_rows) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_counters(raw, cooked, num_rows, changed_rows);
+    }
+}
+
+bool debounce_active(void) { return true; }
+#else
+#    include "none.c"
+#endif
@@ -123,7 +123,12 @@ static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
     debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta        = raw[row] ^ cooked[row];
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        if (!delta) {
+            // nothing pending on this row; its counters are untouched here
+            debounce_pointer += MATRIX_COLS;
+            continue;
+        }
         matrix_row_t existing_row = cooked[row];
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
@@ -0,0 +1,73 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* Column 0 is not debounced at all, column 2 gets 8ms, everything else the
+ * default 5ms. */
+extern "C" uint8_t debounce_time_for_key(uint8_t row, uint8_t col) {
+    if (col == 0) return 0;
+    if (col == 2) return 8;
+    return DEBOUNCE;
+}
+
+TEST_F(DebounceTest, ZeroTimeKeyImmediate) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}}, {{0, 0, DOWN}}},
+        {1, {{0, 0, UP}}, {{0, 0, UP}}},
+        {2, {{0, 0, DOWN}}, {{0, 0, DOWN}}},
+        {3, {{0, 0, UP}}, {{0, 0, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DefaultTimeKeyUnchanged) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{0, 1, UP}}, {}},
+
+        {5, {}, {}}, /* eager DOWN timer must finish first */
+
+        {10, {}, {{0, 1, UP}}}, /* 5ms+5ms after DOWN at time 0 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, LongTimeKeyDeferredLonger) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 2, DOWN}}, {{0, 2, DOWN}}},
+        {1, {{0, 2, UP}}, {}},
+
+        {8, {}, {}}, /* eager DOWN timer must finish first */
+
+        {16, {}, {{0, 2, UP}}}, /* 8ms+8ms after DOWN at time 0 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, MixedTimesIndependent) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}, {0, 1, DOWN}}, {{0, 0, DOWN}, {0, 1, DOWN}}},
+        {1, {{0, 0, UP}, {0, 1, UP}}, {{0, 0, UP}}},
+
+        {5, {}, {}}, /* eager DOWN timer on 0,1 must finish first */
+
+        {10, {}, {{0, 1, UP}}}, /* 5ms+5ms after DOWN at time 0 */
+    });
+    runEvents();
+}
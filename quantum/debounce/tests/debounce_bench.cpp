@@ -0,0 +1,119 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Micro-benchmark for the debounce algorithms. Each scenario replays a
+ * deterministic recorded-style bounce trace with a given number of
+ * simultaneously bouncing keys, advancing the fake timer 1ms per scan, and
+ * reports wall-clock ns per debounce() call. Build one binary per engine
+ * (debounce_bench_<engine>) and compare the numbers.
+ *
+ * The measurements are informational: the only assertion is that the engine
+ * eventually settles, so CI stays green on slow or noisy machines.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+extern "C" {
+#include "quantum.h"
+#include "timer.h"
+#include "debounce.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+/* xorshift-style LCG so every run and every engine sees the same trace */
+class TraceRng {
+   public:
+    uint32_t next() {
+        state_ = state_ * 1664525u + 1013904223u;
+        return state_ >> 8;
+    }
+
+   private:
+    uint32_t state_ = 0x12345678;
+};
+
+double benchScans(unsigned active_keys, unsigned num_scans) {
+    matrix_row_t raw[MATRIX_ROWS]    = {};
+    matrix_row_t cooked[MATRIX_ROWS] = {};
+    TraceRng     rng;
+
+    /* spread the bouncing keys across the matrix */
+    std::vector<std::pair<uint8_t, uint8_t>> keys;
+    for (unsigned i = 0; i < active_keys; i++) {
+        unsigned index = (i * 37 + 5) % (MATRIX_ROWS * MATRIX_COLS);
+        keys.emplace_back(index / MATRIX_COLS, index % MATRIX_COLS);
+    }
+
+    set_time(100);
+    debounce_init(MATRIX_ROWS);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned scan = 0; scan < num_scans; scan++) {
+        bool changed = false;
+        for (auto &key : keys) {
+            /* each bouncing key toggles on roughly half the scans */
+            if (rng.next() & 1) {
+                raw[key.first] ^= (matrix_row_t)1 << key.second;
+                changed = true;
+            }
+        }
+        debounce(raw, cooked, MATRIX_ROWS, changed);
+        advance_time(1);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    /* let the engine settle so the final state is well-defined */
+    for (auto &key : keys) {
+        raw[key.first] &= ~((matrix_row_t)1 << key.second);
+    }
+    for (unsigned i = 0; i < 256; i++) {
+        debounce(raw, cooked, MATRIX_ROWS, i == 0);
+        advance_time(1);
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(cooked[row], 0) << "row " << (int)row << " did not settle";
+    }
+    debounce_free();
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / num_scans;
+}
+
+void benchScenario(const char *name, unsigned active_keys) {
+    static constexpr unsigned kScans = 50000;
+
+    benchScans(active_keys, 1000); /* warm-up */
+    double ns = benchScans(active_keys, kScans);
+    std::cout << "[ BENCH    ] " << MATRIX_ROWS << "x" << MATRIX_COLS << " matrix, " << std::setw(2) << active_keys << " bouncing keys (" << name << "): " << std::fixed << std::setprecision(1) << ns << " ns/scan" << std::endl;
+}
+
+} // namespace
+
+TEST(DebounceBench, Idle) { benchScenario("idle", 0); }
+
+TEST(DebounceBench, OneKey) { benchScenario("single key", 1); }
+
+TEST(DebounceBench, FourKeys) { benchScenario("chord", 4); }
+
+TEST(DebounceBench, SixteenKeys) { benchScenario("rollover burst", 16); }
@@ -28,11 +28,28 @@ debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
 
+# sym_defer_pk_swar must match sym_defer_pk exactly, so it runs the same tests
+debounce_sym_defer_pk_swar_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_swar_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_swar.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
+# sym_defer_pk_list must match sym_defer_pk exactly, so it runs the same tests
+debounce_sym_defer_pk_list_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_list_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_list.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
 debounce_sym_eager_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
 
+debounce_sym_eager_pk_burst_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_eager_pk_burst_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk_burst.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_burst_tests.cpp
+
 debounce_sym_eager_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
@@ -43,6 +60,27 @@ debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
 
+debounce_asym_eager_defer_pk_per_key_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_PER_KEY
+debounce_asym_eager_defer_pk_per_key_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_per_key_tests.cpp
+
+# Micro-benchmarks: one binary per engine over the same recorded-style bounce
+# traces, on a larger matrix than the correctness tests. `make test:debounce_bench`
+# builds and runs all of them.
+DEBOUNCE_BENCH_ENGINES := sym_defer_g sym_defer_pk sym_defer_pk_swar sym_defer_pk_list sym_eager_pk sym_eager_pr asym_eager_defer_pk
+
+DEBOUNCE_BENCH_DEFS := -DMATRIX_ROWS=12 -DMATRIX_COLS=16 -DDEBOUNCE=5
+
+define DEBOUNCE_BENCH_TARGET
+debounce_bench_$1_DEFS := $$(DEBOUNCE_BENCH_DEFS)
+debounce_bench_$1_SRC := $$(TMK_PATH)/common/test/timer.c \
+	$$(QUANTUM_PATH)/debounce/$1.c \
+	$$(QUANTUM_PATH)/debounce/tests/debounce_bench.cpp
+endef
+
+$(foreach engine,$(DEBOUNCE_BENCH_ENGINES),$(eval $(call DEBOUNCE_BENCH_TARGET,$(engine))))
+
 #debounce_fancy_DEFS := -DMATRIX_ROWS=4 -DMATRIX_COLS=10 -DDEBOUNCE=2 -DDEBOUNCE_QUIESCE=30 -DDEBOUNCE_GHOST=5
 debounce_fancy_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_fancy_SRC := $(DEBOUNCE_COMMON_SRC) \
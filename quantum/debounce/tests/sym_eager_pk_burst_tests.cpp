@@ -0,0 +1,58 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* Stub out the hardware re-read burst: edges on column 3 always fail
+ * verification (simulated persistent noise), everything else passes. */
+extern "C" bool matrix_burst_verify(uint8_t row, uint8_t col, bool pressed) {
+    return col != 3;
+}
+
+TEST_F(DebounceTest, VerifiedKeyMatchesEager) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{0, 1, UP}}, {}},
+
+        {5, {}, {{0, 1, UP}}},
+        /* Press key again after 1ms delay (debounce has not yet finished) */
+        {6, {{0, 1, DOWN}}, {}},
+        {10, {}, {{0, 1, DOWN}}}, /* 5ms after UP at time 5 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, RejectedKeyNeverReported) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 3, DOWN}}, {}},
+        {1, {}, {}},
+        {5, {{0, 3, UP}}, {}},
+        {10, {}, {}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, RejectedKeyDoesNotBlockOthers) {
+    addEvents({ /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 3, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{0, 1, UP}, {0, 3, UP}}, {}},
+
+        {5, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
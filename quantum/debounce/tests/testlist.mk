@@ -1,7 +1,18 @@
 TEST_LIST += \
 	debounce_sym_defer_g \
 	debounce_sym_defer_pk \
+	debounce_sym_defer_pk_swar \
+	debounce_sym_defer_pk_list \
 	debounce_sym_eager_pk \
+	debounce_sym_eager_pk_burst \
 	debounce_sym_eager_pr \
 	debounce_asym_eager_defer_pk \
-	debounce_fancy
+	debounce_asym_eager_defer_pk_per_key \
+	debounce_fancy \
+	debounce_bench_sym_defer_g \
+	debounce_bench_sym_defer_pk \
+	debounce_bench_sym_defer_pk_swar \
+	debounce_bench_sym_defer_pk_list \
+	debounce_bench_sym_eager_pk \
+	debounce_bench_sym_eager_pr \
+	debounce_bench_asym_eager_defer_pk
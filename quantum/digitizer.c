@@ -17,11 +17,49 @@
 
 digitizer_t digitizerReport = {.tipswitch = 0, .inrange = 0, .id = 0, .x = 0, .y = 0, .status = DZ_INITIALIZED};
 
+#ifdef DIGITIZER_REPORT_INTERVAL
+/* Paced reporting: samples arrive at matrix-scan granularity, but reports
+ * leave once per DIGITIZER_REPORT_INTERVAL ms with the coordinates walked
+ * linearly from the previously sent position to the newest sample, so the
+ * host sees smooth motion instead of scan-sized jumps. */
+#    ifndef DIGITIZER_INTERPOLATE_MAX_STEPS
+#        define DIGITIZER_INTERPOLATE_MAX_STEPS 16
+#    endif
+static float    last_sent_x   = 0;
+static float    last_sent_y   = 0;
+static float    interp_from_x = 0;
+static float    interp_from_y = 0;
+static uint8_t  interp_steps  = 1;
+static uint8_t  interp_step   = 0;
+static uint16_t frame_timer   = 0;
+static uint16_t sample_timer  = 0;
+#endif
+
 __attribute__((weak)) void digitizer_send(void) {
+#ifdef DIGITIZER_REPORT_INTERVAL
+    if (!(digitizerReport.status & DZ_UPDATED)) return;
+    if (timer_elapsed(frame_timer) < DIGITIZER_REPORT_INTERVAL) return;
+    frame_timer = timer_read();
+
+    digitizer_t out = digitizerReport;
+    interp_step++;
+    if (interp_step < interp_steps) {
+        float t = (float)interp_step / interp_steps;
+        out.x   = interp_from_x + (digitizerReport.x - interp_from_x) * t;
+        out.y   = interp_from_y + (digitizerReport.y - interp_from_y) * t;
+    } else {
+        /* final frame sends the sample itself */
+        digitizerReport.status &= ~DZ_UPDATED;
+    }
+    last_sent_x = out.x;
+    last_sent_y = out.y;
+    host_digitizer_send(&out);
+#else
     if (digitizerReport.status & DZ_UPDATED) {
         host_digitizer_send(&digitizerReport);
         digitizerReport.status &= ~DZ_UPDATED;
     }
+#endif
 }
 
 __attribute__((weak)) void digitizer_task(void) { digitizer_send(); }
@@ -29,6 +67,19 @@ __attribute__((weak)) void digitizer_task(void) { digitizer_send(); }
 digitizer_t digitizer_get_report(void) { return digitizerReport; }
 
 void digitizer_set_report(digitizer_t newDigitizerReport) {
+#ifdef DIGITIZER_REPORT_INTERVAL
+    /* size the interpolation to the observed sample spacing */
+    uint16_t spacing = timer_elapsed(sample_timer);
+    sample_timer     = timer_read();
+    interp_from_x    = last_sent_x;
+    interp_from_y    = last_sent_y;
+    interp_steps     = spacing / DIGITIZER_REPORT_INTERVAL;
+    if (interp_steps < 1) interp_steps = 1;
+    if (interp_steps > DIGITIZER_INTERPOLATE_MAX_STEPS) interp_steps = DIGITIZER_INTERPOLATE_MAX_STEPS;
+    /* never interpolate across a touch-down, lift or out-of-range edge */
+    if (!digitizerReport.inrange || digitizerReport.tipswitch != newDigitizerReport.tipswitch) interp_steps = 1;
+    interp_step = 0;
+#endif
     digitizerReport = newDigitizerReport;
     digitizerReport.status |= DZ_UPDATED;
 }
\ No newline at end of file
@@ -20,6 +20,9 @@
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #endif
+#ifdef PIN_CHANGE_NOTIFY_ENABLE
+#    include "pin_change.h"
+#endif
 
 // for memcpy
 #include <string.h>
@@ -52,6 +55,15 @@ static uint16_t       scan_count;
 static bool dip_switch_state[NUMBER_OF_DIP_SWITCHES]      = {0};
 static bool last_dip_switch_state[NUMBER_OF_DIP_SWITCHES] = {0};
 
+#if defined(DIP_SWITCH_PINS) && defined(PIN_CHANGE_NOTIFY_ENABLE)
+/* With change notification the per-scan pin reads are skipped until a pad
+ * actually toggles; pins that cannot interrupt fall back to polling. */
+static bool          dip_switch_use_notify = false;
+static volatile bool dip_switch_changed    = false;
+
+static void dip_switch_change_callback(void) { dip_switch_changed = true; }
+#endif
+
 __attribute__((weak)) bool dip_switch_update_user(uint8_t index, bool active) { return true; }
 
 __attribute__((weak)) bool dip_switch_update_kb(uint8_t index, bool active) { return dip_switch_update_user(index, active); }
@@ -73,6 +85,14 @@ void dip_switch_init(void) {
     for (uint8_t i = 0; i < NUMBER_OF_DIP_SWITCHES; i++) {
         setPinInputHigh(dip_switch_pad[i]);
     }
+#    ifdef PIN_CHANGE_NOTIFY_ENABLE
+    dip_switch_use_notify = true;
+    for (uint8_t i = 0; i < NUMBER_OF_DIP_SWITCHES; i++) {
+        if (!pin_change_register(dip_switch_pad[i], dip_switch_change_callback)) {
+            dip_switch_use_notify = false;
+        }
+    }
+#    endif
     dip_switch_read(true);
 #endif
 #ifdef DIP_SWITCH_MATRIX_GRID
@@ -84,6 +104,13 @@ void dip_switch_read(bool forced) {
     bool     has_dip_state_changed = false;
     uint32_t dip_switch_mask       = 0;
 
+#if defined(DIP_SWITCH_PINS) && defined(PIN_CHANGE_NOTIFY_ENABLE)
+    if (dip_switch_use_notify && !forced && !dip_switch_changed) {
+        return;
+    }
+    dip_switch_changed = false;
+#endif
+
 #ifdef DIP_SWITCH_MATRIX_GRID
     bool read_raw = false;
 
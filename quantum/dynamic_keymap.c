@@ -30,6 +30,32 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+// Sparse layer storage. Layers at or above DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS
+// are stored as a presence bitmap plus a packed array of up to
+// DYNAMIC_KEYMAP_SPARSE_KEYS explicit keycodes instead of a full
+// MATRIX_ROWS * MATRIX_COLS * 2 block; keys without a presence bit read as
+// KC_TRNS. Since upper layers are mostly transparent this fits two to three
+// times the layer count in the same EEPROM budget. Writing more than
+// DYNAMIC_KEYMAP_SPARSE_KEYS non-transparent keys to one sparse layer drops
+// the excess writes, so pick a budget that covers the fullest upper layer.
+#ifdef DYNAMIC_KEYMAP_SPARSE
+#    ifndef DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS
+#        define DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS 1
+#    endif
+#    ifndef DYNAMIC_KEYMAP_SPARSE_KEYS
+#        define DYNAMIC_KEYMAP_SPARSE_KEYS 32
+#    endif
+#    if DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS > DYNAMIC_KEYMAP_LAYER_COUNT
+#        error DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS must not exceed DYNAMIC_KEYMAP_LAYER_COUNT
+#    endif
+#    define DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE ((MATRIX_ROWS * MATRIX_COLS + 7) / 8)
+#    define DYNAMIC_KEYMAP_LAYER_FLAT_SIZE (MATRIX_ROWS * MATRIX_COLS * 2)
+#    define DYNAMIC_KEYMAP_LAYER_SPARSE_SIZE (DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE + DYNAMIC_KEYMAP_SPARSE_KEYS * 2)
+#    define DYNAMIC_KEYMAP_EEPROM_KEYMAP_SIZE (DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS * DYNAMIC_KEYMAP_LAYER_FLAT_SIZE + (DYNAMIC_KEYMAP_LAYER_COUNT - DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS) * DYNAMIC_KEYMAP_LAYER_SPARSE_SIZE)
+#else
+#    define DYNAMIC_KEYMAP_EEPROM_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#endif
+
 // This is the default EEPROM max address to use for dynamic keymaps.
 // The default is the ATmega32u4 EEPROM max address.
 // Explicitly override it if the keyboard uses a microcontroller with
@@ -63,7 +89,7 @@
 
 // Dynamic macro starts after dynamic keymaps
 #ifndef DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR
-#    define DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR + (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2))
+#    define DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR + DYNAMIC_KEYMAP_EEPROM_KEYMAP_SIZE)
 #endif
 
 // Sanity check that dynamic keymaps fit in available EEPROM
@@ -85,10 +111,198 @@ uint8_t dynamic_keymap_get_layer_count(void) { return DYNAMIC_KEYMAP_LAYER_COUNT
 
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
+    // With DYNAMIC_KEYMAP_SPARSE this is only meaningful for the flat layers;
+    // sparse layers have no fixed per-key address.
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
+#ifdef DYNAMIC_KEYMAP_SPARSE
+static void *dynamic_keymap_sparse_layer_address(uint8_t layer) { return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS * DYNAMIC_KEYMAP_LAYER_FLAT_SIZE + (layer - DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS) * DYNAMIC_KEYMAP_LAYER_SPARSE_SIZE; }
+
+// Number of presence bits set below `index` (the slot the key at `index`
+// occupies), and optionally the total number of slots in use
+static uint8_t dynamic_keymap_sparse_rank(void *base, uint16_t index, uint8_t *used) {
+    uint8_t rank  = 0;
+    uint8_t total = 0;
+    for (uint8_t i = 0; i < DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE; i++) {
+        uint8_t bits = eeprom_read_byte(base + i);
+        total += bitpop(bits);
+        if ((uint16_t)i * 8 + 8 <= index) {
+            rank += bitpop(bits);
+        } else if ((uint16_t)i * 8 < index) {
+            rank += bitpop(bits & (uint8_t)((1 << (index - (uint16_t)i * 8)) - 1));
+        }
+    }
+    if (used != NULL) {
+        *used = total;
+    }
+    return rank;
+}
+
+static uint16_t dynamic_keymap_sparse_read(uint8_t layer, uint8_t row, uint8_t column) {
+    void *   base  = dynamic_keymap_sparse_layer_address(layer);
+    uint16_t index = row * MATRIX_COLS + column;
+    if (!(eeprom_read_byte(base + index / 8) & (1 << (index % 8)))) {
+        return KC_TRNS;
+    }
+    uint8_t rank = dynamic_keymap_sparse_rank(base, index, NULL);
+    if (rank >= DYNAMIC_KEYMAP_SPARSE_KEYS) {
+        // Corrupt bitmap (e.g. before the first reset); stay transparent
+        return KC_TRNS;
+    }
+    void *address = base + DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE + rank * 2;
+    // Big endian, matching the flat layer storage
+    return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+}
+
+// Returns false if the write was dropped (corrupt bitmap or key budget exhausted)
+static bool dynamic_keymap_sparse_write(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    void *   base        = dynamic_keymap_sparse_layer_address(layer);
+    uint16_t index       = row * MATRIX_COLS + column;
+    void *   bit_address = base + index / 8;
+    uint8_t  bits        = eeprom_read_byte(bit_address);
+    uint8_t  bit         = 1 << (index % 8);
+    uint8_t  used;
+    uint8_t  rank  = dynamic_keymap_sparse_rank(base, index, &used);
+    void *   slots = base + DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE;
+    if (rank >= DYNAMIC_KEYMAP_SPARSE_KEYS) {
+        return false;
+    }
+    if (used > DYNAMIC_KEYMAP_SPARSE_KEYS) {
+        used = DYNAMIC_KEYMAP_SPARSE_KEYS;
+    }
+    if (bits & bit) {
+        if (keycode == KC_TRNS) {
+            // Free the slot: pack the keycodes above it down
+            for (uint8_t s = rank; s + 1 < used; s++) {
+                eeprom_update_byte(slots + s * 2, eeprom_read_byte(slots + (s + 1) * 2));
+                eeprom_update_byte(slots + s * 2 + 1, eeprom_read_byte(slots + (s + 1) * 2 + 1));
+            }
+            eeprom_update_byte(bit_address, bits & ~bit);
+        } else {
+            eeprom_update_byte(slots + rank * 2, (uint8_t)(keycode >> 8));
+            eeprom_update_byte(slots + rank * 2 + 1, (uint8_t)(keycode & 0xFF));
+        }
+    } else if (keycode != KC_TRNS) {
+        if (used >= DYNAMIC_KEYMAP_SPARSE_KEYS) {
+            // Layer is at its key budget: drop the write, the key stays transparent
+            return false;
+        }
+        // Claim a slot: shift the keycodes at and above this rank up
+        for (uint8_t s = used; s > rank; s--) {
+            eeprom_update_byte(slots + s * 2, eeprom_read_byte(slots + (s - 1) * 2));
+            eeprom_update_byte(slots + s * 2 + 1, eeprom_read_byte(slots + (s - 1) * 2 + 1));
+        }
+        eeprom_update_byte(slots + rank * 2, (uint8_t)(keycode >> 8));
+        eeprom_update_byte(slots + rank * 2 + 1, (uint8_t)(keycode & 0xFF));
+        eeprom_update_byte(bit_address, bits | bit);
+    }
+    return true;
+}
+
+// Linear layer decode for the cache fill: one pass over the bitmap and the
+// packed keycodes instead of a rank scan per key
+static void dynamic_keymap_sparse_decode(uint8_t layer, uint16_t dest[MATRIX_ROWS][MATRIX_COLS]) {
+    void *  base = dynamic_keymap_sparse_layer_address(layer);
+    uint8_t bitmap[DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE];
+    eeprom_read_block(bitmap, base, DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE);
+    void *  slot  = base + DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE;
+    uint8_t slots = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+            uint16_t index = row * MATRIX_COLS + column;
+            if ((bitmap[index / 8] & (1 << (index % 8))) && slots < DYNAMIC_KEYMAP_SPARSE_KEYS) {
+                dest[row][column] = (eeprom_read_byte(slot) << 8) | eeprom_read_byte(slot + 1);
+                slot += 2;
+                slots++;
+            } else {
+                dest[row][column] = KC_TRNS;
+            }
+        }
+    }
+}
+#endif  // DYNAMIC_KEYMAP_SPARSE
+
+#ifdef DYNAMIC_KEYMAP_CACHE
+// RAM cache of recently used layers, so the per-keystroke lookups do not hit
+// the EEPROM bus. Two slots by default: transparent keys resolve through the
+// active layer and the layer below it, and one slot would thrash between them.
+#    ifndef DYNAMIC_KEYMAP_CACHE_LAYERS
+#        define DYNAMIC_KEYMAP_CACHE_LAYERS 2
+#    endif
+
+static uint16_t keymap_cache[DYNAMIC_KEYMAP_CACHE_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  keymap_cache_layer[DYNAMIC_KEYMAP_CACHE_LAYERS] = {[0 ... DYNAMIC_KEYMAP_CACHE_LAYERS - 1] = 0xFF};  // 0xFF = slot empty
+
+static void dynamic_keymap_cache_invalidate(void) {
+    for (uint8_t slot = 0; slot < DYNAMIC_KEYMAP_CACHE_LAYERS; slot++) {
+        keymap_cache_layer[slot] = 0xFF;
+    }
+}
+
+// Returns the cache slot holding `layer`, filling one from EEPROM on a miss.
+// Eviction rotates through the slots, so the layers involved in a transparent
+// lookup chain all stay resident once loaded.
+static uint8_t dynamic_keymap_cache_slot(uint8_t layer) {
+    static uint8_t next_victim = 0;
+
+    for (uint8_t slot = 0; slot < DYNAMIC_KEYMAP_CACHE_LAYERS; slot++) {
+        if (keymap_cache_layer[slot] == layer) {
+            return slot;
+        }
+    }
+
+    // Miss: load the layer from EEPROM over the next victim
+    uint8_t slot = next_victim;
+    next_victim  = (next_victim + 1) % DYNAMIC_KEYMAP_CACHE_LAYERS;
+
+    keymap_cache_layer[slot] = layer;
+#    ifdef DYNAMIC_KEYMAP_SPARSE
+    if (layer >= DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS) {
+        dynamic_keymap_sparse_decode(layer, keymap_cache[slot]);
+        return slot;
+    }
+#    endif
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+            void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+            // Big endian, so we can read/write EEPROM directly from host if we want
+            keymap_cache[slot][row][column] = (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+        }
+    }
+    return slot;
+}
+
+#    ifndef NO_ACTION_LAYER
+// Called on layer state change, so the layer loads happen while the layer
+// key is still held rather than on the first keystroke of the new layer.
+// Walks active layers from highest to lowest -- the order a transparent
+// lookup resolves through them -- filling at most the available slots.
+void dynamic_keymap_prefetch(void) {
+    layer_state_t state  = layer_state | default_layer_state;
+    uint8_t       loaded = 0;
+
+    for (int8_t layer = DYNAMIC_KEYMAP_LAYER_COUNT - 1; layer >= 0 && loaded < DYNAMIC_KEYMAP_CACHE_LAYERS; layer--) {
+        if (layer == 0 || (state & ((layer_state_t)1 << layer))) {
+            dynamic_keymap_cache_slot(layer);
+            loaded++;
+        }
+    }
+}
+#    endif  // NO_ACTION_LAYER
+#endif  // DYNAMIC_KEYMAP_CACHE
+
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_CACHE
+    if (layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        return keymap_cache[dynamic_keymap_cache_slot(layer)][row][column];
+    }
+#endif
+#ifdef DYNAMIC_KEYMAP_SPARSE
+    if (layer >= DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS) {
+        return dynamic_keymap_sparse_read(layer, row, column);
+    }
+#endif
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -97,25 +311,105 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_SPARSE
+    if (layer >= DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS) {
+        if (!dynamic_keymap_sparse_write(layer, row, column, keycode)) {
+            // Dropped: return before the cached copy diverges from EEPROM
+            return;
+        }
+    } else
+#endif
+    {
+        void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        // Big endian, so we can read/write EEPROM directly from host if we want
+        eeprom_update_byte(address, (uint8_t)(keycode >> 8));
+        eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    }
+#ifdef DYNAMIC_KEYMAP_CACHE
+    // Keep a cached copy coherent rather than dropping the whole slot
+    for (uint8_t slot = 0; slot < DYNAMIC_KEYMAP_CACHE_LAYERS; slot++) {
+        if (keymap_cache_layer[slot] == layer && row < MATRIX_ROWS && column < MATRIX_COLS) {
+            keymap_cache[slot][row][column] = keycode;
+        }
+    }
+#endif
+    action_cache_clear();
+#ifdef COMBO_ENABLE
+    combo_ref_cache_clear();
+#endif
 }
 
 void dynamic_keymap_reset(void) {
+#ifdef DYNAMIC_KEYMAP_SPARSE
+    // Clear the presence bitmaps first, so stale slot accounting from a
+    // previous layout (or uninitialized EEPROM) cannot eat into the
+    // per-layer key budget while the defaults are written below
+    for (int layer = DYNAMIC_KEYMAP_SPARSE_FLAT_LAYERS; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        void *base = dynamic_keymap_sparse_layer_address(layer);
+        for (uint8_t i = 0; i < DYNAMIC_KEYMAP_SPARSE_BITMAP_SIZE; i++) {
+            eeprom_update_byte(base + i, 0);
+        }
+    }
+#endif
     // Reset the keymaps in EEPROM to what is in flash.
     // All keyboards using dynamic keymaps should define a layout
     // for the same number of layers as DYNAMIC_KEYMAP_LAYER_COUNT.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
+#ifdef KEYMAP_COMPACT
+                dynamic_keymap_set_keycode(layer, row, column, keymap_key_to_keycode(layer, (keypos_t){.row = row, .col = column}));
+#else
                 dynamic_keymap_set_keycode(layer, row, column, pgm_read_word(&keymaps[layer][row][column]));
+#endif
             }
         }
     }
 }
 
+#ifdef DYNAMIC_KEYMAP_SPARSE
+// The host-visible buffer layout stays the flat big-endian
+// layer/row/column array so VIA clients need no changes; the bytes are
+// decoded from and re-encoded into the sparse storage as they pass through.
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_keymap_logical_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t o = offset + i;
+        if (o < dynamic_keymap_logical_size) {
+            uint16_t key     = o / 2;
+            uint16_t in_layer = key % (MATRIX_ROWS * MATRIX_COLS);
+            uint16_t keycode = dynamic_keymap_get_keycode(key / (MATRIX_ROWS * MATRIX_COLS), in_layer / MATRIX_COLS, in_layer % MATRIX_COLS);
+            data[i]          = (o & 1) ? (uint8_t)(keycode & 0xFF) : (uint8_t)(keycode >> 8);
+        } else {
+            data[i] = 0x00;
+        }
+    }
+}
+
+void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_keymap_logical_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t o = offset + i;
+        if (o >= dynamic_keymap_logical_size) {
+            continue;
+        }
+        uint16_t key      = o / 2;
+        uint8_t  layer    = key / (MATRIX_ROWS * MATRIX_COLS);
+        uint16_t in_layer = key % (MATRIX_ROWS * MATRIX_COLS);
+        uint8_t  row      = in_layer / MATRIX_COLS;
+        uint8_t  column   = in_layer % MATRIX_COLS;
+        uint16_t keycode  = dynamic_keymap_get_keycode(layer, row, column);
+        if (o & 1) {
+            keycode = (keycode & 0xFF00) | data[i];
+        } else {
+            keycode = (keycode & 0x00FF) | ((uint16_t)data[i] << 8);
+        }
+        // set_keycode keeps any cached copy coherent itself
+        dynamic_keymap_set_keycode(layer, row, column, keycode);
+    }
+    action_cache_clear();
+}
+#else
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
     void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
@@ -142,7 +436,16 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#    ifdef DYNAMIC_KEYMAP_CACHE
+    // Raw buffer writes bypass dynamic_keymap_set_keycode
+    dynamic_keymap_cache_invalidate();
+#    endif
+    action_cache_clear();
+#    ifdef COMBO_ENABLE
+    combo_ref_cache_clear();
+#    endif
 }
+#endif  // DYNAMIC_KEYMAP_SPARSE
 
 // This overrides the one in quantum/keymap_common.c
 uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
@@ -153,6 +456,67 @@ uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
     }
 }
 
+// Macro start offsets, built lazily with chunked reads so triggering macro N
+// does not scan the whole region byte-by-byte, and invalidated whenever the
+// buffer is written. Playback reads through the same size of chunk buffer,
+// so an external I2C/SPI EEPROM is read in bursts instead of one transaction
+// per byte.
+#define DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE 16
+
+static uint16_t macro_index[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     macro_index_valid = false;
+
+// Returns false if the buffer does not contain DYNAMIC_KEYMAP_MACRO_COUNT
+// nulls, i.e. its contents are garbage
+static bool dynamic_keymap_macro_index_build(void) {
+    uint8_t  chunk[DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE];
+    uint16_t offset = 0;
+    uint8_t  macro  = 1;
+
+    macro_index[0] = 0;
+    while (macro < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        if (offset >= DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+            return false;
+        }
+        uint16_t chunk_length = DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset;
+        if (chunk_length > sizeof(chunk)) {
+            chunk_length = sizeof(chunk);
+        }
+        eeprom_read_block(chunk, (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), chunk_length);
+        for (uint16_t i = 0; i < chunk_length && macro < DYNAMIC_KEYMAP_MACRO_COUNT; i++) {
+            if (chunk[i] == 0) {
+                // The next macro starts just past this null
+                macro_index[macro++] = offset + i + 1;
+            }
+        }
+        offset += chunk_length;
+    }
+    return true;
+}
+
+typedef struct {
+    uint16_t offset;  // next unread offset within the macro region
+    uint8_t  pos;
+    uint8_t  len;
+    uint8_t  buf[DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE];
+} macro_reader_t;
+
+// Returns the next byte of the macro buffer, refilling the chunk as needed,
+// or -1 at the end of the region
+static int16_t dynamic_keymap_macro_read(macro_reader_t *reader) {
+    if (reader->pos == reader->len) {
+        uint16_t remaining = DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - reader->offset;
+        if (remaining == 0) {
+            return -1;
+        }
+        reader->len = remaining < sizeof(reader->buf) ? remaining : sizeof(reader->buf);
+        eeprom_read_block(reader->buf, (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + reader->offset), reader->len);
+        reader->offset += reader->len;
+        reader->pos = 0;
+    }
+    return reader->buf[reader->pos++];
+}
+
 uint8_t dynamic_keymap_macro_get_count(void) { return DYNAMIC_KEYMAP_MACRO_COUNT; }
 
 uint16_t dynamic_keymap_macro_get_buffer_size(void) { return DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; }
@@ -181,6 +545,7 @@ void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *da
         source++;
         target++;
     }
+    macro_index_valid = false;
 }
 
 void dynamic_keymap_macro_reset(void) {
@@ -190,6 +555,7 @@ void dynamic_keymap_macro_reset(void) {
         eeprom_update_byte(p, 0);
         ++p;
     }
+    macro_index_valid = false;
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
@@ -206,44 +572,42 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (id > 0) {
-        // If we are past the end of the buffer, then the buffer
-        // contents are garbage, i.e. there were not DYNAMIC_KEYMAP_MACRO_COUNT
-        // nulls in the buffer.
-        if (p == end) {
+    // Seek to the Nth macro through the offset index, building it on the
+    // first use after the buffer changed
+    if (!macro_index_valid) {
+        if (!dynamic_keymap_macro_index_build()) {
+            // Fewer than DYNAMIC_KEYMAP_MACRO_COUNT nulls in the buffer,
+            // so its contents are garbage
             return;
         }
-        if (eeprom_read_byte(p) == 0) {
-            --id;
-        }
-        ++p;
+        macro_index_valid = true;
     }
 
+    macro_reader_t reader = {.offset = macro_index[id], .pos = 0, .len = 0};
+
     // Send the macro string one or three chars at a time
     // by making temporary 1 or 3 char strings
     char data[4] = {0, 0, 0, 0};
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
-        data[0] = eeprom_read_byte(p++);
-        data[1] = 0;
+        int16_t byte = dynamic_keymap_macro_read(&reader);
         // Stop at the null terminator of this macro string
-        if (data[0] == 0) {
+        if (byte <= 0) {
             break;
         }
+        data[0] = byte;
+        data[1] = 0;
         // If the char is magic (tap, down, up),
         // add the next char (key to use) and send a 3 char string.
         if (data[0] == SS_TAP_CODE || data[0] == SS_DOWN_CODE || data[0] == SS_UP_CODE) {
             data[1] = data[0];
             data[0] = SS_QMK_PREFIX;
-            data[2] = eeprom_read_byte(p++);
-            if (data[2] == 0) {
+            byte    = dynamic_keymap_macro_read(&reader);
+            if (byte <= 0) {
                 break;
             }
+            data[2] = byte;
         }
         send_string(data);
     }
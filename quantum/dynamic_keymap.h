@@ -23,6 +23,11 @@ void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
 void     dynamic_keymap_reset(void);
+#if defined(DYNAMIC_KEYMAP_CACHE) && !defined(NO_ACTION_LAYER)
+// Warm the RAM layer cache from EEPROM after a layer state change, so the
+// first keystroke on a freshly activated layer does not pay the load.
+void dynamic_keymap_prefetch(void);
+#endif
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
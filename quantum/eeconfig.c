@@ -23,6 +23,147 @@ void via_eeprom_set_valid(bool valid);
 void eeconfig_init_via(void);
 #endif
 
+#ifdef EECONFIG_WRITE_BEHIND
+#    include "timer.h"
+
+/* RAM shadow of the eeconfig block plus a per-byte dirty mask. Writes land in
+ * the shadow only; eeconfig_task() commits the dirty bytes in one pass once
+ * EECONFIG_COMMIT_DELAY ms have elapsed since the last change, so rapid
+ * settings churn (RGB mode stepping and the like) costs RAM writes only and
+ * flash-emulated EEPROM sees far fewer program cycles. */
+static uint8_t  eeconfig_shadow[EECONFIG_SIZE];
+static uint8_t  eeconfig_dirty_mask[(EECONFIG_SIZE + 7) / 8];
+static bool     eeconfig_shadow_loaded  = false;
+static bool     eeconfig_commit_pending = false;
+static uint16_t eeconfig_commit_timer;
+
+static inline bool eeconfig_in_block(const void *addr) { return (uintptr_t)addr < EECONFIG_SIZE; }
+
+static void eeconfig_shadow_load(void) {
+    if (!eeconfig_shadow_loaded) {
+        eeprom_read_block(eeconfig_shadow, (const void *)0, EECONFIG_SIZE);
+        eeconfig_shadow_loaded = true;
+    }
+}
+
+// Drop the shadow after the underlying EEPROM has been erased or rewritten
+static void eeconfig_shadow_invalidate(void) {
+    eeconfig_shadow_loaded  = false;
+    eeconfig_commit_pending = false;
+    for (uint8_t i = 0; i < sizeof(eeconfig_dirty_mask); i++) {
+        eeconfig_dirty_mask[i] = 0;
+    }
+}
+
+static uint8_t eeconfig_shadow_read(uintptr_t offset) {
+    eeconfig_shadow_load();
+    return eeconfig_shadow[offset];
+}
+
+static void eeconfig_shadow_write(uintptr_t offset, uint8_t value) {
+    eeconfig_shadow_load();
+    if (eeconfig_shadow[offset] != value) {
+        eeconfig_shadow[offset] = value;
+        eeconfig_dirty_mask[offset >> 3] |= 1 << (offset & 7);
+        eeconfig_commit_pending = true;
+    }
+    eeconfig_commit_timer = timer_read();
+}
+
+uint8_t eeconfig_read_byte(const uint8_t *addr) {
+    if (!eeconfig_in_block(addr)) {
+        return eeprom_read_byte(addr);
+    }
+    return eeconfig_shadow_read((uintptr_t)addr);
+}
+
+uint16_t eeconfig_read_word(const uint16_t *addr) {
+    if (!eeconfig_in_block(addr)) {
+        return eeprom_read_word(addr);
+    }
+    return eeconfig_shadow_read((uintptr_t)addr) | (eeconfig_shadow_read((uintptr_t)addr + 1) << 8);
+}
+
+uint32_t eeconfig_read_dword(const uint32_t *addr) {
+    if (!eeconfig_in_block(addr)) {
+        return eeprom_read_dword(addr);
+    }
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        value |= (uint32_t)eeconfig_shadow_read((uintptr_t)addr + i) << (i * 8);
+    }
+    return value;
+}
+
+void eeconfig_read_block(void *buf, const void *addr, size_t len) {
+    if (!eeconfig_in_block(addr)) {
+        eeprom_read_block(buf, addr, len);
+        return;
+    }
+    uint8_t *dest = buf;
+    for (size_t i = 0; i < len; i++) {
+        dest[i] = eeconfig_shadow_read((uintptr_t)addr + i);
+    }
+}
+
+void eeconfig_update_byte(uint8_t *addr, uint8_t value) {
+    if (!eeconfig_in_block(addr)) {
+        eeprom_update_byte(addr, value);
+        return;
+    }
+    eeconfig_shadow_write((uintptr_t)addr, value);
+}
+
+void eeconfig_update_word(uint16_t *addr, uint16_t value) {
+    if (!eeconfig_in_block(addr)) {
+        eeprom_update_word(addr, value);
+        return;
+    }
+    eeconfig_shadow_write((uintptr_t)addr, value & 0xFF);
+    eeconfig_shadow_write((uintptr_t)addr + 1, (value >> 8) & 0xFF);
+}
+
+void eeconfig_update_dword(uint32_t *addr, uint32_t value) {
+    if (!eeconfig_in_block(addr)) {
+        eeprom_update_dword(addr, value);
+        return;
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        eeconfig_shadow_write((uintptr_t)addr + i, (value >> (i * 8)) & 0xFF);
+    }
+}
+
+void eeconfig_update_block(const void *buf, void *addr, size_t len) {
+    if (!eeconfig_in_block(addr)) {
+        eeprom_update_block(buf, addr, len);
+        return;
+    }
+    const uint8_t *src = buf;
+    for (size_t i = 0; i < len; i++) {
+        eeconfig_shadow_write((uintptr_t)addr + i, src[i]);
+    }
+}
+
+void eeconfig_flush(void) {
+    if (!eeconfig_commit_pending) {
+        return;
+    }
+    for (uint8_t i = 0; i < EECONFIG_SIZE; i++) {
+        if (eeconfig_dirty_mask[i >> 3] & (1 << (i & 7))) {
+            eeprom_update_byte((uint8_t *)(uintptr_t)i, eeconfig_shadow[i]);
+            eeconfig_dirty_mask[i >> 3] &= ~(1 << (i & 7));
+        }
+    }
+    eeconfig_commit_pending = false;
+}
+
+void eeconfig_task(void) {
+    if (eeconfig_commit_pending && timer_elapsed(eeconfig_commit_timer) >= EECONFIG_COMMIT_DELAY) {
+        eeconfig_flush();
+    }
+}
+#endif  // EECONFIG_WRITE_BEHIND
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -39,6 +180,184 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
     eeconfig_init_user();
 }
 
+#ifdef EECONFIG_VERSIONED
+/* One directory slot per quantum-owned feature block. The slot order is part
+ * of the stored format: append new slots, never reorder or remove. When a
+ * feature's stored format changes, bump its entry in
+ * eeconfig_feature_versions[] instead of EECONFIG_MAGIC_NUMBER -- only that
+ * feature is then re-initialized on the next boot. 0x00 and 0xFF are never
+ * valid versions, so erased EEPROM reads as "never initialized" either way.
+ * Keyboard- and user-level blocks are reset through the existing
+ * eeconfig_init_kb()/eeconfig_init_user() hooks and are not tracked here. */
+enum eeconfig_slot {
+    EECONFIG_SLOT_DEBUG = 0,
+    EECONFIG_SLOT_DEFAULT_LAYER,
+    EECONFIG_SLOT_KEYMAP,
+    EECONFIG_SLOT_MOUSEKEY_ACCEL,
+    EECONFIG_SLOT_BACKLIGHT,
+    EECONFIG_SLOT_AUDIO,
+    EECONFIG_SLOT_RGBLIGHT,
+    EECONFIG_SLOT_STENOMODE,
+    EECONFIG_SLOT_HANDEDNESS,
+    EECONFIG_SLOT_VELOCIKEY,
+    EECONFIG_SLOT_HAPTIC,
+    EECONFIG_SLOT_MATRIX,
+    EECONFIG_SLOT_COUNT
+};
+
+static const uint8_t eeconfig_feature_versions[EECONFIG_SLOT_COUNT] = {
+    [EECONFIG_SLOT_DEBUG]          = 1,  //
+    [EECONFIG_SLOT_DEFAULT_LAYER]  = 1,  //
+    [EECONFIG_SLOT_KEYMAP]         = 1,  //
+    [EECONFIG_SLOT_MOUSEKEY_ACCEL] = 1,  //
+    [EECONFIG_SLOT_BACKLIGHT]      = 1,  //
+    [EECONFIG_SLOT_AUDIO]          = 1,  //
+    [EECONFIG_SLOT_RGBLIGHT]       = 1,  //
+    [EECONFIG_SLOT_STENOMODE]      = 1,  //
+    [EECONFIG_SLOT_HANDEDNESS]     = 1,  //
+    [EECONFIG_SLOT_VELOCIKEY]      = 1,  //
+    [EECONFIG_SLOT_HAPTIC]         = 1,  //
+    [EECONFIG_SLOT_MATRIX]         = 1,  //
+};
+
+#    ifdef EECONFIG_LAZY_SYNC
+/* Lazy validation state. A slot whose bit is set has been checked against the
+ * compiled version this power cycle and needs no further EEPROM traffic. The
+ * cursor walks the remaining slots from eeconfig_lazy_task(), one per pass, so
+ * boot touches only the magic word and the blocks the init path actually
+ * reads; everything else is repaired in the background. */
+static uint16_t eeconfig_slot_valid;
+static uint8_t  eeconfig_sync_cursor = EECONFIG_SLOT_COUNT;
+
+/* RAM copy of the magic word, so the per-feature eeconfig_is_enabled() checks
+ * during init cost one EEPROM read between them instead of one each */
+static uint16_t eeconfig_magic_cache;
+static bool     eeconfig_magic_cached = false;
+
+static void eeconfig_lazy_invalidate(void) {
+    eeconfig_slot_valid   = 0;
+    eeconfig_sync_cursor  = EECONFIG_SLOT_COUNT;
+    eeconfig_magic_cached = false;
+}
+
+static uint16_t eeconfig_magic_read(void) {
+    if (!eeconfig_magic_cached) {
+        eeconfig_magic_cache  = eeconfig_read_word(EECONFIG_MAGIC);
+        eeconfig_magic_cached = true;
+    }
+    return eeconfig_magic_cache;
+}
+#    endif  // EECONFIG_LAZY_SYNC
+
+// Write one feature block's defaults; mirrors the full init in
+// eeconfig_init_quantum()
+static void eeconfig_init_feature(uint8_t slot) {
+    switch (slot) {
+        case EECONFIG_SLOT_DEBUG:
+            eeconfig_update_byte(EECONFIG_DEBUG, 0);
+            break;
+        case EECONFIG_SLOT_DEFAULT_LAYER:
+            eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, 0);
+            default_layer_state = 0;
+            break;
+        case EECONFIG_SLOT_KEYMAP:
+            eeconfig_update_byte(EECONFIG_KEYMAP_LOWER_BYTE, 0);
+            eeconfig_update_byte(EECONFIG_KEYMAP_UPPER_BYTE, 0);
+            break;
+        case EECONFIG_SLOT_MOUSEKEY_ACCEL:
+            eeconfig_update_byte(EECONFIG_MOUSEKEY_ACCEL, 0);
+            break;
+        case EECONFIG_SLOT_BACKLIGHT:
+            eeconfig_update_byte(EECONFIG_BACKLIGHT, 0);
+            break;
+        case EECONFIG_SLOT_AUDIO:
+            eeconfig_update_byte(EECONFIG_AUDIO, 0xFF);  // On by default
+            break;
+        case EECONFIG_SLOT_RGBLIGHT:
+            eeconfig_update_dword(EECONFIG_RGBLIGHT, 0);
+            break;
+        case EECONFIG_SLOT_STENOMODE:
+            eeconfig_update_byte(EECONFIG_STENOMODE, 0);
+            break;
+        case EECONFIG_SLOT_HANDEDNESS:
+            // TODO: Remove once ARM has a way to configure EECONFIG_HANDEDNESS
+            //        within the emulated eeprom via dfu-util or another tool
+#    if defined INIT_EE_HANDS_LEFT
+#        pragma message "Faking EE_HANDS for left hand"
+            eeconfig_update_byte(EECONFIG_HANDEDNESS, 1);
+#    elif defined INIT_EE_HANDS_RIGHT
+#        pragma message "Faking EE_HANDS for right hand"
+            eeconfig_update_byte(EECONFIG_HANDEDNESS, 0);
+#    endif
+            break;
+        case EECONFIG_SLOT_VELOCIKEY:
+            eeconfig_update_byte(EECONFIG_VELOCIKEY, 0);
+            break;
+        case EECONFIG_SLOT_HAPTIC:
+#    if defined(HAPTIC_ENABLE)
+            haptic_reset();
+#    else
+            // this is used in case haptic is disabled, but we still want sane defaults
+            // in the haptic configuration eeprom. All zero will trigger a haptic_reset
+            // when a haptic-enabled firmware is loaded onto the keyboard.
+            eeconfig_update_dword(EECONFIG_HAPTIC, 0);
+#    endif
+            break;
+        case EECONFIG_SLOT_MATRIX:
+            eeconfig_update_dword(EECONFIG_RGB_MATRIX, 0);
+            eeconfig_update_word(EECONFIG_RGB_MATRIX_EXTENDED, 0);
+            break;
+    }
+}
+
+// Check one slot's stored version and re-initialize its block if stale;
+// cheap once validated (a RAM bitmap test)
+static void eeconfig_validate_slot(uint8_t slot) {
+#    ifdef EECONFIG_LAZY_SYNC
+    if (eeconfig_slot_valid & (1 << slot)) {
+        return;
+    }
+#    endif
+    if (eeconfig_read_byte(EECONFIG_DIRECTORY + slot) != eeconfig_feature_versions[slot]) {
+        eeconfig_init_feature(slot);
+        eeconfig_update_byte(EECONFIG_DIRECTORY + slot, eeconfig_feature_versions[slot]);
+    }
+#    ifdef EECONFIG_LAZY_SYNC
+    eeconfig_slot_valid |= 1 << slot;
+#    endif
+}
+
+void eeconfig_sync(void) {
+#    ifdef EECONFIG_LAZY_SYNC
+    // Defer the directory walk: slots are validated on first access by their
+    // accessors, and eeconfig_lazy_task() sweeps up the rest one per pass
+    eeconfig_sync_cursor = 0;
+#    else
+    for (uint8_t slot = 0; slot < EECONFIG_SLOT_COUNT; slot++) {
+        eeconfig_validate_slot(slot);
+    }
+    eeconfig_flush();
+#    endif
+}
+
+#    ifdef EECONFIG_LAZY_SYNC
+void eeconfig_lazy_task(void) {
+    if (eeconfig_sync_cursor >= EECONFIG_SLOT_COUNT) {
+        return;
+    }
+    eeconfig_validate_slot(eeconfig_sync_cursor++);
+}
+#    endif
+#endif  // EECONFIG_VERSIONED
+
+/* First-access validation hook for the named accessors below; a no-op unless
+ * lazy sync is enabled */
+#if defined(EECONFIG_VERSIONED) && defined(EECONFIG_LAZY_SYNC)
+#    define eeconfig_validate(slot) eeconfig_validate_slot(slot)
+#else
+#    define eeconfig_validate(slot)
+#endif
+
 /*
  * FIXME: needs doc
  */
@@ -49,40 +368,60 @@ void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
-    eeprom_update_byte(EECONFIG_DEBUG, 0);
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, 0);
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_shadow_invalidate();
+#endif
+#ifdef EECONFIG_LAZY_SYNC
+    eeconfig_lazy_invalidate();
+#endif
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+#ifdef EECONFIG_VERSIONED
+    // The erase above cleared the directory, so every feature block reads as
+    // never-initialized: this writes all defaults and stamps the versions.
+    // A reset is rare and must leave every block written before features read
+    // it, so even with lazy sync the whole directory is validated here.
+#    ifdef EECONFIG_LAZY_SYNC
+    for (uint8_t slot = 0; slot < EECONFIG_SLOT_COUNT; slot++) {
+        eeconfig_validate_slot(slot);
+    }
+#    else
+    eeconfig_sync();
+#    endif
+#else
+    eeconfig_update_byte(EECONFIG_DEBUG, 0);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, 0);
     default_layer_state = 0;
-    eeprom_update_byte(EECONFIG_KEYMAP_LOWER_BYTE, 0);
-    eeprom_update_byte(EECONFIG_KEYMAP_UPPER_BYTE, 0);
-    eeprom_update_byte(EECONFIG_MOUSEKEY_ACCEL, 0);
-    eeprom_update_byte(EECONFIG_BACKLIGHT, 0);
-    eeprom_update_byte(EECONFIG_AUDIO, 0xFF);  // On by default
-    eeprom_update_dword(EECONFIG_RGBLIGHT, 0);
-    eeprom_update_byte(EECONFIG_STENOMODE, 0);
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
-    eeprom_update_byte(EECONFIG_VELOCIKEY, 0);
-    eeprom_update_dword(EECONFIG_RGB_MATRIX, 0);
-    eeprom_update_word(EECONFIG_RGB_MATRIX_EXTENDED, 0);
+    eeconfig_update_byte(EECONFIG_KEYMAP_LOWER_BYTE, 0);
+    eeconfig_update_byte(EECONFIG_KEYMAP_UPPER_BYTE, 0);
+    eeconfig_update_byte(EECONFIG_MOUSEKEY_ACCEL, 0);
+    eeconfig_update_byte(EECONFIG_BACKLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_AUDIO, 0xFF);  // On by default
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_STENOMODE, 0);
+    eeconfig_update_dword(EECONFIG_HAPTIC, 0);
+    eeconfig_update_byte(EECONFIG_VELOCIKEY, 0);
+    eeconfig_update_dword(EECONFIG_RGB_MATRIX, 0);
+    eeconfig_update_word(EECONFIG_RGB_MATRIX_EXTENDED, 0);
 
     // TODO: Remove once ARM has a way to configure EECONFIG_HANDEDNESS
     //        within the emulated eeprom via dfu-util or another tool
-#if defined INIT_EE_HANDS_LEFT
-#    pragma message "Faking EE_HANDS for left hand"
-    eeprom_update_byte(EECONFIG_HANDEDNESS, 1);
-#elif defined INIT_EE_HANDS_RIGHT
-#    pragma message "Faking EE_HANDS for right hand"
-    eeprom_update_byte(EECONFIG_HANDEDNESS, 0);
-#endif
+#    if defined INIT_EE_HANDS_LEFT
+#        pragma message "Faking EE_HANDS for left hand"
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, 1);
+#    elif defined INIT_EE_HANDS_RIGHT
+#        pragma message "Faking EE_HANDS for right hand"
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, 0);
+#    endif
 
-#if defined(HAPTIC_ENABLE)
+#    if defined(HAPTIC_ENABLE)
     haptic_reset();
-#else
+#    else
     // this is used in case haptic is disabled, but we still want sane defaults
     // in the haptic configuration eeprom. All zero will trigger a haptic_reset
     // when a haptic-enabled firmware is loaded onto the keyboard.
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
-#endif
+    eeconfig_update_dword(EECONFIG_HAPTIC, 0);
+#    endif
+#endif  // EECONFIG_VERSIONED
 #if defined(VIA_ENABLE)
     // Invalidate VIA eeprom config, and then reset.
     // Just in case if power is lost mid init, this makes sure that it pets
@@ -92,6 +431,9 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+
+    // Persist the defaults right away so a power loss cannot drop them
+    eeconfig_flush();
 }
 
 /** \brief eeconfig initialization
@@ -104,7 +446,13 @@ void eeconfig_init(void) { eeconfig_init_quantum(); }
  *
  * FIXME: needs doc
  */
-void eeconfig_enable(void) { eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER); }
+void eeconfig_enable(void) {
+#ifdef EECONFIG_LAZY_SYNC
+    eeconfig_lazy_invalidate();
+#endif
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_flush();
+}
 
 /** \brief eeconfig disable
  *
@@ -117,7 +465,14 @@ void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_shadow_invalidate();
+#endif
+#ifdef EECONFIG_LAZY_SYNC
+    eeconfig_lazy_invalidate();
+#endif
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    eeconfig_flush();
 }
 
 /** \brief eeconfig is enabled
@@ -125,7 +480,11 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
-    bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+#ifdef EECONFIG_LAZY_SYNC
+    bool is_eeprom_enabled = (eeconfig_magic_read() == EECONFIG_MAGIC_NUMBER);
+#else
+    bool is_eeprom_enabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+#endif
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -139,7 +498,11 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
-    bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+#ifdef EECONFIG_LAZY_SYNC
+    bool is_eeprom_disabled = (eeconfig_magic_read() == EECONFIG_MAGIC_NUMBER_OFF);
+#else
+    bool is_eeprom_disabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+#endif
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -152,89 +515,123 @@ bool eeconfig_is_disabled(void) {
  *
  * FIXME: needs doc
  */
-uint8_t eeconfig_read_debug(void) { return eeprom_read_byte(EECONFIG_DEBUG); }
+uint8_t eeconfig_read_debug(void) {
+    eeconfig_validate(EECONFIG_SLOT_DEBUG);
+    return eeconfig_read_byte(EECONFIG_DEBUG);
+}
 /** \brief eeconfig update debug
  *
  * FIXME: needs doc
  */
-void eeconfig_update_debug(uint8_t val) { eeprom_update_byte(EECONFIG_DEBUG, val); }
+void eeconfig_update_debug(uint8_t val) {
+    eeconfig_validate(EECONFIG_SLOT_DEBUG);
+    eeconfig_update_byte(EECONFIG_DEBUG, val);
+}
 
 /** \brief eeconfig read default layer
  *
  * FIXME: needs doc
  */
-uint8_t eeconfig_read_default_layer(void) { return eeprom_read_byte(EECONFIG_DEFAULT_LAYER); }
+uint8_t eeconfig_read_default_layer(void) {
+    eeconfig_validate(EECONFIG_SLOT_DEFAULT_LAYER);
+    return eeconfig_read_byte(EECONFIG_DEFAULT_LAYER);
+}
 /** \brief eeconfig update default layer
  *
  * FIXME: needs doc
  */
-void eeconfig_update_default_layer(uint8_t val) { eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val); }
+void eeconfig_update_default_layer(uint8_t val) {
+    eeconfig_validate(EECONFIG_SLOT_DEFAULT_LAYER);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, val);
+}
 
 /** \brief eeconfig read keymap
  *
  * FIXME: needs doc
  */
-uint16_t eeconfig_read_keymap(void) { return (eeprom_read_byte(EECONFIG_KEYMAP_LOWER_BYTE) | (eeprom_read_byte(EECONFIG_KEYMAP_UPPER_BYTE) << 8)); }
+uint16_t eeconfig_read_keymap(void) {
+    eeconfig_validate(EECONFIG_SLOT_KEYMAP);
+    return (eeconfig_read_byte(EECONFIG_KEYMAP_LOWER_BYTE) | (eeconfig_read_byte(EECONFIG_KEYMAP_UPPER_BYTE) << 8));
+}
 /** \brief eeconfig update keymap
  *
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
-    eeprom_update_byte(EECONFIG_KEYMAP_LOWER_BYTE, val & 0xFF);
-    eeprom_update_byte(EECONFIG_KEYMAP_UPPER_BYTE, (val >> 8) & 0xFF);
+    eeconfig_validate(EECONFIG_SLOT_KEYMAP);
+    eeconfig_update_byte(EECONFIG_KEYMAP_LOWER_BYTE, val & 0xFF);
+    eeconfig_update_byte(EECONFIG_KEYMAP_UPPER_BYTE, (val >> 8) & 0xFF);
 }
 
 /** \brief eeconfig read audio
  *
  * FIXME: needs doc
  */
-uint8_t eeconfig_read_audio(void) { return eeprom_read_byte(EECONFIG_AUDIO); }
+uint8_t eeconfig_read_audio(void) {
+    eeconfig_validate(EECONFIG_SLOT_AUDIO);
+    return eeconfig_read_byte(EECONFIG_AUDIO);
+}
 /** \brief eeconfig update audio
  *
  * FIXME: needs doc
  */
-void eeconfig_update_audio(uint8_t val) { eeprom_update_byte(EECONFIG_AUDIO, val); }
+void eeconfig_update_audio(uint8_t val) {
+    eeconfig_validate(EECONFIG_SLOT_AUDIO);
+    eeconfig_update_byte(EECONFIG_AUDIO, val);
+}
 
 /** \brief eeconfig read kb
  *
  * FIXME: needs doc
  */
-uint32_t eeconfig_read_kb(void) { return eeprom_read_dword(EECONFIG_KEYBOARD); }
+uint32_t eeconfig_read_kb(void) { return eeconfig_read_dword(EECONFIG_KEYBOARD); }
 /** \brief eeconfig update kb
  *
  * FIXME: needs doc
  */
-void eeconfig_update_kb(uint32_t val) { eeprom_update_dword(EECONFIG_KEYBOARD, val); }
+void eeconfig_update_kb(uint32_t val) { eeconfig_update_dword(EECONFIG_KEYBOARD, val); }
 
 /** \brief eeconfig read user
  *
  * FIXME: needs doc
  */
-uint32_t eeconfig_read_user(void) { return eeprom_read_dword(EECONFIG_USER); }
+uint32_t eeconfig_read_user(void) { return eeconfig_read_dword(EECONFIG_USER); }
 /** \brief eeconfig update user
  *
  * FIXME: needs doc
  */
-void eeconfig_update_user(uint32_t val) { eeprom_update_dword(EECONFIG_USER, val); }
+void eeconfig_update_user(uint32_t val) { eeconfig_update_dword(EECONFIG_USER, val); }
 
 /** \brief eeconfig read haptic
  *
  * FIXME: needs doc
  */
-uint32_t eeconfig_read_haptic(void) { return eeprom_read_dword(EECONFIG_HAPTIC); }
+uint32_t eeconfig_read_haptic(void) {
+    eeconfig_validate(EECONFIG_SLOT_HAPTIC);
+    return eeconfig_read_dword(EECONFIG_HAPTIC);
+}
 /** \brief eeconfig update haptic
  *
  * FIXME: needs doc
  */
-void eeconfig_update_haptic(uint32_t val) { eeprom_update_dword(EECONFIG_HAPTIC, val); }
+void eeconfig_update_haptic(uint32_t val) {
+    eeconfig_validate(EECONFIG_SLOT_HAPTIC);
+    eeconfig_update_dword(EECONFIG_HAPTIC, val);
+}
 
 /** \brief eeconfig read split handedness
  *
  * FIXME: needs doc
  */
-bool eeconfig_read_handedness(void) { return !!eeprom_read_byte(EECONFIG_HANDEDNESS); }
+bool eeconfig_read_handedness(void) {
+    eeconfig_validate(EECONFIG_SLOT_HANDEDNESS);
+    return !!eeconfig_read_byte(EECONFIG_HANDEDNESS);
+}
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
-void eeconfig_update_handedness(bool val) { eeprom_update_byte(EECONFIG_HANDEDNESS, !!val); }
+void eeconfig_update_handedness(bool val) {
+    eeconfig_validate(EECONFIG_SLOT_HANDEDNESS);
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, !!val);
+}
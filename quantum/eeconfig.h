@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "eeprom.h"
 
 #ifndef EECONFIG_MAGIC_NUMBER
 #    define EECONFIG_MAGIC_NUMBER (uint16_t)0xFEE9  // When changing, decrement this value to avoid future re-init issues
@@ -53,8 +54,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 // TODO: Combine these into a single word and single block of EEPROM
 #define EECONFIG_KEYMAP_UPPER_BYTE (uint8_t *)34
+#ifdef EECONFIG_VERSIONED
+// Per-feature format version directory, one byte per feature slot.
+// Spare bytes are left for future slots so appending one does not move
+// anything stored behind the eeconfig block.
+#    define EECONFIG_DIRECTORY (uint8_t *)35
+#    define EECONFIG_DIRECTORY_SIZE 16
 // Size of EEPROM being used, other code can refer to this for available EEPROM
-#define EECONFIG_SIZE 35
+#    define EECONFIG_SIZE (35 + EECONFIG_DIRECTORY_SIZE)
+#else
+// Size of EEPROM being used, other code can refer to this for available EEPROM
+#    define EECONFIG_SIZE 35
+#endif
 /* debug bit */
 #define EECONFIG_DEBUG_ENABLE (1 << 0)
 #define EECONFIG_DEBUG_MATRIX (1 << 1)
@@ -73,11 +84,67 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define EECONFIG_KEYMAP_LOWER_BYTE EECONFIG_KEYMAP
 
+/* Accessors for the eeconfig block. With EECONFIG_WRITE_BEHIND enabled,
+ * writes land in a RAM shadow and are committed to EEPROM in one debounced
+ * pass once the settings stop changing; otherwise they go straight through. */
+#ifdef EECONFIG_WRITE_BEHIND
+#    ifndef EECONFIG_COMMIT_DELAY
+#        define EECONFIG_COMMIT_DELAY 500
+#    endif
+
+uint8_t  eeconfig_read_byte(const uint8_t *addr);
+uint16_t eeconfig_read_word(const uint16_t *addr);
+uint32_t eeconfig_read_dword(const uint32_t *addr);
+void     eeconfig_read_block(void *buf, const void *addr, size_t len);
+void     eeconfig_update_byte(uint8_t *addr, uint8_t value);
+void     eeconfig_update_word(uint16_t *addr, uint16_t value);
+void     eeconfig_update_dword(uint32_t *addr, uint32_t value);
+void     eeconfig_update_block(const void *buf, void *addr, size_t len);
+
+// Commit any pending shadow writes to EEPROM now
+void eeconfig_flush(void);
+// Debounced commit, called from keyboard_task()
+void eeconfig_task(void);
+#else
+#    define eeconfig_read_byte(addr) eeprom_read_byte(addr)
+#    define eeconfig_read_word(addr) eeprom_read_word(addr)
+#    define eeconfig_read_dword(addr) eeprom_read_dword(addr)
+#    define eeconfig_read_block(buf, addr, len) eeprom_read_block(buf, addr, len)
+#    define eeconfig_update_byte(addr, value) eeprom_update_byte(addr, value)
+#    define eeconfig_update_word(addr, value) eeprom_update_word(addr, value)
+#    define eeconfig_update_dword(addr, value) eeprom_update_dword(addr, value)
+#    define eeconfig_update_block(buf, addr, len) eeprom_update_block(buf, addr, len)
+#    define eeconfig_flush() \
+        do {                 \
+        } while (0)
+#endif
+
 bool eeconfig_is_enabled(void);
 bool eeconfig_is_disabled(void);
 
 void eeconfig_init(void);
 void eeconfig_init_quantum(void);
+
+#ifdef EECONFIG_VERSIONED
+/* Re-initialize only the feature blocks whose stored format version differs
+ * from the compiled one (see eeconfig_feature_versions[] in eeconfig.c).
+ * Called on boot when the magic already matches, so a firmware update that
+ * changes one feature's stored format no longer wipes every other setting
+ * or the dynamic keymap area behind the eeconfig block. */
+void eeconfig_sync(void);
+#endif
+#ifdef EECONFIG_LAZY_SYNC
+#    ifndef EECONFIG_VERSIONED
+#        error EECONFIG_LAZY_SYNC requires EECONFIG_VERSIONED
+#    endif
+/* With EECONFIG_LAZY_SYNC, boot checks only the magic word (cached in RAM so
+ * the per-feature eeconfig_is_enabled() calls during init cost one EEPROM
+ * read between them). Each feature block is validated against the version
+ * directory on its first access; blocks nothing touched yet are swept one
+ * per pass from keyboard_task(). Worthwhile on external I2C EEPROMs, where
+ * every boot-time transaction delays first-keystroke readiness. */
+void eeconfig_lazy_task(void);
+#endif
 void eeconfig_init_kb(void);
 void eeconfig_init_user(void);
 
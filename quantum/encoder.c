@@ -23,6 +23,21 @@
 // for memcpy
 #include <string.h>
 
+#ifdef ENCODER_INTERRUPT_DRIVEN
+#    if !defined(__AVR__)
+#        error "ENCODER_INTERRUPT_DRIVEN is currently only supported on AVR"
+#    endif
+#    include "atomic_util.h"
+#    ifdef PIN_CHANGE_NOTIFY_ENABLE
+#        include "pin_change.h"
+#    else
+#        include <avr/interrupt.h>
+#        if !defined(PCMSK0)
+#            error "ENCODER_INTERRUPT_DRIVEN requires pin-change interrupt support (PCINT0)"
+#        endif
+#    endif
+#endif
+
 #if !defined(ENCODER_RESOLUTIONS) && !defined(ENCODER_RESOLUTION)
 #    define ENCODER_RESOLUTION 4
 #endif
@@ -34,6 +49,11 @@
 #define NUMBER_OF_ENCODERS (sizeof(encoders_pad_a) / sizeof(pin_t))
 static pin_t encoders_pad_a[] = ENCODERS_PAD_A;
 static pin_t encoders_pad_b[] = ENCODERS_PAD_B;
+// pre-resolved pad handles: the quadrature sampler runs on every scan (or
+// in the pin-change ISR), so the port address and bit mask are computed
+// once in encoder_init() instead of on every read
+static pin_fast_t encoders_pad_a_fast[NUMBER_OF_ENCODERS];
+static pin_fast_t encoders_pad_b_fast[NUMBER_OF_ENCODERS];
 #ifdef ENCODER_RESOLUTIONS
 static uint8_t encoder_resolutions[] = ENCODER_RESOLUTIONS;
 #endif
@@ -47,8 +67,14 @@ static uint8_t encoder_resolutions[] = ENCODER_RESOLUTIONS;
 #endif
 static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
 
-static uint8_t encoder_state[NUMBER_OF_ENCODERS]  = {0};
-static int8_t  encoder_pulses[NUMBER_OF_ENCODERS] = {0};
+static uint8_t encoder_state[NUMBER_OF_ENCODERS] = {0};
+#ifdef ENCODER_INTERRUPT_DRIVEN
+// written from the pin-change ISR, drained by encoder_read()
+static volatile int8_t encoder_pulses[NUMBER_OF_ENCODERS] = {0};
+static void            encoder_interrupt_decode(void);
+#else
+static int8_t encoder_pulses[NUMBER_OF_ENCODERS] = {0};
+#endif
 
 #ifdef SPLIT_KEYBOARD
 // right half encoders come over as second set of encoders
@@ -59,6 +85,47 @@ static uint8_t thisHand, thatHand;
 static uint8_t encoder_value[NUMBER_OF_ENCODERS] = {0};
 #endif
 
+#ifdef ENCODER_VELOCITY
+#    ifndef ENCODER_VELOCITY_INTERVAL_MS
+#        define ENCODER_VELOCITY_INTERVAL_MS 50
+#    endif
+#    ifndef ENCODER_VELOCITY_CURVE
+#        define ENCODER_VELOCITY_CURVE \
+            { 1, 1, 2, 4, 6, 8 }
+#    endif
+// multiplier per detents-seen-this-interval, clamped to the last entry
+static const uint8_t encoder_velocity_curve[] = ENCODER_VELOCITY_CURVE;
+#    define ENCODER_VELOCITY_CURVE_MAX (sizeof(encoder_velocity_curve) - 1)
+#    ifdef SPLIT_KEYBOARD
+static uint8_t  encoder_ticks[NUMBER_OF_ENCODERS * 2]          = {0};
+static uint16_t encoder_velocity_timer[NUMBER_OF_ENCODERS * 2] = {0};
+#    else
+static uint8_t  encoder_ticks[NUMBER_OF_ENCODERS]          = {0};
+static uint16_t encoder_velocity_timer[NUMBER_OF_ENCODERS] = {0};
+#    endif
+
+/* Called once per detent from the scan loop, before the callbacks, so
+ * encoder_velocity() already reflects the detent being delivered. */
+static void encoder_velocity_tick(uint8_t index) {
+    if (timer_elapsed(encoder_velocity_timer[index]) > ENCODER_VELOCITY_INTERVAL_MS) {
+        encoder_velocity_timer[index] = timer_read();
+        encoder_ticks[index]          = 0;
+    }
+    if (encoder_ticks[index] < ENCODER_VELOCITY_CURVE_MAX) {
+        encoder_ticks[index]++;
+    }
+}
+
+uint8_t encoder_velocity(uint8_t index) {
+    if (timer_elapsed(encoder_velocity_timer[index]) > ENCODER_VELOCITY_INTERVAL_MS) {
+        return encoder_velocity_curve[0];
+    }
+    return encoder_velocity_curve[encoder_ticks[index]];
+}
+#else
+#    define encoder_velocity_tick(index)
+#endif
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) { return true; }
 
 __attribute__((weak)) bool encoder_update_kb(uint8_t index, bool clockwise) { return encoder_update_user(index, clockwise); }
@@ -85,15 +152,99 @@ void encoder_init(void) {
         setPinInputHigh(encoders_pad_a[i]);
         setPinInputHigh(encoders_pad_b[i]);
 
-        encoder_state[i] = (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
+        encoders_pad_a_fast[i] = pinFastResolve(encoders_pad_a[i]);
+        encoders_pad_b_fast[i] = pinFastResolve(encoders_pad_b[i]);
+
+        encoder_state[i] = (readPinFast(encoders_pad_a_fast[i]) << 0) | (readPinFast(encoders_pad_b_fast[i]) << 1);
     }
 
 #ifdef SPLIT_KEYBOARD
     thisHand = isLeftHand ? 0 : NUMBER_OF_ENCODERS;
     thatHand = NUMBER_OF_ENCODERS - thisHand;
 #endif
+
+#ifdef ENCODER_INTERRUPT_DRIVEN
+    // Pads must sit on the PCINT0 bank (port B on the ATmega32U4 family) to
+    // raise pin-change interrupts; the decode itself reads every encoder.
+#    ifdef PIN_CHANGE_NOTIFY_ENABLE
+    for (uint8_t i = 0; i < NUMBER_OF_ENCODERS; i++) {
+        pin_change_register(encoders_pad_a[i], encoder_interrupt_decode);
+        pin_change_register(encoders_pad_b[i], encoder_interrupt_decode);
+    }
+#    else
+    for (uint8_t i = 0; i < NUMBER_OF_ENCODERS; i++) {
+        if ((encoders_pad_a[i] >> PORT_SHIFTER) == PINB_ADDRESS) {
+            PCMSK0 |= _BV(encoders_pad_a[i] & 0xF);
+        }
+        if ((encoders_pad_b[i] >> PORT_SHIFTER) == PINB_ADDRESS) {
+            PCMSK0 |= _BV(encoders_pad_b[i] & 0xF);
+        }
+    }
+    PCICR |= _BV(PCIE0);
+#    endif
+#endif
 }
 
+#ifdef ENCODER_INTERRUPT_DRIVEN
+/* Quadrature decode runs in the pin-change ISR, so no transition is lost
+ * while the main loop is busy elsewhere. Only the pulse accumulator is
+ * updated here; detent handling and the encoder_update_kb() callbacks stay
+ * in encoder_read() because they can emit keycodes. */
+// Also safe to run when nothing moved: resampling the same pin state shifts
+// in a duplicate reading, which the LUT counts as zero pulses.
+static void encoder_interrupt_decode(void) {
+    for (uint8_t i = 0; i < NUMBER_OF_ENCODERS; i++) {
+        encoder_state[i] <<= 2;
+        encoder_state[i] |= (readPinFast(encoders_pad_a_fast[i]) << 0) | (readPinFast(encoders_pad_b_fast[i]) << 1);
+        encoder_pulses[i] += encoder_LUT[encoder_state[i] & 0xF];
+#    ifdef ENCODER_DEFAULT_POS
+        if ((encoder_state[i] & 0x3) == ENCODER_DEFAULT_POS) {
+            encoder_pulses[i] = 0;
+        }
+#    endif
+    }
+}
+
+#    ifndef PIN_CHANGE_NOTIFY_ENABLE
+ISR(PCINT0_vect) { encoder_interrupt_decode(); }
+#    endif
+
+bool encoder_read(void) {
+    bool changed = false;
+    for (uint8_t i = 0; i < NUMBER_OF_ENCODERS; i++) {
+#    ifdef ENCODER_RESOLUTIONS
+        uint8_t resolution = encoder_resolutions[i];
+#    else
+        uint8_t resolution = ENCODER_RESOLUTION;
+#    endif
+        uint8_t index = i;
+#    ifdef SPLIT_KEYBOARD
+        index += thisHand;
+#    endif
+        int8_t pulses;
+        ATOMIC_BLOCK_FORCEON {
+            pulses            = encoder_pulses[i];
+            encoder_pulses[i] = pulses % resolution;
+        }
+        while (pulses >= resolution) {
+            pulses -= resolution;
+            encoder_value[index]++;
+            changed = true;
+            encoder_velocity_tick(index);
+            encoder_update_kb(index, ENCODER_COUNTER_CLOCKWISE);
+        }
+        while (pulses <= -resolution) {
+            pulses += resolution;
+            encoder_value[index]--;
+            changed = true;
+            encoder_velocity_tick(index);
+            encoder_update_kb(index, ENCODER_CLOCKWISE);
+        }
+    }
+    return changed;
+}
+#else
+
 static bool encoder_update(uint8_t index, uint8_t state) {
     bool    changed = false;
     uint8_t i       = index;
@@ -111,11 +262,13 @@ static bool encoder_update(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] >= resolution) {
         encoder_value[index]++;
         changed = true;
+        encoder_velocity_tick(index);
         encoder_update_kb(index, ENCODER_COUNTER_CLOCKWISE);
     }
     if (encoder_pulses[i] <= -resolution) {  // direction is arbitrary here, but this clockwise
         encoder_value[index]--;
         changed = true;
+        encoder_velocity_tick(index);
         encoder_update_kb(index, ENCODER_CLOCKWISE);
     }
     encoder_pulses[i] %= resolution;
@@ -131,11 +284,12 @@ bool encoder_read(void) {
     bool changed = false;
     for (uint8_t i = 0; i < NUMBER_OF_ENCODERS; i++) {
         encoder_state[i] <<= 2;
-        encoder_state[i] |= (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
+        encoder_state[i] |= (readPinFast(encoders_pad_a_fast[i]) << 0) | (readPinFast(encoders_pad_b_fast[i]) << 1);
         changed |= encoder_update(i, encoder_state[i]);
     }
     return changed;
 }
+#endif  // ENCODER_INTERRUPT_DRIVEN
 
 #ifdef SPLIT_KEYBOARD
 void last_encoder_activity_trigger(void);
@@ -151,12 +305,14 @@ void encoder_update_raw(uint8_t* slave_state) {
             delta--;
             encoder_value[index]++;
             changed = true;
+            encoder_velocity_tick(index);
             encoder_update_kb(index, ENCODER_COUNTER_CLOCKWISE);
         }
         while (delta < 0) {
             delta++;
             encoder_value[index]--;
             changed = true;
+            encoder_velocity_tick(index);
             encoder_update_kb(index, ENCODER_CLOCKWISE);
         }
     }
@@ -288,6 +288,15 @@ void haptic_play(void) {
 #endif
 }
 
+#if defined(DRV2605L) && defined(DRV2605L_PATTERN_SLOTS)
+void haptic_play_pattern(uint8_t slot) {
+    DRV_pulse_pattern(slot);
+#    ifdef SOLENOID_ENABLE
+    solenoid_fire();
+#    endif
+}
+#endif
+
 void haptic_shutdown(void) {
 #ifdef SOLENOID_ENABLE
     solenoid_shutdown();
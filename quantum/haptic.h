@@ -74,4 +74,7 @@ void    haptic_cont_increase(void);
 void    haptic_cont_decrease(void);
 
 void haptic_play(void);
+#if defined(DRV2605L) && defined(DRV2605L_PATTERN_SLOTS)
+void haptic_play_pattern(uint8_t slot);
+#endif
 void haptic_shutdown(void);
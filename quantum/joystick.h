@@ -20,6 +20,12 @@
 
 #define JOYSTICK_RESOLUTION ((1L << (JOYSTICK_AXES_RESOLUTION - 1)) - 1)
 
+// number of ADC conversions averaged per axis update when
+// JOYSTICK_ROUND_ROBIN is enabled
+#ifndef JOYSTICK_OVERSAMPLE
+#    define JOYSTICK_OVERSAMPLE 4
+#endif
+
 // configure on input_pin of the joystick_axes array entry to JS_VIRTUAL_AXIS
 // to prevent it from being read from the ADC. This allows outputing forged axis value.
 //
@@ -31,6 +31,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
+#include "trace_probe.h"
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -109,6 +111,45 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
 #endif
+#if defined(EEPROM_TRANSIENT) && defined(TRANSIENT_EEPROM_SYNC)
+#    include "eeprom_transient.h"
+#endif
+#if defined(RAW_ENABLE) && defined(RAW_HID_DEFERRED)
+#    include "raw_hid.h"
+#endif
+#ifdef SEND_STRING_STREAMING
+#    include "send_string.h"
+#endif
+#ifdef SUSPEND_FAST_WAKEUP
+#    include "suspend.h"
+#endif
+#ifdef RADIO_LINK_ENABLE
+#    include "radio_link.h"
+#endif
+#ifdef TELEMETRY_ENABLE
+#    include "telemetry.h"
+#endif
+#ifdef LATENCY_TRACE
+#    include "latency_trace.h"
+#endif
+#ifdef WATCHDOG_ENABLE
+#    include "watchdog.h"
+#else
+#    define watchdog_mark(subsystem)
+#    define watchdog_feed()
+#endif
+#ifdef KEYEVENT_QUEUE_ENABLE
+#    include "keyevent_queue.h"
+#endif
+#include "perf_counter.h"
+#ifdef TASK_EXECUTOR_ENABLE
+#    include "task_executor.h"
+static void task_executor_subsystems_init(void);
+#endif
+
+// Fallback for fully custom matrix implementations that don't latch a
+// timestamp during their scan; the standard engines provide a real one.
+__attribute__((weak)) uint16_t matrix_get_scan_timestamp(void) { return timer_read(); }
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) { return last_input_modification_time; }
@@ -124,6 +165,99 @@ uint32_t        last_encoder_activity_time(void) { return last_encoder_modificat
 uint32_t        last_encoder_activity_elapsed(void) { return timer_elapsed32(last_encoder_modification_time); }
 void            last_encoder_activity_trigger(void) { last_encoder_modification_time = last_input_modification_time = timer_read32(); }
 
+#ifdef MATRIX_SCAN_GOVERNOR
+// Adaptive scan-rate governor: once there has been no input activity for
+// MATRIX_SCAN_GOVERNOR_IDLE_MS, keyboard_task() is rate-limited to one full
+// pass every MATRIX_SCAN_GOVERNOR_INTERVAL_MS instead of free-running. Any
+// input activity returns the scan loop to full speed immediately.
+#    ifndef MATRIX_SCAN_GOVERNOR_IDLE_MS
+#        define MATRIX_SCAN_GOVERNOR_IDLE_MS 500
+#    endif
+#    ifndef MATRIX_SCAN_GOVERNOR_INTERVAL_MS
+#        define MATRIX_SCAN_GOVERNOR_INTERVAL_MS 8
+#    endif
+
+static uint16_t last_throttled_scan_time = 0;
+
+static bool keyboard_task_throttled(void) {
+    if (last_input_activity_elapsed() < MATRIX_SCAN_GOVERNOR_IDLE_MS) {
+        return false;
+    }
+    if (timer_elapsed(last_throttled_scan_time) < MATRIX_SCAN_GOVERNOR_INTERVAL_MS) {
+        return true;
+    }
+    last_throttled_scan_time = timer_read();
+    return false;
+}
+#endif
+
+#if defined(MATRIX_SCAN_PROFILER) || defined(RGB_MATRIX_FLUSH_STATS) || defined(PERF_COUNTER_ENABLE) || defined(TASK_EXECUTOR_ENABLE)
+__attribute__((weak)) uint32_t scan_profile_timer_read_us(void) { return timer_read32() * 1000; }
+#endif
+
+#ifdef MATRIX_SCAN_PROFILER
+// Structured scan-time instrumentation: per-probe min/avg/max durations are
+// accumulated over one-second windows, printed on the console and kept
+// available through scan_profile_get() for raw HID query handlers.
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint32_t samples;
+} scan_profile_accum_t;
+
+static scan_profile_accum_t scan_profile_accum[SCAN_PROFILE_COUNT];
+static scan_profile_stats_t scan_profile_window[SCAN_PROFILE_COUNT];
+static uint32_t             scan_profile_window_timer = 0;
+
+static const char *scan_profile_names[SCAN_PROFILE_COUNT] = {"matrix", "debounce", "lighting", "oled", "encoder"};
+
+void scan_profile_sample(uint8_t probe, uint32_t duration_us) {
+    scan_profile_accum_t *accum = &scan_profile_accum[probe];
+    if (accum->samples == 0 || duration_us < accum->min) accum->min = duration_us;
+    if (duration_us > accum->max) accum->max = duration_us;
+    accum->sum += duration_us;
+    accum->samples++;
+}
+
+bool scan_profile_get(uint8_t probe, scan_profile_stats_t *stats) {
+    if (probe >= SCAN_PROFILE_COUNT) {
+        return false;
+    }
+    *stats = scan_profile_window[probe];
+    return true;
+}
+
+static void scan_profile_task(void) {
+    if (timer_elapsed32(scan_profile_window_timer) < 1000) {
+        return;
+    }
+    scan_profile_window_timer = timer_read32();
+    for (uint8_t i = 0; i < SCAN_PROFILE_COUNT; i++) {
+        scan_profile_accum_t *accum  = &scan_profile_accum[i];
+        scan_profile_stats_t *window = &scan_profile_window[i];
+        window->min                  = accum->min;
+        window->max                  = accum->max;
+        window->avg                  = accum->samples ? (accum->sum / accum->samples) : 0;
+        window->samples              = accum->samples;
+        if (accum->samples) {
+            dprintf("scan_profile %s: min %lu avg %lu max %lu us (%lu samples)\n", scan_profile_names[i], window->min, window->avg, window->max, window->samples);
+        }
+        accum->min = accum->max = accum->sum = accum->samples = 0;
+    }
+}
+
+#    define SCAN_PROFILE_CALL(probe, call)                                      \
+        do {                                                                    \
+            uint32_t _probe_start = scan_profile_timer_read_us();               \
+            call;                                                               \
+            scan_profile_sample(probe, scan_profile_timer_read_us() - _probe_start); \
+        } while (0)
+#else
+#    define SCAN_PROFILE_CALL(probe, call) call
+#    define scan_profile_task()
+#endif
+
 // Only enable this if console is enabled to print to
 #if defined(DEBUG_MATRIX_SCAN_RATE)
 static uint32_t matrix_timer           = 0;
@@ -150,17 +284,29 @@ uint32_t get_matrix_scan_rate(void) { return last_matrix_scan_count; }
 #endif
 
 #ifdef MATRIX_HAS_GHOST
+#    ifndef KEYMAP_COMPACT
 extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
-static matrix_row_t   get_real_keys(uint8_t row, matrix_row_t rowdata) {
-    matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (pgm_read_byte(&keymaps[0][row][col]) && (rowdata & (1 << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
-            out |= 1 << col;
+#    endif
+
+// Per-row mask of the columns holding a real (non-KC_NO) key in the base
+// keymap. The keymap is constant, so this is cached once at init rather
+// than re-read from flash for every row comparison each scan.
+static matrix_row_t ghost_real_key_mask[MATRIX_ROWS];
+
+static void ghost_mask_init(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t out = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+#ifdef KEYMAP_COMPACT
+            if (keymap_key_to_keycode(0, (keypos_t){.row = row, .col = col}) != KC_NO) {
+#else
+            if (pgm_read_byte(&keymaps[0][row][col])) {
+#endif
+                out |= (matrix_row_t)1 << col;
+            }
         }
+        ghost_real_key_mask[row] = out;
     }
-    return out;
 }
 
 static inline bool popcount_more_than_one(matrix_row_t rowdata) {
@@ -173,7 +319,7 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
     If there are "active" blanks in the matrix, the key can't be pressed by the user,
     there is no doubt as to which keys are really being pressed.
     The ghosts will be ignored, they are KC_NO.   */
-    rowdata = get_real_keys(row, rowdata);
+    rowdata &= ghost_real_key_mask[row];
     if ((popcount_more_than_one(rowdata)) == 0) {
         return false;
     }
@@ -185,7 +331,7 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
     we are checking one row at a time, not all of them at once.
     */
     for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
-        if (i != row && popcount_more_than_one(get_real_keys(i, matrix_get_row(i)) & rowdata)) {
+        if (i != row && popcount_more_than_one(matrix_get_row(i) & ghost_real_key_mask[i] & rowdata)) {
             return true;
         }
     }
@@ -279,6 +425,31 @@ __attribute__((weak)) bool is_keyboard_left(void) { return true; }
  */
 __attribute__((weak)) bool should_process_keypress(void) { return is_keyboard_master(); }
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_MATRIX_TIMESTAMP)
+
+#    include "transactions.h"
+
+extern uint8_t thatHand;
+
+/** \brief keyevent_timestamp
+ *
+ * Events from the slave half are stamped with the slave's own commit time in
+ * the synchronized timer domain, so their timing does not pick up transport
+ * latency or poll phase jitter.
+ */
+static uint16_t keyevent_timestamp(uint8_t row) {
+    if (is_keyboard_master() && row >= thatHand && row < thatHand + (MATRIX_ROWS) / 2) {
+        return split_slave_scan_timestamp();
+    }
+    return matrix_get_scan_timestamp();
+}
+
+#else
+
+#    define keyevent_timestamp(row) matrix_get_scan_timestamp()
+
+#endif  // defined(SPLIT_KEYBOARD) && defined(SPLIT_MATRIX_TIMESTAMP)
+
 /** \brief housekeeping_task_kb
  *
  * Override this function if you have a need to execute code for every keyboard main loop iteration.
@@ -302,6 +473,104 @@ void housekeeping_task(void) {
     housekeeping_task_user();
 }
 
+/* Cosmetic subsystems grouped into named init stages. With
+ * KEYBOARD_INIT_STAGED defined, keyboard_init() brings up only the input
+ * path (matrix, mice, encoders) and these stages run one per scan pass from
+ * keyboard_task(), so the first keystroke does not wait behind display and
+ * lighting bring-up. Without it, keyboard_init() runs them inline at their
+ * original positions. KEYBOARD_INIT_PROFILE additionally records each
+ * stage's duration and prints the timings on the console shortly after
+ * boot, once the host has had a chance to attach. */
+enum keyboard_init_stages {
+    KEYBOARD_INIT_STAGE_DISPLAYS = 0,
+    KEYBOARD_INIT_STAGE_LIGHTING,
+#ifdef KEYBOARD_INIT_STAGED
+    KEYBOARD_INIT_STAGE_QUANTUM,
+#endif
+    KEYBOARD_INIT_STAGE_POST,
+    KEYBOARD_INIT_STAGE_COUNT
+};
+
+#ifdef KEYBOARD_INIT_PROFILE
+#    ifndef KEYBOARD_INIT_PROFILE_DELAY
+#        define KEYBOARD_INIT_PROFILE_DELAY 3000
+#    endif
+static uint16_t init_profile_stage_time[KEYBOARD_INIT_STAGE_COUNT];
+static uint16_t init_profile_core_time;  // keyboard_init() itself
+static bool     init_profile_printed = false;
+#endif
+
+#ifdef KEYBOARD_INIT_STAGED
+static uint8_t keyboard_init_stage_pending = 0;
+#endif
+
+static void keyboard_init_stage(uint8_t stage) {
+#ifdef KEYBOARD_INIT_PROFILE
+    uint16_t start = timer_read();
+#endif
+    switch (stage) {
+        case KEYBOARD_INIT_STAGE_DISPLAYS:
+#ifdef QWIIC_ENABLE
+            qwiic_init();
+#endif
+#ifdef OLED_ENABLE
+            oled_init(OLED_ROTATION_0);
+#endif
+#ifdef ST7565_ENABLE
+            st7565_init(DISPLAY_ROTATION_0);
+#endif
+            break;
+        case KEYBOARD_INIT_STAGE_LIGHTING:
+#ifdef BACKLIGHT_ENABLE
+            backlight_init();
+#endif
+#ifdef RGBLIGHT_ENABLE
+            rgblight_init();
+#endif
+            break;
+#ifdef KEYBOARD_INIT_STAGED
+        case KEYBOARD_INIT_STAGE_QUANTUM:
+            quantum_init_cosmetic();
+            break;
+#endif
+        case KEYBOARD_INIT_STAGE_POST:
+            keyboard_post_init_kb();
+            break;
+    }
+#ifdef KEYBOARD_INIT_PROFILE
+    init_profile_stage_time[stage] = timer_elapsed(start);
+#endif
+}
+
+#ifdef KEYBOARD_INIT_PROFILE
+static const char *init_stage_names[KEYBOARD_INIT_STAGE_COUNT] = {
+    "displays",
+    "lighting",
+#    ifdef KEYBOARD_INIT_STAGED
+    "quantum",
+#    endif
+    "post",
+};
+
+static void init_profile_task(void) {
+    if (init_profile_printed || timer_read32() < KEYBOARD_INIT_PROFILE_DELAY) {
+        return;
+    }
+#    ifdef KEYBOARD_INIT_STAGED
+    if (keyboard_init_stage_pending < KEYBOARD_INIT_STAGE_COUNT) {
+        return;
+    }
+#    endif
+    init_profile_printed = true;
+    dprintf("init_profile core: %ums\n", init_profile_core_time);
+    for (uint8_t i = 0; i < KEYBOARD_INIT_STAGE_COUNT; i++) {
+        dprintf("init_profile %s: %ums\n", init_stage_names[i], init_profile_stage_time[i]);
+    }
+}
+#else
+#    define init_profile_task()
+#endif
+
 /** \brief keyboard_init
  *
  * FIXME: needs doc
@@ -309,21 +578,22 @@ void housekeeping_task(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+    TRACE_PROBE_INIT();
+#ifdef KEYBOARD_INIT_PROFILE
+    uint16_t init_start = timer_read();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
     matrix_init();
+#ifdef MATRIX_HAS_GHOST
+    ghost_mask_init();
+#endif
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
-#ifdef QWIIC_ENABLE
-    qwiic_init();
-#endif
-#ifdef OLED_ENABLE
-    oled_init(OLED_ROTATION_0);
-#endif
-#ifdef ST7565_ENABLE
-    st7565_init(DISPLAY_ROTATION_0);
+#ifndef KEYBOARD_INIT_STAGED
+    keyboard_init_stage(KEYBOARD_INIT_STAGE_DISPLAYS);
 #endif
 #ifdef PS2_MOUSE_ENABLE
     ps2_mouse_init();
@@ -334,11 +604,8 @@ void keyboard_init(void) {
 #ifdef ADB_MOUSE_ENABLE
     adb_mouse_init();
 #endif
-#ifdef BACKLIGHT_ENABLE
-    backlight_init();
-#endif
-#ifdef RGBLIGHT_ENABLE
-    rgblight_init();
+#ifndef KEYBOARD_INIT_STAGED
+    keyboard_init_stage(KEYBOARD_INIT_STAGE_LIGHTING);
 #endif
 #ifdef ENCODER_ENABLE
     encoder_init();
@@ -361,7 +628,26 @@ void keyboard_init(void) {
     debug_enable = true;
 #endif
 
-    keyboard_post_init_kb(); /* Always keep this last */
+#ifdef TASK_EXECUTOR_ENABLE
+    task_executor_subsystems_init();
+#endif
+
+#ifdef WATCHDOG_ENABLE
+    // attribute a pending watchdog reset, then arm; from here on
+    // keyboard_task() must feed once per pass
+    watchdog_init();
+#endif
+
+#ifdef KEYBOARD_INIT_PROFILE
+    init_profile_core_time = timer_elapsed(init_start);
+#endif
+
+#ifndef KEYBOARD_INIT_STAGED
+    keyboard_init_stage(KEYBOARD_INIT_STAGE_POST); /* Always keep this last */
+#endif
+    // With KEYBOARD_INIT_STAGED, the remaining stages (displays, lighting,
+    // heavy quantum cosmetics, keyboard_post_init_kb) run one per scan pass
+    // from keyboard_task(); the input path is live from here.
 }
 
 /** \brief key_event_task
@@ -378,6 +664,141 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef TASK_EXECUTOR_ENABLE
+/* Cosmetic subsystems routed through the cooperative executor instead of
+ * running unconditionally every pass. The input path (matrix, action
+ * processing, mice, encoders) stays inline in keyboard_task(); lighting
+ * and display tasks only run when due, and get throttled automatically
+ * when they exceed their runtime budget. */
+#    ifndef TASK_EXECUTOR_LIGHTING_INTERVAL_MS
+#        define TASK_EXECUTOR_LIGHTING_INTERVAL_MS 1
+#    endif
+#    ifndef TASK_EXECUTOR_DISPLAY_INTERVAL_MS
+#        define TASK_EXECUTOR_DISPLAY_INTERVAL_MS 5
+#    endif
+#    ifndef TASK_EXECUTOR_LIGHTING_BUDGET_US
+#        define TASK_EXECUTOR_LIGHTING_BUDGET_US 500
+#    endif
+#    ifndef TASK_EXECUTOR_DISPLAY_BUDGET_US
+#        define TASK_EXECUTOR_DISPLAY_BUDGET_US 1000
+#    endif
+
+#    ifdef RGBLIGHT_ENABLE
+static void rgblight_exec_task(void) { SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, rgblight_task()); }
+#    endif
+#    ifdef LED_MATRIX_ENABLE
+static void led_matrix_exec_task(void) { SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, led_matrix_task()); }
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+static void rgb_matrix_exec_task(void) {
+    PERF_COUNT(PERF_RGB_FRAMES);
+    PERF_TIMER_START(PERF_TIMER_RGB_MATRIX);
+    SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, rgb_matrix_task());
+    PERF_TIMER_STOP(PERF_TIMER_RGB_MATRIX);
+}
+#    endif
+#    if defined(BACKLIGHT_ENABLE) && (defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS))
+static void backlight_exec_task(void) { backlight_task(); }
+#    endif
+#    ifdef QWIIC_ENABLE
+static void qwiic_exec_task(void) { qwiic_task(); }
+#    endif
+#    ifdef OLED_ENABLE
+static void oled_exec_task(void) { SCAN_PROFILE_CALL(SCAN_PROFILE_OLED, oled_task()); }
+#    endif
+#    ifdef ST7565_ENABLE
+static void st7565_exec_task(void) { st7565_task(); }
+#    endif
+
+static void task_executor_subsystems_init(void) {
+#    ifdef RGBLIGHT_ENABLE
+    task_executor_register(rgblight_exec_task, TASK_EXECUTOR_LIGHTING_INTERVAL_MS, 1, TASK_EXECUTOR_LIGHTING_BUDGET_US);
+#    endif
+#    ifdef LED_MATRIX_ENABLE
+    task_executor_register(led_matrix_exec_task, TASK_EXECUTOR_LIGHTING_INTERVAL_MS, 1, TASK_EXECUTOR_LIGHTING_BUDGET_US);
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    task_executor_register(rgb_matrix_exec_task, TASK_EXECUTOR_LIGHTING_INTERVAL_MS, 1, TASK_EXECUTOR_LIGHTING_BUDGET_US);
+#    endif
+#    if defined(BACKLIGHT_ENABLE) && (defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS))
+    task_executor_register(backlight_exec_task, TASK_EXECUTOR_LIGHTING_INTERVAL_MS, 1, TASK_EXECUTOR_LIGHTING_BUDGET_US);
+#    endif
+#    ifdef QWIIC_ENABLE
+    task_executor_register(qwiic_exec_task, TASK_EXECUTOR_DISPLAY_INTERVAL_MS, 2, TASK_EXECUTOR_DISPLAY_BUDGET_US);
+#    endif
+#    ifdef OLED_ENABLE
+    task_executor_register(oled_exec_task, TASK_EXECUTOR_DISPLAY_INTERVAL_MS, 2, TASK_EXECUTOR_DISPLAY_BUDGET_US);
+#    endif
+#    ifdef ST7565_ENABLE
+    task_executor_register(st7565_exec_task, TASK_EXECUTOR_DISPLAY_INTERVAL_MS, 2, TASK_EXECUTOR_DISPLAY_BUDGET_US);
+#    endif
+}
+#endif
+
+#ifdef COSMETICS_THREAD
+/* The platform layer overrides these with a real mutex and calls
+ * keyboard_cosmetics_task() from a dedicated lower-priority thread (see
+ * tmk_core/protocol/chibios/chibios.c). The lock serializes a cosmetics
+ * pass against key-event processing, whose user hooks commonly draw to
+ * the display or adjust lighting. */
+__attribute__((weak)) void keyboard_cosmetics_lock(void) {}
+__attribute__((weak)) void keyboard_cosmetics_unlock(void) {}
+#endif
+
+/** \brief Lighting and display housekeeping
+ *
+ * Everything here is cosmetic: skipping or delaying a pass can never lose
+ * input. Runs inline from keyboard_task() by default; with COSMETICS_THREAD
+ * defined the platform layer runs it from a separate lower-priority thread
+ * instead, so the matrix scan rate survives OLED/RGB load.
+ */
+void keyboard_cosmetics_task(void) {
+#ifdef COSMETICS_THREAD
+    keyboard_cosmetics_lock();
+#endif
+
+#ifdef TASK_EXECUTOR_ENABLE
+    // run whichever registered lighting/display tasks are due this pass
+    task_executor_run();
+#else
+#    if defined(RGBLIGHT_ENABLE)
+    SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, rgblight_task());
+#    endif
+
+#    ifdef LED_MATRIX_ENABLE
+    SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, led_matrix_task());
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    PERF_COUNT(PERF_RGB_FRAMES);
+    PERF_TIMER_START(PERF_TIMER_RGB_MATRIX);
+    SCAN_PROFILE_CALL(SCAN_PROFILE_LIGHTING, rgb_matrix_task());
+    PERF_TIMER_STOP(PERF_TIMER_RGB_MATRIX);
+#    endif
+
+#    if defined(BACKLIGHT_ENABLE)
+#        if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
+    backlight_task();
+#        endif
+#    endif
+
+#    ifdef QWIIC_ENABLE
+    qwiic_task();
+#    endif
+
+#    ifdef OLED_ENABLE
+    SCAN_PROFILE_CALL(SCAN_PROFILE_OLED, oled_task());
+#    endif
+
+#    ifdef ST7565_ENABLE
+    st7565_task();
+#    endif
+#endif
+
+#ifdef COSMETICS_THREAD
+    keyboard_cosmetics_unlock();
+#endif
+}
+
 /** \brief Keyboard task: Do keyboard routine jobs
  *
  * Do routine keyboard jobs:
@@ -390,9 +811,15 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
  *
  * This is repeatedly called as fast as possible.
  */
+/* last lock-LED state pushed to led_set(); host changes are picked up by
+ * polling from keyboard_task(), never from USB request context */
+static uint8_t led_status       = 0;
+static bool    led_force_update = false;
+
+void keyboard_led_force_update(void) { led_force_update = true; }
+
 void keyboard_task(void) {
     static matrix_row_t matrix_prev[MATRIX_ROWS];
-    static uint8_t      led_status    = 0;
     matrix_row_t        matrix_row    = 0;
     matrix_row_t        matrix_change = 0;
 #ifdef QMK_KEYS_PER_SCAN
@@ -402,9 +829,54 @@ void keyboard_task(void) {
     bool encoders_changed = false;
 #endif
 
-    uint8_t matrix_changed = matrix_scan();
+#ifdef MATRIX_SCAN_GOVERNOR
+    if (keyboard_task_throttled()) {
+        return;
+    }
+#endif
+
+    PERF_COUNT(PERF_SCAN_PASSES);
+    PERF_TIMER_START(PERF_TIMER_KEYBOARD_TASK);
+
+#ifdef KEYBOARD_INIT_STAGED
+    // Deferred bring-up: one init stage per scan pass, input stays live
+    if (keyboard_init_stage_pending < KEYBOARD_INIT_STAGE_COUNT) {
+        keyboard_init_stage(keyboard_init_stage_pending++);
+    }
+#endif
+    init_profile_task();
+
+    // single deadline check covering all one shot timeouts
+    oneshot_expiry_task();
+
+    watchdog_mark(WD_SUBSYSTEM_MATRIX);
+    uint8_t matrix_changed = 0;
+    TRACE_SCAN_START();
+    SCAN_PROFILE_CALL(SCAN_PROFILE_MATRIX, matrix_changed = matrix_scan());
+    TRACE_SCAN_END();
     if (matrix_changed) last_matrix_activity_trigger();
 
+#ifdef COSMETICS_THREAD
+    // user hooks running out of action_exec commonly touch display and
+    // lighting state; hold the cosmetics lock so a concurrent cosmetics
+    // pass cannot interleave with them
+    keyboard_cosmetics_lock();
+#endif
+
+    watchdog_mark(WD_SUBSYSTEM_ACTION);
+
+#ifdef KEYEVENT_QUEUE_ENABLE
+    // events deposited from ISR/DMA scan context since the last pass
+    {
+        keyevent_t queued_event;
+        while (keyevent_queue_pop(&queued_event)) {
+            last_matrix_activity_trigger();
+            PERF_COUNT(PERF_KEY_EVENTS);
+            action_exec(queued_event);
+        }
+    }
+#endif
+
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
         matrix_row    = matrix_get_row(r);
         matrix_change = matrix_row ^ matrix_prev[r];
@@ -419,8 +891,12 @@ void keyboard_task(void) {
             for (uint8_t c = 0; c < MATRIX_COLS; c++, col_mask <<= 1) {
                 if (matrix_change & col_mask) {
                     if (should_process_keypress()) {
+#ifdef LATENCY_TRACE
+                        latency_trace_event_queued(keyevent_timestamp(r));
+#endif
+                        PERF_COUNT(PERF_KEY_EVENTS);
                         action_exec((keyevent_t){
-                            .key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = (timer_read() | 1) /* time should not be 0 */
+                            .key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = (keyevent_timestamp(r) | 1) /* time should not be 0 */
                         });
                     }
                     // record a processed key
@@ -447,38 +923,38 @@ void keyboard_task(void) {
 
 MATRIX_LOOP_END:
 
+    // deliver coalesced layer change notifications before the tasks below
+    // react to layer state (no-op unless LAYER_STATE_COALESCE is defined)
+    layer_state_flush();
+
+#ifdef COSMETICS_THREAD
+    keyboard_cosmetics_unlock();
+#endif
+
 #ifdef DEBUG_MATRIX_SCAN_RATE
     matrix_scan_perf_task();
 #endif
 
-#if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
-#endif
+    scan_profile_task();
 
-#ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
-#endif
-#ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+#ifdef TELEMETRY_ENABLE
+    telemetry_task();
 #endif
 
-#if defined(BACKLIGHT_ENABLE)
-#    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
-#    endif
+#ifndef COSMETICS_THREAD
+    // inline cosmetics pass; with COSMETICS_THREAD the platform's dedicated
+    // thread runs it instead
+    watchdog_mark(WD_SUBSYSTEM_COSMETICS);
+    keyboard_cosmetics_task();
 #endif
 
 #ifdef ENCODER_ENABLE
-    encoders_changed = encoder_read();
+    watchdog_mark(WD_SUBSYSTEM_ENCODER);
+    SCAN_PROFILE_CALL(SCAN_PROFILE_ENCODER, encoders_changed = encoder_read());
     if (encoders_changed) last_encoder_activity_trigger();
 #endif
 
-#ifdef QWIIC_ENABLE
-    qwiic_task();
-#endif
-
 #ifdef OLED_ENABLE
-    oled_task();
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
 #        ifdef ENCODER_ENABLE
@@ -490,7 +966,6 @@ MATRIX_LOOP_END:
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
 #        ifdef ENCODER_ENABLE
@@ -501,6 +976,8 @@ MATRIX_LOOP_END:
 #    endif
 #endif
 
+    watchdog_mark(WD_SUBSYSTEM_MOUSE);
+
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
     mousekey_task();
@@ -518,6 +995,8 @@ MATRIX_LOOP_END:
     adb_mouse_task();
 #endif
 
+    watchdog_mark(WD_SUBSYSTEM_HOUSEKEEPING);
+
 #ifdef SERIAL_LINK_ENABLE
     serial_link_update();
 #endif
@@ -527,7 +1006,9 @@ MATRIX_LOOP_END:
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
+    watchdog_mark(WD_SUBSYSTEM_POINTING);
     pointing_device_task();
+    watchdog_mark(WD_SUBSYSTEM_HOUSEKEEPING);
 #endif
 
 #ifdef MIDI_ENABLE
@@ -548,11 +1029,59 @@ MATRIX_LOOP_END:
     digitizer_task();
 #endif
 
-    // update LED
-    if (led_status != host_keyboard_leds()) {
-        led_status = host_keyboard_leds();
-        keyboard_set_leds(led_status);
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_task();
+#endif
+
+#ifdef EECONFIG_LAZY_SYNC
+    eeconfig_lazy_task();
+#endif
+
+#if defined(EEPROM_TRANSIENT) && defined(TRANSIENT_EEPROM_SYNC)
+    eeprom_transient_sync_task();
+#endif
+
+#if defined(RAW_ENABLE) && defined(RAW_HID_DEFERRED)
+    raw_hid_queue_task();
+#endif
+
+#ifdef SEND_STRING_STREAMING
+    send_string_stream_task();
+#endif
+
+#ifdef SUSPEND_FAST_WAKEUP
+    suspend_wakeup_task();
+#endif
+
+#ifdef RADIO_LINK_ENABLE
+    // transmit any report frame whose latency window has expired
+    radio_link_task();
+#endif
+
+    // update LED: host changes are only ever applied here, so the USB
+    // SET_REPORT path just stores a byte and the led_update callback chain
+    // (often OLED/RGB work) runs in scan-loop context. With
+    // LED_UPDATE_INTERVAL_MS set, a storm of host toggles (e.g. VM focus
+    // switches replaying lock state) coalesces to one update per interval.
+#if defined(LED_UPDATE_INTERVAL_MS) && LED_UPDATE_INTERVAL_MS > 0
+    static uint16_t led_update_timer = 0;
+    if (led_force_update || timer_elapsed(led_update_timer) >= LED_UPDATE_INTERVAL_MS)
+#endif
+    {
+        if (led_force_update || led_status != host_keyboard_leds()) {
+            led_force_update = false;
+            led_status       = host_keyboard_leds();
+            keyboard_set_leds(led_status);
+        }
+#if defined(LED_UPDATE_INTERVAL_MS) && LED_UPDATE_INTERVAL_MS > 0
+        led_update_timer = timer_read();
+#endif
     }
+
+    PERF_TIMER_STOP(PERF_TIMER_KEYBOARD_TASK);
+
+    // one feed per completed pass; a stalled pass never reaches this
+    watchdog_feed();
 }
 
 /** \brief keyboard set leds
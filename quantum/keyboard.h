@@ -60,6 +60,9 @@ void keyboard_init(void);
 void keyboard_task(void);
 /* it runs when host LED status is updated */
 void keyboard_set_leds(uint8_t leds);
+/* force the next keyboard_task() pass to re-apply lock-LED state even if it
+ * looks unchanged; safe to call from USB event/interrupt context */
+void keyboard_led_force_update(void);
 /* it runs whenever code has to behave differently on a slave */
 bool is_keyboard_master(void);
 /* it runs whenever code has to behave differently on left vs right split */
@@ -74,6 +77,16 @@ void housekeeping_task(void);       // To be executed by the main loop in each b
 void housekeeping_task_kb(void);    // To be overridden by keyboard-level code
 void housekeeping_task_user(void);  // To be overridden by user/keymap-level code
 
+/* lighting/display housekeeping, split out of keyboard_task(); with
+ * COSMETICS_THREAD defined the platform layer runs it on a dedicated
+ * lower-priority thread instead of inline in the scan loop */
+void keyboard_cosmetics_task(void);
+#ifdef COSMETICS_THREAD
+/* implemented by the platform layer with a real mutex */
+void keyboard_cosmetics_lock(void);
+void keyboard_cosmetics_unlock(void);
+#endif
+
 uint32_t last_input_activity_time(void);     // Timestamp of the last matrix or encoder activity
 uint32_t last_input_activity_elapsed(void);  // Number of milliseconds since the last matrix or encoder activity
 
@@ -85,6 +98,35 @@ uint32_t last_encoder_activity_elapsed(void);  // Number of milliseconds since t
 
 uint32_t get_matrix_scan_rate(void);
 
+#if defined(MATRIX_SCAN_PROFILER) || defined(RGB_MATRIX_FLUSH_STATS) || defined(PERF_COUNTER_ENABLE) || defined(TASK_EXECUTOR_ENABLE)
+/* microsecond time source; weak default has millisecond granularity, override per platform */
+uint32_t scan_profile_timer_read_us(void);
+#endif
+
+#ifdef MATRIX_SCAN_PROFILER
+/* instrumented sections of the scan loop */
+enum scan_profile_probe {
+    SCAN_PROFILE_MATRIX,    // matrix_scan(), including debounce
+    SCAN_PROFILE_DEBOUNCE,  // debounce() alone
+    SCAN_PROFILE_LIGHTING,  // rgblight/led_matrix/rgb_matrix tasks
+    SCAN_PROFILE_OLED,      // oled_task()
+    SCAN_PROFILE_ENCODER,   // encoder_read()
+    SCAN_PROFILE_COUNT
+};
+
+typedef struct {
+    uint32_t min;      // microseconds
+    uint32_t avg;      // microseconds
+    uint32_t max;      // microseconds
+    uint32_t samples;  // samples in the last completed window
+} scan_profile_stats_t;
+
+/* record one sample for a probe */
+void scan_profile_sample(uint8_t probe, uint32_t duration_us);
+/* stats of the last completed 1-second window, e.g. for a raw HID query handler */
+bool scan_profile_get(uint8_t probe, scan_profile_stats_t *stats);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
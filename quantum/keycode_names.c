@@ -0,0 +1,41 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keycode_names.h"
+#include "progmem.h"
+#include "keycode_names_table.h"
+
+const char *keycode_name_P(uint16_t keycode) {
+    if (keycode > 0xFF) {
+        return NULL;
+    }
+
+    uint16_t low  = 0;
+    uint16_t high = KEYCODE_NAMES_COUNT;
+    while (low < high) {
+        uint16_t mid  = (low + high) / 2;
+        uint8_t  code = pgm_read_byte(&keycode_names_codes[mid]);
+        if (code == keycode) {
+            return &keycode_names_pool[pgm_read_word(&keycode_names_offsets[mid])];
+        }
+        if (code < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,27 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Look up the canonical name of a basic keycode in the generated flash
+ * table (see util/keycode_name_gen.py). Returns a PROGMEM pointer to the
+ * name without its "KC_" prefix, e.g. "ESCAPE" for 0x29 - print it with
+ * xprintf("KC_%S", ...) or send_string_P(). Returns NULL for codes the
+ * table does not cover (anything above 0xFF, and HID codes QMK leaves
+ * unassigned). */
+const char *keycode_name_P(uint16_t keycode);
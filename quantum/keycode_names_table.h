@@ -0,0 +1,263 @@
+/* Generated by util/keycode_name_gen.py from quantum/keycode.h - do not edit.
+ *
+ * 250 names, 1408 bytes of pool, names stored without the KC_ prefix.
+ * Mouse keys carry their default (non-VIA) code assignment.
+ */
+
+#pragma once
+
+#define KEYCODE_NAMES_COUNT 250
+
+static const char keycode_names_pool[1408] PROGMEM =
+    "MEDIA_FAST_FORWARD\0"
+    "MEDIA_NEXT_TRACK\0"
+    "MEDIA_PLAY_PAUSE\0"
+    "MEDIA_PREV_TRACK\0"
+    "BRIGHTNESS_DOWN\0"
+    "AUDIO_VOL_DOWN\0"
+    "KP_EQUAL_AS400\0"
+    "LOCKING_SCROLL\0"
+    "BRIGHTNESS_UP\0"
+    "WWW_FAVORITES\0"
+    "AUDIO_VOL_UP\0"
+    "LOCKING_CAPS\0"
+    "MEDIA_REWIND\0"
+    "MEDIA_SELECT\0"
+    "NONUS_BSLASH\0"
+    "SYSTEM_POWER\0"
+    "SYSTEM_SLEEP\0"
+    "APPLICATION\0"
+    "CLEAR_AGAIN\0"
+    "KP_ASTERISK\0"
+    "LOCKING_NUM\0"
+    "MEDIA_EJECT\0"
+    "MS_WH_RIGHT\0"
+    "MY_COMPUTER\0"
+    "SYSTEM_WAKE\0"
+    "WWW_FORWARD\0"
+    "WWW_REFRESH\0"
+    "AUDIO_MUTE\0"
+    "CALCULATOR\0"
+    "MEDIA_STOP\0"
+    "MS_WH_DOWN\0"
+    "MS_WH_LEFT\0"
+    "NONUS_HASH\0"
+    "SCROLLLOCK\0"
+    "WWW_SEARCH\0"
+    "ALT_ERASE\0"
+    "MS_ACCEL0\0"
+    "MS_ACCEL1\0"
+    "MS_ACCEL2\0"
+    "POST_FAIL\0"
+    "ROLL_OVER\0"
+    "SEPARATOR\0"
+    "UNDEFINED\0"
+    "CAPSLOCK\0"
+    "KP_COMMA\0"
+    "KP_ENTER\0"
+    "KP_EQUAL\0"
+    "KP_MINUS\0"
+    "KP_SLASH\0"
+    "LBRACKET\0"
+    "MS_RIGHT\0"
+    "MS_WH_UP\0"
+    "RBRACKET\0"
+    "WWW_BACK\0"
+    "WWW_HOME\0"
+    "WWW_STOP\0"
+    "_VOLDOWN\0"
+    "EXECUTE\0"
+    "KP_PLUS\0"
+    "MS_BTN1\0"
+    "MS_BTN2\0"
+    "MS_BTN3\0"
+    "MS_BTN4\0"
+    "MS_BTN5\0"
+    "MS_BTN6\0"
+    "MS_BTN7\0"
+    "MS_BTN8\0"
+    "MS_DOWN\0"
+    "MS_LEFT\0"
+    "NUMLOCK\0"
+    "PSCREEN\0"
+    "BSPACE\0"
+    "CANCEL\0"
+    "DELETE\0"
+    "ESCAPE\0"
+    "INSERT\0"
+    "KP_DOT\0"
+    "LSHIFT\0"
+    "PGDOWN\0"
+    "RETURN\0"
+    "RSHIFT\0"
+    "SCOLON\0"
+    "SYSREQ\0"
+    "_VOLUP\0"
+    "CLEAR\0"
+    "CRSEL\0"
+    "EXSEL\0"
+    "GRAVE\0"
+    "LANG1\0"
+    "LANG2\0"
+    "LANG3\0"
+    "LANG4\0"
+    "LANG5\0"
+    "LANG6\0"
+    "LANG7\0"
+    "LANG8\0"
+    "LANG9\0"
+    "LCTRL\0"
+    "MS_UP\0"
+    "PASTE\0"
+    "PRIOR\0"
+    "QUOTE\0"
+    "RCTRL\0"
+    "COPY\0"
+    "FIND\0"
+    "FN10\0"
+    "FN11\0"
+    "FN12\0"
+    "FN13\0"
+    "FN14\0"
+    "FN15\0"
+    "FN16\0"
+    "FN17\0"
+    "FN18\0"
+    "FN19\0"
+    "FN20\0"
+    "FN21\0"
+    "FN22\0"
+    "FN23\0"
+    "FN24\0"
+    "FN25\0"
+    "FN26\0"
+    "FN27\0"
+    "FN28\0"
+    "FN29\0"
+    "FN30\0"
+    "FN31\0"
+    "HELP\0"
+    "INT1\0"
+    "INT2\0"
+    "INT3\0"
+    "INT4\0"
+    "INT5\0"
+    "INT6\0"
+    "INT7\0"
+    "INT8\0"
+    "INT9\0"
+    "KP_0\0"
+    "KP_1\0"
+    "KP_2\0"
+    "KP_3\0"
+    "KP_4\0"
+    "KP_5\0"
+    "KP_6\0"
+    "KP_7\0"
+    "KP_8\0"
+    "KP_9\0"
+    "LALT\0"
+    "LGUI\0"
+    "MAIL\0"
+    "MENU\0"
+    "OPER\0"
+    "PGUP\0"
+    "RALT\0"
+    "RGUI\0"
+    "UNDO\0"
+    "CUT\0"
+    "END\0"
+    "F10\0"
+    "F11\0"
+    "F12\0"
+    "F13\0"
+    "F14\0"
+    "F15\0"
+    "F16\0"
+    "F17\0"
+    "F18\0"
+    "F19\0"
+    "F20\0"
+    "F21\0"
+    "F22\0"
+    "F23\0"
+    "F24\0"
+    "FN0\0"
+    "FN1\0"
+    "FN2\0"
+    "FN3\0"
+    "FN4\0"
+    "FN5\0"
+    "FN6\0"
+    "FN7\0"
+    "FN8\0"
+    "FN9\0"
+    "OUT\0"
+    "TAB\0"
+    "F1\0"
+    "F2\0"
+    "F3\0"
+    "F4\0"
+    "F5\0"
+    "F6\0"
+    "F7\0"
+    "F8\0"
+    "F9\0"
+    "NO\0"
+    "C\0"
+    "F\0"
+    "G\0"
+    "J\0"
+    "V\0"
+    "W\0"
+    "X\0"
+    "Z\0"
+;
+
+static const uint8_t keycode_names_codes[KEYCODE_NAMES_COUNT] PROGMEM = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B,
+    0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B,
+    0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xC0,
+    0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC,
+    0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8,
+    0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4,
+    0xE5, 0xE6, 0xE7, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5,
+    0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF,
+};
+
+static const uint16_t keycode_names_offsets[KEYCODE_NAMES_COUNT] PROGMEM = {
+    1389, 508, 498, 528, 554, 1360, 1392, 17, 51, 1394, 1396, 222,
+    1209, 1398, 34, 129, 296, 84, 1244, 143, 858, 235, 157, 209,
+    1219, 1400, 1402, 1404, 984, 1406, 486, 496, 702, 710, 718, 726,
+    734, 742, 943, 114, 559, 797, 776, 1358, 777, 577, 568, 592,
+    619, 217, 425, 846, 969, 885, 550, 814, 218, 538, 1362, 1365,
+    1368, 1371, 1374, 1377, 1380, 1383, 1386, 1254, 1258, 1262, 768, 436,
+    47, 804, 641, 1226, 790, 1250, 825, 316, 420, 81, 142, 760,
+    583, 274, 574, 672, 556, 1156, 1161, 1166, 1171, 1176, 1181, 1186,
+    1191, 1196, 1151, 811, 211, 250, 231, 565, 1266, 1270, 1274, 1278,
+    1282, 1286, 1290, 1294, 1298, 1302, 1306, 1310, 664, 1101, 1216, 204,
+    398, 268, 1241, 1246, 981, 957, 986, 375, 860, 655, 172, 286,
+    116, 547, 101, 1106, 1111, 1116, 1121, 1126, 1131, 1136, 1141, 1146,
+    891, 897, 903, 909, 915, 921, 927, 933, 939, 458, 853, 783,
+    867, 963, 832, 518, 1354, 1221, 262, 873, 879, 224, 237, 334,
+    370, 159, 86, 19, 53, 392, 36, 198, 298, 1211, 381, 322,
+    447, 637, 628, 346, 646, 358, 145, 0, 185, 131, 70, 1314,
+    1318, 1322, 1326, 1330, 1334, 1338, 1342, 1346, 1350, 991, 996, 1001,
+    1006, 1011, 1016, 1021, 1026, 1031, 1036, 1041, 1046, 1051, 1056, 1061,
+    1066, 1071, 1076, 1081, 1086, 1091, 1096, 945, 818, 1201, 1206, 975,
+    839, 1231, 1236, 951, 744, 752, 601, 680, 688, 696, 704, 712,
+    720, 728, 736, 610, 403, 414, 310, 468, 478, 488,
+};
@@ -0,0 +1,75 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keyevent_queue.h"
+
+/* compiler barrier: a slot must be completely written before the sequence
+ * counter publishes it (and fully copied out before the counter releases
+ * it); same-core ISR visibility needs no hardware fence */
+#define keyevent_queue_barrier() __asm__ volatile("" ::: "memory")
+
+static keyevent_t queue[KEYEVENT_QUEUE_SIZE];
+
+/* free-running mod-256 sequence counters; (write - read) is the number of
+ * unconsumed events, and a distance beyond the capacity means the producer
+ * lapped the consumer. The producer bumps queue_claim before touching a slot
+ * and queue_write after, so the consumer can tell an overwrite in progress
+ * apart from a queue that is merely full: with a single published counter a
+ * pop racing the overwrite of the oldest slot of an exactly-full queue would
+ * copy a half-written record and still see a distance of exactly
+ * KEYEVENT_QUEUE_SIZE */
+static volatile uint8_t  queue_claim   = 0;
+static volatile uint8_t  queue_write   = 0;
+static volatile uint8_t  queue_read    = 0;
+static uint16_t          queue_overrun = 0; /* consumer-owned */
+
+void keyevent_queue_push(keyevent_t event) {
+    queue_claim++;
+    keyevent_queue_barrier();
+    queue[queue_write % KEYEVENT_QUEUE_SIZE] = event;
+    keyevent_queue_barrier();
+    queue_write++;
+}
+
+bool keyevent_queue_pop(keyevent_t *event) {
+    for (;;) {
+        uint8_t write = queue_write;
+        if (write == queue_read) {
+            return false;
+        }
+        if ((uint8_t)(write - queue_read) > KEYEVENT_QUEUE_SIZE) {
+            /* lapped: everything older than one full queue is overwritten */
+            queue_overrun += (uint8_t)(write - queue_read) - KEYEVENT_QUEUE_SIZE;
+            queue_read = (uint8_t)(write - KEYEVENT_QUEUE_SIZE);
+        }
+        *event = queue[queue_read % KEYEVENT_QUEUE_SIZE];
+        keyevent_queue_barrier();
+        /* the copy is intact only if the producer did not claim this slot
+         * while it was being read (checked against queue_claim so that an
+         * overwrite still in flight is caught); otherwise resync and retry */
+        if ((uint8_t)(queue_claim - queue_read) <= KEYEVENT_QUEUE_SIZE) {
+            queue_read++;
+            return true;
+        }
+    }
+}
+
+uint8_t keyevent_queue_pending(void) {
+    uint8_t pending = (uint8_t)(queue_write - queue_read);
+    return pending > KEYEVENT_QUEUE_SIZE ? KEYEVENT_QUEUE_SIZE : pending;
+}
+
+uint16_t keyevent_queue_overrun_count(void) { return queue_overrun; }
@@ -0,0 +1,60 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+/* Lock-free single-producer single-consumer key event queue
+ * (KEYEVENT_QUEUE_ENABLE)
+ *
+ * Formalizes the handoff between matrix acquisition and action processing
+ * that the polled scan does implicitly through the matrix arrays: an
+ * interrupt- or DMA-driven scan engine pushes keyevent_t records (which carry
+ * their own timestamp) from ISR context, and keyboard_task() drains them into
+ * action_exec() on the next pass. Free-running sequence counters stand in for
+ * locks: the producer never blocks - when the consumer falls a full queue
+ * behind, the oldest entries are overwritten and the consumer detects the lap
+ * from the sequence distance, resynchronizes to the oldest intact entry and
+ * counts the loss, so a stalled pass can never corrupt the queue or stall the
+ * ISR. Single-byte counter accesses are atomic on every supported target.
+ *
+ * KEYEVENT_QUEUE_SIZE (default 16) must be a power of two, at most 128.
+ */
+
+#ifndef KEYEVENT_QUEUE_SIZE
+#    define KEYEVENT_QUEUE_SIZE 16
+#endif
+
+#if (KEYEVENT_QUEUE_SIZE & (KEYEVENT_QUEUE_SIZE - 1)) != 0 || KEYEVENT_QUEUE_SIZE > 128
+#    error KEYEVENT_QUEUE_SIZE must be a power of two no larger than 128
+#endif
+
+/* producer side, safe from ISR context; never blocks, overwrites the
+ * oldest entry when the queue is full */
+void keyevent_queue_push(keyevent_t event);
+
+/* consumer side: oldest event out, false when empty; skips entries the
+ * producer overwrote mid-copy */
+bool keyevent_queue_pop(keyevent_t *event);
+
+/* events currently waiting (clamped to the queue capacity) */
+uint8_t keyevent_queue_pending(void);
+
+/* events lost to producer overwrites since boot */
+uint16_t keyevent_queue_overrun_count(void);
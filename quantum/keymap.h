@@ -52,5 +52,17 @@ uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 // translates function id to action
 uint16_t keymap_function_id_to_action(uint16_t function_id);
 
+#ifdef KEYMAP_COMPACT
+/* Dense layers in layout-argument order, with a generated (row,col) ->
+ * index table; KC_NO padding is not stored. The sizes and the index
+ * table initializer come from a header generated by
+ * util/keymap_compact_gen.py, included from the keyboard's config.h. */
+extern const uint16_t keymaps[][KEYMAP_COMPACT_SIZE];
+extern const uint8_t  keymap_compact_index[MATRIX_ROWS][MATRIX_COLS];
+#    ifndef KEYMAP_COMPACT_UNMAPPED
+#        define KEYMAP_COMPACT_UNMAPPED 0xFF
+#    endif
+#else
 extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
+#endif
 extern const uint16_t fn_actions[];
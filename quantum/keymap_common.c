@@ -36,11 +36,47 @@ extern keymap_config_t keymap_config;
 
 #include <inttypes.h>
 
+#ifdef ACTION_RESOLUTION_CACHE
+#    ifndef ACTION_RESOLUTION_CACHE_SIZE
+#        define ACTION_RESOLUTION_CACHE_SIZE 8
+#    endif
+/* Direct-mapped cache of recently resolved (layer, position) -> action
+ * entries. Typing bursts revisit the same few positions, and every release
+ * re-resolves the position its press already decoded, so most events are
+ * answered here without re-reading the keymap or walking the decode switch.
+ * Flushed whenever the keymap or the bootmagic keycode remapping changes. */
+typedef struct {
+    uint8_t  layer;
+    keypos_t key;
+    action_t action;
+    bool     valid;
+} action_cache_entry_t;
+
+static action_cache_entry_t action_resolution_cache[ACTION_RESOLUTION_CACHE_SIZE];
+
+void action_cache_clear(void) { memset(action_resolution_cache, 0, sizeof(action_resolution_cache)); }
+
+static inline uint8_t action_cache_slot(uint8_t layer, keypos_t key) { return ((uint8_t)(key.row * MATRIX_COLS) + key.col + layer) % ACTION_RESOLUTION_CACHE_SIZE; }
+#endif
+
 /* converts key to action */
 action_t action_for_key(uint8_t layer, keypos_t key) {
+#ifdef ACTION_RESOLUTION_CACHE
+    action_cache_entry_t *entry = &action_resolution_cache[action_cache_slot(layer, key)];
+    if (entry->valid && entry->layer == layer && entry->key.row == key.row && entry->key.col == key.col) {
+        return entry->action;
+    }
+#endif
     // 16bit keycodes - important
     uint16_t keycode = keymap_key_to_keycode(layer, key);
-    return action_for_keycode(keycode);
+    action_t action  = action_for_keycode(keycode);
+#ifdef ACTION_RESOLUTION_CACHE
+    entry->layer  = layer;
+    entry->key    = key;
+    entry->action = action;
+    entry->valid  = true;
+#endif
+    return action;
 };
 
 action_t action_for_keycode(uint16_t keycode) {
@@ -176,10 +212,78 @@ __attribute__((weak)) const macro_t *action_get_macro(keyrecord_t *record, uint8
 __attribute__((weak)) void action_function(keyrecord_t *record, uint8_t id, uint8_t opt) {}
 
 // translates key to keycode
+#ifdef KEYMAP_LOOKUP_CACHE
+/* Two-entry memo of the most recent keymap lookups. A release resolves the
+ * same (layer, position) its press just did, and the transparent-layer
+ * cascade repeats identical lookups on both edges, so two slots answer the
+ * common press/release pair without touching flash. Only the weak default
+ * lookup below uses this; the keymap it reads is flash-resident and
+ * immutable, so the cache never needs invalidation. */
+static struct {
+    uint8_t  layer;
+    keypos_t key;
+    uint16_t keycode;
+    bool     valid;
+} keymap_lookup_cache[2];
+static uint8_t keymap_lookup_victim = 0;
+
+static inline bool keymap_lookup_cached(uint8_t layer, keypos_t key, uint16_t *keycode) {
+    for (uint8_t i = 0; i < 2; i++) {
+        if (keymap_lookup_cache[i].valid && keymap_lookup_cache[i].layer == layer && keymap_lookup_cache[i].key.row == key.row && keymap_lookup_cache[i].key.col == key.col) {
+            *keycode = keymap_lookup_cache[i].keycode;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline void keymap_lookup_store(uint8_t layer, keypos_t key, uint16_t keycode) {
+    keymap_lookup_cache[keymap_lookup_victim].layer   = layer;
+    keymap_lookup_cache[keymap_lookup_victim].key     = key;
+    keymap_lookup_cache[keymap_lookup_victim].keycode = keycode;
+    keymap_lookup_cache[keymap_lookup_victim].valid   = true;
+    keymap_lookup_victim ^= 1;
+}
+#endif
+
+#ifdef KEYMAP_COMPACT
+// one flash copy of the generated (row,col) -> dense index table
+const uint8_t keymap_compact_index[MATRIX_ROWS][MATRIX_COLS] PROGMEM = KEYMAP_COMPACT_INDEX;
+
 __attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
-    // Read entire word (16bits)
-    return pgm_read_word(&keymaps[(layer)][(key.row)][(key.col)]);
+#    ifdef KEYMAP_LOOKUP_CACHE
+    uint16_t cached;
+    if (keymap_lookup_cached(layer, key, &cached)) {
+        return cached;
+    }
+#    endif
+    uint8_t index = pgm_read_byte(&keymap_compact_index[key.row][key.col]);
+    if (index == KEYMAP_COMPACT_UNMAPPED) {
+        return KC_NO;
+    }
+    uint16_t keycode = pgm_read_word(&keymaps[(layer)][index]);
+#    ifdef KEYMAP_LOOKUP_CACHE
+    keymap_lookup_store(layer, key, keycode);
+#    endif
+    return keycode;
 }
+#else
+__attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+#    ifdef KEYMAP_LOOKUP_CACHE
+    uint16_t cached;
+    if (keymap_lookup_cached(layer, key, &cached)) {
+        return cached;
+    }
+#    endif
+    // Flat lookup: one precomputed layer stride instead of the compiler's
+    // two-dimensional address arithmetic per call
+    uint16_t keycode = pgm_read_word((const uint16_t *)keymaps + (uint16_t)layer * (MATRIX_ROWS * MATRIX_COLS) + (uint16_t)key.row * MATRIX_COLS + key.col);
+#    ifdef KEYMAP_LOOKUP_CACHE
+    keymap_lookup_store(layer, key, keycode);
+#    endif
+    return keycode;
+}
+#endif
 
 // translates function id to action
 __attribute__((weak)) uint16_t keymap_function_id_to_action(uint16_t function_id) {
@@ -0,0 +1,106 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Keystroke latency tracer (LATENCY_TRACE_ENABLE = yes)
+ *
+ * Timestamps one keystroke at a time as it moves through the firmware:
+ * the debounce-committed matrix sample (the event timestamp latched by
+ * matrix_get_scan_timestamp()), the moment process_record() picks the
+ * event up, and the moment the resulting keyboard report is written to
+ * the USB IN endpoint. Each stage accumulates a histogram of 1 ms
+ * buckets, retrievable over raw HID, so firmware changes can be A/B
+ * compared on-device without an external measurement rig.
+ *
+ * Only one keystroke is in flight at a time; a new edge arriving before
+ * the previous one reaches the endpoint simply restarts the trace. That
+ * under-samples bursts, but keeps the hooks to a couple of compares on
+ * the hot path and is plenty for comparing distributions.
+ */
+
+#include <string.h>
+
+#include "latency_trace.h"
+#include "timer.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static uint16_t trace_histogram[LATENCY_TRACE_STAGE_COUNT][LATENCY_TRACE_BUCKETS];
+
+/* debounce-committed sample time of the keystroke being traced */
+static uint16_t trace_start;
+/* stages still owed: armed until process_record(), in flight until the IN write */
+static bool trace_armed;
+static bool trace_in_flight;
+
+static void trace_accumulate(uint8_t stage, uint16_t delta) {
+    uint8_t bucket = (delta < LATENCY_TRACE_BUCKETS) ? (uint8_t)delta : (LATENCY_TRACE_BUCKETS - 1);
+    if (trace_histogram[stage][bucket] < UINT16_MAX) {
+        trace_histogram[stage][bucket]++;
+    }
+}
+
+void latency_trace_event_queued(uint16_t timestamp) {
+    trace_start     = timestamp;
+    trace_armed     = true;
+    trace_in_flight = true;
+    trace_accumulate(LATENCY_TRACE_QUEUE, timer_elapsed(timestamp));
+}
+
+void latency_trace_process(void) {
+    if (!trace_armed) return;
+    trace_armed = false;
+    trace_accumulate(LATENCY_TRACE_PROCESS, timer_elapsed(trace_start));
+}
+
+void latency_trace_report(void) {
+    /* ignore reports not caused by a traced keystroke (ticks, LED echoes) */
+    if (!trace_in_flight || trace_armed) return;
+    trace_in_flight = false;
+    trace_accumulate(LATENCY_TRACE_REPORT, timer_elapsed(trace_start));
+}
+
+const uint16_t *latency_trace_histogram(uint8_t stage) {
+    if (stage >= LATENCY_TRACE_STAGE_COUNT) return NULL;
+    return trace_histogram[stage];
+}
+
+#ifdef RAW_ENABLE
+bool latency_trace_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != LATENCY_TRACE_HID_ID) return false;
+
+    switch (data[1]) {
+        case id_latency_trace_get: {
+            uint8_t stage = data[2];
+            if (stage < LATENCY_TRACE_STAGE_COUNT && length >= 3 + 2 * LATENCY_TRACE_BUCKETS) {
+                uint8_t *p = &data[3];
+                for (uint8_t i = 0; i < LATENCY_TRACE_BUCKETS; i++) {
+                    *p++ = (uint8_t)(trace_histogram[stage][i] & 0xFF);
+                    *p++ = (uint8_t)(trace_histogram[stage][i] >> 8);
+                }
+            }
+            break;
+        }
+        case id_latency_trace_reset:
+            memset(trace_histogram, 0, sizeof(trace_histogram));
+            break;
+    }
+
+    /* echo the (possibly filled-in) packet back as the reply */
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
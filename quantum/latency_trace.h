@@ -0,0 +1,58 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Number of 1 ms histogram buckets per stage; the last bucket collects
+ * everything at or beyond (LATENCY_TRACE_BUCKETS - 1) ms. The default is
+ * sized so one stage fits in a single 32 byte raw HID report. */
+#ifndef LATENCY_TRACE_BUCKETS
+#    define LATENCY_TRACE_BUCKETS 14
+#endif
+
+/* Each stage measures elapsed time from the debounce-committed matrix
+ * sample of a keystroke to a later point in the pipeline. */
+enum latency_trace_stage {
+    LATENCY_TRACE_QUEUE = 0, /* matrix sample -> key event queued */
+    LATENCY_TRACE_PROCESS,   /* matrix sample -> process_record() */
+    LATENCY_TRACE_REPORT,    /* matrix sample -> USB endpoint IN write */
+    LATENCY_TRACE_STAGE_COUNT
+};
+
+/* First byte of a raw HID packet addressed to the tracer. Chosen high to
+ * stay clear of VIA's command range. */
+#define LATENCY_TRACE_HID_ID 0xE7
+
+enum latency_trace_hid_command {
+    id_latency_trace_get   = 0x01, /* [id, get, stage] -> buckets, little-endian uint16 */
+    id_latency_trace_reset = 0x02, /* clear all histograms */
+};
+
+/* instrumentation hooks, called from keyboard.c / action.c / the USB driver */
+void latency_trace_event_queued(uint16_t timestamp);
+void latency_trace_process(void);
+void latency_trace_report(void);
+
+/* direct access for on-device consumers (e.g. dprintf dumps) */
+const uint16_t *latency_trace_histogram(uint8_t stage);
+
+#ifdef RAW_ENABLE
+/* Call from raw_hid_receive_kb(); returns true if the packet was consumed. */
+bool latency_trace_hid_receive(uint8_t *data, uint8_t length);
+#endif
@@ -28,6 +28,11 @@ typedef int8_t (*sendchar_func_t)(uint8_t c);
 /* transmit a character.  return 0 on success, -1 on error. */
 int8_t sendchar(uint8_t c);
 
+#ifdef CONSOLE_BUFFERED
+/* characters dropped because the console ring buffer was full (saturating) */
+uint16_t console_overflow_count(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
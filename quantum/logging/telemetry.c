@@ -0,0 +1,139 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "telemetry.h"
+#include "sendchar.h"
+#include "timer.h"
+#include "keyboard.h"
+#ifdef PERF_COUNTER_ENABLE
+#    include "perf_counter.h"
+#endif
+#ifdef RADIO_LINK_ENABLE
+#    include "radio_link.h"
+#endif
+#ifdef WATCHDOG_ENABLE
+#    include "watchdog.h"
+#endif
+
+static uint8_t frame_checksum;
+
+static void emit_byte(uint8_t b) {
+    frame_checksum ^= b;
+    sendchar(b);
+}
+
+static void emit_u32(uint32_t v) {
+    emit_byte(v & 0xFF);
+    emit_byte((v >> 8) & 0xFF);
+    emit_byte((v >> 16) & 0xFF);
+    emit_byte((v >> 24) & 0xFF);
+}
+
+void telemetry_emit(uint8_t type, const void *payload, uint8_t length) {
+    const uint8_t *p = (const uint8_t *)payload;
+
+    sendchar(0xD7);
+    sendchar(0xA9);
+    frame_checksum = 0;
+    emit_byte((TELEMETRY_VERSION << 4) | (type & 0x0F));
+    emit_u32(timer_read32());
+    emit_byte(length);
+    for (uint8_t i = 0; i < length; i++) {
+        emit_byte(p[i]);
+    }
+    sendchar(frame_checksum);
+}
+
+#ifdef MATRIX_SCAN_PROFILER
+static void telemetry_emit_scan_profile(void) {
+    for (uint8_t probe = 0; probe < SCAN_PROFILE_COUNT; probe++) {
+        scan_profile_stats_t stats;
+        if (!scan_profile_get(probe, &stats) || !stats.samples) {
+            continue;
+        }
+        uint8_t payload[1 + 4 * sizeof(uint32_t)];
+        payload[0] = probe;
+        uint32_t fields[4] = {stats.min, stats.avg, stats.max, stats.samples};
+        for (uint8_t i = 0; i < 4; i++) {
+            payload[1 + 4 * i + 0] = fields[i] & 0xFF;
+            payload[1 + 4 * i + 1] = (fields[i] >> 8) & 0xFF;
+            payload[1 + 4 * i + 2] = (fields[i] >> 16) & 0xFF;
+            payload[1 + 4 * i + 3] = (fields[i] >> 24) & 0xFF;
+        }
+        telemetry_emit(TELEMETRY_SCAN_PROFILE, payload, sizeof(payload));
+    }
+}
+#endif
+
+#ifdef PERF_COUNTER_ENABLE
+static void telemetry_emit_perf_counters(void) {
+    uint8_t payload[1 + PERF_COUNTER_COUNT * sizeof(uint32_t)];
+    payload[0] = PERF_COUNTER_COUNT;
+    for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        payload[1 + 4 * i + 0] = perf_counters[i] & 0xFF;
+        payload[1 + 4 * i + 1] = (perf_counters[i] >> 8) & 0xFF;
+        payload[1 + 4 * i + 2] = (perf_counters[i] >> 16) & 0xFF;
+        payload[1 + 4 * i + 3] = (perf_counters[i] >> 24) & 0xFF;
+    }
+    telemetry_emit(TELEMETRY_PERF_COUNTERS, payload, sizeof(payload));
+}
+#endif
+
+#ifdef RADIO_LINK_ENABLE
+static void telemetry_emit_link_quality(void) {
+    uint16_t frames  = radio_link_frame_count();
+    uint16_t reports = radio_link_report_count();
+    uint8_t  payload[4] = {(uint8_t)(frames & 0xFF), (uint8_t)(frames >> 8), (uint8_t)(reports & 0xFF), (uint8_t)(reports >> 8)};
+    telemetry_emit(TELEMETRY_LINK_QUALITY, payload, sizeof(payload));
+}
+#endif
+
+#ifdef WATCHDOG_ENABLE
+static void telemetry_emit_watchdog(void) {
+    uint8_t  payload[3 + 2 * WD_SUBSYSTEM_COUNT];
+    uint16_t fired = watchdog_fired_count();
+    payload[0]     = WD_SUBSYSTEM_COUNT;
+    payload[1]     = fired & 0xFF;
+    payload[2]     = fired >> 8;
+    for (uint8_t i = 0; i < WD_SUBSYSTEM_COUNT; i++) {
+        uint16_t count         = watchdog_stall_count(i);
+        payload[3 + 2 * i]     = count & 0xFF;
+        payload[3 + 2 * i + 1] = count >> 8;
+    }
+    telemetry_emit(TELEMETRY_WATCHDOG, payload, sizeof(payload));
+}
+#endif
+
+void telemetry_task(void) {
+    static uint32_t last_emit = 0;
+    if (timer_elapsed32(last_emit) < TELEMETRY_INTERVAL_MS) {
+        return;
+    }
+    last_emit = timer_read32();
+
+#ifdef MATRIX_SCAN_PROFILER
+    telemetry_emit_scan_profile();
+#endif
+#ifdef PERF_COUNTER_ENABLE
+    telemetry_emit_perf_counters();
+#endif
+#ifdef RADIO_LINK_ENABLE
+    telemetry_emit_link_quality();
+#endif
+#ifdef WATCHDOG_ENABLE
+    telemetry_emit_watchdog();
+#endif
+}
@@ -0,0 +1,60 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Binary telemetry records over the console endpoint (TELEMETRY_ENABLE)
+ *
+ * Frames structured records into the same sendchar() stream that carries
+ * console text, so no extra USB endpoint is needed and hid_listen-style
+ * tooling keeps working (it shows the frames as line noise). A fleet
+ * agent resynchronizes on the two magic bytes, which never occur in
+ * ASCII console text, and validates the checksum; util/telemetry_decode.py
+ * is the reference parser. Records are fixed little-endian binary, so
+ * emission costs a few dozen sendchar() calls and none of xprintf's
+ * formatting time.
+ *
+ * Wire format (all multi-byte fields little-endian):
+ *   0xD7 0xA9                magic
+ *   uint8_t  version<<4|type TELEMETRY_VERSION in the high nibble
+ *   uint32_t timestamp       timer_read32(), ms since boot
+ *   uint8_t  length          payload bytes
+ *   uint8_t  payload[length]
+ *   uint8_t  checksum        XOR of everything from the version byte on
+ */
+
+#define TELEMETRY_VERSION 1
+
+enum telemetry_record_type {
+    TELEMETRY_SCAN_PROFILE  = 0x1, /* per-probe scan_profile_stats_t records */
+    TELEMETRY_PERF_COUNTERS = 0x2, /* the perf_counters[] array */
+    TELEMETRY_LINK_QUALITY  = 0x3, /* radio link frame/report counters */
+    TELEMETRY_WATCHDOG      = 0x4, /* watchdog reset count and per-subsystem stalls */
+};
+
+/* how often telemetry_task() emits the periodic records */
+#ifndef TELEMETRY_INTERVAL_MS
+#    define TELEMETRY_INTERVAL_MS 1000
+#endif
+
+/* frame and transmit one record; payload may be NULL when length is 0 */
+void telemetry_emit(uint8_t type, const void *payload, uint8_t length);
+
+/* periodic emission of every instrumentation source compiled in;
+ * called once per keyboard_task() pass */
+void telemetry_task(void);
@@ -20,7 +20,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "matrix.h"
 #include "debounce.h"
+#include "trace_probe.h"
 #include "quantum.h"
+#ifdef MATRIX_INJECT_ENABLE
+#    include "matrix_inject.h"
+#endif
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -94,6 +98,77 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+#ifdef MATRIX_FAST_PINS
+// Pre-resolved port/mask handles for the input pins, filled in by
+// matrix_init() after any *_RIGHT pin fixups, so the per-pin read loops
+// pay a single indirect port access instead of re-deriving the register
+// address and mask from the pin number on every read. Costs
+// sizeof(pin_fast_t) of RAM per input pin, hence opt-in. NO_PIN entries
+// carry a zero mask and always read as released.
+#    if !defined(DIRECT_PINS) && !(defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS))
+#        error "MATRIX_FAST_PINS requires the standard pin tables (DIRECT_PINS, or MATRIX_ROW_PINS and MATRIX_COL_PINS)"
+#    endif
+#    if defined(DIRECT_PINS)
+static pin_fast_t direct_pins_fast[MATRIX_ROWS][MATRIX_COLS];
+#    elif (DIODE_DIRECTION == COL2ROW)
+static pin_fast_t col_pins_fast[MATRIX_COLS];
+#    elif (DIODE_DIRECTION == ROW2COL)
+static pin_fast_t row_pins_fast[ROWS_PER_HAND];
+#    endif
+
+static inline uint8_t readMatrixPinFast(pin_fast_t handle) { return handle.mask ? (uint8_t)readPinFast(handle) : 1; }
+
+static void matrix_init_fast_pins(void) {
+#    if defined(DIRECT_PINS)
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                direct_pins_fast[row][col] = pinFastResolve(direct_pins[row][col]);
+            }
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        if (col_pins[i] != NO_PIN) {
+            col_pins_fast[i] = pinFastResolve(col_pins[i]);
+        }
+    }
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t i = 0; i < ROWS_PER_HAND; i++) {
+        if (row_pins[i] != NO_PIN) {
+            row_pins_fast[i] = pinFastResolve(row_pins[i]);
+        }
+    }
+#    endif
+}
+#endif
+
+#ifdef MATRIX_UNROLLED_SCAN
+// Force full unrolling of the per-pin scan loops. With the pin tables
+// const the compiler then folds each table load into an immediate pin
+// constant, turning the hot read path into straight-line code.
+#    if defined(DIRECT_PINS_RIGHT) || defined(MATRIX_ROW_PINS_RIGHT) || defined(MATRIX_COL_PINS_RIGHT)
+#        error "MATRIX_UNROLLED_SCAN requires constant pin tables; it cannot be combined with *_RIGHT pin overrides"
+#    endif
+#    define MATRIX_UNROLL_LOOP _Pragma("GCC unroll 32")
+#else
+#    define MATRIX_UNROLL_LOOP
+#endif
+
+#ifdef MATRIX_INTERRUPT_SCAN
+// Number of consecutive scans with an empty, unchanged matrix before the
+// matrix is parked and the MCU waits for a column interrupt.
+#    ifndef MATRIX_INTERRUPT_SCAN_IDLE_SCANS
+#        define MATRIX_INTERRUPT_SCAN_IDLE_SCANS 250
+#    endif
+
+static uint16_t matrix_idle_scan_count = 0;
+
+// Implemented by the platform/keyboard: arm pin-change interrupts on the
+// input pins and sleep until one fires (or a wakeup source elapses).
+__attribute__((weak)) void matrix_wait_for_interrupt(void) {}
+#endif
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -114,19 +189,57 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     matrix_row_t current_row_value = 0;
 
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_UNROLL_LOOP
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+#    ifdef MATRIX_FAST_PINS
+        current_row_value |= readMatrixPinFast(direct_pins_fast[current_row][col_index]) ? 0 : row_shifter;
+#    else
         pin_t pin = direct_pins[current_row][col_index];
         if (pin != NO_PIN) {
             current_row_value |= readPin(pin) ? 0 : row_shifter;
         }
+#    endif
     }
 
     // Update the matrix
     current_matrix[current_row] = current_row_value;
 }
 
+bool matrix_read_key(uint8_t row, uint8_t col) {
+    pin_t pin = direct_pins[row][col];
+    if (pin == NO_PIN) {
+        return false;
+    }
+    return !readPin(pin);
+}
+
+#    ifdef MATRIX_INTERRUPT_SCAN
+// Direct pins are permanently armed inputs; there is nothing to park.
+static void matrix_park_outputs(void) {}
+static void matrix_unpark_outputs(void) {}
+#    endif
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+
+#        ifdef MATRIX_PARALLEL_READ
+// Per-input-pin bit masks within the (single, shared) input port, filled in
+// by matrix_init() once the pin tables are final.
+static port_data_t matrix_input_masks[(DIODE_DIRECTION == COL2ROW) ? MATRIX_COLS : ROWS_PER_HAND];
+
+static void matrix_init_input_masks(void) {
+#            if (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        matrix_input_masks[i] = pinToBitMask(col_pins[i]);
+    }
+#            else
+    for (uint8_t i = 0; i < ROWS_PER_HAND; i++) {
+        matrix_input_masks[i] = pinToBitMask(row_pins[i]);
+    }
+#            endif
+}
+#        endif
+
 #        if (DIODE_DIRECTION == COL2ROW)
 
 static bool select_row(uint8_t row) {
@@ -151,6 +264,19 @@ static void unselect_rows(void) {
     }
 }
 
+#        ifdef MATRIX_INTERRUPT_SCAN
+// Park the matrix with every row driven active so that any keypress pulls
+// its column low and can trigger a pin-change interrupt.
+static void matrix_park_outputs(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        select_row(x);
+    }
+    matrix_output_select_delay();
+}
+
+static void matrix_unpark_outputs(void) { unselect_rows(); }
+#        endif
+
 __attribute__((weak)) void matrix_init_pins(void) {
     unselect_rows();
     for (uint8_t x = 0; x < MATRIX_COLS; x++) {
@@ -160,6 +286,46 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#        ifdef MATRIX_PIPELINED_SCAN
+#            ifndef MATRIX_PARALLEL_READ
+#                error "MATRIX_PIPELINED_SCAN requires MATRIX_PARALLEL_READ: the raw port sample must be cheap enough to defer bit extraction"
+#            endif
+// Pipelined scan: sample row N's port, immediately strobe row N+1, then
+// extract row N's bits while row N+1 settles. This hides both the
+// unselect and select settle windows behind useful work. NO_PIN rows are
+// not supported in this mode.
+static void matrix_read_rows_pipelined(matrix_row_t current_matrix[]) {
+    select_row(0);
+    matrix_output_select_delay();
+
+    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+        port_data_t port_value = readPort(col_pins[0]);
+
+        unselect_row(current_row);
+        if (current_row + 1 < ROWS_PER_HAND) {
+            select_row(current_row + 1);
+        }
+
+        // Extract the sampled bits while the next row settles
+        matrix_row_t current_row_value = 0;
+        matrix_row_t row_shifter       = MATRIX_ROW_SHIFTER;
+        MATRIX_UNROLL_LOOP
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            if (!(port_value & matrix_input_masks[col_index])) {
+                current_row_value |= row_shifter;
+            }
+        }
+        current_matrix[current_row] = current_row_value;
+
+        if (current_row + 1 < ROWS_PER_HAND) {
+            matrix_output_select_delay();
+        } else {
+            matrix_output_unselect_delay(current_row, current_row_value != 0);
+        }
+    }
+}
+#        endif
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
@@ -169,14 +335,32 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PARALLEL_READ
+    // All column pins share one GPIO port: sample it with a single read and
+    // extract each column bit. NO_PIN columns are not supported in this mode.
+    port_data_t  port_value  = readPort(col_pins[0]);
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_UNROLL_LOOP
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        if (!(port_value & matrix_input_masks[col_index])) {
+            current_row_value |= row_shifter;
+        }
+    }
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    MATRIX_UNROLL_LOOP
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+#                ifdef MATRIX_FAST_PINS
+        uint8_t pin_state = readMatrixPinFast(col_pins_fast[col_index]);
+#                else
         uint8_t pin_state = readMatrixPin(col_pins[col_index]);
+#                endif
 
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -186,6 +370,19 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+bool matrix_read_key(uint8_t row, uint8_t col) {
+    if (!select_row(row)) {
+        return false;
+    }
+    matrix_output_select_delay();
+
+    bool pressed = readMatrixPin(col_pins[col]) == 0;
+
+    unselect_row(row);
+    matrix_output_unselect_delay(row, pressed);
+    return pressed;
+}
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -210,6 +407,19 @@ static void unselect_cols(void) {
     }
 }
 
+#        ifdef MATRIX_INTERRUPT_SCAN
+// Park the matrix with every column driven active so that any keypress pulls
+// its row low and can trigger a pin-change interrupt.
+static void matrix_park_outputs(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        select_col(x);
+    }
+    matrix_output_select_delay();
+}
+
+static void matrix_unpark_outputs(void) { unselect_cols(); }
+#        endif
+
 __attribute__((weak)) void matrix_init_pins(void) {
     unselect_cols();
     for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
@@ -219,6 +429,48 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#        ifdef MATRIX_PIPELINED_SCAN
+#            ifndef MATRIX_PARALLEL_READ
+#                error "MATRIX_PIPELINED_SCAN requires MATRIX_PARALLEL_READ: the raw port sample must be cheap enough to defer bit extraction"
+#            endif
+// Pipelined scan: sample column N's port, immediately strobe column N+1,
+// then extract column N's bits while column N+1 settles. This hides both
+// the unselect and select settle windows behind useful work. NO_PIN
+// columns are not supported in this mode.
+static void matrix_read_cols_pipelined(matrix_row_t current_matrix[]) {
+    select_col(0);
+    matrix_output_select_delay();
+
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+        port_data_t port_value = readPort(row_pins[0]);
+
+        unselect_col(current_col);
+        if (current_col + 1 < MATRIX_COLS) {
+            select_col(current_col + 1);
+        }
+
+        // Extract the sampled bits while the next column settles
+        bool key_pressed = false;
+        MATRIX_UNROLL_LOOP
+        for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+            if (!(port_value & matrix_input_masks[row_index])) {
+                current_matrix[row_index] |= row_shifter;
+                key_pressed = true;
+            } else {
+                current_matrix[row_index] &= ~row_shifter;
+            }
+        }
+
+        if (current_col + 1 < MATRIX_COLS) {
+            matrix_output_select_delay();
+        } else {
+            matrix_output_unselect_delay(current_col, key_pressed);
+        }
+    }
+}
+#        endif
+
 __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter) {
     bool key_pressed = false;
 
@@ -228,10 +480,31 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PARALLEL_READ
+    // All row pins share one GPIO port: sample it with a single read and
+    // extract each row bit. NO_PIN rows are not supported in this mode.
+    port_data_t port_value = readPort(row_pins[0]);
+    MATRIX_UNROLL_LOOP
+    for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+        if (!(port_value & matrix_input_masks[row_index])) {
+            // Pin LO, set col bit
+            current_matrix[row_index] |= row_shifter;
+            key_pressed = true;
+        } else {
+            // Pin HI, clear col bit
+            current_matrix[row_index] &= ~row_shifter;
+        }
+    }
+#            else
     // For each row...
+    MATRIX_UNROLL_LOOP
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#                ifdef MATRIX_FAST_PINS
+        if (readMatrixPinFast(row_pins_fast[row_index]) == 0) {
+#                else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#                endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -240,12 +513,26 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
             current_matrix[row_index] &= ~row_shifter;
         }
     }
+#            endif
 
     // Unselect col
     unselect_col(current_col);
     matrix_output_unselect_delay(current_col, key_pressed);  // wait for all Row signals to go HIGH
 }
 
+bool matrix_read_key(uint8_t row, uint8_t col) {
+    if (!select_col(col)) {
+        return false;
+    }
+    matrix_output_select_delay();
+
+    bool pressed = readMatrixPin(row_pins[row]) == 0;
+
+    unselect_col(col);
+    matrix_output_unselect_delay(col, pressed);
+    return pressed;
+}
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
@@ -286,6 +573,14 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#if defined(MATRIX_PARALLEL_READ) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+    matrix_init_input_masks();
+#endif
+
+#ifdef MATRIX_FAST_PINS
+    matrix_init_fast_pins();
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
@@ -295,6 +590,10 @@ void matrix_init(void) {
         matrix[i]     = 0;
     }
 
+#ifdef MATRIX_MASKED
+    matrix_mask_init();
+#endif
+
     debounce_init(ROWS_PER_HAND);
 
     matrix_init_quantum();
@@ -332,10 +631,18 @@ bool matrix_post_scan(void) {
             changed = true;
         }
 
+#    ifdef MATRIX_MASKED
+        matrix_mask_refresh();
+#    endif
+
         matrix_scan_quantum();
     } else {
         transport_slave(matrix + thatHand, matrix + thisHand);
 
+#    ifdef MATRIX_MASKED
+        matrix_mask_refresh();
+#    endif
+
         matrix_slave_scan_kb();
     }
 
@@ -343,10 +650,50 @@ bool matrix_post_scan(void) {
 }
 #endif
 
+#ifdef MATRIX_INTERRUPT_SCAN
+// Returns true while the local half has been completely idle long enough
+// that the matrix can be parked and the MCU put to sleep until a key edge.
+static bool matrix_can_interrupt_scan(bool changed) {
+    if (changed) {
+        matrix_idle_scan_count = 0;
+        return false;
+    }
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row]) {
+            matrix_idle_scan_count = 0;
+            return false;
+        }
+    }
+    if (matrix_idle_scan_count < MATRIX_INTERRUPT_SCAN_IDLE_SCANS) {
+        matrix_idle_scan_count++;
+        return false;
+    }
+    return true;
+}
+
+// Drive every output active so any keypress reaches an input pin, sleep
+// until the platform wakes us, then restore the outputs for polling.
+// Also used by the suspend path for pin-change wake from host sleep.
+void matrix_interrupt_sleep(void) {
+    matrix_park_outputs();
+    matrix_wait_for_interrupt();
+    matrix_unpark_outputs();
+}
+#endif
+
+extern uint16_t matrix_scan_timestamp;
+
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
-#if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
+    // latch the event timestamp as close to the input sampling as possible
+    matrix_scan_timestamp = matrix_timestamp_read();
+
+#if defined(MATRIX_PIPELINED_SCAN) && !defined(DIRECT_PINS) && (DIODE_DIRECTION == COL2ROW)
+    matrix_read_rows_pipelined(curr_matrix);
+#elif defined(MATRIX_PIPELINED_SCAN) && !defined(DIRECT_PINS) && (DIODE_DIRECTION == ROW2COL)
+    matrix_read_cols_pipelined(curr_matrix);
+#elif defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
         matrix_read_cols_on_row(curr_matrix, current_row);
@@ -359,15 +706,57 @@ uint8_t matrix_scan(void) {
     }
 #endif
 
-    bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
-    if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+    // bitmap of the rows whose raw state changed this scan
+    uint32_t changed_rows = 0;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] != curr_matrix[row]) {
+            raw_matrix[row] = curr_matrix[row];
+            changed_rows |= (uint32_t)1 << row;
+        }
+    }
+    bool changed = changed_rows != 0;
+
+#ifdef MATRIX_INTERRUPT_SCAN
+    if (matrix_can_interrupt_scan(changed)) {
+        // All keys are up and the matrix has been quiet: sleep until a
+        // keypress reaches an input pin, then return to normal polling.
+        matrix_interrupt_sleep();
+        matrix_idle_scan_count = 0;
+    }
+#endif
+
+#ifdef MATRIX_SCAN_PROFILER
+    uint32_t debounce_start = scan_profile_timer_read_us();
+#endif
+
+    TRACE_DEBOUNCE_START();
+#ifdef SPLIT_KEYBOARD
+    debounce_dirty(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed_rows);
+#else
+    debounce_dirty(raw_matrix, matrix, ROWS_PER_HAND, changed_rows);
+#endif
+    TRACE_DEBOUNCE_END();
+
+#ifdef MATRIX_SCAN_PROFILER
+    scan_profile_sample(SCAN_PROFILE_DEBOUNCE, scan_profile_timer_read_us() - debounce_start);
+#endif
 
 #ifdef SPLIT_KEYBOARD
-    debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
     changed = (changed || matrix_post_scan());
 #else
-    debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef MATRIX_MASKED
+    matrix_mask_refresh();
+#    endif
     matrix_scan_quantum();
+#endif
+
+#ifdef MATRIX_INJECT_ENABLE
+    // test rig: merge host-injected key state after debounce, so it takes
+    // the same path through the event pipeline as an electrical keypress
+    changed = (matrix_inject_apply(matrix, MATRIX_ROWS) || changed);
+#    ifdef MATRIX_MASKED
+    matrix_mask_refresh();
+#    endif
 #endif
     return (uint8_t)changed;
 }
@@ -52,6 +52,21 @@ bool matrix_is_modified(void) __attribute__((deprecated));
 bool matrix_is_on(uint8_t row, uint8_t col);
 /* matrix state on row */
 matrix_row_t matrix_get_row(uint8_t row);
+#ifdef MATRIX_MASKED
+/* build the per-row mask resolution table from matrix_mask[]; called from matrix_init */
+void matrix_mask_init(void);
+/* re-apply matrix_mask[] to the rows it partially masks; called once the debounced matrix is committed */
+void matrix_mask_refresh(void);
+#endif
+/* timestamp latched when the matrix inputs were last sampled; used for key event times */
+uint16_t matrix_get_scan_timestamp(void);
+/* time source for the scan timestamp; override to latch a hardware capture timer */
+uint16_t matrix_timestamp_read(void);
+/* current electrical state of a single key, re-read on demand */
+bool matrix_read_key(uint8_t row, uint8_t col);
+/* oversampling burst around a suspected edge: true if the majority of
+ * re-reads agree the key is in state `pressed` */
+bool matrix_burst_verify(uint8_t row, uint8_t col, bool pressed);
 /* print matrix for debug */
 void matrix_print(void);
 /* delay between changing matrix pin state and reading values */
@@ -67,6 +82,8 @@ void matrix_power_down(void);
 /* executes code for Quantum */
 void matrix_init_quantum(void);
 void matrix_scan_quantum(void);
+/* heavy cosmetic bring-up (audio, LED/RGB matrix), deferrable via KEYBOARD_INIT_STAGED */
+void quantum_init_cosmetic(void);
 
 void matrix_init_kb(void);
 void matrix_scan_kb(void);
@@ -79,6 +96,13 @@ void matrix_slave_scan_kb(void);
 void matrix_slave_scan_user(void);
 #endif
 
+#ifdef MATRIX_INTERRUPT_SCAN
+/* arm pin-change interrupts on the matrix inputs and sleep until one fires */
+void matrix_wait_for_interrupt(void);
+/* park the outputs, sleep until a key edge, then restore them for polling */
+void matrix_interrupt_sleep(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
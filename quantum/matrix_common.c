@@ -13,8 +13,54 @@
 matrix_row_t raw_matrix[MATRIX_ROWS];
 matrix_row_t matrix[MATRIX_ROWS];
 
+/* timestamp of the most recent input sampling, latched as close to the
+ * electrical event as the scan engine allows */
+uint16_t matrix_scan_timestamp;
+
+__attribute__((weak)) uint16_t matrix_timestamp_read(void) { return timer_read(); }
+
+uint16_t matrix_get_scan_timestamp(void) { return matrix_scan_timestamp; }
+
 #ifdef MATRIX_MASKED
 extern const matrix_row_t matrix_mask[];
+
+/* Masked view of the debounced matrix, maintained at scan commit time so
+ * matrix_get_row() is a plain read instead of re-applying the mask on every
+ * call. Each row resolves through a pointer: rows whose mask keeps every
+ * column point straight into matrix[], rows whose mask drops every column
+ * point at a constant zero row, and neither costs anything per scan. Only the
+ * remaining, partially masked rows are collected into a list and re-masked by
+ * matrix_mask_refresh() once the debounced matrix has been committed. */
+#    define MATRIX_ROW_USED_MASK ((matrix_row_t)(((matrix_row_t) ~(matrix_row_t)0) >> (8 * sizeof(matrix_row_t) - MATRIX_COLS)))
+
+static matrix_row_t        matrix_masked[MATRIX_ROWS];
+static const matrix_row_t *matrix_effective[MATRIX_ROWS];
+static uint8_t             matrix_mask_rows[MATRIX_ROWS];
+static uint8_t             matrix_mask_row_count = 0;
+static const matrix_row_t  matrix_masked_none    = 0;
+
+void matrix_mask_init(void) {
+    matrix_mask_row_count = 0;
+    for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
+        matrix_row_t used = matrix_mask[i] & MATRIX_ROW_USED_MASK;
+        if (used == MATRIX_ROW_USED_MASK) {
+            matrix_effective[i] = &matrix[i];
+        } else if (used == 0) {
+            matrix_effective[i] = &matrix_masked_none;
+        } else {
+            matrix_effective[i]                       = &matrix_masked[i];
+            matrix_masked[i]                          = matrix[i] & matrix_mask[i];
+            matrix_mask_rows[matrix_mask_row_count++] = i;
+        }
+    }
+}
+
+void matrix_mask_refresh(void) {
+    for (uint8_t n = 0; n < matrix_mask_row_count; n++) {
+        uint8_t row       = matrix_mask_rows[n];
+        matrix_masked[row] = matrix[row] & matrix_mask[row];
+    }
+}
 #endif
 
 // user-defined overridable functions
@@ -37,9 +83,10 @@ inline bool matrix_is_on(uint8_t row, uint8_t col) { return (matrix[row] & ((mat
 
 inline matrix_row_t matrix_get_row(uint8_t row) {
     // Matrix mask lets you disable switches in the returned matrix data. For example, if you have a
-    // switch blocker installed and the switch is always pressed.
+    // switch blocker installed and the switch is always pressed. The mask is applied once per scan
+    // at commit time (matrix_mask_refresh()), so this stays a plain read.
 #ifdef MATRIX_MASKED
-    return matrix[row] & matrix_mask[row];
+    return *matrix_effective[row];
 #else
     return matrix[row];
 #endif
@@ -90,11 +137,45 @@ __attribute__((weak)) void matrix_io_delay(void) { wait_us(MATRIX_IO_DELAY); }
 __attribute__((weak)) void matrix_output_select_delay(void) { waitInputPinDelay(); }
 __attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_pressed) { matrix_io_delay(); }
 
+#ifndef DEBOUNCE_BURST_SAMPLES
+#    define DEBOUNCE_BURST_SAMPLES 3
+#endif
+#ifndef DEBOUNCE_BURST_INTERVAL_US
+#    define DEBOUNCE_BURST_INTERVAL_US 30
+#endif
+
+// Fallback when the matrix implementation has no single-key read; it just
+// mirrors the last full scan, so burst verification always agrees.
+__attribute__((weak)) bool matrix_read_key(uint8_t row, uint8_t col) { return raw_matrix[row] & (MATRIX_ROW_SHIFTER << col); }
+
+// Oversampling burst around a suspected edge: re-read the single key a few
+// times and accept the edge only if the majority of re-reads agree.
+__attribute__((weak)) bool matrix_burst_verify(uint8_t row, uint8_t col, bool pressed) {
+    uint8_t agree = 0;
+    for (uint8_t i = 0; i < DEBOUNCE_BURST_SAMPLES; i++) {
+        wait_us(DEBOUNCE_BURST_INTERVAL_US);
+        if (matrix_read_key(row, col) == pressed) {
+            agree++;
+        }
+    }
+    return agree * 2 > DEBOUNCE_BURST_SAMPLES;
+}
+
+// Fallback for debounce engines without per-row dirty tracking
+__attribute__((weak)) void debounce_dirty(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint32_t changed_rows) { debounce(raw, cooked, num_rows, changed_rows != 0); }
+
 // CUSTOM MATRIX 'LITE'
 __attribute__((weak)) void matrix_init_custom(void) {}
 
 __attribute__((weak)) bool matrix_scan_custom(matrix_row_t current_matrix[]) { return true; }
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_DEBOUNCE_LOCAL_ONLY)
+// Each half only carries debounce state for its own rows; the other half's
+// rows were already debounced there before transport and are copied through.
+#    include "split_util.h"
+#    define ROWS_PER_HAND (MATRIX_ROWS / 2)
+#endif
+
 __attribute__((weak)) void matrix_init(void) {
     matrix_init_custom();
 
@@ -104,15 +185,39 @@ __attribute__((weak)) void matrix_init(void) {
         matrix[i]     = 0;
     }
 
+#ifdef MATRIX_MASKED
+    matrix_mask_init();
+#endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_DEBOUNCE_LOCAL_ONLY)
+    debounce_init(ROWS_PER_HAND);
+#else
     debounce_init(MATRIX_ROWS);
+#endif
 
     matrix_init_quantum();
 }
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
+    matrix_scan_timestamp = matrix_timestamp_read();
+
     bool changed = matrix_scan_custom(raw_matrix);
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_DEBOUNCE_LOCAL_ONLY)
+    uint8_t this_hand = isLeftHand ? 0 : ROWS_PER_HAND;
+    uint8_t that_hand = ROWS_PER_HAND - this_hand;
+
+    debounce(raw_matrix + this_hand, matrix + this_hand, ROWS_PER_HAND, changed);
+    for (uint8_t i = 0; i < ROWS_PER_HAND; i++) {
+        matrix[that_hand + i] = raw_matrix[that_hand + i];
+    }
+#else
     debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+#endif
+
+#ifdef MATRIX_MASKED
+    matrix_mask_refresh();
+#endif
 
     matrix_scan_quantum();
     return changed;
@@ -0,0 +1,95 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Matrix injection test mode (MATRIX_INJECT_ENABLE = yes)
+ *
+ * Lets a host tool simulate key events over raw HID: an injected key is
+ * OR-ed into the debounced matrix on the next scan pass and then flows
+ * through the normal event pipeline (tapping, layers, report build, USB
+ * IN endpoint) exactly like an electrical keypress, minus the debounce
+ * window. Pairing the inject command with a read of the resulting
+ * keyboard report gives an end-to-end latency measurement that needs no
+ * external signal generator; see util/hid_latency_test.py.
+ *
+ * This is a test rig feature: it deliberately bypasses debounce, and an
+ * injected release also clears the bit if the physical key at that
+ * position happens to be held. Don't ship it enabled.
+ */
+
+#include <string.h>
+
+#include "matrix_inject.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+/* desired injected state, merged into the cooked matrix each scan */
+static matrix_row_t inject_overlay[MATRIX_ROWS];
+/* what the previous apply wrote, so released bits get taken back out */
+static matrix_row_t inject_applied[MATRIX_ROWS];
+
+void matrix_inject_set(uint8_t row, uint8_t col, bool pressed) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return;
+    }
+    if (pressed) {
+        inject_overlay[row] |= ((matrix_row_t)1 << col);
+    } else {
+        inject_overlay[row] &= ~((matrix_row_t)1 << col);
+    }
+}
+
+void matrix_inject_clear(void) { memset(inject_overlay, 0, sizeof(inject_overlay)); }
+
+bool matrix_inject_apply(matrix_row_t cooked_matrix[], uint8_t num_rows) {
+    bool changed = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t merged = (cooked_matrix[row] & ~inject_applied[row]) | inject_overlay[row];
+        if (merged != cooked_matrix[row]) {
+            cooked_matrix[row] = merged;
+            changed            = true;
+        }
+        inject_applied[row] = inject_overlay[row];
+    }
+    return changed;
+}
+
+#ifdef RAW_ENABLE
+
+bool matrix_inject_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != MATRIX_INJECT_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case id_matrix_inject_set:
+            if (length < 5) {
+                return false;
+            }
+            matrix_inject_set(data[2], data[3], data[4]);
+            break;
+        case id_matrix_inject_clear:
+            matrix_inject_clear();
+            break;
+        default:
+            return false;
+    }
+
+    raw_hid_send(data, length);
+    return true;
+}
+
+#endif
@@ -0,0 +1,46 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/* First byte of a raw HID packet addressed to the injector. Chosen high
+ * to stay clear of VIA's command range. */
+#define MATRIX_INJECT_HID_ID 0xE4
+
+enum matrix_inject_hid_command {
+    id_matrix_inject_set   = 0x01, /* [id, set, row, col, pressed] */
+    id_matrix_inject_clear = 0x02, /* release all injected keys */
+};
+
+/* Set or clear one injected key; takes effect on the next scan pass. */
+void matrix_inject_set(uint8_t row, uint8_t col, bool pressed);
+void matrix_inject_clear(void);
+
+/* Merge the injected state into the debounced matrix; called once per
+ * scan from matrix_scan(). Returns true if any row changed. */
+bool matrix_inject_apply(matrix_row_t cooked_matrix[], uint8_t num_rows);
+
+#ifdef RAW_ENABLE
+/* Call from raw_hid_receive_kb(); returns true if the packet was consumed.
+ * The packet is echoed back once the injection is latched, so the host
+ * can separate USB round-trip time from firmware processing time. */
+bool matrix_inject_hid_receive(uint8_t *data, uint8_t length);
+#endif
@@ -70,6 +70,89 @@ uint8_t mk_wheel_max_speed   = MOUSEKEY_WHEEL_MAX_SPEED;
 uint8_t mk_wheel_time_to_max = MOUSEKEY_WHEEL_TIME_TO_MAX;
 
 #    ifndef MK_COMBINED
+#        ifdef MOUSEKEY_CURVE_TABLE
+
+/* Velocity curve precomputed into 8.8 fixed-point tables indexed by the
+ * repeat counter, so each tick costs a lookup instead of a multiply and
+ * divide. The mk_* parameters are runtime-adjustable, so the tables live
+ * in RAM and are rebuilt when the parameters change rather than baked
+ * into PROGMEM. The fractional bits feed the sub-pixel accumulators in
+ * mousekey_task(), so slow curve segments are no longer truncated to
+ * whole pixels per event. */
+static uint16_t move_curve[MOUSEKEY_TIME_TO_MAX + 1];
+static uint16_t wheel_curve[MOUSEKEY_WHEEL_TIME_TO_MAX + 1];
+static uint8_t  move_frac_x  = 0;
+static uint8_t  move_frac_y  = 0;
+static uint8_t  wheel_frac_v = 0;
+static uint8_t  wheel_frac_h = 0;
+static uint8_t  curve_params[4];
+
+static uint16_t curve_entry(uint16_t delta, uint8_t max_speed, uint8_t time_to_max, uint8_t max, uint16_t i) {
+    uint32_t unit;
+    if (i == 0) {
+        unit = (uint32_t)delta << 8;
+    } else if (i >= time_to_max) {
+        unit = ((uint32_t)delta * max_speed) << 8;
+    } else {
+        unit = (((uint32_t)delta * max_speed * i) << 8) / time_to_max;
+    }
+    if (unit > ((uint32_t)max << 8)) unit = (uint32_t)max << 8;
+    return unit ? (uint16_t)unit : 1;
+}
+
+static void curve_rebuild(void) {
+    if (curve_params[0] == mk_max_speed && curve_params[1] == mk_time_to_max && curve_params[2] == mk_wheel_max_speed && curve_params[3] == mk_wheel_time_to_max) return;
+    curve_params[0] = mk_max_speed;
+    curve_params[1] = mk_time_to_max;
+    curve_params[2] = mk_wheel_max_speed;
+    curve_params[3] = mk_wheel_time_to_max;
+    for (uint16_t i = 0; i <= MOUSEKEY_TIME_TO_MAX; i++) {
+        move_curve[i] = curve_entry(MOUSEKEY_MOVE_DELTA, mk_max_speed, mk_time_to_max, MOUSEKEY_MOVE_MAX, i);
+    }
+    for (uint16_t i = 0; i <= MOUSEKEY_WHEEL_TIME_TO_MAX; i++) {
+        wheel_curve[i] = curve_entry(MOUSEKEY_WHEEL_DELTA, mk_wheel_max_speed, mk_wheel_time_to_max, MOUSEKEY_WHEEL_MAX, i);
+    }
+}
+
+static uint16_t move_curve_at(uint8_t i) {
+    if (i > mk_time_to_max) i = mk_time_to_max;
+    if (i > MOUSEKEY_TIME_TO_MAX) i = MOUSEKEY_TIME_TO_MAX;
+    return move_curve[i];
+}
+
+static uint16_t wheel_curve_at(uint8_t i) {
+    if (i > mk_wheel_time_to_max) i = mk_wheel_time_to_max;
+    if (i > MOUSEKEY_WHEEL_TIME_TO_MAX) i = MOUSEKEY_WHEEL_TIME_TO_MAX;
+    return wheel_curve[i];
+}
+
+static uint16_t move_unit_fp(void) {
+    curve_rebuild();
+    if (mousekey_accel & (1 << 0)) return move_curve_at(UINT8_MAX) / 4;
+    if (mousekey_accel & (1 << 1)) return move_curve_at(UINT8_MAX) / 2;
+    if (mousekey_accel & (1 << 2)) return move_curve_at(UINT8_MAX);
+    return move_curve_at(mousekey_repeat);
+}
+
+static uint16_t wheel_unit_fp(void) {
+    curve_rebuild();
+    if (mousekey_accel & (1 << 0)) return wheel_curve_at(UINT8_MAX) / 4;
+    if (mousekey_accel & (1 << 1)) return wheel_curve_at(UINT8_MAX) / 2;
+    if (mousekey_accel & (1 << 2)) return wheel_curve_at(UINT8_MAX);
+    return wheel_curve_at(mousekey_wheel_repeat);
+}
+
+static uint8_t move_unit(void) {
+    uint8_t unit = move_unit_fp() >> 8;
+    return unit ? unit : 1;
+}
+
+static uint8_t wheel_unit(void) {
+    uint8_t unit = wheel_unit_fp() >> 8;
+    return unit ? unit : 1;
+}
+
+#        else /* #ifdef MOUSEKEY_CURVE_TABLE */
 
 static uint8_t move_unit(void) {
     uint16_t unit;
@@ -107,6 +190,8 @@ static uint8_t wheel_unit(void) {
     return (unit > MOUSEKEY_WHEEL_MAX ? MOUSEKEY_WHEEL_MAX : (unit == 0 ? 1 : unit));
 }
 
+#        endif /* #ifdef MOUSEKEY_CURVE_TABLE */
+
 #    else /* #ifndef MK_COMBINED */
 #        ifdef MK_KINETIC_SPEED
 
@@ -218,8 +303,23 @@ void mousekey_task(void) {
 
     if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) > (mousekey_repeat ? mk_interval : mk_delay * 10)) {
         if (mousekey_repeat != UINT8_MAX) mousekey_repeat++;
+#    if defined(MOUSEKEY_CURVE_TABLE) && !defined(MK_COMBINED)
+        /* integer part moves this event, fractional part carries over */
+        uint16_t unit_fp = move_unit_fp();
+        if (tmpmr.x != 0) {
+            uint16_t acc   = move_frac_x + unit_fp;
+            mouse_report.x = (acc >> 8) * ((tmpmr.x > 0) ? 1 : -1);
+            move_frac_x    = acc & 0xFF;
+        }
+        if (tmpmr.y != 0) {
+            uint16_t acc   = move_frac_y + unit_fp;
+            mouse_report.y = (acc >> 8) * ((tmpmr.y > 0) ? 1 : -1);
+            move_frac_y    = acc & 0xFF;
+        }
+#    else
         if (tmpmr.x != 0) mouse_report.x = move_unit() * ((tmpmr.x > 0) ? 1 : -1);
         if (tmpmr.y != 0) mouse_report.y = move_unit() * ((tmpmr.y > 0) ? 1 : -1);
+#    endif
 
         /* diagonal move [1/sqrt(2)] */
         if (mouse_report.x && mouse_report.y) {
@@ -235,8 +335,22 @@ void mousekey_task(void) {
     }
     if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) > (mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10)) {
         if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
+#    if defined(MOUSEKEY_CURVE_TABLE) && !defined(MK_COMBINED)
+        uint16_t wheel_fp = wheel_unit_fp();
+        if (tmpmr.v != 0) {
+            uint16_t acc   = wheel_frac_v + wheel_fp;
+            mouse_report.v = (acc >> 8) * ((tmpmr.v > 0) ? 1 : -1);
+            wheel_frac_v   = acc & 0xFF;
+        }
+        if (tmpmr.h != 0) {
+            uint16_t acc   = wheel_frac_h + wheel_fp;
+            mouse_report.h = (acc >> 8) * ((tmpmr.h > 0) ? 1 : -1);
+            wheel_frac_h   = acc & 0xFF;
+        }
+#    else
         if (tmpmr.v != 0) mouse_report.v = wheel_unit() * ((tmpmr.v > 0) ? 1 : -1);
         if (tmpmr.h != 0) mouse_report.h = wheel_unit() * ((tmpmr.h > 0) ? 1 : -1);
+#    endif
 
         /* diagonal move [1/sqrt(2)] */
         if (mouse_report.v && mouse_report.h) {
@@ -315,11 +429,21 @@ void mousekey_off(uint8_t code) {
         mousekey_accel &= ~(1 << 2);
     if (mouse_report.x == 0 && mouse_report.y == 0) {
         mousekey_repeat = 0;
+#    if defined(MOUSEKEY_CURVE_TABLE) && !defined(MK_COMBINED)
+        move_frac_x = 0;
+        move_frac_y = 0;
+#    endif
 #    ifdef MK_KINETIC_SPEED
         mouse_timer = 0;
 #    endif /* #ifdef MK_KINETIC_SPEED */
     }
-    if (mouse_report.v == 0 && mouse_report.h == 0) mousekey_wheel_repeat = 0;
+    if (mouse_report.v == 0 && mouse_report.h == 0) {
+        mousekey_wheel_repeat = 0;
+#    if defined(MOUSEKEY_CURVE_TABLE) && !defined(MK_COMBINED)
+        wheel_frac_v = 0;
+        wheel_frac_h = 0;
+#    endif
+    }
 }
 
 #else /* #ifndef MK_3_SPEED */
@@ -466,6 +590,12 @@ void mousekey_clear(void) {
     mousekey_repeat       = 0;
     mousekey_wheel_repeat = 0;
     mousekey_accel        = 0;
+#if defined(MOUSEKEY_CURVE_TABLE) && !defined(MK_3_SPEED) && !defined(MK_COMBINED)
+    move_frac_x  = 0;
+    move_frac_y  = 0;
+    wheel_frac_v = 0;
+    wheel_frac_h = 0;
+#endif
 }
 
 static void mousekey_debug(void) {
@@ -0,0 +1,122 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* On-device performance counters (PERF_COUNTER_ENABLE = yes)
+ *
+ * A fixed set of named event counters and accumulating microsecond
+ * timers, instrumented across the scan loop, the lighting task, the
+ * split transport and the i2c/spi drivers. Counters are plain uint32
+ * increments; timers pair a start/stop around a section and accumulate
+ * total elapsed time plus a sample count, so a host tool can diff two
+ * raw HID dumps and derive rates and averages without any on-device
+ * arithmetic. The microsecond source is scan_profile_timer_read_us(),
+ * shared with the scan profiler; override it per platform for real
+ * sub-millisecond resolution.
+ */
+
+#include <string.h>
+
+#include "perf_counter.h"
+#include "keyboard.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+uint32_t perf_counters[PERF_COUNTER_COUNT];
+
+typedef struct {
+    uint32_t total_us;
+    uint32_t samples;
+    uint32_t start_us;
+    bool     running;
+} perf_timer_t;
+
+static perf_timer_t perf_timers[PERF_TIMER_COUNT];
+
+void perf_timer_start(uint8_t timer) {
+    perf_timer_t *t = &perf_timers[timer];
+    t->start_us     = scan_profile_timer_read_us();
+    t->running      = true;
+}
+
+void perf_timer_stop(uint8_t timer) {
+    perf_timer_t *t = &perf_timers[timer];
+    if (!t->running) {
+        return; /* unmatched stop, e.g. an early return skipped the start */
+    }
+    t->total_us += scan_profile_timer_read_us() - t->start_us;
+    t->samples++;
+    t->running = false;
+}
+
+uint32_t perf_counter_get(uint8_t counter) { return perf_counters[counter]; }
+
+void perf_timer_get(uint8_t timer, uint32_t *total_us, uint32_t *samples) {
+    *total_us = perf_timers[timer].total_us;
+    *samples  = perf_timers[timer].samples;
+}
+
+void perf_counter_reset(void) {
+    memset(perf_counters, 0, sizeof(perf_counters));
+    memset(perf_timers, 0, sizeof(perf_timers));
+}
+
+#ifdef RAW_ENABLE
+
+static uint8_t *write_u32(uint8_t *p, uint32_t value) {
+    *p++ = value & 0xFF;
+    *p++ = (value >> 8) & 0xFF;
+    *p++ = (value >> 16) & 0xFF;
+    *p++ = (value >> 24) & 0xFF;
+    return p;
+}
+
+bool perf_counter_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != PERF_COUNTER_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case id_perf_counter_get: {
+            uint8_t *p = &data[2];
+            for (uint8_t i = 0; i < PERF_COUNTER_COUNT && (uint8_t)(p - data) + 4 <= length; i++) {
+                p = write_u32(p, perf_counters[i]);
+            }
+            break;
+        }
+        case id_perf_timer_get: {
+            if (length < 3 || data[2] >= PERF_TIMER_COUNT) {
+                return false;
+            }
+            uint32_t total_us, samples;
+            perf_timer_get(data[2], &total_us, &samples);
+            uint8_t *p = &data[3];
+            p          = write_u32(p, total_us);
+            write_u32(p, samples);
+            break;
+        }
+        case id_perf_counter_reset:
+            perf_counter_reset();
+            break;
+        default:
+            return false;
+    }
+
+    raw_hid_send(data, length);
+    return true;
+}
+
+#endif
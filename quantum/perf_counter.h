@@ -0,0 +1,83 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Fixed-slot event counters. Incrementing one is a single array element
+ * bump (PERF_COUNT below), cheap enough to leave in driver hot paths. */
+enum perf_counter_id {
+    PERF_SCAN_PASSES = 0,    /* keyboard_task() passes that ran a scan */
+    PERF_KEY_EVENTS,         /* key edges handed to action_exec() */
+    PERF_RGB_FRAMES,         /* rgb_matrix_task() invocations */
+    PERF_SPLIT_TRANSACTIONS, /* master->slave transport rounds */
+    PERF_SPLIT_ERRORS,       /* transport rounds that failed */
+    PERF_I2C_TRANSFERS,      /* i2c_transmit()/i2c_receive() calls */
+    PERF_I2C_ERRORS,         /* I2C transfers that returned an error */
+    PERF_SPI_TRANSFERS,      /* spi_transmit()/spi_receive() calls */
+    PERF_COUNTER_COUNT
+};
+
+/* Accumulating microsecond timers: total elapsed time and sample count,
+ * so hosts can derive averages and rates between two dumps. */
+enum perf_timer_id {
+    PERF_TIMER_KEYBOARD_TASK = 0, /* one full keyboard_task() pass */
+    PERF_TIMER_RGB_MATRIX,        /* rgb_matrix_task() */
+    PERF_TIMER_TRANSPORT,         /* split transport round */
+    PERF_TIMER_COUNT
+};
+
+/* First byte of a raw HID packet addressed to the counter subsystem.
+ * Chosen high to stay clear of VIA's command range. */
+#define PERF_COUNTER_HID_ID 0xE5
+
+enum perf_counter_hid_command {
+    id_perf_counter_get   = 0x01, /* [id, get] -> counters, little-endian uint32 */
+    id_perf_timer_get     = 0x02, /* [id, get, timer] -> total_us, samples (uint32) */
+    id_perf_counter_reset = 0x03, /* zero all counters and timers */
+};
+
+#ifdef PERF_COUNTER_ENABLE
+
+extern uint32_t perf_counters[PERF_COUNTER_COUNT];
+
+/* one load/increment/store; no function call on the hot path */
+#    define PERF_COUNT(id) (perf_counters[id]++)
+
+void perf_timer_start(uint8_t timer);
+void perf_timer_stop(uint8_t timer);
+#    define PERF_TIMER_START(id) perf_timer_start(id)
+#    define PERF_TIMER_STOP(id) perf_timer_stop(id)
+
+uint32_t perf_counter_get(uint8_t counter);
+void     perf_timer_get(uint8_t timer, uint32_t *total_us, uint32_t *samples);
+void     perf_counter_reset(void);
+
+#    ifdef RAW_ENABLE
+/* Call from raw_hid_receive_kb(); returns true if the packet was consumed. */
+bool perf_counter_hid_receive(uint8_t *data, uint8_t length);
+#    endif
+
+#else
+
+/* compiled out: instrumented call sites need no #ifdef of their own */
+#    define PERF_COUNT(id)
+#    define PERF_TIMER_START(id)
+#    define PERF_TIMER_STOP(id)
+
+#endif
@@ -0,0 +1,73 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pin_change.h"
+
+#if !defined(__AVR__)
+#    error "PIN_CHANGE_NOTIFY_ENABLE is currently only supported on AVR"
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#if !defined(PCMSK0)
+#    error "PIN_CHANGE_NOTIFY_ENABLE requires pin-change interrupt support (PCINT0)"
+#endif
+
+#ifndef MAX_PIN_CHANGE_HANDLERS
+#    define MAX_PIN_CHANGE_HANDLERS 8
+#endif
+
+typedef struct pin_change_entry_t {
+    uint8_t               mask;
+    pin_change_callback_t callback;
+} pin_change_entry_t;
+
+static pin_change_entry_t pin_change_entries[MAX_PIN_CHANGE_HANDLERS];
+static uint8_t            pin_change_entry_count = 0;
+static uint8_t            pin_change_last_state  = 0;
+
+bool pin_change_register(pin_t pin, pin_change_callback_t callback) {
+    // only the PCINT0 bank (port B on the ATmega32U4 family) can interrupt
+    if ((pin >> PORT_SHIFTER) != PINB_ADDRESS) {
+        return false;
+    }
+    if (pin_change_entry_count == MAX_PIN_CHANGE_HANDLERS) {
+        return false;
+    }
+    uint8_t mask = _BV(pin & 0xF);
+
+    pin_change_entries[pin_change_entry_count].mask     = mask;
+    pin_change_entries[pin_change_entry_count].callback = callback;
+    pin_change_entry_count++;
+
+    pin_change_last_state = PINB;
+    PCMSK0 |= mask;
+    PCICR |= _BV(PCIE0);
+    return true;
+}
+
+ISR(PCINT0_vect) {
+    uint8_t state   = PINB;
+    uint8_t changed = state ^ pin_change_last_state;
+
+    pin_change_last_state = state;
+    for (uint8_t i = 0; i < pin_change_entry_count; i++) {
+        if (pin_change_entries[i].mask & changed) {
+            pin_change_entries[i].callback();
+        }
+    }
+}
@@ -0,0 +1,30 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+/* Shared pin-change notification framework. Consumers register a callback
+ * for a pin and stop polling it; the callback runs in interrupt context
+ * whenever the pin toggles, so it should only set a flag or update an
+ * accumulator the main loop drains. */
+
+typedef void (*pin_change_callback_t)(void);
+
+/* Returns false if the pin cannot raise a pin-change interrupt or the
+ * handler table is full - the caller should keep polling in that case. */
+bool pin_change_register(pin_t pin, pin_change_callback_t callback);
@@ -22,11 +22,40 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "print.h"
 #include "debug.h"
 #include "pointing_device.h"
+#include "triple_buffer.h"
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_POINTING_ENABLE)
+#    include "keyboard.h"
+#    include "transactions.h"
+#endif  // defined(SPLIT_KEYBOARD) && defined(SPLIT_POINTING_ENABLE)
 
 static report_mouse_t mouseReport = {};
+// Hands finished reports from pointing_device_set_report() to
+// pointing_device_send(), so a report published from a driver callback can
+// never be observed half-written by the sending side
+static TRIPLE_BUFFER_T(report_mouse_t) sharedReport = TRIPLE_BUFFER_INIT;
 
 __attribute__((weak)) bool has_mouse_report_changed(report_mouse_t new, report_mouse_t old) { return (new.buttons != old.buttons) || (new.x&& new.x != old.x) || (new.y&& new.y != old.y) || (new.h&& new.h != old.h) || (new.v&& new.v != old.v); }
 
+#ifdef POINTING_DEVICE_REPORT_INTERVAL
+// Sub-frame deltas gathered between paced reports; int16_t so several
+// full-scale samples can pile up without loss
+static int16_t  accumulated_x;
+static int16_t  accumulated_y;
+static int16_t  accumulated_v;
+static int16_t  accumulated_h;
+static uint16_t report_interval_timer;
+
+static int8_t pointing_device_take8(int16_t* accumulator) {
+    int16_t value = *accumulator;
+    if (value > 127) value = 127;
+    if (value < -127) value = -127;
+    // leave any clipped remainder for the next report
+    *accumulator -= value;
+    return (int8_t)value;
+}
+#endif
+
 __attribute__((weak)) void pointing_device_init(void) {
     // initialize device, if that needs to be done.
 }
@@ -34,6 +63,55 @@ __attribute__((weak)) void pointing_device_init(void) {
 __attribute__((weak)) void pointing_device_send(void) {
     static report_mouse_t old_report = {};
 
+    // Pick up the latest complete report; the triple buffer guarantees a
+    // coherent snapshot even if pointing_device_set_report() runs concurrently
+    report_mouse_t* latest = tbuf_read(&sharedReport);
+    if (latest) {
+        mouseReport = *latest;
+    }
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_POINTING_ENABLE)
+    // On the slave half there is no host to report to; queue the deltas for
+    // the master's next pointing fetch instead
+    if (!is_keyboard_master()) {
+        static uint8_t last_buttons = 0;
+        if (mouseReport.x || mouseReport.y || mouseReport.v || mouseReport.h || mouseReport.buttons != last_buttons) {
+            split_pointing_accumulate(mouseReport);
+            last_buttons = mouseReport.buttons;
+        }
+        mouseReport.x = 0;
+        mouseReport.y = 0;
+        mouseReport.v = 0;
+        mouseReport.h = 0;
+        old_report    = mouseReport;
+        return;
+    }
+#endif  // defined(SPLIT_KEYBOARD) && defined(SPLIT_POINTING_ENABLE)
+
+#ifdef POINTING_DEVICE_REPORT_INTERVAL
+    // Decouple sampling from reporting: the task may sample the sensor on
+    // every scan pass, but reports leave on a fixed cadence with the
+    // sub-frame deltas accumulated, so pacing follows the timer rather
+    // than scan-loop jitter. Button edges bypass the pacing.
+    accumulated_x += mouseReport.x;
+    accumulated_y += mouseReport.y;
+    accumulated_v += mouseReport.v;
+    accumulated_h += mouseReport.h;
+    if (mouseReport.buttons == old_report.buttons && timer_elapsed(report_interval_timer) < POINTING_DEVICE_REPORT_INTERVAL) {
+        mouseReport.x = 0;
+        mouseReport.y = 0;
+        mouseReport.v = 0;
+        mouseReport.h = 0;
+        old_report    = mouseReport;
+        return;
+    }
+    report_interval_timer = timer_read();
+    mouseReport.x         = pointing_device_take8(&accumulated_x);
+    mouseReport.y         = pointing_device_take8(&accumulated_y);
+    mouseReport.v         = pointing_device_take8(&accumulated_v);
+    mouseReport.h         = pointing_device_take8(&accumulated_h);
+#endif
+
     // If you need to do other things, like debugging, this is the place to do it.
     if (has_mouse_report_changed(mouseReport, old_report)) {
         host_mouse_send(&mouseReport);
@@ -59,4 +137,7 @@ __attribute__((weak)) void pointing_device_task(void) {
 
 report_mouse_t pointing_device_get_report(void) { return mouseReport; }
 
-void pointing_device_set_report(report_mouse_t newMouseReport) { mouseReport = newMouseReport; }
+void pointing_device_set_report(report_mouse_t newMouseReport) {
+    mouseReport = newMouseReport;
+    tbuf_write(&sharedReport, newMouseReport);
+}
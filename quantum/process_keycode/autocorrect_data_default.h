@@ -0,0 +1,39 @@
+/* Built-in default autocorrect dictionary. Replaced entirely when a generated
+ * autocorrect_data.h is found on the include path (put one next to your
+ * keymap). Source entries:
+ *
+ *     :teh        -> the
+ *     widht       -> width
+ *     recieve     -> receive
+ *     seperate    -> separate
+ *     definately  -> definitely
+ *     occured     -> occurred
+ *     acheive     -> achieve
+ *     beleive     -> believe
+ *     wierd       -> weird
+ *     :alot:      -> a lot
+ */
+// Generated by util/make_autocorrect_data.py from autocorrect_dict.txt
+// 10 entries, 170 bytes. Do not edit by hand.
+#pragma once
+
+#define AUTOCORRECT_MIN_LENGTH 4
+#define AUTOCORRECT_MAX_LENGTH 10
+
+static const uint8_t autocorrect_data[170] PROGMEM = {
+    0x07, 0x13, 0x00, 0x08, 0x31, 0x00, 0x0B, 0x78, 0x00, 0x17, 0x81, 0x00,
+    0x1C, 0x8B, 0x00, 0x2C, 0x9D, 0x00, 0x00, 0x08, 0x1A, 0x00, 0x15, 0x26,
+    0x00, 0x00, 0x40, 0x15, 0x18, 0x06, 0x06, 0x12, 0x00, 0x81, 0x72, 0x65,
+    0x64, 0x00, 0x40, 0x08, 0x0C, 0x1A, 0x00, 0x83, 0x65, 0x69, 0x72, 0x64,
+    0x00, 0x17, 0x38, 0x00, 0x19, 0x47, 0x00, 0x00, 0x40, 0x04, 0x15, 0x08,
+    0x13, 0x08, 0x16, 0x00, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x08,
+    0x4E, 0x00, 0x0C, 0x5A, 0x00, 0x00, 0x40, 0x0C, 0x06, 0x08, 0x15, 0x00,
+    0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x40, 0x08, 0x00, 0x0B, 0x64, 0x00,
+    0x0F, 0x6E, 0x00, 0x00, 0x40, 0x06, 0x04, 0x00, 0x83, 0x69, 0x65, 0x76,
+    0x65, 0x00, 0x40, 0x08, 0x05, 0x00, 0x83, 0x69, 0x65, 0x76, 0x65, 0x00,
+    0x40, 0x08, 0x17, 0x2C, 0x00, 0x81, 0x68, 0x65, 0x00, 0x40, 0x0B, 0x07,
+    0x0C, 0x1A, 0x00, 0x81, 0x74, 0x68, 0x00, 0x40, 0x0F, 0x08, 0x17, 0x04,
+    0x11, 0x0C, 0x09, 0x08, 0x07, 0x00, 0x84, 0x69, 0x74, 0x65, 0x6C, 0x79,
+    0x00, 0x40, 0x17, 0x12, 0x0F, 0x04, 0x2C, 0x00, 0xC3, 0x20, 0x6C, 0x6F,
+    0x74, 0x00,
+};
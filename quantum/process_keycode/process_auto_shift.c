@@ -23,7 +23,11 @@
 
 static uint16_t autoshift_time    = 0;
 static uint16_t autoshift_timeout = AUTO_SHIFT_TIMEOUT;
-static uint16_t autoshift_lastkey = KC_NO;
+// Expiry timestamp of the key currently in progress, computed once at press
+// so the scan loop only compares against it instead of recomputing elapsed
+// time every scan.
+static uint16_t autoshift_deadline = 0;
+static uint16_t autoshift_lastkey  = KC_NO;
 static struct {
     // Whether autoshift is enabled.
     bool enabled : 1;
@@ -74,6 +78,7 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     // Record the keycode so we can simulate it later.
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
+    autoshift_deadline          = now + autoshift_timeout;
     autoshift_flags.in_progress = true;
 
 #    if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
@@ -141,9 +146,8 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger) {
  */
 void autoshift_matrix_scan(void) {
     if (autoshift_flags.in_progress) {
-        const uint16_t now     = timer_read();
-        const uint16_t elapsed = TIMER_DIFF_16(now, autoshift_time);
-        if (elapsed >= autoshift_timeout) {
+        const uint16_t now = timer_read();
+        if (timer_expired(now, autoshift_deadline)) {
             autoshift_end(autoshift_lastkey, now, true);
         }
     }
@@ -175,7 +179,12 @@ bool get_autoshift_state(void) { return autoshift_flags.enabled; }
 
 uint16_t get_autoshift_timeout(void) { return autoshift_timeout; }
 
-void set_autoshift_timeout(uint16_t timeout) { autoshift_timeout = timeout; }
+void set_autoshift_timeout(uint16_t timeout) {
+    autoshift_timeout = timeout;
+    if (autoshift_flags.in_progress) {
+        autoshift_deadline = autoshift_time + autoshift_timeout;
+    }
+}
 
 bool process_auto_shift(uint16_t keycode, keyrecord_t *record) {
     // Note that record->event.time isn't reliable, see:
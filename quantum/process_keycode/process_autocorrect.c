@@ -0,0 +1,207 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "process_autocorrect.h"
+
+#if __has_include("autocorrect_data.h")
+#    include "autocorrect_data.h"
+#else
+#    include "autocorrect_data_default.h"
+#endif
+
+/* Trie node encoding (see util/make_autocorrect_data.py, which is the only
+ * producer of this format):
+ *
+ *   0x80|flags|bspaces  leaf: erase `bspaces & 0x3F` characters and send the
+ *                       NUL-terminated correction string that follows. Flag
+ *                       0x40 means the match was completed by a word-boundary
+ *                       key, which is not suppressed.
+ *   0x40                chain: the NUL-terminated keycode run that follows
+ *                       must match successive buffer entries, newest first;
+ *                       the next node continues directly after the NUL.
+ *   otherwise           branch: (keycode, offset_lo, offset_hi) entries
+ *                       terminated by a zero keycode.
+ *
+ * Typos are stored spelled backwards, so a lookup starts at the newest
+ * keystroke and walks towards older ones; the walk is bounded by
+ * AUTOCORRECT_MAX_LENGTH regardless of dictionary size. */
+
+static bool autocorrect_enabled = true;
+
+/* Recent keycodes, oldest first. Seeded with a word boundary so dictionary
+ * entries anchored to the start of a word can match the very first thing
+ * typed after a reset. */
+static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+static uint8_t typo_buffer_size                    = 1;
+
+bool autocorrect_is_enabled(void) { return autocorrect_enabled; }
+
+void autocorrect_enable(void) { autocorrect_enabled = true; }
+
+void autocorrect_disable(void) {
+    autocorrect_enabled = false;
+    typo_buffer_size    = 1;
+}
+
+void autocorrect_toggle(void) {
+    if (autocorrect_enabled) {
+        autocorrect_disable();
+    } else {
+        autocorrect_enable();
+    }
+}
+
+static void typo_buffer_reset(void) {
+    typo_buffer[0]   = KC_SPC;
+    typo_buffer_size = 1;
+}
+
+// Walk the trie against the buffer, newest keystroke first. On a match,
+// returns the leaf flag byte and points *correction at the flash-resident
+// replacement string; returns 0 otherwise.
+static uint8_t autocorrect_match(const char **correction) {
+    uint16_t offset = 0;
+    uint8_t  depth  = typo_buffer_size;
+    for (;;) {
+        uint8_t code = pgm_read_byte(autocorrect_data + offset);
+        if (code & 0x80) {
+            // leaf: a dictionary typo ends here
+            *correction = (const char *)(autocorrect_data + offset + 1);
+            return code;
+        }
+        if (code == 0x40) {
+            // chain: single-child run, compare in place
+            offset++;
+            for (;;) {
+                code = pgm_read_byte(autocorrect_data + offset);
+                if (code == 0) {
+                    offset++;  // chain done; next node follows the NUL
+                    break;
+                }
+                if (depth == 0 || typo_buffer[depth - 1] != code) {
+                    return 0;
+                }
+                depth--;
+                offset++;
+            }
+            continue;
+        }
+        // branch: find the entry for the next-oldest keystroke
+        if (depth == 0) {
+            return 0;
+        }
+        uint8_t key = typo_buffer[depth - 1];
+        for (;;) {
+            code = pgm_read_byte(autocorrect_data + offset);
+            if (code == 0) {
+                return 0;
+            }
+            if (code == key) {
+                offset = pgm_read_byte(autocorrect_data + offset + 1) | (pgm_read_byte(autocorrect_data + offset + 2) << 8);
+                break;
+            }
+            offset += 3;
+        }
+        depth--;
+    }
+}
+
+bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
+    if (!autocorrect_enabled || !record->event.pressed) {
+        return true;
+    }
+
+    switch (keycode) {
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+            // dual-role keys count only when tapped
+            if (record->tap.count == 0) {
+                return true;
+            }
+            keycode &= 0xFF;
+            break;
+    }
+
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+    if (mods & ~MOD_MASK_SHIFT) {
+        // chorded shortcut, not prose; whatever was being typed is over
+        typo_buffer_reset();
+        return true;
+    }
+
+    uint8_t key;
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            key = (uint8_t)keycode;
+            break;
+        case KC_1 ... KC_0:
+        case KC_ENT:
+        case KC_TAB:
+        case KC_SPC:
+        case KC_MINS:
+        case KC_DOT:
+        case KC_COMM:
+        case KC_SCLN:
+        case KC_SLSH:
+            key = KC_SPC;  // any word boundary is stored as a space
+            break;
+        case KC_QUOT:
+            key = KC_QUOT;  // apostrophe is part of contractions
+            break;
+        case KC_BSPC:
+            if (typo_buffer_size > 0) {
+                typo_buffer_size--;
+            }
+            return true;
+        case KC_LSFT:
+        case KC_RSFT:
+            return true;  // capitalization does not affect matching
+        default:
+            typo_buffer_reset();
+            return true;
+    }
+
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    typo_buffer[typo_buffer_size++] = key;
+
+    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+        return true;
+    }
+
+    const char *correction;
+    uint8_t     leaf = autocorrect_match(&correction);
+    if (leaf == 0) {
+        return true;
+    }
+
+    for (uint8_t i = leaf & 0x3F; i > 0; i--) {
+        tap_code(KC_BSPC);
+    }
+    send_string_P(correction);
+    typo_buffer_reset();
+
+    // A boundary-completed match keeps its trigger key (the correction is
+    // typed before it registers); a letter-completed match replaces it, the
+    // correction string already ends with that letter.
+    return (leaf & 0x40) != 0;
+}
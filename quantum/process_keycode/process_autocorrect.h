@@ -0,0 +1,44 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "action.h"
+
+/**
+ * Autocorrect (AUTOCORRECT_ENABLE) watches the letters you type and fixes
+ * common typos on the fly: when the last few keystrokes spell a word from the
+ * dictionary, the typo is erased with backspaces and the correction is sent
+ * in its place.
+ *
+ * The dictionary is compiled at build time by util/make_autocorrect_data.py
+ * into a trie stored in flash, keyed on the typo spelled backwards so each
+ * keystroke is matched newest-letter-first in one bounded walk -- there is no
+ * per-keystroke scan over the word list, and the only RAM cost is a buffer of
+ * the last AUTOCORRECT_MAX_LENGTH keycodes. Drop the generated
+ * autocorrect_data.h next to your keymap to replace the small built-in
+ * default dictionary.
+ */
+
+bool process_autocorrect(uint16_t keycode, keyrecord_t *record);
+
+bool autocorrect_is_enabled(void);
+void autocorrect_enable(void);
+void autocorrect_disable(void);
+void autocorrect_toggle(void);
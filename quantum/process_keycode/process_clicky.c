@@ -21,6 +21,9 @@
 #    ifndef AUDIO_CLICKY_FREQ_RANDOMNESS
 #        define AUDIO_CLICKY_FREQ_RANDOMNESS 0.05f
 #    endif  // !AUDIO_CLICKY_FREQ_RANDOMNESS
+#    ifndef AUDIO_CLICKY_BLIP_DURATION
+#        define AUDIO_CLICKY_BLIP_DURATION 10  // milliseconds
+#    endif  // !AUDIO_CLICKY_BLIP_DURATION
 
 float clicky_freq = AUDIO_CLICKY_FREQ_DEFAULT;
 float clicky_rand = AUDIO_CLICKY_FREQ_RANDOMNESS;
@@ -39,9 +42,17 @@ void clicky_play(void) {
 #    ifndef NO_MUSIC_MODE
     if (music_activated || midi_activated || !audio_config.enable) return;
 #    endif  // !NO_MUSIC_MODE
+#    ifdef AUDIO_CLICKY_BLIP
+    /* one-shot blip: a single tone handed straight to the audio driver,
+     * which starts rendering it within the current buffer period. This
+     * skips the melody state machine and its tempo-quantized delay note,
+     * so the click follows the keystroke at constant cost. */
+    audio_play_note(clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX)))), AUDIO_CLICKY_BLIP_DURATION);
+#    else
     clicky_song[1][0] = 2.0f * clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
     clicky_song[2][0] = clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
     PLAY_SONG(clicky_song);
+#    endif  // AUDIO_CLICKY_BLIP
 }
 
 void clicky_freq_up(void) {
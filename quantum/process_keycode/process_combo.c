@@ -18,6 +18,14 @@
 #include "process_combo.h"
 #include "action_tapping.h"
 
+#ifdef TIMEOUT_WHEEL_ENABLE
+#    include "timeout_wheel.h"
+#endif
+
+#ifdef COMBO_KEY_INDEX
+#    include <stdlib.h>
+#endif
+
 
 #ifdef COMBO_COUNT
 __attribute__((weak)) combo_t  key_combos[COMBO_COUNT];
@@ -51,6 +59,21 @@ static uint16_t timer                 = 0;
 static bool     b_combo_enable        = true;  // defaults to enabled
 static uint16_t longest_term          = 0;
 
+#if defined(TIMEOUT_WHEEL_ENABLE) && !defined(COMBO_NO_TIMER)
+static timeout_wheel_timer_t combo_timeout;
+
+/* combo_task() stays the expiry handler and re-checks timer/longest_term
+ * itself; one armed deadline replaces its per-scan timer poll. Re-armed on
+ * every buffered press since longest_term can grow while the timer runs. */
+static void combo_arm_timeout(void) {
+    if (timer) {
+        timeout_wheel_arm(&combo_timeout, combo_task, timer + longest_term + 1);
+    }
+}
+#else
+#    define combo_arm_timeout()
+#endif
+
 typedef struct {
     keyrecord_t record;
     uint16_t combo_index;
@@ -107,7 +130,7 @@ static inline void release_combo(uint16_t combo_index, combo_t *combo) {
             .keycode = combo->keycode,
         };
 #ifndef NO_ACTION_TAPPING
-        action_tapping_process(record);
+        action_tapping_process(&record);
 #else
         process_record(&record);
 #endif
@@ -152,15 +175,99 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_KEY_INDEX
+/* Inverted index: (keycode, combo) pairs sorted by keycode, so a key event
+ * only touches the combos that actually contain that keycode instead of
+ * walking the whole key_combos[] table. Built once on first use; combo key
+ * definitions must not change afterwards. A dirty bit per combo records
+ * which combos may hold partial state, so bookkeeping that has to consider
+ * "all combos" only visits those. */
+static uint16_t *combo_index_keycodes;
+static uint16_t *combo_index_combos;
+static uint16_t  combo_index_len;
+static uint8_t  *combo_dirty;
+
+#    define COMBO_DIRTY_SET(index) (combo_dirty[(index) / 8] |= 1 << ((index) % 8))
+#    define COMBO_DIRTY_CLEAR(index) (combo_dirty[(index) / 8] &= ~(1 << ((index) % 8)))
+
+static void combo_index_build(void) {
+    combo_index_len = 0;
+    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+        const uint16_t *keys = key_combos[idx].keys;
+        for (uint8_t i = 0; pgm_read_word(&keys[i]) != COMBO_END; i++) {
+            combo_index_len++;
+        }
+    }
+
+    combo_index_keycodes = (uint16_t *)malloc(combo_index_len * sizeof(uint16_t));
+    combo_index_combos   = (uint16_t *)malloc(combo_index_len * sizeof(uint16_t));
+    combo_dirty          = (uint8_t *)calloc((COMBO_LEN + 7) / 8, sizeof(uint8_t));
+
+    uint16_t n = 0;
+    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+        const uint16_t *keys = key_combos[idx].keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            /* insertion sort by keycode */
+            uint16_t pos = n;
+            while (pos > 0 && combo_index_keycodes[pos - 1] > key) {
+                combo_index_keycodes[pos] = combo_index_keycodes[pos - 1];
+                combo_index_combos[pos]   = combo_index_combos[pos - 1];
+                pos--;
+            }
+            combo_index_keycodes[pos] = key;
+            combo_index_combos[pos]   = idx;
+            n++;
+        }
+    }
+}
+
+/* leftmost entry with the given keycode, or combo_index_len */
+static uint16_t combo_index_lookup(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_len;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_index_keycodes[mid] < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
 void clear_combos(void) {
-    uint16_t index = 0;
     longest_term = 0;
+#ifdef COMBO_KEY_INDEX
+    if (!combo_dirty) {
+        return;
+    }
+    for (uint16_t byte = 0; byte < (COMBO_LEN + 7) / 8; ++byte) {
+        if (!combo_dirty[byte]) {
+            continue;
+        }
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            if (!(combo_dirty[byte] & (1 << bit))) {
+                continue;
+            }
+            uint16_t index = byte * 8 + bit;
+            combo_t *combo = &key_combos[index];
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+                COMBO_DIRTY_CLEAR(index);
+            }
+        }
+    }
+#else
+    uint16_t index = 0;
     for (index = 0; index < COMBO_LEN; ++index) {
         combo_t *combo = &key_combos[index];
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
         }
     }
+#endif
 }
 
 static inline void dump_key_buffer(void) {
@@ -171,6 +278,13 @@ static inline void dump_key_buffer(void) {
         return;
     }
 
+#ifdef COMBO_BATCH_FLUSH
+    /* Hold reports back while the whole buffer is re-emitted, so the host
+     * gets one report with the accumulated state instead of one blocking
+     * transfer per buffered event. */
+    defer_keyboard_report();
+#endif
+
     for (uint8_t key_buffer_i = key_buffer_next; key_buffer_i < key_buffer_size; key_buffer_i++) {
         key_buffer_next = key_buffer_i + 1;
 
@@ -185,7 +299,7 @@ static inline void dump_key_buffer(void) {
             process_combo_event(qrecord->combo_index, true);
         } else {
 #ifndef NO_ACTION_TAPPING
-        action_tapping_process(*record);
+        action_tapping_process(record);
 #else
         process_record(record);
 #endif
@@ -194,6 +308,10 @@ static inline void dump_key_buffer(void) {
     }
 
     key_buffer_next = key_buffer_size = 0;
+
+#ifdef COMBO_BATCH_FLUSH
+    flush_keyboard_report();
+#endif
 }
 
 #define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
@@ -457,6 +575,30 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+#if defined(COMBO_ONLY_FROM_LAYER) && defined(COMBO_REF_LAYER_CACHE)
+/* Per-position cache of the reference layer's keycodes, so each event costs
+ * one RAM read instead of a keymap lookup (which goes to EEPROM for dynamic
+ * keymaps). Filled lazily per position; 0xFFFF marks an unfilled slot. Costs
+ * 2 bytes of RAM per matrix position. */
+static uint16_t combo_ref_cache[MATRIX_ROWS][MATRIX_COLS];
+static bool     combo_ref_cache_primed = false;
+
+void combo_ref_cache_clear(void) { combo_ref_cache_primed = false; }
+
+static uint16_t combo_ref_lookup(keypos_t key) {
+    if (!combo_ref_cache_primed) {
+        memset(combo_ref_cache, 0xFF, sizeof(combo_ref_cache));
+        combo_ref_cache_primed = true;
+    }
+    uint16_t keycode = combo_ref_cache[key.row][key.col];
+    if (keycode == 0xFFFF) {
+        keycode                           = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, key);
+        combo_ref_cache[key.row][key.col] = keycode;
+    }
+    return keycode;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
     bool is_combo_key          = false;
     bool no_combo_keys_pressed = true;
@@ -478,14 +620,49 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 
 #ifdef COMBO_ONLY_FROM_LAYER
     /* Only check keycodes from one layer. */
+#    ifdef COMBO_REF_LAYER_CACHE
+    keycode = combo_ref_lookup(record->event.key);
+#    else
     keycode = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, record->event.key);
+#    endif
 #endif
 
+#ifdef COMBO_KEY_INDEX
+    if (!combo_dirty) {
+        combo_index_build();
+    }
+    /* Only the combos containing this keycode can change state or claim the key. */
+    for (uint16_t n = combo_index_lookup(keycode); n < combo_index_len && combo_index_keycodes[n] == keycode; ++n) {
+        uint16_t idx   = combo_index_combos[n];
+        combo_t *combo = &key_combos[idx];
+        is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        if (!NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo)) {
+            COMBO_DIRTY_SET(idx);
+        }
+    }
+    /* Untouched combos trivially have no keys down; check just the dirty ones. */
+    for (uint16_t byte = 0; no_combo_keys_pressed && byte < (COMBO_LEN + 7) / 8; ++byte) {
+        if (!combo_dirty[byte]) {
+            continue;
+        }
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            if (!(combo_dirty[byte] & (1 << bit))) {
+                continue;
+            }
+            combo_t *combo = &key_combos[byte * 8 + bit];
+            if (!(NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo))) {
+                no_combo_keys_pressed = false;
+                break;
+            }
+        }
+    }
+#else
     for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
         combo_t *combo = &key_combos[idx];
         is_combo_key |= process_single_combo(combo, keycode, record, idx);
         no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
     }
+#endif
 
     if (record->event.pressed && is_combo_key) {
 #ifndef COMBO_NO_TIMER
@@ -498,6 +675,7 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
         timer = timer_read();
 #   endif
 #endif
+        combo_arm_timeout();
 
         if (key_buffer_size < COMBO_KEY_BUFFER_LENGTH) {
             key_buffer[key_buffer_size++] = (queued_record_t){
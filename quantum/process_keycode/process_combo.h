@@ -79,3 +79,10 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#if defined(COMBO_ONLY_FROM_LAYER) && defined(COMBO_REF_LAYER_CACHE)
+/* Drop the cached reference-layer keycodes, e.g. after a dynamic keymap edit */
+void combo_ref_cache_clear(void);
+#else
+#    define combo_ref_cache_clear()
+#endif
@@ -37,6 +37,17 @@ __attribute__((weak)) void dynamic_macro_record_key_user(int8_t direction, keyre
 
 __attribute__((weak)) void dynamic_macro_record_end_user(int8_t direction) { dynamic_macro_led_blink(); }
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAYBACK
+/* Playback cursor state. While play_cursor is non-NULL a macro is being
+ * streamed out one event at a time from dynamic_macro_task(), so the matrix
+ * keeps scanning instead of stalling for the whole macro. */
+static keyrecord_t * play_cursor    = NULL;
+static keyrecord_t * play_end       = NULL;
+static int8_t        play_direction = 0;
+static uint16_t      play_next_time = 0;
+static layer_state_t play_saved_layer_state;
+#endif
+
 /* Convenience macros used for retrieving the debug info. All of them
  * need a `direction` variable accessible at the call site.
  */
@@ -70,6 +81,27 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
 void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAYBACK
+    if (play_cursor != NULL) {
+        /* Already playing. */
+        return;
+    }
+
+    if (macro_buffer == macro_end) {
+        dynamic_macro_play_user(direction);
+        return;
+    }
+
+    play_saved_layer_state = layer_state;
+
+    clear_keyboard();
+    layer_clear();
+
+    play_cursor    = macro_buffer;
+    play_end       = macro_end;
+    play_direction = direction;
+    play_next_time = timer_read();
+#else
     layer_state_t saved_layer_state = layer_state;
 
     clear_keyboard();
@@ -85,7 +117,40 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
     layer_state = saved_layer_state;
 
     dynamic_macro_play_user(direction);
+#endif
+}
+
+#ifdef DYNAMIC_MACRO_ASYNC_PLAYBACK
+/**
+ * Stream out the next event of the macro being played, if it is due.
+ * Called from the matrix scan loop.
+ */
+void dynamic_macro_task(void) {
+    if (play_cursor == NULL) {
+        return;
+    }
+
+    const uint16_t now = timer_read();
+    if (!timer_expired(now, play_next_time)) {
+        return;
+    }
+
+    process_record(play_cursor);
+    play_cursor += play_direction;
+    play_next_time = now + DYNAMIC_MACRO_PLAYBACK_INTERVAL;
+
+    if (play_cursor == play_end) {
+        const int8_t direction = play_direction;
+
+        play_cursor = NULL;
+
+        clear_keyboard();
+        layer_state = play_saved_layer_state;
+
+        dynamic_macro_play_user(direction);
+    }
 }
+#endif
 
 /**
  * Record a single key in a dynamic macro.
@@ -193,6 +258,22 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
      * 1,2 - either macro 1 or 2 is being recorded */
     static uint8_t macro_id = 0;
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAYBACK
+    /* While a macro is streaming out, ignore the dynamic macro keys so
+     * playback cannot be restarted or recorded over mid-flight. */
+    switch (keycode) {
+        case DYN_REC_START1:
+        case DYN_REC_START2:
+        case DYN_REC_STOP:
+        case DYN_MACRO_PLAY1:
+        case DYN_MACRO_PLAY2:
+            if (play_cursor != NULL) {
+                return false;
+            }
+            break;
+    }
+#endif
+
     if (macro_id == 0) {
         /* No macro recording in progress. */
         if (!record->event.pressed) {
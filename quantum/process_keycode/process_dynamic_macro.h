@@ -33,8 +33,18 @@
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+/* Delay between played-back events in milliseconds when asynchronous
+ * playback is enabled. The default of one event per millisecond matches
+ * the USB full-speed polling rate. */
+#ifndef DYNAMIC_MACRO_PLAYBACK_INTERVAL
+#    define DYNAMIC_MACRO_PLAYBACK_INTERVAL 1
+#endif
+
 void dynamic_macro_led_blink(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
+#ifdef DYNAMIC_MACRO_ASYNC_PLAYBACK
+void dynamic_macro_task(void);
+#endif
 void dynamic_macro_record_start_user(void);
 void dynamic_macro_play_user(int8_t direction);
 void dynamic_macro_record_key_user(int8_t direction, keyrecord_t *record);
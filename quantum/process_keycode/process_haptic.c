@@ -85,6 +85,17 @@ __attribute__((weak)) bool get_haptic_enabled_key(uint16_t keycode, keyrecord_t
     return true;
 }
 
+#if defined(DRV2605L) && defined(DRV2605L_PATTERN_SLOTS)
+/* Picks the pattern slot played for a given key. Override with a lookup
+ * into a PROGMEM table keyed on keycode or matrix position to give
+ * individual keys their own feedback strength. */
+__attribute__((weak)) uint8_t get_haptic_pattern_key(uint16_t keycode, keyrecord_t *record) { return 0; }
+
+static void haptic_play_key(uint16_t keycode, keyrecord_t *record) { haptic_play_pattern(get_haptic_pattern_key(keycode, record)); }
+#else
+static void haptic_play_key(uint16_t keycode, keyrecord_t *record) { haptic_play(); }
+#endif
+
 bool process_haptic(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         switch (keycode) {
@@ -134,12 +145,12 @@ bool process_haptic(uint16_t keycode, keyrecord_t *record) {
         if (record->event.pressed) {
             // keypress
             if (haptic_get_feedback() < 2 && get_haptic_enabled_key(keycode, record)) {
-                haptic_play();
+                haptic_play_key(keycode, record);
             }
         } else {
             // keyrelease
             if (haptic_get_feedback() > 0 && get_haptic_enabled_key(keycode, record)) {
-                haptic_play();
+                haptic_play_key(keycode, record);
             }
         }
     }
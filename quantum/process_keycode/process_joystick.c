@@ -75,88 +75,119 @@ void restorePinState(pin_t pin, uint16_t restoreState) {
 
 __attribute__((weak)) bool process_joystick_analogread() { return process_joystick_analogread_quantum(); }
 
-bool process_joystick_analogread_quantum() {
 #if JOYSTICK_AXES_COUNT > 0
-    for (int axis_index = 0; axis_index < JOYSTICK_AXES_COUNT; ++axis_index) {
-        if (joystick_axes[axis_index].input_pin == JS_VIRTUAL_AXIS) {
-            continue;
-        }
+static int16_t joystick_read_axis_raw(int axis_index) {
+    // save previous input pin status as well
+    uint16_t inputSavedState = savePinState(joystick_axes[axis_index].input_pin);
 
-        // save previous input pin status as well
-        uint16_t inputSavedState = savePinState(joystick_axes[axis_index].input_pin);
+    // disable pull-up resistor
+    writePinLow(joystick_axes[axis_index].input_pin);
 
-        // disable pull-up resistor
-        writePinLow(joystick_axes[axis_index].input_pin);
+    // if pin was a pull-up input, we need to uncharge it by turning it low
+    // before making it a low input
+    setPinOutput(joystick_axes[axis_index].input_pin);
 
-        // if pin was a pull-up input, we need to uncharge it by turning it low
-        // before making it a low input
-        setPinOutput(joystick_axes[axis_index].input_pin);
+    wait_us(10);
 
-        wait_us(10);
+    // save and apply output pin status
+    uint16_t outputSavedState = 0;
+    if (joystick_axes[axis_index].output_pin != JS_VIRTUAL_AXIS) {
+        // save previous output pin status
+        outputSavedState = savePinState(joystick_axes[axis_index].output_pin);
 
-        // save and apply output pin status
-        uint16_t outputSavedState = 0;
-        if (joystick_axes[axis_index].output_pin != JS_VIRTUAL_AXIS) {
-            // save previous output pin status
-            outputSavedState = savePinState(joystick_axes[axis_index].output_pin);
-
-            setPinOutput(joystick_axes[axis_index].output_pin);
-            writePinHigh(joystick_axes[axis_index].output_pin);
-        }
+        setPinOutput(joystick_axes[axis_index].output_pin);
+        writePinHigh(joystick_axes[axis_index].output_pin);
+    }
 
-        uint16_t groundSavedState = 0;
-        if (joystick_axes[axis_index].ground_pin != JS_VIRTUAL_AXIS) {
-            // save previous output pin status
-            groundSavedState = savePinState(joystick_axes[axis_index].ground_pin);
+    uint16_t groundSavedState = 0;
+    if (joystick_axes[axis_index].ground_pin != JS_VIRTUAL_AXIS) {
+        // save previous output pin status
+        groundSavedState = savePinState(joystick_axes[axis_index].ground_pin);
 
-            setPinOutput(joystick_axes[axis_index].ground_pin);
-            writePinLow(joystick_axes[axis_index].ground_pin);
-        }
+        setPinOutput(joystick_axes[axis_index].ground_pin);
+        writePinLow(joystick_axes[axis_index].ground_pin);
+    }
 
-        wait_us(10);
+    wait_us(10);
 
-        setPinInput(joystick_axes[axis_index].input_pin);
+    setPinInput(joystick_axes[axis_index].input_pin);
 
-        wait_us(10);
+    wait_us(10);
 
 #    if defined(__AVR__) || defined(PROTOCOL_CHIBIOS)
-        int16_t axis_val = analogReadPin(joystick_axes[axis_index].input_pin);
+    int16_t axis_val = analogReadPin(joystick_axes[axis_index].input_pin);
 #    else
-        // default to resting position
-        int16_t axis_val = joystick_axes[axis_index].mid_digit;
+    // default to resting position
+    int16_t axis_val = joystick_axes[axis_index].mid_digit;
 #    endif
 
-        // test the converted value against the lower range
-        int32_t ref        = joystick_axes[axis_index].mid_digit;
-        int32_t range      = joystick_axes[axis_index].min_digit;
-        int32_t ranged_val = ((axis_val - ref) * -JOYSTICK_RESOLUTION) / (range - ref);
+    // restore output, ground and input status
+    if (joystick_axes[axis_index].output_pin != JS_VIRTUAL_AXIS) {
+        restorePinState(joystick_axes[axis_index].output_pin, outputSavedState);
+    }
+    if (joystick_axes[axis_index].ground_pin != JS_VIRTUAL_AXIS) {
+        restorePinState(joystick_axes[axis_index].ground_pin, groundSavedState);
+    }
 
-        if (ranged_val > 0) {
-            // the value is in the higher range
-            range      = joystick_axes[axis_index].max_digit;
-            ranged_val = ((axis_val - ref) * JOYSTICK_RESOLUTION) / (range - ref);
-        }
+    restorePinState(joystick_axes[axis_index].input_pin, inputSavedState);
 
-        // clamp the result in the valid range
-        ranged_val = ranged_val < -JOYSTICK_RESOLUTION ? -JOYSTICK_RESOLUTION : ranged_val;
-        ranged_val = ranged_val > JOYSTICK_RESOLUTION ? JOYSTICK_RESOLUTION : ranged_val;
+    return axis_val;
+}
 
-        if (ranged_val != joystick_status.axes[axis_index]) {
-            joystick_status.axes[axis_index] = ranged_val;
-            joystick_status.status |= JS_UPDATED;
-        }
+static void joystick_update_axis(int axis_index, int16_t axis_val) {
+    // test the converted value against the lower range
+    int32_t ref        = joystick_axes[axis_index].mid_digit;
+    int32_t range      = joystick_axes[axis_index].min_digit;
+    int32_t ranged_val = ((axis_val - ref) * -JOYSTICK_RESOLUTION) / (range - ref);
+
+    if (ranged_val > 0) {
+        // the value is in the higher range
+        range      = joystick_axes[axis_index].max_digit;
+        ranged_val = ((axis_val - ref) * JOYSTICK_RESOLUTION) / (range - ref);
+    }
 
-        // restore output, ground and input status
-        if (joystick_axes[axis_index].output_pin != JS_VIRTUAL_AXIS) {
-            restorePinState(joystick_axes[axis_index].output_pin, outputSavedState);
+    // clamp the result in the valid range
+    ranged_val = ranged_val < -JOYSTICK_RESOLUTION ? -JOYSTICK_RESOLUTION : ranged_val;
+    ranged_val = ranged_val > JOYSTICK_RESOLUTION ? JOYSTICK_RESOLUTION : ranged_val;
+
+    if (ranged_val != joystick_status.axes[axis_index]) {
+        joystick_status.axes[axis_index] = ranged_val;
+        joystick_status.status |= JS_UPDATED;
+    }
+}
+#endif
+
+bool process_joystick_analogread_quantum() {
+#if JOYSTICK_AXES_COUNT > 0
+#    ifdef JOYSTICK_ROUND_ROBIN
+    // One conversion per pass: each call samples a single axis into its
+    // accumulator and the axis value is updated once JOYSTICK_OVERSAMPLE
+    // samples have been averaged. The loop cost no longer grows with the
+    // axis count, and the decimation filters ADC noise.
+    static uint8_t  sample_axis  = 0;
+    static uint16_t sample_acc   = 0;
+    static uint8_t  sample_count = 0;
+
+    if (joystick_axes[sample_axis].input_pin != JS_VIRTUAL_AXIS) {
+        sample_acc += joystick_read_axis_raw(sample_axis);
+        if (++sample_count >= JOYSTICK_OVERSAMPLE) {
+            joystick_update_axis(sample_axis, sample_acc / JOYSTICK_OVERSAMPLE);
+            sample_acc   = 0;
+            sample_count = 0;
+            sample_axis  = (sample_axis + 1) % JOYSTICK_AXES_COUNT;
         }
-        if (joystick_axes[axis_index].ground_pin != JS_VIRTUAL_AXIS) {
-            restorePinState(joystick_axes[axis_index].ground_pin, groundSavedState);
+    } else {
+        sample_axis = (sample_axis + 1) % JOYSTICK_AXES_COUNT;
+    }
+#    else
+    for (int axis_index = 0; axis_index < JOYSTICK_AXES_COUNT; ++axis_index) {
+        if (joystick_axes[axis_index].input_pin == JS_VIRTUAL_AXIS) {
+            continue;
         }
 
-        restorePinState(joystick_axes[axis_index].input_pin, inputSavedState);
+        joystick_update_axis(axis_index, joystick_read_axis_raw(axis_index));
     }
-
+#    endif
 #endif
     return true;
 }
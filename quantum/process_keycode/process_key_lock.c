@@ -46,6 +46,9 @@
 // Locked key state. This is an array of 256 bits, one for each of the standard keys supported qmk.
 uint64_t key_state[4] = {0x0, 0x0, 0x0, 0x0};
 bool     watching     = false;
+// Number of keys currently locked, so the common no-locks case can exit
+// before touching the state words at all.
+static uint8_t locked_count = 0;
 
 // Translate any OSM keycodes back to their unmasked versions.
 static inline uint16_t translate_keycode(uint16_t keycode) {
@@ -83,6 +86,16 @@ bool process_key_lock(uint16_t *keycode, keyrecord_t *record) {
     //    by returning false, so the OS never sees that the key was released
     //    until the user pressed the key again.
 
+    // Fast exit for the common case: nothing is locked and we are not
+    // watching, so only KC_LOCK itself needs any handling.
+    if (locked_count == 0 && !watching) {
+        if (*keycode == KC_LOCK && record->event.pressed) {
+            watching = true;
+            return false;
+        }
+        return true;
+    }
+
     // We translate any OSM keycodes back to their original keycodes, so that if the key being
     // one-shot modded is a standard keycode, we can handle it. This is the only set of special
     // keys that we handle
@@ -108,6 +121,9 @@ bool process_key_lock(uint16_t *keycode, keyrecord_t *record) {
             // KC_F press is registered, when the user likely meant to hold F
             if (watching) {
                 watching = false;
+                if (!(KEY_STATE(translated_keycode))) {
+                    locked_count++;
+                }
                 SET_KEY_STATE(translated_keycode);
                 // We need to set the keycode passed in to be the translated keycode, in case we
                 // translated a OSM back to the original keycode.
@@ -118,6 +134,7 @@ bool process_key_lock(uint16_t *keycode, keyrecord_t *record) {
 
             if (KEY_STATE(translated_keycode)) {
                 UNSET_KEY_STATE(translated_keycode);
+                locked_count--;
                 // The key is already held, stop this process. The up event will be sent when the user
                 // releases the key.
                 return false;
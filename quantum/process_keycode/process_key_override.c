@@ -84,6 +84,52 @@ static bool enabled = true;
 // Public variables
 __attribute__((weak)) const key_override_t **key_overrides = NULL;
 
+// Prefilter state built once from the override list. Most key events cannot
+// match any override; the bitmap of (hashed) trigger keycodes and the union
+// of all required trigger mods let those events skip the override loop with
+// two cheap tests. Hash collisions only cost a redundant loop pass.
+static uint8_t trigger_key_bitmap[32];
+static uint8_t trigger_mods_union       = 0;
+static bool    has_no_trigger_overrides = false;  // any override with trigger == KC_NO
+static bool    has_modless_overrides    = false;  // any override with trigger_mods == 0
+static bool    prefilter_built          = false;
+
+static inline uint8_t trigger_key_hash(const uint16_t keycode) { return (uint8_t)(keycode ^ (keycode >> 8)); }
+
+static inline bool trigger_key_possible(const uint16_t keycode) {
+    const uint8_t hash = trigger_key_hash(keycode);
+    return (trigger_key_bitmap[hash / 8] & (1 << (hash % 8))) != 0;
+}
+
+static void build_trigger_prefilter(void) {
+    prefilter_built = true;
+
+    if (key_overrides == NULL) {
+        return;
+    }
+
+    for (uint8_t i = 0;; i++) {
+        const key_override_t *const override = key_overrides[i];
+
+        if (override == NULL) {
+            break;
+        }
+
+        if (override->trigger == KC_NO) {
+            has_no_trigger_overrides = true;
+        } else {
+            const uint8_t hash = trigger_key_hash(override->trigger);
+            trigger_key_bitmap[hash / 8] |= 1 << (hash % 8);
+        }
+
+        if (override->trigger_mods == 0) {
+            has_modless_overrides = true;
+        } else {
+            trigger_mods_union |= override->trigger_mods;
+        }
+    }
+}
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -247,6 +293,22 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
         return true;
     }
 
+    if (!prefilter_built) {
+        build_trigger_prefilter();
+    }
+
+    // Cheap exits for events that cannot possibly activate any override:
+    // every override requires a trigger mod but none of them are active, or
+    // neither this key nor the held key is any override's trigger.
+    if (!has_modless_overrides && (active_mods & trigger_mods_union) == 0) {
+        *activated = false;
+        return true;
+    }
+    if (!has_no_trigger_overrides && !trigger_key_possible(keycode) && (last_key_down == 0 || !trigger_key_possible(last_key_down))) {
+        *activated = false;
+        return true;
+    }
+
     for (uint8_t i = 0;; i++) {
         const key_override_t *const override = key_overrides[i];
 
@@ -18,6 +18,9 @@
 
 #    include "process_leader.h"
 #    include <string.h>
+#    ifdef TIMEOUT_WHEEL_ENABLE
+#        include "timeout_wheel.h"
+#    endif
 
 #    ifndef LEADER_TIMEOUT
 #        define LEADER_TIMEOUT 300
@@ -34,6 +37,93 @@ uint16_t leader_time = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#    ifdef LEADER_SEQUENCE_TABLE
+/* Incremental matching over the sorted leader_sequences[] table. The keys
+ * pressed so far select a contiguous range of sequences sharing that prefix;
+ * each new key narrows the range with two binary searches, so committing a
+ * sequence never scans the whole table. */
+static uint16_t match_lo     = 0;
+static uint16_t match_hi     = 0;
+static bool     match_failed = false;
+
+static uint16_t sequence_key(uint16_t index, uint8_t depth) { return pgm_read_word(&leader_sequences[index].keys[depth]); }
+
+static uint16_t leader_table_bound(uint16_t keycode, uint8_t depth, bool upper) {
+    uint16_t lo = match_lo, hi = match_hi;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        uint16_t key = sequence_key(mid, depth);
+        if (key < keycode || (upper && key == keycode)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void leader_table_advance(uint16_t keycode, uint8_t depth) {
+    if (match_failed) {
+        return;
+    }
+    uint16_t lo = leader_table_bound(keycode, depth, false);
+    uint16_t hi = leader_table_bound(keycode, depth, true);
+    if (lo == hi) {
+        match_failed = true;
+    } else {
+        match_lo = lo;
+        match_hi = hi;
+    }
+}
+
+/* The first sequence in the range is the shortest one with the current
+ * prefix; it is an exact match when its length equals the keys typed. */
+static bool leader_table_complete(void) { return !match_failed && match_lo < match_hi && (leader_sequence_size >= 5 || sequence_key(match_lo, leader_sequence_size) == 0); }
+
+static void leader_table_fire(void) {
+    qk_leader_func_t func = (qk_leader_func_t)pgm_read_ptr(&leader_sequences[match_lo].func);
+    leading               = false;
+    leader_end();
+    if (func) {
+        func();
+    }
+}
+
+void leader_task(void) {
+    if (!leading) {
+        return;
+    }
+#        ifdef LEADER_NO_TIMEOUT
+    if (leader_sequence_size == 0) {
+        return;
+    }
+#        endif
+    if (timer_elapsed(leader_time) > LEADER_TIMEOUT) {
+        if (leader_table_complete()) {
+            leader_table_fire();
+        } else {
+            leading = false;
+            leader_end();
+        }
+    }
+}
+#    endif
+
+#    if defined(TIMEOUT_WHEEL_ENABLE) && defined(LEADER_SEQUENCE_TABLE)
+static timeout_wheel_timer_t leader_timeout;
+
+/* leader_task() stays the expiry handler and re-checks everything itself;
+ * one armed deadline replaces its per-scan timer poll. */
+static void leader_arm_timeout(void) {
+    if (!leading) {
+        return;
+    }
+    timeout_wheel_arm(&leader_timeout, leader_task, leader_time + LEADER_TIMEOUT + 1);
+}
+#    else
+#        define leader_arm_timeout()
+#    endif
+
 void qk_leader_start(void) {
     if (leading) {
         return;
@@ -43,6 +133,14 @@ void qk_leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#    ifndef LEADER_NO_TIMEOUT
+    leader_arm_timeout();
+#    endif  // LEADER_NO_TIMEOUT
+#    ifdef LEADER_SEQUENCE_TABLE
+    match_lo     = 0;
+    match_hi     = leader_sequences_count;
+    match_failed = false;
+#    endif
 }
 
 bool process_leader(uint16_t keycode, keyrecord_t *record) {
@@ -61,6 +159,14 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
                 if (leader_sequence_size < (sizeof(leader_sequence) / sizeof(leader_sequence[0]))) {
                     leader_sequence[leader_sequence_size] = keycode;
                     leader_sequence_size++;
+#    ifdef LEADER_SEQUENCE_TABLE
+                    leader_table_advance(keycode, leader_sequence_size - 1);
+                    if (match_hi - match_lo == 1 && leader_table_complete()) {
+                        /* unique exact match with no longer extensions - fire
+                         * without waiting for the timeout */
+                        leader_table_fire();
+                    }
+#    endif
                 } else {
                     leading = false;
                     leader_end();
@@ -68,6 +174,7 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
 #    ifdef LEADER_PER_KEY_TIMING
                 leader_time = timer_read();
 #    endif
+                leader_arm_timeout();
                 return false;
             }
         } else {
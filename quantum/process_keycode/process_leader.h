@@ -24,6 +24,25 @@ void leader_start(void);
 void leader_end(void);
 void qk_leader_start(void);
 
+#ifdef LEADER_SEQUENCE_TABLE
+typedef void (*qk_leader_func_t)(void);
+
+typedef struct {
+    uint16_t         keys[5]; /* unused slots are 0 */
+    qk_leader_func_t func;
+} qk_leader_sequence_t;
+
+/* Must be sorted lexicographically by keys; the 0 padding sorts a short
+ * sequence directly before any longer sequences it is a prefix of. */
+extern const qk_leader_sequence_t leader_sequences[];
+extern const uint16_t             leader_sequences_count;
+
+#    define LEADER_SEQUENCE(func, ...) \
+        { {__VA_ARGS__}, func }
+
+void leader_task(void);
+#endif
+
 #define SEQ_ONE_KEY(key) if (leader_sequence[0] == (key) && leader_sequence[1] == 0 && leader_sequence[2] == 0 && leader_sequence[3] == 0 && leader_sequence[4] == 0)
 #define SEQ_TWO_KEYS(key1, key2) if (leader_sequence[0] == (key1) && leader_sequence[1] == (key2) && leader_sequence[2] == 0 && leader_sequence[3] == 0 && leader_sequence[4] == 0)
 #define SEQ_THREE_KEYS(key1, key2, key3) if (leader_sequence[0] == (key1) && leader_sequence[1] == (key2) && leader_sequence[2] == (key3) && leader_sequence[3] == 0 && leader_sequence[4] == 0)
@@ -171,7 +171,8 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                 }
 
                 eeconfig_update_keymap(keymap_config.raw);
-                clear_keyboard();  // clear to prevent stuck keys
+                action_cache_clear();  // remapping changed, cached decodes are stale
+                clear_keyboard();      // clear to prevent stuck keys
 
                 return false;
         }
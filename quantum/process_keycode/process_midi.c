@@ -242,6 +242,9 @@ bool process_midi(uint16_t keycode, keyrecord_t *record) {
 
 void midi_task(void) {
     midi_device_process(&midi_device);
+#    ifdef MIDI_EVENT_BATCH
+    midi_flush_batch();
+#    endif
 #    ifdef MIDI_ADVANCED
     if (timer_elapsed(midi_modulation_timer) < midi_config.modulation_interval) return;
     midi_modulation_timer = timer_read();
@@ -299,7 +299,15 @@ void music_mode_cycle(void) {
 void music_task(void) {
     if (music_sequence_playing) {
         if ((music_sequence_timer == 0) || (timer_elapsed(music_sequence_timer) > music_sequence_interval)) {
-            music_sequence_timer = timer_read();
+            // advance the deadline by the interval instead of resetting it to
+            // 'now': a delayed poll (OLED/RGB stall) then shortens the next
+            // step instead of pushing back every later one, so the sequence
+            // tempo stays accurate under main-loop load
+            if (music_sequence_timer == 0 || timer_elapsed(music_sequence_timer) > 2 * music_sequence_interval) {
+                music_sequence_timer = timer_read();
+            } else {
+                music_sequence_timer += music_sequence_interval;
+            }
             uint8_t prev_note    = music_sequence[(music_sequence_position - 1 < 0) ? (music_sequence_position - 1 + music_sequence_count) : (music_sequence_position - 1)];
             uint8_t next_note    = music_sequence[music_sequence_position];
             music_noteoff(prev_note);
@@ -65,6 +65,10 @@ static steno_mode_t mode;
 
 static const uint8_t boltmap[64] PROGMEM = {TXB_NUL, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_S_L, TXB_S_L, TXB_T_L, TXB_K_L, TXB_P_L, TXB_W_L, TXB_H_L, TXB_R_L, TXB_A_L, TXB_O_L, TXB_STR, TXB_STR, TXB_NUL, TXB_NUL, TXB_NUL, TXB_STR, TXB_STR, TXB_E_R, TXB_U_R, TXB_F_R, TXB_R_R, TXB_P_R, TXB_B_R, TXB_L_R, TXB_G_R, TXB_T_R, TXB_S_R, TXB_D_R, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_Z_R};
 
+/* Packed (state byte index << 3 | bit position) per steno key, replacing the
+ * division and modulo by 7 with a single indexed load. */
+static const uint8_t geminimap[42] PROGMEM = {0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x28};
+
 #ifdef STENO_COMBINEDMAP
 /* Used to look up when pressing the middle row key to combine two consonant or vowel keys */
 static const uint16_t combinedmap_first[] PROGMEM = {STN_S1, STN_TL, STN_PL, STN_HL, STN_FR, STN_PR, STN_LR, STN_TR, STN_DR, STN_A, STN_E};
@@ -76,27 +80,35 @@ static void steno_clear_state(void) {
     memset(chord, 0, sizeof(chord));
 }
 
-static void send_steno_state(uint8_t size, bool send_empty) {
+static void send_steno_state(uint8_t size, bool send_empty, bool terminate) {
+#ifdef VIRTSER_ENABLE
+    /* Assemble the whole packet first so it goes out as one write instead of
+     * one USB transfer per byte. */
+    uint8_t packet[MAX_STATE_SIZE + 1];
+    uint8_t length = 0;
     for (uint8_t i = 0; i < size; ++i) {
         if (chord[i] || send_empty) {
-#ifdef VIRTSER_ENABLE
-            virtser_send(chord[i]);
-#endif
+            packet[length++] = chord[i];
         }
     }
+    if (terminate) {
+        packet[length++] = TXB_NUL;
+    }
+    virtser_send_buf(packet, length);
+#endif
 }
 
 void steno_init() {
     if (!eeconfig_is_enabled()) {
         eeconfig_init();
     }
-    mode = eeprom_read_byte(EECONFIG_STENOMODE);
+    mode = eeconfig_read_byte(EECONFIG_STENOMODE);
 }
 
 void steno_set_mode(steno_mode_t new_mode) {
     steno_clear_state();
     mode = new_mode;
-    eeprom_update_byte(EECONFIG_STENOMODE, mode);
+    eeconfig_update_byte(EECONFIG_STENOMODE, mode);
 }
 
 /* override to intercept chords right before they get sent.
@@ -112,14 +124,11 @@ static void send_steno_chord(void) {
     if (send_steno_chord_user(mode, chord)) {
         switch (mode) {
             case STENO_MODE_BOLT:
-                send_steno_state(BOLT_STATE_SIZE, false);
-#ifdef VIRTSER_ENABLE
-                virtser_send(0);  // terminating byte
-#endif
+                send_steno_state(BOLT_STATE_SIZE, false, true);  // terminating byte
                 break;
             case STENO_MODE_GEMINI:
                 chord[0] |= 0x80;  // Indicate start of packet
-                send_steno_state(GEMINI_STATE_SIZE, true);
+                send_steno_state(GEMINI_STATE_SIZE, true, false);
                 break;
         }
     }
@@ -142,8 +151,9 @@ static bool update_state_bolt(uint8_t key, bool press) {
 }
 
 static bool update_state_gemini(uint8_t key, bool press) {
-    int     idx = key / 7;
-    uint8_t bit = 1 << (6 - (key % 7));
+    uint8_t packed = pgm_read_byte(geminimap + key);
+    uint8_t idx    = packed >> 3;
+    uint8_t bit    = 1 << (packed & 0x07);
     if (press) {
         state[idx] |= bit;
         chord[idx] |= bit;
@@ -15,12 +15,63 @@
  */
 #include "quantum.h"
 
+#ifdef TIMEOUT_WHEEL_ENABLE
+#    include "timeout_wheel.h"
+#endif
+
 #ifndef NO_ACTION_ONESHOT
 uint8_t get_oneshot_mods(void);
 #endif
 
 static uint16_t last_td;
-static int16_t  highest_td = -1;
+
+/* Dances with count > 0, linked through next_active. In practice this holds
+ * one entry (the dance in progress) plus any finished-but-still-held dances,
+ * so per-event and per-scan work no longer grows with tap_dance_actions[]. */
+static qk_tap_dance_action_t *active_td_actions = NULL;
+
+static void tap_dance_add_active(qk_tap_dance_action_t *action) {
+    action->next_active = active_td_actions;
+    active_td_actions   = action;
+}
+
+static void tap_dance_remove_active(qk_tap_dance_action_t *action) {
+    for (qk_tap_dance_action_t **cur = &active_td_actions; *cur; cur = &(*cur)->next_active) {
+        if (*cur == action) {
+            *cur                = action->next_active;
+            action->next_active = NULL;
+            return;
+        }
+    }
+}
+
+static uint16_t tap_dance_term(qk_tap_dance_action_t *action) {
+    if (action->custom_tapping_term > 0) {
+        return action->custom_tapping_term;
+    }
+#ifdef TAPPING_TERM_PER_KEY
+    return get_tapping_term(action->state.keycode, NULL);
+#else
+    return TAPPING_TERM;
+#endif
+}
+
+#ifdef TIMEOUT_WHEEL_ENABLE
+static timeout_wheel_timer_t tap_dance_timeout;
+
+/* One timer covers every in-progress dance: each tap arms it for the
+ * earliest pending term, and after the expiry scan it is re-armed for
+ * whatever is still counting. Firing early on a deadline a reset left
+ * stale is safe - tap_dance_task() re-checks every action's own timer. */
+static void tap_dance_timeout_expired(void) {
+    tap_dance_task();
+    for (qk_tap_dance_action_t *action = active_td_actions; action; action = action->next_active) {
+        if (action->state.count) {
+            timeout_wheel_arm_earliest(&tap_dance_timeout, tap_dance_timeout_expired, action->state.timer + tap_dance_term(action) + 1);
+        }
+    }
+}
+#endif
 
 void qk_tap_dance_pair_on_each_tap(qk_tap_dance_state_t *state, void *user_data) {
     qk_tap_dance_pair_t *pair = (qk_tap_dance_pair_t *)user_data;
@@ -105,16 +156,14 @@ static inline void process_tap_dance_action_on_reset(qk_tap_dance_action_t *acti
 }
 
 void preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    qk_tap_dance_action_t *action;
+    qk_tap_dance_action_t *action = active_td_actions;
 
     if (!record->event.pressed) return;
 
-    if (highest_td == -1) return;
-
-    for (int i = 0; i <= highest_td; i++) {
-        action = &tap_dance_actions[i];
-        if (action->state.count) {
-            if (keycode == action->state.keycode && keycode == last_td) continue;
+    while (action) {
+        /* reset_tap_dance() may unlink the current entry */
+        qk_tap_dance_action_t *next = action->next_active;
+        if (!(keycode == action->state.keycode && keycode == last_td)) {
             action->state.interrupted          = true;
             action->state.interrupting_keycode = keycode;
             process_tap_dance_action_on_dance_finished(action);
@@ -124,6 +173,7 @@ void preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
             // modifiers), but these weak mods should not affect the keypress which interrupted the tap dance.
             clear_weak_mods();
         }
+        action = next;
     }
 }
 
@@ -133,12 +183,14 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
     switch (keycode) {
         case QK_TAP_DANCE ... QK_TAP_DANCE_MAX:
-            if ((int16_t)idx > highest_td) highest_td = idx;
             action = &tap_dance_actions[idx];
 
             action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
                 action->state.keycode = keycode;
+                if (!action->state.count) {
+                    tap_dance_add_active(action);
+                }
                 action->state.count++;
                 action->state.timer = timer_read();
 #ifndef NO_ACTION_ONESHOT
@@ -149,6 +201,9 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 action->state.weak_mods = get_mods();
                 action->state.weak_mods |= get_weak_mods();
                 process_tap_dance_action_on_each_tap(action);
+#ifdef TIMEOUT_WHEEL_ENABLE
+                timeout_wheel_arm_earliest(&tap_dance_timeout, tap_dance_timeout_expired, action->state.timer + tap_dance_term(action) + 1);
+#endif
 
                 last_td = keycode;
             } else {
@@ -164,24 +219,16 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task() {
-    if (highest_td == -1) return;
-    uint16_t tap_user_defined;
-
-    for (uint8_t i = 0; i <= highest_td; i++) {
-        qk_tap_dance_action_t *action = &tap_dance_actions[i];
-        if (action->custom_tapping_term > 0) {
-            tap_user_defined = action->custom_tapping_term;
-        } else {
-#ifdef TAPPING_TERM_PER_KEY
-            tap_user_defined = get_tapping_term(action->state.keycode, NULL);
-#else
-            tap_user_defined = TAPPING_TERM;
-#endif
-        }
-        if (action->state.count && timer_elapsed(action->state.timer) > tap_user_defined) {
+    qk_tap_dance_action_t *action = active_td_actions;
+
+    while (action) {
+        /* reset_tap_dance() may unlink the current entry */
+        qk_tap_dance_action_t *next = action->next_active;
+        if (action->state.count && timer_elapsed(action->state.timer) > tap_dance_term(action)) {
             process_tap_dance_action_on_dance_finished(action);
             reset_tap_dance(&action->state);
         }
+        action = next;
     }
 }
 
@@ -199,4 +246,6 @@ void reset_tap_dance(qk_tap_dance_state_t *state) {
     state->finished             = false;
     state->interrupting_keycode = 0;
     last_td                     = 0;
+
+    tap_dance_remove_active(action);
 }
@@ -37,7 +37,7 @@ typedef struct {
 
 typedef void (*qk_tap_dance_user_fn_t)(qk_tap_dance_state_t *state, void *user_data);
 
-typedef struct {
+typedef struct qk_tap_dance_action_t {
     struct {
         qk_tap_dance_user_fn_t on_each_tap;
         qk_tap_dance_user_fn_t on_dance_finished;
@@ -46,6 +46,8 @@ typedef struct {
     qk_tap_dance_state_t state;
     uint16_t             custom_tapping_term;
     void *               user_data;
+    /* intrusive list of dances with count > 0, maintained internally */
+    struct qk_tap_dance_action_t *next_active;
 } qk_tap_dance_action_t;
 
 typedef struct {
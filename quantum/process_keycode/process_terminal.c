@@ -19,6 +19,9 @@
 #include "version.h"
 #include <stdio.h>
 #include <math.h>
+#ifdef KEYCODE_NAMES_ENABLE
+#    include "keycode_names.h"
+#endif
 
 #ifndef CMD_BUFF_SIZE
 #    define CMD_BUFF_SIZE 5
@@ -51,10 +54,62 @@ __attribute__((weak)) const char keycode_to_ascii_lut[58] = {0, 0, 0, 0, 'a', 'b
 __attribute__((weak)) const char shifted_keycode_to_ascii_lut[58] = {0, 0, 0, 0, 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '!', '@', '#', '$', '%', '^', '&', '*', '(', ')', 0, 0, 0, '\t', ' ', '_', '+', '{', '}', '|', 0, ':', '\'', '~', '<', '>', '?'};
 
 struct stringcase {
-    char *string;
+    const char *string;
+    uint8_t     length;  // precomputed, so dispatch can skip non-matches on length alone
     void (*func)(void);
 } typedef stringcase;
 
+#define TERMINAL_COMMAND(name, func) \
+    { name, sizeof(name) - 1, func }
+
+#ifdef SEND_STRING_STREAMING
+/* Responses are composed into this buffer and then played back one keystroke
+ * per task pass by the send_string streaming engine, so a long dump (e.g.
+ * `keymap`) types out in the background instead of freezing scanning for its
+ * whole duration. Sized so a full keymap layer dump ("0x%04x," per key plus
+ * a newline per row) plus the trailing prompt fits. */
+#    ifndef TERMINAL_RESPONSE_BUFFER_SIZE
+#        define TERMINAL_RESPONSE_BUFFER_SIZE (MATRIX_ROWS * (MATRIX_COLS * 7 + 1) + 80)
+#    endif
+static char     terminal_response[TERMINAL_RESPONSE_BUFFER_SIZE];
+static uint16_t terminal_response_length = 0;
+
+static void terminal_output(const char *str) {
+    uint16_t length = strlen(str);
+    if (length > sizeof(terminal_response) - 1 - terminal_response_length) {
+        // truncate rather than overflow; the buffer is sized for the largest
+        // built-in response, so this only trips on oversized custom prompts
+        length = sizeof(terminal_response) - 1 - terminal_response_length;
+    }
+    memcpy(&terminal_response[terminal_response_length], str, length);
+    terminal_response_length += length;
+    terminal_response[terminal_response_length] = '\0';
+}
+
+static void terminal_output_P(const char *str) {
+    uint16_t length = strlen_P(str);
+    if (length > sizeof(terminal_response) - 1 - terminal_response_length) {
+        length = sizeof(terminal_response) - 1 - terminal_response_length;
+    }
+    memcpy_P(&terminal_response[terminal_response_length], str, length);
+    terminal_response_length += length;
+    terminal_response[terminal_response_length] = '\0';
+}
+
+static void terminal_response_flush(void) {
+    if (terminal_response_length != 0) {
+        send_string_stream(terminal_response, 0);
+        terminal_response_length = 0;
+    }
+}
+#else  // SEND_STRING_STREAMING
+#    define terminal_output(str) send_string(str)
+#    define terminal_output_P(str) send_string_P(str)
+#    define terminal_response_flush()
+#endif  // SEND_STRING_STREAMING
+
+#define TERMINAL_OUTPUT(string) terminal_output_P(PSTR(string))
+
 void enable_terminal(void) {
     terminal_enabled = true;
     strcpy(buffer, "");
@@ -67,7 +122,8 @@ void enable_terminal(void) {
 
 void disable_terminal(void) {
     terminal_enabled = false;
-    SEND_STRING("\n");
+    TERMINAL_OUTPUT("\n");
+    terminal_response_flush();
 }
 
 void push_to_cmd_buffer(void) {
@@ -93,24 +149,34 @@ void push_to_cmd_buffer(void) {
 }
 
 void terminal_about(void) {
-    SEND_STRING("QMK Firmware\n");
-    SEND_STRING("  v");
-    SEND_STRING(QMK_VERSION);
-    SEND_STRING("\n" SS_TAP(X_HOME) "  Built: ");
-    SEND_STRING(QMK_BUILDDATE);
-    send_string(newline);
+    TERMINAL_OUTPUT("QMK Firmware\n");
+    TERMINAL_OUTPUT("  v");
+    TERMINAL_OUTPUT(QMK_VERSION);
+    TERMINAL_OUTPUT("\n" SS_TAP(X_HOME) "  Built: ");
+    TERMINAL_OUTPUT(QMK_BUILDDATE);
+    terminal_output(newline);
 #ifdef TERMINAL_HELP
     if (strlen(arguments[1]) != 0) {
-        SEND_STRING("You entered: ");
-        send_string(arguments[1]);
-        send_string(newline);
+        TERMINAL_OUTPUT("You entered: ");
+        terminal_output(arguments[1]);
+        terminal_output(newline);
     }
 #endif
 }
 
 void terminal_help(void);
 
+#ifndef KEYMAP_COMPACT
 extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
+#endif
+
+static uint16_t terminal_keymap_read(uint16_t layer, uint16_t row, uint16_t col) {
+#ifdef KEYMAP_COMPACT
+    return keymap_key_to_keycode(layer, (keypos_t){.row = row, .col = col});
+#else
+    return pgm_read_word(&keymaps[layer][row][col]);
+#endif
+}
 
 void terminal_keycode(void) {
     if (strlen(arguments[1]) != 0 && strlen(arguments[2]) != 0 && strlen(arguments[3]) != 0) {
@@ -119,17 +185,25 @@ void terminal_keycode(void) {
         uint16_t layer   = strtol(arguments[1], (char **)NULL, 10);
         uint16_t row     = strtol(arguments[2], (char **)NULL, 10);
         uint16_t col     = strtol(arguments[3], (char **)NULL, 10);
-        uint16_t keycode = pgm_read_word(&keymaps[layer][row][col]);
+        uint16_t keycode = terminal_keymap_read(layer, row, col);
         itoa(keycode, keycode_dec, 10);
         itoa(keycode, keycode_hex, 16);
-        SEND_STRING("0x");
-        send_string(keycode_hex);
-        SEND_STRING(" (");
-        send_string(keycode_dec);
-        SEND_STRING(")\n");
+        TERMINAL_OUTPUT("0x");
+        terminal_output(keycode_hex);
+        TERMINAL_OUTPUT(" (");
+        terminal_output(keycode_dec);
+        TERMINAL_OUTPUT(")");
+#ifdef KEYCODE_NAMES_ENABLE
+        const char *keycode_name = keycode_name_P(keycode);
+        if (keycode_name != NULL) {
+            TERMINAL_OUTPUT(" KC_");
+            terminal_output_P(keycode_name);
+        }
+#endif
+        TERMINAL_OUTPUT("\n");
     } else {
 #ifdef TERMINAL_HELP
-        SEND_STRING("usage: keycode <layer> <row> <col>\n");
+        TERMINAL_OUTPUT("usage: keycode <layer> <row> <col>\n");
 #endif
     }
 }
@@ -139,61 +213,65 @@ void terminal_keymap(void) {
         uint16_t layer = strtol(arguments[1], (char **)NULL, 10);
         for (int r = 0; r < MATRIX_ROWS; r++) {
             for (int c = 0; c < MATRIX_COLS; c++) {
-                uint16_t keycode = pgm_read_word(&keymaps[layer][r][c]);
+                uint16_t keycode = terminal_keymap_read(layer, r, c);
                 char     keycode_s[8];
                 sprintf(keycode_s, "0x%04x,", keycode);
-                send_string(keycode_s);
+                terminal_output(keycode_s);
             }
-            send_string(newline);
+            terminal_output(newline);
         }
     } else {
 #ifdef TERMINAL_HELP
-        SEND_STRING("usage: keymap <layer>\n");
+        TERMINAL_OUTPUT("usage: keymap <layer>\n");
 #endif
     }
 }
 
 void print_cmd_buff(void) {
+#ifndef SEND_STRING_STREAMING
     /* without the below wait, a race condition can occur wherein the
      buffer can be printed before it has been fully moved */
     wait_ms(250);
+#endif
     for (int i = 0; i < CMD_BUFF_SIZE; i++) {
         char tmpChar = ' ';
         itoa(i, &tmpChar, 10);
         const char *tmpCnstCharStr = &tmpChar;  // because sned_string wont take a normal char *
-        send_string(tmpCnstCharStr);
-        SEND_STRING(". ");
-        send_string(cmd_buffer[i]);
-        SEND_STRING("\n");
+        terminal_output(tmpCnstCharStr);
+        TERMINAL_OUTPUT(". ");
+        terminal_output(cmd_buffer[i]);
+        TERMINAL_OUTPUT("\n");
     }
 }
 
 void flush_cmd_buffer(void) {
     memset(cmd_buffer, 0, CMD_BUFF_SIZE * 80);
-    SEND_STRING("Buffer Cleared!\n");
+    TERMINAL_OUTPUT("Buffer Cleared!\n");
 }
 
-stringcase terminal_cases[] = {{"about", terminal_about}, {"help", terminal_help}, {"keycode", terminal_keycode}, {"keymap", terminal_keymap}, {"flush-buffer", flush_cmd_buffer}, {"print-buffer", print_cmd_buff}, {"exit", disable_terminal}};
+stringcase terminal_cases[] = {TERMINAL_COMMAND("about", terminal_about), TERMINAL_COMMAND("help", terminal_help), TERMINAL_COMMAND("keycode", terminal_keycode), TERMINAL_COMMAND("keymap", terminal_keymap), TERMINAL_COMMAND("flush-buffer", flush_cmd_buffer), TERMINAL_COMMAND("print-buffer", print_cmd_buff), TERMINAL_COMMAND("exit", disable_terminal)};
 
 void terminal_help(void) {
-    SEND_STRING("commands available:\n  ");
+    TERMINAL_OUTPUT("commands available:\n  ");
     for (stringcase *case_p = terminal_cases; case_p != terminal_cases + sizeof(terminal_cases) / sizeof(terminal_cases[0]); case_p++) {
-        send_string(case_p->string);
-        SEND_STRING(" ");
+        terminal_output(case_p->string);
+        TERMINAL_OUTPUT(" ");
     }
-    send_string(newline);
+    terminal_output(newline);
 }
 
 void command_not_found(void) {
+#ifndef SEND_STRING_STREAMING
     wait_ms(50);  // sometimes buffer isnt grabbed quick enough
-    SEND_STRING("command \"");
-    send_string(buffer);
-    SEND_STRING("\" not found\n");
+#endif
+    TERMINAL_OUTPUT("command \"");
+    terminal_output(buffer);
+    TERMINAL_OUTPUT("\" not found\n");
 }
 
 void process_terminal_command(void) {
     // we capture return bc of the order of events, so we need to manually send a newline
-    send_string(newline);
+    terminal_output(newline);
 
     char *  pch;
     uint8_t i = 0;
@@ -204,9 +282,11 @@ void process_terminal_command(void) {
         i++;
     }
 
-    bool command_found = false;
+    // strtok left the command name NUL-terminated at the start of the buffer
+    uint8_t command_length = strlen(buffer);
+    bool    command_found  = false;
     for (stringcase *case_p = terminal_cases; case_p != terminal_cases + sizeof(terminal_cases) / sizeof(terminal_cases[0]); case_p++) {
-        if (0 == strcmp(case_p->string, buffer)) {
+        if (case_p->length == command_length && 0 == memcmp(case_p->string, buffer, command_length)) {
             command_found = true;
             (*case_p->func)();
             break;
@@ -218,9 +298,12 @@ void process_terminal_command(void) {
     if (terminal_enabled) {
         strcpy(buffer, "");
         for (int i = 0; i < 6; i++) strcpy(arguments[i], "");
-        SEND_STRING(SS_TAP(X_HOME));
-        send_string(terminal_prompt);
+        TERMINAL_OUTPUT(SS_TAP(X_HOME));
+        terminal_output(terminal_prompt);
     }
+    // in streaming mode this starts the background playback of everything
+    // composed above; until it finishes, new commands are held off
+    terminal_response_flush();
 }
 void check_pos(void) {
     if (current_cmd_buffer_pos >= CMD_BUFF_SIZE) {  // if over the top, move it back down to the top of the buffer so you can climb back down...
@@ -252,6 +335,15 @@ bool process_terminal(uint16_t keycode, keyrecord_t *record) {
             switch (keycode) {
                 case KC_ENTER:
                 case KC_KP_ENTER:
+#ifdef SEND_STRING_STREAMING
+                    if (send_string_stream_active()) {
+                        // the previous response is still typing out of the
+                        // shared buffer; refuse the command instead of
+                        // corrupting the playback
+                        TERMINAL_BELL();
+                        return false;
+                    }
+#endif
                     push_to_cmd_buffer();
                     current_cmd_buffer_pos = 0;
                     process_terminal_command();
@@ -61,10 +61,18 @@ __attribute__((weak)) void qk_ucis_symbol_fallback(void) {
 __attribute__((weak)) void qk_ucis_cancel(void) {}
 
 void register_ucis(const uint32_t *code_points) {
+#ifdef UNICODE_BATCH_SEND
+    uint8_t count = 0;
+    while (count < UCIS_MAX_CODE_POINTS && code_points[count]) {
+        count++;
+    }
+    register_unicode_batch(code_points, count);
+#else
     for (int i = 0; i < UCIS_MAX_CODE_POINTS && code_points[i]; i++) {
         register_unicode(code_points[i]);
         wait_ms(UNICODE_TYPE_DELAY);
     }
+#endif
 }
 
 bool process_ucis(uint16_t keycode, keyrecord_t *record) {
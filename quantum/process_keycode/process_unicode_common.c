@@ -29,8 +29,99 @@ static int8_t  selected_count = sizeof selected / sizeof *selected;
 static int8_t  selected_index;
 #endif
 
+#ifdef UNICODE_SEQUENCE_CACHE
+#    include "progmem.h"
+
+/* Prebuilt per-mode start/finish/cancel sequences. Each chord step presses
+ * its mods and key together in one report and releases them in the next, so
+ * an entry chord like Ctrl+Shift+U costs two reports instead of the four
+ * register/unregister round trips of tap_code16(). The tables live in flash;
+ * a mode change swaps three pointers and the emit path does no per-call
+ * dispatch or rebuilding. */
+enum unicode_seq_op {
+    UC_SEQ_END = 0,
+    UC_SEQ_CHORD,  /* press mods+key in one report, release in the next */
+    UC_SEQ_HOLD,   /* register and keep held across the digits */
+    UC_SEQ_UNHOLD, /* release a held key */
+};
+
+typedef struct {
+    uint8_t op;
+    uint8_t mods;
+    uint8_t key;
+} unicode_seq_step_t;
+
+/* report mods byte from the mod bits of a 16-bit mod-keycode */
+#    define UC_SEQ_MODS16(kc) ((((kc) >> 8) & 0x10) ? (uint8_t)(((((kc) >> 8) & 0x0F)) << 4) : (uint8_t)(((kc) >> 8) & 0x0F))
+
+#    define UC_SEQ_STEPS 3 /* longest sequence, incl. the END terminator */
+
+static const unicode_seq_step_t unicode_start_seqs[UC__COUNT][UC_SEQ_STEPS] PROGMEM = {
+    [UC_MAC]  = {{UC_SEQ_HOLD, 0, UNICODE_KEY_MAC}},
+    [UC_LNX]  = {{UC_SEQ_CHORD, UC_SEQ_MODS16(UNICODE_KEY_LNX), (uint8_t)(UNICODE_KEY_LNX)}},
+    [UC_WIN]  = {{UC_SEQ_HOLD, 0, KC_LALT}, {UC_SEQ_CHORD, 0, KC_PPLS}},
+    [UC_WINC] = {{UC_SEQ_CHORD, 0, UNICODE_KEY_WINC}, {UC_SEQ_CHORD, 0, KC_U}},
+};
+
+static const unicode_seq_step_t unicode_finish_seqs[UC__COUNT][UC_SEQ_STEPS] PROGMEM = {
+    [UC_MAC]  = {{UC_SEQ_UNHOLD, 0, UNICODE_KEY_MAC}},
+    [UC_LNX]  = {{UC_SEQ_CHORD, 0, KC_SPC}},
+    [UC_WIN]  = {{UC_SEQ_UNHOLD, 0, KC_LALT}},
+    [UC_WINC] = {{UC_SEQ_CHORD, 0, KC_ENTER}},
+};
+
+static const unicode_seq_step_t unicode_cancel_seqs[UC__COUNT][UC_SEQ_STEPS] PROGMEM = {
+    [UC_MAC]  = {{UC_SEQ_UNHOLD, 0, UNICODE_KEY_MAC}},
+    [UC_LNX]  = {{UC_SEQ_CHORD, 0, KC_ESC}},
+    [UC_WIN]  = {{UC_SEQ_UNHOLD, 0, KC_LALT}},
+    [UC_WINC] = {{UC_SEQ_CHORD, 0, KC_ESC}},
+};
+
+static const unicode_seq_step_t *unicode_seq_start  = unicode_start_seqs[UC_BSD]; /* empty until init */
+static const unicode_seq_step_t *unicode_seq_finish = unicode_finish_seqs[UC_BSD];
+static const unicode_seq_step_t *unicode_seq_cancel = unicode_cancel_seqs[UC_BSD];
+
+static void unicode_seq_select(void) {
+    /* unknown modes fall back to the (empty) UC_BSD sequences, matching the
+     * default implementations' no-op switch cases */
+    uint8_t mode       = unicode_config.input_mode < UC__COUNT ? unicode_config.input_mode : UC_BSD;
+    unicode_seq_start  = unicode_start_seqs[mode];
+    unicode_seq_finish = unicode_finish_seqs[mode];
+    unicode_seq_cancel = unicode_cancel_seqs[mode];
+}
+
+static void unicode_seq_play(const unicode_seq_step_t *seq) {
+    for (uint8_t i = 0; i < UC_SEQ_STEPS; i++) {
+        uint8_t op = pgm_read_byte(&seq[i].op);
+        if (op == UC_SEQ_END) {
+            break;
+        }
+        uint8_t mods = pgm_read_byte(&seq[i].mods);
+        uint8_t key  = pgm_read_byte(&seq[i].key);
+        switch (op) {
+            case UC_SEQ_CHORD:
+                if (mods) add_mods(mods);
+                add_key(key);
+                send_keyboard_report();
+                del_key(key);
+                if (mods) del_mods(mods);
+                send_keyboard_report();
+                break;
+            case UC_SEQ_HOLD:
+                register_code(key);
+                break;
+            case UC_SEQ_UNHOLD:
+                unregister_code(key);
+                break;
+        }
+    }
+}
+#else
+#    define unicode_seq_select()
+#endif
+
 void unicode_input_mode_init(void) {
-    unicode_config.raw = eeprom_read_byte(EECONFIG_UNICODEMODE);
+    unicode_config.raw = eeconfig_read_byte(EECONFIG_UNICODEMODE);
 #if UNICODE_SELECTED_MODES != -1
 #    if UNICODE_CYCLE_PERSIST
     // Find input_mode in selected modes
@@ -50,6 +141,7 @@ void unicode_input_mode_init(void) {
     unicode_config.input_mode = selected[selected_index = 0];
 #    endif
 #endif
+    unicode_seq_select();
     dprintf("Unicode input mode init to: %u\n", unicode_config.input_mode);
 }
 
@@ -57,6 +149,7 @@ uint8_t get_unicode_input_mode(void) { return unicode_config.input_mode; }
 
 void set_unicode_input_mode(uint8_t mode) {
     unicode_config.input_mode = mode;
+    unicode_seq_select();
     persist_unicode_input_mode();
     dprintf("Unicode input mode set to: %u\n", unicode_config.input_mode);
 }
@@ -68,6 +161,7 @@ void cycle_unicode_input_mode(int8_t offset) {
         selected_index += selected_count;
     }
     unicode_config.input_mode = selected[selected_index];
+    unicode_seq_select();
 #    if UNICODE_CYCLE_PERSIST
     persist_unicode_input_mode();
 #    endif
@@ -75,8 +169,44 @@ void cycle_unicode_input_mode(int8_t offset) {
 #endif
 }
 
-void persist_unicode_input_mode(void) { eeprom_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode); }
+void persist_unicode_input_mode(void) { eeconfig_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode); }
 
+#ifdef UNICODE_SEQUENCE_CACHE
+__attribute__((weak)) void unicode_input_start(void) {
+    unicode_saved_caps_lock = host_keyboard_led_state().caps_lock;
+
+    // Must come before the mods are touched, or else UNICODE_KEY_LNX
+    // (usually Ctrl-Shift-U) might not work correctly in the shifted case.
+    if (unicode_config.input_mode == UC_LNX && unicode_saved_caps_lock) {
+        tap_code(KC_CAPS);
+    }
+
+    unicode_saved_mods = get_mods();  // Save current mods
+    clear_mods();                     // Unregister mods to start from a clean state
+
+    unicode_seq_play(unicode_seq_start);
+
+    wait_ms(UNICODE_TYPE_DELAY);
+}
+
+__attribute__((weak)) void unicode_input_finish(void) {
+    unicode_seq_play(unicode_seq_finish);
+    if (unicode_config.input_mode == UC_LNX && unicode_saved_caps_lock) {
+        tap_code(KC_CAPS);
+    }
+
+    set_mods(unicode_saved_mods);  // Reregister previously set mods
+}
+
+__attribute__((weak)) void unicode_input_cancel(void) {
+    unicode_seq_play(unicode_seq_cancel);
+    if (unicode_config.input_mode == UC_LNX && unicode_saved_caps_lock) {
+        tap_code(KC_CAPS);
+    }
+
+    set_mods(unicode_saved_mods);  // Reregister previously set mods
+}
+#else
 __attribute__((weak)) void unicode_input_start(void) {
     unicode_saved_caps_lock = host_keyboard_led_state().caps_lock;
 
@@ -154,6 +284,7 @@ __attribute__((weak)) void unicode_input_cancel(void) {
 
     set_mods(unicode_saved_mods);  // Reregister previously set mods
 }
+#endif
 
 void register_hex(uint16_t hex) {
     for (int i = 3; i >= 0; i--) {
@@ -199,6 +330,81 @@ void register_unicode(uint32_t code_point) {
     unicode_input_finish();
 }
 
+#ifdef UNICODE_BATCH_SEND
+/* Emit one code point inside an already-open batch. macOS hex input keeps
+ * accepting fixed-width UTF-16 units while the input key is held, so no
+ * per-character setup is needed there; the other modes need their own entry
+ * chord per character but share the surrounding mods/caps handling. */
+static void unicode_batch_emit(uint32_t code_point) {
+    switch (unicode_config.input_mode) {
+        case UC_MAC:
+            if (code_point > 0xFFFF) {
+                // Convert code point to UTF-16 surrogate pair
+                code_point -= 0x10000;
+                uint32_t lo = code_point & 0x3FF, hi = (code_point & 0xFFC00) >> 10;
+                register_hex(hi + 0xD800);
+                register_hex(lo + 0xDC00);
+            } else {
+                // Fixed-width digits: without a terminator, hex input reads
+                // exactly four digits per unit, so zeros must not be stripped
+                register_hex(code_point);
+            }
+            break;
+        case UC_LNX:
+            tap_code16(UNICODE_KEY_LNX);
+            wait_ms(UNICODE_TYPE_DELAY);
+            register_hex32(code_point);
+            tap_code(KC_SPC);
+            break;
+        case UC_WIN:
+            register_code(KC_LALT);
+            tap_code(KC_PPLS);
+            register_hex32(code_point);
+            unregister_code(KC_LALT);
+            break;
+        case UC_WINC:
+            tap_code(UNICODE_KEY_WINC);
+            tap_code(KC_U);
+            register_hex32(code_point);
+            tap_code(KC_ENTER);
+            break;
+    }
+}
+
+void register_unicode_batch(const uint32_t *code_points, uint8_t count) {
+    unicode_saved_caps_lock = host_keyboard_led_state().caps_lock;
+    if (unicode_config.input_mode == UC_LNX && unicode_saved_caps_lock) {
+        tap_code(KC_CAPS);
+    }
+
+    unicode_saved_mods = get_mods();
+    clear_mods();
+
+    if (unicode_config.input_mode == UC_MAC) {
+        register_code(UNICODE_KEY_MAC);
+    }
+    wait_ms(UNICODE_TYPE_DELAY);
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t code_point = code_points[i];
+        if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UC_WIN)) {
+            // Code point out of range, skip it
+            continue;
+        }
+        unicode_batch_emit(code_point);
+    }
+
+    if (unicode_config.input_mode == UC_MAC) {
+        unregister_code(UNICODE_KEY_MAC);
+    }
+    if (unicode_config.input_mode == UC_LNX && unicode_saved_caps_lock) {
+        tap_code(KC_CAPS);
+    }
+
+    set_mods(unicode_saved_mods);
+}
+#endif
+
 // clang-format off
 
 void send_unicode_hex_string(const char *str) {
@@ -264,6 +470,26 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+#ifdef UNICODE_BATCH_SEND
+    uint32_t batch[UNICODE_BATCH_SIZE];
+    uint8_t  batched = 0;
+
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+
+        if (code_point >= 0) {
+            batch[batched++] = code_point;
+            if (batched == UNICODE_BATCH_SIZE) {
+                register_unicode_batch(batch, batched);
+                batched = 0;
+            }
+        }
+    }
+    if (batched) {
+        register_unicode_batch(batch, batched);
+    }
+#else
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -272,6 +498,7 @@ void send_unicode_string(const char *str) {
             register_unicode(code_point);
         }
     }
+#endif
 }
 
 // clang-format off
@@ -49,6 +49,11 @@
 #    define UNICODE_TYPE_DELAY 10
 #endif
 
+// Number of code points sent per input session in batch mode
+#ifndef UNICODE_BATCH_SIZE
+#    define UNICODE_BATCH_SIZE 16
+#endif
+
 // Deprecated aliases
 #if !defined(UNICODE_KEY_MAC) && defined(UNICODE_KEY_OSX)
 #    define UNICODE_KEY_MAC UNICODE_KEY_OSX
@@ -89,6 +94,9 @@ void unicode_input_cancel(void);
 void register_hex(uint16_t hex);
 void register_hex32(uint32_t hex);
 void register_unicode(uint32_t code_point);
+#ifdef UNICODE_BATCH_SEND
+void register_unicode_batch(const uint32_t *code_points, uint8_t count);
+#endif
 
 void send_unicode_hex_string(const char *str);
 void send_unicode_string(const char *str);
@@ -17,6 +17,10 @@
 #include "quantum.h"
 #include "magic.h"
 
+#ifdef TIMEOUT_WHEEL_ENABLE
+#    include "timeout_wheel.h"
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "outputselect.h"
 #endif
@@ -193,6 +197,146 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+#ifdef PROCESS_RECORD_FAST_PATH
+/* The fast path only works when every enabled feature hook is triggered
+ * solely by keycodes in its own range; features that must observe every key
+ * event cannot be skipped. */
+#    if defined(KEY_LOCK_ENABLE) || (defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)) || (defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)) || defined(HAPTIC_ENABLE) || defined(VIA_ENABLE) || defined(KEY_OVERRIDE_ENABLE) || defined(TAP_DANCE_ENABLE) || defined(LEADER_ENABLE) || defined(AUTO_SHIFT_ENABLE) || defined(AUTOCORRECT_ENABLE) || defined(TERMINAL_ENABLE) || defined(SPACE_CADET_ENABLE) || ((defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE))
+#        error "PROCESS_RECORD_FAST_PATH cannot be used with features that must observe every key event (key lock, dynamic macro, clicky, haptic, VIA, key overrides, tap dance, leader, auto shift, autocorrect, terminal, space cadet, music mode)"
+#    endif
+
+/* Per-256-keycode-block dispatch, generated from the feature flags at
+ * compile time. A block is either unclaimed (kb/user hook only), owned by
+ * exactly one enabled feature (one indexed call to that handler), or home
+ * to several interleaved feature keycodes (full chain). */
+
+/* How many enabled feature hooks live in the interleaved loose-keycode
+ * blocks 0x5C-0x5F (magic, grave escape, audio, MIDI, backlight, RGB,
+ * printer, joystick, sequencer share that enum); when exactly one does,
+ * those blocks dispatch straight to it. */
+#    if defined(SEQUENCER_ENABLE)
+#        define PR_LOOSE_SEQUENCER 1
+#    else
+#        define PR_LOOSE_SEQUENCER 0
+#    endif
+#    if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
+#        define PR_LOOSE_MIDI 1
+#    else
+#        define PR_LOOSE_MIDI 0
+#    endif
+#    if defined(AUDIO_ENABLE)
+#        define PR_LOOSE_AUDIO 1
+#    else
+#        define PR_LOOSE_AUDIO 0
+#    endif
+#    if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
+#        define PR_LOOSE_BACKLIGHT 1
+#    else
+#        define PR_LOOSE_BACKLIGHT 0
+#    endif
+#    if defined(PRINTING_ENABLE)
+#        define PR_LOOSE_PRINTER 1
+#    else
+#        define PR_LOOSE_PRINTER 0
+#    endif
+#    if defined(MAGIC_KEYCODE_ENABLE)
+#        define PR_LOOSE_MAGIC 1
+#    else
+#        define PR_LOOSE_MAGIC 0
+#    endif
+#    if defined(GRAVE_ESC_ENABLE)
+#        define PR_LOOSE_GRAVE_ESC 1
+#    else
+#        define PR_LOOSE_GRAVE_ESC 0
+#    endif
+#    if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+#        define PR_LOOSE_RGB 1
+#    else
+#        define PR_LOOSE_RGB 0
+#    endif
+#    if defined(JOYSTICK_ENABLE)
+#        define PR_LOOSE_JOYSTICK 1
+#    else
+#        define PR_LOOSE_JOYSTICK 0
+#    endif
+#    define PR_LOOSE_COUNT (PR_LOOSE_SEQUENCER + PR_LOOSE_MIDI + PR_LOOSE_AUDIO + PR_LOOSE_BACKLIGHT + PR_LOOSE_PRINTER + PR_LOOSE_MAGIC + PR_LOOSE_GRAVE_ESC + PR_LOOSE_RGB + PR_LOOSE_JOYSTICK)
+
+#    if PR_LOOSE_COUNT == 1
+#        if PR_LOOSE_SEQUENCER
+#            define PR_LOOSE_HANDLER process_sequencer
+#        elif PR_LOOSE_MIDI
+#            define PR_LOOSE_HANDLER process_midi
+#        elif PR_LOOSE_AUDIO
+#            define PR_LOOSE_HANDLER process_audio
+#        elif PR_LOOSE_BACKLIGHT
+#            define PR_LOOSE_HANDLER process_backlight
+#        elif PR_LOOSE_PRINTER
+#            define PR_LOOSE_HANDLER process_printer
+#        elif PR_LOOSE_MAGIC
+#            define PR_LOOSE_HANDLER process_magic
+#        elif PR_LOOSE_GRAVE_ESC
+#            define PR_LOOSE_HANDLER process_grave_esc
+#        elif PR_LOOSE_RGB
+#            define PR_LOOSE_HANDLER process_rgb
+#        elif PR_LOOSE_JOYSTICK
+#            define PR_LOOSE_HANDLER process_joystick
+#        endif
+#    endif
+
+/* handler indices, assigned densely in flag order */
+#    ifdef STENO_ENABLE
+#        define PR_HANDLER_STENO 0
+#        define PR_HANDLER_COUNT_1 1
+#    else
+#        define PR_HANDLER_COUNT_1 0
+#    endif
+#    if defined(UNICODE_ENABLE) || defined(UNICODEMAP_ENABLE) || defined(UCIS_ENABLE)
+#        define PR_HANDLER_UNICODE PR_HANDLER_COUNT_1
+#        define PR_HANDLER_COUNT_2 (PR_HANDLER_COUNT_1 + 1)
+#    else
+#        define PR_HANDLER_COUNT_2 PR_HANDLER_COUNT_1
+#    endif
+#    if PR_LOOSE_COUNT == 1
+#        define PR_HANDLER_LOOSE PR_HANDLER_COUNT_2
+#        define PR_HANDLER_COUNT (PR_HANDLER_COUNT_2 + 1)
+#    else
+#        define PR_HANDLER_COUNT PR_HANDLER_COUNT_2
+#    endif
+
+/* block map entry: 0 = unclaimed, 1 = chain, >= 2 = handler index + 2 */
+#    define PR_BLOCK_NONE 0
+#    define PR_BLOCK_CHAIN 1
+#    define PR_BLOCK_HANDLER0 2
+
+#    if PR_HANDLER_COUNT > 0
+static bool (*const process_record_block_handlers[PR_HANDLER_COUNT])(uint16_t, keyrecord_t *) = {
+#        ifdef STENO_ENABLE
+    [PR_HANDLER_STENO] = process_steno,
+#        endif
+#        if defined(UNICODE_ENABLE) || defined(UNICODEMAP_ENABLE) || defined(UCIS_ENABLE)
+    [PR_HANDLER_UNICODE] = process_unicode_common,
+#        endif
+#        if PR_LOOSE_COUNT == 1
+    [PR_HANDLER_LOOSE] = PR_LOOSE_HANDLER,
+#        endif
+};
+#    endif
+
+static const uint8_t process_record_block_map[256] = {
+#    if PR_LOOSE_COUNT == 1
+    [0x5C ... 0x5F] = PR_BLOCK_HANDLER0 + PR_HANDLER_LOOSE,
+#    elif PR_LOOSE_COUNT > 1
+    [0x5C ... 0x5F] = PR_BLOCK_CHAIN,
+#    endif
+#    ifdef STENO_ENABLE
+    [QK_STENO >> 8] = PR_BLOCK_HANDLER0 + PR_HANDLER_STENO,
+#    endif
+#    if defined(UNICODE_ENABLE) || defined(UNICODEMAP_ENABLE) || defined(UCIS_ENABLE)
+    [(QK_UNICODE >> 8)...(QK_UNICODE_MAX >> 8)] = PR_BLOCK_HANDLER0 + PR_HANDLER_UNICODE,
+#    endif
+};
+#endif
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -223,6 +367,21 @@ bool process_record_quantum(keyrecord_t *record) {
     preprocess_tap_dance(keycode, record);
 #endif
 
+#ifdef PROCESS_RECORD_FAST_PATH
+    const uint8_t block_dispatch = process_record_block_map[keycode >> 8];
+    if (block_dispatch != PR_BLOCK_CHAIN) {
+        // at most one feature hook can act on this keycode; the
+        // keyboard/user hook runs first, as in the chain
+        if (!process_record_kb(keycode, record)) {
+            return false;
+        }
+#    if PR_HANDLER_COUNT > 0
+        if (block_dispatch >= PR_BLOCK_HANDLER0 && !process_record_block_handlers[block_dispatch - PR_BLOCK_HANDLER0](keycode, record)) {
+            return false;
+        }
+#    endif
+    } else
+#endif
     if (!(
 #if defined(KEY_LOCK_ENABLE)
             // Must run first to be able to mask key_up events.
@@ -278,6 +437,9 @@ bool process_record_quantum(keyrecord_t *record) {
 #ifdef AUTO_SHIFT_ENABLE
             process_auto_shift(keycode, record) &&
 #endif
+#ifdef AUTOCORRECT_ENABLE
+            process_autocorrect(keycode, record) &&
+#endif
 #ifdef TERMINAL_ENABLE
             process_terminal(keycode, record) &&
 #endif
@@ -369,12 +531,11 @@ layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_
 
 void update_tri_layer(uint8_t layer1, uint8_t layer2, uint8_t layer3) { layer_state_set(update_tri_layer_state(layer_state, layer1, layer2, layer3)); }
 
-void matrix_init_quantum() {
-    magic();
-    led_init_ports();
-#ifdef BACKLIGHT_ENABLE
-    backlight_init_ports();
-#endif
+// Cosmetic subsystems with the heaviest bring-up cost. With
+// KEYBOARD_INIT_STAGED this runs as a deferred stage from keyboard_task()
+// once the input path is live; otherwise matrix_init_quantum() calls it
+// inline as before.
+void quantum_init_cosmetic(void) {
 #ifdef AUDIO_ENABLE
     audio_init();
 #endif
@@ -384,6 +545,17 @@ void matrix_init_quantum() {
 #ifdef RGB_MATRIX_ENABLE
     rgb_matrix_init();
 #endif
+}
+
+void matrix_init_quantum() {
+    magic();
+    led_init_ports();
+#ifdef BACKLIGHT_ENABLE
+    backlight_init_ports();
+#endif
+#ifndef KEYBOARD_INIT_STAGED
+    quantum_init_cosmetic();
+#endif
 #if defined(UNICODE_ENABLE) || defined(UNICODEMAP_ENABLE) || defined(UCIS_ENABLE)
     unicode_input_mode_init();
 #endif
@@ -430,12 +602,26 @@ void matrix_scan_quantum() {
     sequencer_task();
 #endif
 
-#ifdef TAP_DANCE_ENABLE
+#ifdef TIMEOUT_WHEEL_ENABLE
+    // tap dance, combo and leader deadlines share one registry; this is a
+    // single compare against the earliest of them
+    timeout_wheel_task();
+#else
+#    ifdef TAP_DANCE_ENABLE
     tap_dance_task();
-#endif
+#    endif
 
-#ifdef COMBO_ENABLE
+#    ifdef COMBO_ENABLE
     combo_task();
+#    endif
+
+#    if defined(LEADER_ENABLE) && defined(LEADER_SEQUENCE_TABLE)
+    leader_task();
+#    endif
+#endif
+
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_ASYNC_PLAYBACK)
+    dynamic_macro_task();
 #endif
 
 #ifdef LED_MATRIX_ENABLE
@@ -121,6 +121,10 @@ extern layer_state_t layer_state;
 #    include "process_auto_shift.h"
 #endif
 
+#ifdef AUTOCORRECT_ENABLE
+#    include "process_autocorrect.h"
+#endif
+
 #ifdef COMBO_ENABLE
 #    include "process_combo.h"
 #endif
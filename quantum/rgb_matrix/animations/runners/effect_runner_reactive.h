@@ -13,8 +13,9 @@ bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
         uint16_t tick = max_tick;
         // Reverse search to find most recent key hit
         for (int8_t j = g_last_hit_tracker.count - 1; j >= 0; j--) {
-            if (g_last_hit_tracker.index[j] == i && g_last_hit_tracker.tick[j] < tick) {
-                tick = g_last_hit_tracker.tick[j];
+            uint8_t slot = last_hit_slot(&g_last_hit_tracker, j);
+            if (g_last_hit_tracker.index[slot] == i && g_last_hit_tracker.tick[slot] < tick) {
+                tick = g_last_hit_tracker.tick[slot];
                 break;
             }
         }
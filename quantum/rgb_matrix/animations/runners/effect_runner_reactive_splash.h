@@ -13,10 +13,15 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
         HSV hsv = rgb_matrix_config.hsv;
         hsv.v   = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+            uint8_t slot = last_hit_slot(&g_last_hit_tracker, j);
+            int16_t dx   = g_led_config.point[i].x - g_last_hit_tracker.x[slot];
+            int16_t dy   = g_led_config.point[i].y - g_last_hit_tracker.y[slot];
+#ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+            uint8_t dist = g_rgb_hit_dist[slot][i];
+#else
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+#endif
+            uint16_t tick = scale16by8(g_last_hit_tracker.tick[slot], qadd8(rgb_matrix_config.speed, 1));
             hsv           = effect_func(hsv, dx, dy, dist, tick);
         }
         hsv.v   = scale8(hsv.v, rgb_matrix_config.hsv.v);
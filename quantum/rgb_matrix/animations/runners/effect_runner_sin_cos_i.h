@@ -5,9 +5,21 @@ typedef HSV (*sin_cos_i_f)(HSV hsv, int8_t sin, int8_t cos, uint8_t i, uint8_t t
 bool effect_runner_sin_cos_i(effect_params_t* params, sin_cos_i_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint16_t time      = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 4);
-    int8_t   cos_value = cos8(time) - 128;
-    int8_t   sin_value = sin8(time) - 128;
+    uint16_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 4);
+#ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+    // g_rgb_timer is latched for the whole frame, so later chunks of the same
+    // frame can reuse the values computed by the first one
+    static uint16_t last_time;
+    static int8_t   cos_value, sin_value;
+    if (time != last_time || params->init) {
+        last_time = time;
+        cos_value = cos8(time) - 128;
+        sin_value = sin8(time) - 128;
+    }
+#else
+    int8_t cos_value = cos8(time) - 128;
+    int8_t sin_value = sin8(time) - 128;
+#endif
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         RGB rgb = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, cos_value, sin_value, i, time));
@@ -7,25 +7,18 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        endif
 
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
-    uint8_t m_row = row - 1;
-    uint8_t p_row = row + 1;
     uint8_t m_col = col - 1;
     uint8_t p_col = col + 1;
 
-    if (m_col < col) g_rgb_frame_buffer[row][m_col] = qadd8(g_rgb_frame_buffer[row][m_col], 16);
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], 32);
-    if (p_col < MATRIX_COLS) g_rgb_frame_buffer[row][p_col] = qadd8(g_rgb_frame_buffer[row][p_col], 16);
+    // Splash into the pressed row and its neighbors, one row at a time
+    for (uint8_t r = (row == 0) ? 0 : row - 1; r <= row + 1 && r < MATRIX_ROWS; r++) {
+        uint8_t *cell   = g_rgb_frame_buffer[r];
+        uint8_t  center = (r == row) ? 32 : 16;
+        uint8_t  side   = (r == row) ? 16 : 13;
 
-    if (p_row < MATRIX_ROWS) {
-        if (m_col < col) g_rgb_frame_buffer[p_row][m_col] = qadd8(g_rgb_frame_buffer[p_row][m_col], 13);
-        g_rgb_frame_buffer[p_row][col] = qadd8(g_rgb_frame_buffer[p_row][col], 16);
-        if (p_col < MATRIX_COLS) g_rgb_frame_buffer[p_row][p_col] = qadd8(g_rgb_frame_buffer[p_row][p_col], 13);
-    }
-
-    if (m_row < row) {
-        if (m_col < col) g_rgb_frame_buffer[m_row][m_col] = qadd8(g_rgb_frame_buffer[m_row][m_col], 13);
-        g_rgb_frame_buffer[m_row][col] = qadd8(g_rgb_frame_buffer[m_row][col], 16);
-        if (p_col < MATRIX_COLS) g_rgb_frame_buffer[m_row][p_col] = qadd8(g_rgb_frame_buffer[m_row][p_col], 13);
+        if (m_col < col) cell[m_col] = qadd8(cell[m_col], side);
+        cell[col] = qadd8(cell[col], center);
+        if (p_col < MATRIX_COLS) cell[p_col] = qadd8(cell[p_col], side);
     }
 }
 
@@ -63,7 +56,16 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         uint8_t col = i / MATRIX_ROWS;
         uint8_t val = g_rgb_frame_buffer[row][col];
 
-        // set the pixel colour
+        // Cold cells were painted black when they decayed to zero, so all
+        // the per-cell work can be skipped until a keypress reheats them
+        if (val == 0) continue;
+
+        if (decrease_heatmap_values) {
+            val                          = qsub8(val, 1);
+            g_rgb_frame_buffer[row][col] = val;
+        }
+
+        // set the pixel colour; a decay to zero paints black one last time
         uint8_t led[LED_HITS_TO_REMEMBER];
         uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
         for (uint8_t j = 0; j < led_count; ++j) {
@@ -73,10 +75,6 @@ bool TYPING_HEATMAP(effect_params_t* params) {
             RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
             rgb_matrix_set_color(led[j], rgb.r, rgb.g, rgb.b);
         }
-
-        if (decrease_heatmap_values) {
-            g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-        }
     }
 
     return led_max < sizeof(g_rgb_frame_buffer);
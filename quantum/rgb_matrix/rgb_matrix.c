@@ -39,7 +39,40 @@ const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 // clang-format on
 
+#ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+// Per-LED distance and atan2 angle around the matrix center, filled once at
+// init for the dx/dy effect runners
+uint8_t g_rgb_led_dist[DRIVER_LED_TOTAL];
+uint8_t g_rgb_led_angle[DRIVER_LED_TOTAL];
+uint8_t g_rgb_render_led = 0;
+
+// 256-entry hue ring at the current saturation/value. Filled lazily so a
+// config change doesn't stall one frame with 256 conversions; per-LED
+// modified saturation/value falls back to a direct conversion.
+static RGB     rgb_hue_table[256];
+static uint8_t rgb_hue_table_valid[256 / 8];
+static uint8_t rgb_hue_table_sat;
+static uint8_t rgb_hue_table_val;
+
+__attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    if (hsv.s != rgb_hue_table_sat || hsv.v != rgb_hue_table_val) {
+        if (hsv.s != rgb_matrix_config.hsv.s || hsv.v != rgb_matrix_config.hsv.v) {
+            return hsv_to_rgb(hsv);
+        }
+        // config changed; re-key the table to the new saturation/value
+        memset(rgb_hue_table_valid, 0, sizeof(rgb_hue_table_valid));
+        rgb_hue_table_sat = hsv.s;
+        rgb_hue_table_val = hsv.v;
+    }
+    if (!(rgb_hue_table_valid[hsv.h >> 3] & (1 << (hsv.h & 7)))) {
+        rgb_hue_table[hsv.h] = hsv_to_rgb(hsv);
+        rgb_hue_table_valid[hsv.h >> 3] |= 1 << (hsv.h & 7);
+    }
+    return rgb_hue_table[hsv.h];
+}
+#else
 __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) { return hsv_to_rgb(hsv); }
+#endif  // RGB_MATRIX_PRECOMPUTE_TABLES
 
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
@@ -70,6 +103,21 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) { return hsv_to_rgb(hsv
 #    define RGB_DISABLE_TIMEOUT 0
 #endif
 
+#ifdef RGB_MATRIX_IDLE_DIMMING
+#    ifndef RGB_MATRIX_IDLE_DIM_TIMEOUT
+#        define RGB_MATRIX_IDLE_DIM_TIMEOUT 60000
+#    endif
+#    ifndef RGB_MATRIX_IDLE_FREEZE_TIMEOUT
+#        define RGB_MATRIX_IDLE_FREEZE_TIMEOUT 300000
+#    endif
+#    ifndef RGB_MATRIX_IDLE_OFF_TIMEOUT
+#        define RGB_MATRIX_IDLE_OFF_TIMEOUT 0  // disabled by default; RGB_DISABLE_TIMEOUT already covers plain off
+#    endif
+#    ifndef RGB_MATRIX_IDLE_DIM_VALUE
+#        define RGB_MATRIX_IDLE_DIM_VALUE 128
+#    endif
+#endif
+
 #if !defined(RGB_MATRIX_MAXIMUM_BRIGHTNESS) || RGB_MATRIX_MAXIMUM_BRIGHTNESS > UINT8_MAX
 #    undef RGB_MATRIX_MAXIMUM_BRIGHTNESS
 #    define RGB_MATRIX_MAXIMUM_BRIGHTNESS UINT8_MAX
@@ -124,8 +172,21 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif  // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
+#    ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+uint8_t g_rgb_hit_dist[LED_HITS_TO_REMEMBER][DRIVER_LED_TOTAL];
+#    endif
 #endif  // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+#    if RGB_MATRIX_LED_PROCESS_LIMIT < 1
+#        error "RGB_MATRIX_ADAPTIVE_LIMIT requires a positive RGB_MATRIX_LED_PROCESS_LIMIT"
+#    endif
+#    ifndef RGB_MATRIX_ADAPTIVE_LIMIT_MIN
+#        define RGB_MATRIX_ADAPTIVE_LIMIT_MIN 8
+#    endif
+uint8_t g_rgb_led_process_limit = RGB_MATRIX_LED_PROCESS_LIMIT;
+#endif  // RGB_MATRIX_ADAPTIVE_LIMIT
+
 // internals
 static bool            suspend_state     = false;
 static bool            rgb_update_eeprom = false;
@@ -136,6 +197,23 @@ static rgb_task_states rgb_task_state    = SYNCING;
 #if RGB_DISABLE_TIMEOUT > 0
 static uint32_t rgb_anykey_timer;
 #endif  // RGB_DISABLE_TIMEOUT > 0
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+static bool    rgb_long_pass_seen = false;
+static uint8_t rgb_clean_frames   = 0;
+#endif  // RGB_MATRIX_ADAPTIVE_LIMIT
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+static uint8_t rgb_shadow_buffer[DRIVER_LED_TOTAL][3];
+static bool    rgb_frame_dirty = true;
+#endif  // RGB_MATRIX_DIRTY_TRACKING
+#ifdef RGB_MATRIX_IDLE_DIMMING
+typedef enum { RGB_IDLE_ACTIVE, RGB_IDLE_DIMMED, RGB_IDLE_FROZEN, RGB_IDLE_OFF } rgb_idle_stage_t;
+static rgb_idle_stage_t rgb_idle_stage = RGB_IDLE_ACTIVE;
+#endif  // RGB_MATRIX_IDLE_DIMMING
+#if defined(RGB_MATRIX_BLEND_OVERLAYS) && !defined(RGB_MATRIX_DIRTY_TRACKING)
+// readable copy of the current frame for blending; dirty tracking already
+// keeps one in its shadow buffer
+static uint8_t rgb_blend_buffer[DRIVER_LED_TOTAL][3];
+#endif  // defined(RGB_MATRIX_BLEND_OVERLAYS) && !defined(RGB_MATRIX_DIRTY_TRACKING)
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -148,9 +226,9 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
-void eeconfig_read_rgb_matrix(void) { eeprom_read_block(&rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_matrix_config)); }
+void eeconfig_read_rgb_matrix(void) { eeconfig_read_block(&rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_matrix_config)); }
 
-void eeconfig_update_rgb_matrix(void) { eeprom_update_block(&rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_matrix_config)); }
+void eeconfig_update_rgb_matrix(void) { eeconfig_update_block(&rgb_matrix_config, EECONFIG_RGB_MATRIX, sizeof(rgb_matrix_config)); }
 
 void eeconfig_update_rgb_matrix_default(void) {
     dprintf("eeconfig_update_rgb_matrix_default\n");
@@ -175,7 +253,49 @@ void eeconfig_debug_rgb_matrix(void) {
 
 __attribute__((weak)) uint8_t rgb_matrix_map_row_column_to_led_kb(uint8_t row, uint8_t column, uint8_t *led_i) { return 0; }
 
+#ifdef RGB_MATRIX_LED_MAP_CACHE
+// Flattened key -> LED map, built once at init by running the full
+// resolution (the _kb multi-LED hook plus matrix_co) for every position.
+// Reactive effects resolve keyhits in the keystroke path, so this turns
+// each hit into one indexed read of {start, count} plus a short copy.
+#    ifndef RGB_MATRIX_LED_MAP_LIST_SIZE
+#        define RGB_MATRIX_LED_MAP_LIST_SIZE (DRIVER_LED_TOTAL + 8)
+#    endif
+
+typedef struct PACKED {
+    uint8_t start;
+    uint8_t count;
+} led_map_slot_t;
+
+static led_map_slot_t led_map[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t        led_map_list[RGB_MATRIX_LED_MAP_LIST_SIZE];
+
+static uint8_t rgb_matrix_map_row_column_to_led_slow(uint8_t row, uint8_t column, uint8_t *led_i);
+
+static void led_map_cache_init(void) {
+    uint8_t fill = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led[LED_HITS_TO_REMEMBER];
+            uint8_t count = rgb_matrix_map_row_column_to_led_slow(row, col, led);
+            if (fill + count > RGB_MATRIX_LED_MAP_LIST_SIZE) {
+                // out of list space (raise RGB_MATRIX_LED_MAP_LIST_SIZE);
+                // leave the slot on the slow path rather than dropping LEDs
+                led_map[row][col] = (led_map_slot_t){.start = UINT8_MAX, .count = 0};
+                continue;
+            }
+            led_map[row][col] = (led_map_slot_t){.start = fill, .count = count};
+            for (uint8_t i = 0; i < count; i++) {
+                led_map_list[fill++] = led[i];
+            }
+        }
+    }
+}
+
+static uint8_t rgb_matrix_map_row_column_to_led_slow(uint8_t row, uint8_t column, uint8_t *led_i) {
+#else
 uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *led_i) {
+#endif
     uint8_t led_count = rgb_matrix_map_row_column_to_led_kb(row, column, led_i);
     uint8_t led_index = g_led_config.matrix_co[row][column];
     if (led_index != NO_LED) {
@@ -185,9 +305,82 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+#ifdef RGB_MATRIX_LED_MAP_CACHE
+uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *led_i) {
+    led_map_slot_t slot = led_map[row][column];
+    if (slot.start == UINT8_MAX) {
+        return rgb_matrix_map_row_column_to_led_slow(row, column, led_i);
+    }
+    for (uint8_t i = 0; i < slot.count; i++) {
+        led_i[i] = led_map_list[slot.start + i];
+    }
+    return slot.count;
+}
+#endif
+
+#ifdef RGB_MATRIX_FLUSH_STATS
+// Flush timings accumulate until cleared; with RGB_MATRIX_INCREMENTAL_FLUSH
+// each sample covers one chunk of the frame rather than the whole frame
+static uint32_t rgb_flush_us_min = UINT32_MAX;
+static uint32_t rgb_flush_us_max = 0;
+static uint32_t rgb_flush_us_sum = 0;
+static uint32_t rgb_flush_count  = 0;
+
+void rgb_matrix_get_flush_stats(rgb_matrix_flush_stats_t *stats) {
+    stats->min     = rgb_flush_count ? rgb_flush_us_min : 0;
+    stats->avg     = rgb_flush_count ? (rgb_flush_us_sum / rgb_flush_count) : 0;
+    stats->max     = rgb_flush_us_max;
+    stats->flushes = rgb_flush_count;
+    stats->bytes   = rgb_flush_count * rgb_matrix_flush_bytes;
+}
+
+void rgb_matrix_clear_flush_stats(void) {
+    rgb_flush_us_min = UINT32_MAX;
+    rgb_flush_us_max = 0;
+    rgb_flush_us_sum = 0;
+    rgb_flush_count  = 0;
+}
+
+void rgb_matrix_update_pwm_buffers(void) {
+    uint32_t start = scan_profile_timer_read_us();
+    rgb_matrix_driver.flush();
+    uint32_t duration = scan_profile_timer_read_us() - start;
+    if (duration < rgb_flush_us_min) rgb_flush_us_min = duration;
+    if (duration > rgb_flush_us_max) rgb_flush_us_max = duration;
+    rgb_flush_us_sum += duration;
+    rgb_flush_count++;
+}
+#else
 void rgb_matrix_update_pwm_buffers(void) { rgb_matrix_driver.flush(); }
+#endif  // RGB_MATRIX_FLUSH_STATS
+
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+// Drivers that transmit their PWM state in chunks report here whether part of
+// the frame is still unsent; the task keeps flushing until this clears
+__attribute__((weak)) bool rgb_matrix_driver_flush_pending(void) { return false; }
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_IDLE_DIMMING
+    if (rgb_idle_stage != RGB_IDLE_ACTIVE) {
+        red   = scale8(red, RGB_MATRIX_IDLE_DIM_VALUE);
+        green = scale8(green, RGB_MATRIX_IDLE_DIM_VALUE);
+        blue  = scale8(blue, RGB_MATRIX_IDLE_DIM_VALUE);
+    }
+#endif  // RGB_MATRIX_IDLE_DIMMING
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    uint8_t *shadow = rgb_shadow_buffer[index];
+    if (shadow[0] == red && shadow[1] == green && shadow[2] == blue) return;
+    shadow[0]       = red;
+    shadow[1]       = green;
+    shadow[2]       = blue;
+    rgb_frame_dirty = true;
+#endif  // RGB_MATRIX_DIRTY_TRACKING
+#if defined(RGB_MATRIX_BLEND_OVERLAYS) && !defined(RGB_MATRIX_DIRTY_TRACKING)
+    rgb_blend_buffer[index][0] = red;
+    rgb_blend_buffer[index][1] = green;
+    rgb_blend_buffer[index][2] = blue;
+#endif  // defined(RGB_MATRIX_BLEND_OVERLAYS) && !defined(RGB_MATRIX_DIRTY_TRACKING)
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     if (!is_keyboard_left() && index >= k_rgb_matrix_split[0])
         rgb_matrix_driver.set_color(index - k_rgb_matrix_split[0], red, green, blue);
@@ -197,13 +390,25 @@ void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_DIRTY_TRACKING) || defined(RGB_MATRIX_IDLE_DIMMING) || defined(RGB_MATRIX_BLEND_OVERLAYS) || (defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT))
+    // Per-LED so that dirty tracking / idle dimming / blending / split clipping stays in sync
     for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) rgb_matrix_set_color(i, red, green, blue);
 #else
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
 
+#ifdef RGB_MATRIX_BLEND_OVERLAYS
+void rgb_matrix_set_color_blend(int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+#    ifdef RGB_MATRIX_DIRTY_TRACKING
+    const uint8_t *cur = rgb_shadow_buffer[index];
+#    else
+    const uint8_t *cur = rgb_blend_buffer[index];
+#    endif
+    rgb_matrix_set_color(index, blend8(cur[0], red, alpha), blend8(cur[1], green, alpha), blend8(cur[2], blue, alpha));
+}
+#endif  // RGB_MATRIX_BLEND_OVERLAYS
+
 void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -225,21 +430,28 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2);  // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        // O(1) ring insert; when full the head slot holds the oldest entry,
+        // which is exactly the one to evict
+        uint8_t slot         = last_hit_buffer.head;
+        last_hit_buffer.head = (slot + 1) % LED_HITS_TO_REMEMBER;
+        if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+            last_hit_buffer.count++;
+        }
+        last_hit_buffer.x[slot]     = g_led_config.point[led[i]].x;
+        last_hit_buffer.y[slot]     = g_led_config.point[led[i]].y;
+        last_hit_buffer.index[slot] = led[i];
+        last_hit_buffer.tick[slot]  = 0;
+
+#    ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+        // Pay the distance math once per hit instead of per (LED x hit) pair
+        // every frame in the splash runners
+        for (uint8_t j = 0; j < DRIVER_LED_TOTAL; j++) {
+            int16_t dx              = g_led_config.point[j].x - last_hit_buffer.x[slot];
+            int16_t dy              = g_led_config.point[j].y - last_hit_buffer.y[slot];
+            g_rgb_hit_dist[slot][j] = sqrt16(dx * dx + dy * dy);
+        }
+#    endif  // RGB_MATRIX_PRECOMPUTE_TABLES
     }
 #endif  // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -283,6 +495,62 @@ static bool rgb_matrix_none(effect_params_t *params) {
     return false;
 }
 
+#ifdef RGB_MATRIX_HSV_TRANSITION
+void rgb_matrix_sethsv_eeprom_helper(uint16_t hue, uint8_t sat, uint8_t val, bool write_to_eeprom);
+
+/* Render-path HSV interpolation: a host or keycode sets a target color and a
+ * duration once, the per-frame lerp happens here, and the EEPROM write is
+ * deferred until the target is reached -- one transaction and one config
+ * commit instead of a stream of intermediate sethsv calls. */
+static struct {
+    bool     active;
+    bool     write_eeprom;
+    HSV      from;
+    HSV      to;
+    uint16_t duration;
+    uint32_t start;
+} rgb_transition;
+
+static void rgb_transition_step(void) {
+    if (!rgb_transition.active) {
+        return;
+    }
+    uint32_t elapsed = sync_timer_elapsed32(rgb_transition.start);
+    if (elapsed >= rgb_transition.duration) {
+        rgb_transition.active = false;
+        rgb_matrix_sethsv_eeprom_helper(rgb_transition.to.h, rgb_transition.to.s, rgb_transition.to.v, rgb_transition.write_eeprom);
+        return;
+    }
+    uint8_t frac = (uint8_t)((elapsed * 255) / rgb_transition.duration);
+    // hue takes the short way around the color circle
+    rgb_matrix_config.hsv.h = rgb_transition.from.h + (uint8_t)(((int16_t)(int8_t)(rgb_transition.to.h - rgb_transition.from.h) * frac) / 255);
+    rgb_matrix_config.hsv.s = lerp8by8(rgb_transition.from.s, rgb_transition.to.s, frac);
+    rgb_matrix_config.hsv.v = lerp8by8(rgb_transition.from.v, rgb_transition.to.v, frac);
+}
+
+static void rgb_matrix_sethsv_transition_helper(uint16_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms, bool write_to_eeprom) {
+    if (!rgb_matrix_config.enable) {
+        return;
+    }
+    if (duration_ms == 0) {
+        rgb_matrix_sethsv_eeprom_helper(hue, sat, val, write_to_eeprom);
+        return;
+    }
+    rgb_transition.from         = rgb_matrix_config.hsv;
+    rgb_transition.to.h         = (uint8_t)hue;
+    rgb_transition.to.s         = sat;
+    rgb_transition.to.v         = (val > RGB_MATRIX_MAXIMUM_BRIGHTNESS) ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : val;
+    rgb_transition.duration     = duration_ms;
+    rgb_transition.start        = sync_timer_read32();
+    rgb_transition.write_eeprom = write_to_eeprom;
+    rgb_transition.active       = true;
+}
+void rgb_matrix_sethsv_transition(uint16_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms) { rgb_matrix_sethsv_transition_helper(hue, sat, val, duration_ms, true); }
+void rgb_matrix_sethsv_transition_noeeprom(uint16_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms) { rgb_matrix_sethsv_transition_helper(hue, sat, val, duration_ms, false); }
+
+bool rgb_matrix_transition_active(void) { return rgb_transition.active; }
+#endif  // RGB_MATRIX_HSV_TRANSITION
+
 static void rgb_task_timers(void) {
 #if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) || RGB_DISABLE_TIMEOUT > 0
     uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
@@ -302,21 +570,34 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    // Entries age uniformly and are inserted in order, so the expired ones
+    // are always the oldest prefix of the ring
     uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
+    uint8_t tail  = last_hit_slot(&last_hit_buffer, 0);
+    for (uint8_t j = 0; j < count; ++j) {
+        uint8_t slot = (uint8_t)(tail + j) % LED_HITS_TO_REMEMBER;
+        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[slot]) {
             last_hit_buffer.count--;
             continue;
         }
-        last_hit_buffer.tick[i] += deltaTime;
+        last_hit_buffer.tick[slot] += deltaTime;
     }
 #endif  // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+#ifdef RGB_MATRIX_HSV_TRANSITION
+    rgb_transition_step();
+#endif
 }
 
 static void rgb_task_sync(void) {
     // next task
     if (rgb_update_eeprom) eeconfig_update_rgb_matrix();
     rgb_update_eeprom = false;
+#ifdef RGB_MATRIX_IDLE_DIMMING
+    // hold the last rendered frame on the LEDs; rendering resumes as soon as
+    // input activity drops the idle stage again
+    if (rgb_idle_stage == RGB_IDLE_FROZEN) return;
+#endif  // RGB_MATRIX_IDLE_DIMMING
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
@@ -324,6 +605,22 @@ static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+    // Adjust the per-pass chunk between frames so a single RENDERING pass
+    // stays within one timer tick. The millisecond timer is coarse, so shrink
+    // aggressively on a long pass and only creep back up once the passes have
+    // been consistently short.
+    if (rgb_long_pass_seen) {
+        uint8_t next            = g_rgb_led_process_limit - g_rgb_led_process_limit / 4;
+        g_rgb_led_process_limit = next < RGB_MATRIX_ADAPTIVE_LIMIT_MIN ? RGB_MATRIX_ADAPTIVE_LIMIT_MIN : next;
+        rgb_clean_frames        = 0;
+    } else if (g_rgb_led_process_limit < RGB_MATRIX_LED_PROCESS_LIMIT && ++rgb_clean_frames >= 32) {
+        g_rgb_led_process_limit++;
+        rgb_clean_frames = 0;
+    }
+    rgb_long_pass_seen = false;
+#endif  // RGB_MATRIX_ADAPTIVE_LIMIT
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -400,7 +697,26 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_enable = rgb_matrix_config.enable;
 
     // update pwm buffers
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // skip the (potentially lengthy) driver transfer if no LED changed color
+    if (rgb_frame_dirty
+#    ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+        || rgb_matrix_driver_flush_pending()
+#    endif
+    ) {
+        rgb_matrix_update_pwm_buffers();
+        rgb_frame_dirty = false;
+    }
+#else
     rgb_matrix_update_pwm_buffers();
+#endif  // RGB_MATRIX_DIRTY_TRACKING
+
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+    // part of the frame is still unsent; flush more of it next pass
+    if (rgb_matrix_driver_flush_pending()) {
+        return;
+    }
+#endif  // RGB_MATRIX_INCREMENTAL_FLUSH
 
     // next task
     rgb_task_state = SYNCING;
@@ -409,12 +725,28 @@ static void rgb_task_flush(uint8_t effect) {
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
+#ifdef RGB_MATRIX_IDLE_DIMMING
+    uint32_t idle = last_input_activity_elapsed();
+    if (RGB_MATRIX_IDLE_OFF_TIMEOUT > 0 && idle >= (uint32_t)RGB_MATRIX_IDLE_OFF_TIMEOUT) {
+        rgb_idle_stage = RGB_IDLE_OFF;
+    } else if (idle >= (uint32_t)RGB_MATRIX_IDLE_FREEZE_TIMEOUT) {
+        rgb_idle_stage = RGB_IDLE_FROZEN;
+    } else if (idle >= (uint32_t)RGB_MATRIX_IDLE_DIM_TIMEOUT) {
+        rgb_idle_stage = RGB_IDLE_DIMMED;
+    } else {
+        rgb_idle_stage = RGB_IDLE_ACTIVE;
+    }
+#endif  // RGB_MATRIX_IDLE_DIMMING
+
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
     // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_DISABLE_TIMEOUT > 0
                              (rgb_anykey_timer > (uint32_t)RGB_DISABLE_TIMEOUT) ||
 #endif  // RGB_DISABLE_TIMEOUT > 0
+#ifdef RGB_MATRIX_IDLE_DIMMING
+                             (rgb_idle_stage == RGB_IDLE_OFF) ||
+#endif  // RGB_MATRIX_IDLE_DIMMING
                              false;
 
     uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
@@ -423,13 +755,23 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+            uint16_t render_start = timer_read();
+#endif  // RGB_MATRIX_ADAPTIVE_LIMIT
             rgb_task_render(effect);
             if (effect) {
                 rgb_matrix_indicators();
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
-            break;
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+            // Two tick boundaries crossed guarantees this pass ran for more
+            // than a full millisecond; one boundary could just be straddling
+            if (timer_elapsed(render_start) > 1) {
+                rgb_long_pass_seen = true;
+            }
+#endif  // RGB_MATRIX_ADAPTIVE_LIMIT
+        } break;
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -439,7 +781,56 @@ void rgb_matrix_task(void) {
     }
 }
 
+#ifdef RGB_MATRIX_INDICATOR_RULES
+#    ifndef RGB_MATRIX_INDICATOR_MAX_LEDS
+#        define RGB_MATRIX_INDICATOR_MAX_LEDS 16
+#    endif
+
+// Active (led, color) pairs compiled from the rule table. The table is only
+// walked when the host LED report or the layer state changes; the per-frame
+// cost is a straight copy of this list into the framebuffer.
+static struct {
+    uint8_t led;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} rgb_indicator_active[RGB_MATRIX_INDICATOR_MAX_LEDS];
+static uint8_t       rgb_indicator_active_count = 0;
+static uint8_t       rgb_indicator_last_leds    = 0xFF;
+static layer_state_t rgb_indicator_last_layers  = ~(layer_state_t)0;
+
+static void rgb_matrix_indicator_rules_compile(void) {
+    uint8_t       leds   = host_keyboard_leds();
+    layer_state_t layers = default_layer_state;
+#    ifndef NO_ACTION_LAYER
+    layers |= layer_state;
+#    endif
+    if (leds == rgb_indicator_last_leds && layers == rgb_indicator_last_layers) return;
+    rgb_indicator_last_leds    = leds;
+    rgb_indicator_last_layers  = layers;
+    rgb_indicator_active_count = 0;
+    for (uint8_t i = 0; i < rgb_matrix_indicator_rule_count; i++) {
+        const rgb_matrix_indicator_rule_t *rule = &rgb_matrix_indicator_rules[i];
+        if ((leds & rule->host_led_mask) != rule->host_led_mask) continue;
+        if (rule->layer_mask && !(layers & rule->layer_mask)) continue;
+        for (uint8_t j = 0; j < rule->led_count && rgb_indicator_active_count < RGB_MATRIX_INDICATOR_MAX_LEDS; j++) {
+            rgb_indicator_active[rgb_indicator_active_count].led = rule->led_min + j;
+            rgb_indicator_active[rgb_indicator_active_count].r   = rule->r;
+            rgb_indicator_active[rgb_indicator_active_count].g   = rule->g;
+            rgb_indicator_active[rgb_indicator_active_count].b   = rule->b;
+            rgb_indicator_active_count++;
+        }
+    }
+}
+#endif  // RGB_MATRIX_INDICATOR_RULES
+
 void rgb_matrix_indicators(void) {
+#ifdef RGB_MATRIX_INDICATOR_RULES
+    rgb_matrix_indicator_rules_compile();
+    for (uint8_t i = 0; i < rgb_indicator_active_count; i++) {
+        rgb_matrix_set_color(rgb_indicator_active[i].led, rgb_indicator_active[i].r, rgb_indicator_active[i].g, rgb_indicator_active[i].b);
+    }
+#endif  // RGB_MATRIX_INDICATOR_RULES
     rgb_matrix_indicators_kb();
     rgb_matrix_indicators_user();
 }
@@ -454,7 +845,11 @@ void rgb_matrix_indicators_advanced(effect_params_t *params) {
      * and not sure which would be better. Otherwise, this should be called from
      * rgb_task_render, right before the iter++ line.
      */
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+    uint8_t min = g_rgb_led_process_limit * (params->iter - 1);
+    uint8_t max = min + g_rgb_led_process_limit;
+    if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
     uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (params->iter - 1);
     uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
@@ -473,13 +868,28 @@ __attribute__((weak)) void rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        int16_t dx        = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy        = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_rgb_led_dist[i]  = sqrt16(dx * dx + dy * dy);
+        g_rgb_led_angle[i] = atan2_8(dy, dx);
+    }
+#endif  // RGB_MATRIX_PRECOMPUTE_TABLES
+
+#ifdef RGB_MATRIX_LED_MAP_CACHE
+    led_map_cache_init();
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
+    g_last_hit_tracker.head  = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
     }
 
     last_hit_buffer.count = 0;
+    last_hit_buffer.head  = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
@@ -501,10 +911,30 @@ void rgb_matrix_init(void) {
 
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_DISABLE_WHEN_USB_SUSPENDED
+#    ifdef RGB_MATRIX_FAST_SUSPEND
+    if (state != suspend_state) {
+        // one global-current register write per controller, instead of
+        // rendering and flushing a dark frame over I2C while the host is
+        // waiting for the suspend acknowledgment
+        rgb_matrix_driver_suspend(state);
+        if (!state) {
+            // the controllers still hold the pre-suspend PWM frame, so the
+            // restore is instant; re-render from scratch on the next pass
+            rgb_task_state = STARTING;
+        }
+    }
+#    else
     if (state && !suspend_state) {  // only run if turning off, and only once
         rgb_task_render(0);         // turn off all LEDs when suspending
         rgb_task_flush(0);          // and actually flash led state to LEDs
+#        ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+        // the task may not run again before sleep; drain the rest synchronously
+        while (rgb_matrix_driver_flush_pending()) {
+            rgb_matrix_update_pwm_buffers();
+        }
+#        endif  // RGB_MATRIX_INCREMENTAL_FLUSH
     }
+#    endif      // RGB_MATRIX_FAST_SUSPEND
     suspend_state = state;
 #endif
 }
@@ -580,6 +1010,10 @@ void rgb_matrix_sethsv_eeprom_helper(uint16_t hue, uint8_t sat, uint8_t val, boo
     if (!rgb_matrix_config.enable) {
         return;
     }
+#ifdef RGB_MATRIX_HSV_TRANSITION
+    // a direct color set takes over from any transition in flight
+    rgb_transition.active = false;
+#endif
     rgb_matrix_config.hsv.h = hue;
     rgb_matrix_config.hsv.s = sat;
     rgb_matrix_config.hsv.v = (val > RGB_MATRIX_MAXIMUM_BRIGHTNESS) ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : val;
@@ -47,7 +47,15 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
 #endif
 
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#ifdef RGB_MATRIX_ADAPTIVE_LIMIT
+// Runtime-adjusted chunk size, never larger than RGB_MATRIX_LED_PROCESS_LIMIT.
+// Only changed between frames, so limit * iter stays consistent within one.
+extern uint8_t g_rgb_led_process_limit;
+#    define RGB_MATRIX_USE_LIMITS(min, max)                   \
+        uint8_t min = g_rgb_led_process_limit * params->iter; \
+        uint8_t max = min + g_rgb_led_process_limit;          \
+        if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
 #    define RGB_MATRIX_USE_LIMITS(min, max)                        \
         uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter; \
         uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;          \
@@ -63,6 +71,13 @@
         rgb_matrix_set_color(i, r, g, b);          \
     }
 
+#ifdef RGB_MATRIX_BLEND_OVERLAYS
+#    define RGB_MATRIX_INDICATOR_BLEND_COLOR(i, r, g, b, a) \
+        if (i >= led_min && i <= led_max) {                 \
+            rgb_matrix_set_color_blend(i, r, g, b, a);      \
+        }
+#endif
+
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
@@ -99,11 +114,48 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+#ifdef RGB_MATRIX_BLEND_OVERLAYS
+// Blend over whatever the current frame already holds at this LED; alpha 0
+// leaves the LED untouched, 255 is fully opaque. Meant for overlays and
+// indicator hooks so they only pay for the LEDs they write.
+void rgb_matrix_set_color_blend(int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+#endif
 
 void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
 
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+// Provided by drivers that support chunked flushing; true while part of the
+// current frame is still unsent
+bool rgb_matrix_driver_flush_pending(void);
+#endif
+
+#ifdef RGB_MATRIX_FAST_SUSPEND
+// Provided by drivers that can blank and restore all LEDs with a global
+// current/shutdown register instead of streaming a dark frame
+void rgb_matrix_driver_suspend(bool suspended);
+#endif
+
+#ifdef RGB_MATRIX_FLUSH_STATS
+typedef struct {
+    uint32_t min;      // microseconds
+    uint32_t avg;      // microseconds
+    uint32_t max;      // microseconds
+    uint32_t flushes;  // driver flush calls since the last clear
+    uint32_t bytes;    // wire bytes moved since the last clear
+} rgb_matrix_flush_stats_t;
+
+// Wire bytes one driver flush call moves for the active backend, including
+// register/command framing (one chunk of the frame when
+// RGB_MATRIX_INCREMENTAL_FLUSH is enabled, the whole frame otherwise)
+extern const uint16_t rgb_matrix_flush_bytes;
+
+// In-situ driver flush timing, e.g. for a raw HID query handler
+void rgb_matrix_get_flush_stats(rgb_matrix_flush_stats_t *stats);
+void rgb_matrix_clear_flush_stats(void);
+#endif
+
 // This runs after another backlight effect and replaces
 // colors already set
 void rgb_matrix_indicators(void);
@@ -114,6 +166,26 @@ void rgb_matrix_indicators_advanced(effect_params_t *params);
 void rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 void rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+#ifdef RGB_MATRIX_INDICATOR_RULES
+// Declarative indicator rule: when every bit of host_led_mask is set in
+// host_keyboard_leds() and layer_mask is zero or overlaps the active layers,
+// paint led_count LEDs starting at led_min with the given color. Rules are
+// only re-evaluated when the host LED report or the layer state changes.
+typedef struct rgb_matrix_indicator_rule_t {
+    uint8_t       host_led_mask;
+    layer_state_t layer_mask;
+    uint8_t       led_min;
+    uint8_t       led_count;
+    uint8_t       r;
+    uint8_t       g;
+    uint8_t       b;
+} rgb_matrix_indicator_rule_t;
+
+// Rule table supplied by the keyboard or keymap
+extern const rgb_matrix_indicator_rule_t rgb_matrix_indicator_rules[];
+extern const uint8_t                     rgb_matrix_indicator_rule_count;
+#endif  // RGB_MATRIX_INDICATOR_RULES
+
 void rgb_matrix_init(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -134,6 +206,13 @@ void        rgb_matrix_step_reverse(void);
 void        rgb_matrix_step_reverse_noeeprom(void);
 void        rgb_matrix_sethsv(uint16_t hue, uint8_t sat, uint8_t val);
 void        rgb_matrix_sethsv_noeeprom(uint16_t hue, uint8_t sat, uint8_t val);
+#ifdef RGB_MATRIX_HSV_TRANSITION
+// Fade to the target color over duration_ms in the render path; the EEPROM
+// write (for the non-noeeprom variant) happens once, when the fade completes
+void rgb_matrix_sethsv_transition(uint16_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms);
+void rgb_matrix_sethsv_transition_noeeprom(uint16_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms);
+bool rgb_matrix_transition_active(void);
+#endif
 HSV         rgb_matrix_get_hsv(void);
 uint8_t     rgb_matrix_get_hue(void);
 uint8_t     rgb_matrix_get_sat(void);
@@ -217,11 +296,28 @@ typedef struct {
 extern const rgb_matrix_driver_t rgb_matrix_driver;
 
 extern rgb_config_t rgb_matrix_config;
+#ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+extern uint8_t g_rgb_led_dist[DRIVER_LED_TOTAL];
+extern uint8_t g_rgb_led_angle[DRIVER_LED_TOTAL];
+extern uint8_t g_rgb_render_led;  // LED the dx/dy runners are currently rendering
+// Table-driven angle around the matrix center for the current LED; the
+// arguments are only evaluated by the atan2_8 fallback
+#    define rgb_matrix_led_angle(dy, dx) (g_rgb_led_angle[g_rgb_render_led])
+#else
+#    define rgb_matrix_led_angle(dy, dx) atan2_8(dy, dx)
+#endif
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+#    ifdef RGB_MATRIX_PRECOMPUTE_TABLES
+// Distance from each hit ring slot to every LED, filled when the hit lands
+extern uint8_t g_rgb_hit_dist[LED_HITS_TO_REMEMBER][DRIVER_LED_TOTAL];
+#    endif
+
+// Physical slot of the j-th oldest live entry in the hit ring
+static inline uint8_t last_hit_slot(const last_hit_t *tracker, uint8_t j) { return (uint8_t)(tracker->head + LED_HITS_TO_REMEMBER - tracker->count + j) % LED_HITS_TO_REMEMBER; }
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
@@ -40,8 +40,11 @@
 #endif  // LED_HITS_TO_REMEMBER
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// Ring buffer of the most recent key hits: head is the next slot to write,
+// so when full the oldest entry is the one overwritten
 typedef struct PACKED {
     uint8_t  count;
+    uint8_t  head;
     uint8_t  x[LED_HITS_TO_REMEMBER];
     uint8_t  y[LED_HITS_TO_REMEMBER];
     uint8_t  index[LED_HITS_TO_REMEMBER];
@@ -178,7 +178,7 @@ void rgblight_check_config(void) {
 
 uint32_t eeconfig_read_rgblight(void) {
 #ifdef EEPROM_ENABLE
-    return eeprom_read_dword(EECONFIG_RGBLIGHT);
+    return eeconfig_read_dword(EECONFIG_RGBLIGHT);
 #else
     return 0;
 #endif
@@ -187,7 +187,7 @@ uint32_t eeconfig_read_rgblight(void) {
 void eeconfig_update_rgblight(uint32_t val) {
 #ifdef EEPROM_ENABLE
     rgblight_check_config();
-    eeprom_update_dword(EECONFIG_RGBLIGHT, val);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, val);
 #endif
 }
 
@@ -468,7 +468,83 @@ void rgblight_sethsv_noeeprom_old(uint8_t hue, uint8_t sat, uint8_t val) {
     }
 }
 
+#ifdef RGBLIGHT_HSV_TRANSITION
+/* Timer-path HSV interpolation: rgblight_sethsv_transition() records the
+ * target and duration, rgblight_task() applies the lerped color at
+ * RGBLIGHT_TRANSITION_INTERVAL ms steps through the normal sethsv path, and
+ * the EEPROM commit happens once when the target is reached. */
+static struct {
+    bool     active;
+    bool     write_eeprom;
+    uint8_t  from_hue, from_sat, from_val;
+    uint8_t  to_hue, to_sat, to_val;
+    uint16_t duration;
+    uint16_t start;
+    uint16_t last_step;
+} rgblight_transition;
+
+// distinguishes the transition's own sethsv calls from a direct color set,
+// which takes over and cancels the transition
+static bool rgblight_transition_stepping = false;
+
+static void rgblight_transition_step(void) {
+    if (!rgblight_transition.active) {
+        return;
+    }
+    uint16_t now = sync_timer_read();
+    if ((uint16_t)(now - rgblight_transition.last_step) < RGBLIGHT_TRANSITION_INTERVAL) {
+        return;
+    }
+    rgblight_transition.last_step = now;
+    uint16_t elapsed              = now - rgblight_transition.start;
+
+    rgblight_transition_stepping = true;
+    if (elapsed >= rgblight_transition.duration) {
+        rgblight_transition.active = false;
+        rgblight_sethsv_eeprom_helper(rgblight_transition.to_hue, rgblight_transition.to_sat, rgblight_transition.to_val, rgblight_transition.write_eeprom);
+    } else {
+        uint8_t frac = (uint8_t)(((uint32_t)elapsed * 255) / rgblight_transition.duration);
+        // hue takes the short way around the color circle
+        uint8_t hue = rgblight_transition.from_hue + (uint8_t)(((int16_t)(int8_t)(rgblight_transition.to_hue - rgblight_transition.from_hue) * frac) / 255);
+        uint8_t sat = rgblight_transition.from_sat + (uint8_t)(((int16_t)(rgblight_transition.to_sat - rgblight_transition.from_sat) * frac) / 255);
+        uint8_t val = rgblight_transition.from_val + (uint8_t)(((int16_t)(rgblight_transition.to_val - rgblight_transition.from_val) * frac) / 255);
+        rgblight_sethsv_eeprom_helper(hue, sat, val, false);
+    }
+    rgblight_transition_stepping = false;
+}
+
+static void rgblight_sethsv_transition_helper(uint8_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms, bool write_to_eeprom) {
+    if (!rgblight_config.enable) {
+        return;
+    }
+    if (duration_ms == 0) {
+        rgblight_sethsv_eeprom_helper(hue, sat, val, write_to_eeprom);
+        return;
+    }
+    rgblight_transition.from_hue     = rgblight_config.hue;
+    rgblight_transition.from_sat     = rgblight_config.sat;
+    rgblight_transition.from_val     = rgblight_config.val;
+    rgblight_transition.to_hue       = hue;
+    rgblight_transition.to_sat       = sat;
+    rgblight_transition.to_val       = val;
+    rgblight_transition.duration     = duration_ms;
+    rgblight_transition.start        = sync_timer_read();
+    rgblight_transition.last_step    = rgblight_transition.start;
+    rgblight_transition.write_eeprom = write_to_eeprom;
+    rgblight_transition.active       = true;
+}
+void rgblight_sethsv_transition(uint8_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms) { rgblight_sethsv_transition_helper(hue, sat, val, duration_ms, true); }
+void rgblight_sethsv_transition_noeeprom(uint8_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms) { rgblight_sethsv_transition_helper(hue, sat, val, duration_ms, false); }
+
+bool rgblight_transition_active(void) { return rgblight_transition.active; }
+#endif  // RGBLIGHT_HSV_TRANSITION
+
 void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool write_to_eeprom) {
+#ifdef RGBLIGHT_HSV_TRANSITION
+    if (!rgblight_transition_stepping) {
+        rgblight_transition.active = false;
+    }
+#endif
     if (rgblight_config.enable) {
         rgblight_status.base_mode = mode_base_table[rgblight_config.mode];
         if (rgblight_config.mode == RGBLIGHT_MODE_STATIC_LIGHT) {
@@ -943,83 +1019,89 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
 }
 
 void rgblight_task(void) {
+#    ifdef RGBLIGHT_HSV_TRANSITION
+    rgblight_transition_step();
+#    endif
     if (rgblight_status.timer_enabled) {
-        effect_func_t effect_func   = rgblight_effect_dummy;
-        uint16_t      interval_time = 2000;  // dummy interval
-        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
-        animation_status.delta      = delta;
-
-        // static light mode, do nothing here
-        if (1 == 0) {  // dummy
+        if (animation_status.restart) {
+            animation_status.restart    = false;
+            animation_status.last_timer = sync_timer_read();
+            animation_status.pos16      = 0;  // restart signal to local each effect
         }
+
+        // animation_status.last_timer holds the next frame deadline, so an
+        // idle pass costs a single comparison before any mode dispatch
+        uint16_t now = sync_timer_read();
+        if (timer_expired(now, animation_status.last_timer)) {
+            effect_func_t effect_func   = rgblight_effect_dummy;
+            uint16_t      interval_time = 2000;  // dummy interval
+            uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
+            animation_status.delta      = delta;
+
+            // static light mode, do nothing here
+            if (1 == 0) {  // dummy
+            }
 #    ifdef RGBLIGHT_EFFECT_BREATHING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
-            // breathing mode
-            interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
-            effect_func   = rgblight_effect_breathing;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
+                // breathing mode
+                interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
+                effect_func   = rgblight_effect_breathing;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
-            // rainbow mood mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_rainbow_mood;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
+                // rainbow mood mode
+                interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
+                effect_func   = rgblight_effect_rainbow_mood;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
-            // rainbow swirl mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
-            effect_func   = rgblight_effect_rainbow_swirl;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
+                // rainbow swirl mode
+                interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
+                effect_func   = rgblight_effect_rainbow_swirl;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_SNAKE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
-            // snake mode
-            interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
-            effect_func   = rgblight_effect_snake;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
+                // snake mode
+                interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
+                effect_func   = rgblight_effect_snake;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_KNIGHT
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
-            // knight mode
-            interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_knight;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
+                // knight mode
+                interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
+                effect_func   = rgblight_effect_knight;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_CHRISTMAS
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
-            // christmas mode
-            interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
-            effect_func   = (effect_func_t)rgblight_effect_christmas;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
+                // christmas mode
+                interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
+                effect_func   = (effect_func_t)rgblight_effect_christmas;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RGB_TEST
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
-            // RGB test mode
-            interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
-            effect_func   = (effect_func_t)rgblight_effect_rgbtest;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
+                // RGB test mode
+                interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
+                effect_func   = (effect_func_t)rgblight_effect_rgbtest;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_ALTERNATING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
-            interval_time = 500;
-            effect_func   = (effect_func_t)rgblight_effect_alternating;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
+                interval_time = 500;
+                effect_func   = (effect_func_t)rgblight_effect_alternating;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_TWINKLE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
-            interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
-            effect_func   = (effect_func_t)rgblight_effect_twinkle;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
+                interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
+                effect_func   = (effect_func_t)rgblight_effect_twinkle;
+            }
 #    endif
-        if (animation_status.restart) {
-            animation_status.restart    = false;
-            animation_status.last_timer = sync_timer_read();
-            animation_status.pos16      = 0;  // restart signal to local each effect
-        }
-        uint16_t now = sync_timer_read();
-        if (timer_expired(now, animation_status.last_timer)) {
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             static uint16_t report_last_timer = 0;
             static bool     tick_flag         = false;
@@ -1035,6 +1117,11 @@ void rgblight_task(void) {
             oldpos16 = animation_status.pos16;
 #    endif
             animation_status.last_timer += interval_time;
+            if (timer_expired(now, animation_status.last_timer)) {
+                // the task was stalled past a whole extra interval; skip the
+                // missed frames instead of replaying them back-to-back
+                animation_status.last_timer = now + interval_time;
+            }
             effect_func(&animation_status);
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             if (animation_status.pos16 == 0 && oldpos16 != 0) {
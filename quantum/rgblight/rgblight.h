@@ -69,16 +69,48 @@
  *****/
 
 #ifdef RGBLIGHT_ANIMATIONS
+#    ifdef KEYMAP_STRIP_UNUSED
+// The build scanned the keymap for RGB mode keycodes: narrow the all-on
+// RGBLIGHT_ANIMATIONS set to the effects the keymap can actually select,
+// dropping the dead effect code and tables from the binary. Effects only
+// reachable by cycling with RGB_MOD or from custom code need an explicit
+// RGBLIGHT_EFFECT_* define in config.h to survive the strip.
+#        if defined(KEYMAP_USES_RGB_MODE_BREATHE) || defined(KEYMAP_USES_RGB_M_B)
+#            define RGBLIGHT_EFFECT_BREATHING
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_RAINBOW) || defined(KEYMAP_USES_RGB_M_R)
+#            define RGBLIGHT_EFFECT_RAINBOW_MOOD
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_SWIRL) || defined(KEYMAP_USES_RGB_M_SW)
+#            define RGBLIGHT_EFFECT_RAINBOW_SWIRL
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_SNAKE) || defined(KEYMAP_USES_RGB_M_SN)
+#            define RGBLIGHT_EFFECT_SNAKE
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_KNIGHT) || defined(KEYMAP_USES_RGB_M_K)
+#            define RGBLIGHT_EFFECT_KNIGHT
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_XMAS) || defined(KEYMAP_USES_RGB_M_X)
+#            define RGBLIGHT_EFFECT_CHRISTMAS
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_GRADIENT) || defined(KEYMAP_USES_RGB_M_G)
+#            define RGBLIGHT_EFFECT_STATIC_GRADIENT
+#        endif
+#        if defined(KEYMAP_USES_RGB_MODE_RGBTEST) || defined(KEYMAP_USES_RGB_M_T)
+#            define RGBLIGHT_EFFECT_RGB_TEST
+#        endif
+#    else
 // for backward compatibility
-#    define RGBLIGHT_EFFECT_BREATHING
-#    define RGBLIGHT_EFFECT_RAINBOW_MOOD
-#    define RGBLIGHT_EFFECT_RAINBOW_SWIRL
-#    define RGBLIGHT_EFFECT_SNAKE
-#    define RGBLIGHT_EFFECT_KNIGHT
-#    define RGBLIGHT_EFFECT_CHRISTMAS
-#    define RGBLIGHT_EFFECT_STATIC_GRADIENT
-#    define RGBLIGHT_EFFECT_RGB_TEST
-#    define RGBLIGHT_EFFECT_ALTERNATING
+#        define RGBLIGHT_EFFECT_BREATHING
+#        define RGBLIGHT_EFFECT_RAINBOW_MOOD
+#        define RGBLIGHT_EFFECT_RAINBOW_SWIRL
+#        define RGBLIGHT_EFFECT_SNAKE
+#        define RGBLIGHT_EFFECT_KNIGHT
+#        define RGBLIGHT_EFFECT_CHRISTMAS
+#        define RGBLIGHT_EFFECT_STATIC_GRADIENT
+#        define RGBLIGHT_EFFECT_RGB_TEST
+#        define RGBLIGHT_EFFECT_ALTERNATING
+#    endif
 #endif
 
 #ifdef RGBLIGHT_STATIC_PATTERNS
@@ -100,6 +132,14 @@
 #    define RGBLIGHT_USE_TIMER
 #endif
 
+// timed HSV fades are driven from rgblight_task()
+#ifdef RGBLIGHT_HSV_TRANSITION
+#    define RGBLIGHT_USE_TIMER
+#    ifndef RGBLIGHT_TRANSITION_INTERVAL
+#        define RGBLIGHT_TRANSITION_INTERVAL 16
+#    endif
+#endif
+
 // clang-format on
 
 #define _RGBM_SINGLE_STATIC(sym) RGBLIGHT_MODE_##sym,
@@ -333,6 +373,13 @@ void rgblight_decrease_speed(void);
 void rgblight_decrease_speed_noeeprom(void);
 void rgblight_sethsv(uint8_t hue, uint8_t sat, uint8_t val);
 void rgblight_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val);
+#ifdef RGBLIGHT_HSV_TRANSITION
+// Fade to the target color over duration_ms from rgblight_task(); the EEPROM
+// write (for the non-noeeprom variant) happens once, when the fade completes
+void rgblight_sethsv_transition(uint8_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms);
+void rgblight_sethsv_transition_noeeprom(uint8_t hue, uint8_t sat, uint8_t val, uint16_t duration_ms);
+bool rgblight_transition_active(void);
+#endif
 
 /*   effect speed */
 uint8_t rgblight_get_speed(void);
@@ -228,6 +228,101 @@ void send_string_with_delay_P(const char *str, uint8_t interval) {
     }
 }
 
+#ifdef SEND_STRING_STREAMING
+/* Streaming engine: instead of blocking inside send_string() for the whole
+ * macro (every character is register+unregister plus wait_ms), the string is
+ * played back one unit per pass from keyboard_task(), so the matrix keeps
+ * scanning while a snippet types out.  PROGMEM strings are batch-decoded a
+ * chunk at a time to avoid a pgm read per byte.
+ */
+#    ifndef SEND_STRING_CHUNK_SIZE
+#        define SEND_STRING_CHUNK_SIZE 16
+#    endif
+
+static const char *stream_str = NULL;
+static bool        stream_active   = false;
+static bool        stream_progmem  = false;
+static uint8_t     stream_interval = 0;
+static uint16_t    stream_delay    = 0; // pending SS_DELAY, in ms
+static uint16_t    stream_timer    = 0;
+static char        stream_chunk[SEND_STRING_CHUNK_SIZE];
+static uint8_t     stream_chunk_pos = 0;
+static uint8_t     stream_chunk_len = 0;
+
+static uint8_t stream_next_byte(void) {
+    if (!stream_progmem) return (uint8_t)*stream_str++;
+    if (stream_chunk_pos >= stream_chunk_len) {
+        // one memcpy_P per chunk; reading a few bytes past the terminator
+        // is harmless, flash is always readable
+        memcpy_P(stream_chunk, stream_str, SEND_STRING_CHUNK_SIZE);
+        stream_str += SEND_STRING_CHUNK_SIZE;
+        stream_chunk_pos = 0;
+        stream_chunk_len = SEND_STRING_CHUNK_SIZE;
+    }
+    return (uint8_t)stream_chunk[stream_chunk_pos++];
+}
+
+static bool send_string_stream_start(const char *str, uint8_t interval, bool progmem) {
+    if (stream_active) return false;
+    stream_str       = str;
+    stream_progmem   = progmem;
+    stream_interval  = interval;
+    stream_delay     = 0;
+    stream_chunk_pos = 0;
+    stream_chunk_len = 0;
+    stream_timer     = timer_read();
+    stream_active    = true;
+    return true;
+}
+
+bool send_string_stream(const char *str, uint8_t interval) { return send_string_stream_start(str, interval, false); }
+
+bool send_string_stream_P(const char *str, uint8_t interval) { return send_string_stream_start(str, interval, true); }
+
+bool send_string_stream_active(void) { return stream_active; }
+
+void send_string_stream_task(void) {
+    if (!stream_active) return;
+
+    // pace to one unit per millisecond at most; SS_DELAY and the caller's
+    // interval stretch the gap without blocking
+    uint16_t due = stream_delay;
+    if (stream_interval > due) due = stream_interval;
+    if (due == 0) due = 1;
+    if (timer_elapsed(stream_timer) < due) return;
+    stream_timer = timer_read();
+    stream_delay = 0;
+
+    uint8_t ascii_code = stream_next_byte();
+    if (!ascii_code) {
+        stream_active = false;
+        stream_str    = NULL;
+        return;
+    }
+    if (ascii_code == SS_QMK_PREFIX) {
+        ascii_code = stream_next_byte();
+        if (ascii_code == SS_TAP_CODE) {
+            tap_code(stream_next_byte());
+        } else if (ascii_code == SS_DOWN_CODE) {
+            register_code(stream_next_byte());
+        } else if (ascii_code == SS_UP_CODE) {
+            unregister_code(stream_next_byte());
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms      = 0;
+            uint8_t  keycode = stream_next_byte();
+            while (isdigit(keycode)) {
+                ms *= 10;
+                ms += keycode - '0';
+                keycode = stream_next_byte();
+            }
+            stream_delay = ms;
+        }
+    } else {
+        send_char((char)ascii_code);
+    }
+}
+#endif
+
 void send_char(char ascii_code) {
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') {  // BEL
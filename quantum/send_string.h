@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -46,6 +47,19 @@ void send_string_P(const char *str);
 void send_string_with_delay_P(const char *str, uint8_t interval);
 void send_char(char ascii_code);
 
+#ifdef SEND_STRING_STREAMING
+#    define SEND_STRING_STREAM(string) send_string_stream_P(PSTR(string), 0)
+
+/* begin playing a string one keystroke per task pass; returns false if one
+ * is already playing. The string must stay valid until playback finishes. */
+bool send_string_stream(const char *str, uint8_t interval);
+bool send_string_stream_P(const char *str, uint8_t interval);
+/* true while a streamed string is still playing */
+bool send_string_stream_active(void);
+/* advances playback; called from keyboard_task() */
+void send_string_stream_task(void);
+#endif
+
 void send_dword(uint32_t number);
 void send_word(uint16_t number);
 void send_byte(uint8_t number);
@@ -34,6 +34,57 @@ sequencer_config_t sequencer_config = {
 
 sequencer_state_t sequencer_internal_state = {0, 0, 0, 0, SEQUENCER_PHASE_ATTACK};
 
+#ifdef SEQUENCER_MIDI_CLOCK
+/* MIDI-clock slave mode. A host sending the 24ppqn realtime clock drives the
+ * step boundaries directly: each step waits for an exact number of clock
+ * ticks instead of the millisecond timer, so the pattern cannot drift against
+ * the host. The 96 clocks of a four-beat bar divide evenly into every
+ * supported resolution, making the tick count exact with no residual to
+ * accumulate. Sync engages on the first start/continue message, a stop
+ * message freezes the pattern in place, and toggling the sequencer off and
+ * on returns it to the free-running internal timer. */
+static bool    sequencer_clock_slaved  = false;
+static bool    sequencer_clock_running = false;
+static uint8_t sequencer_clock_count   = 0;
+static uint8_t sequencer_clock_pending = 0;
+
+static uint8_t sequencer_get_clocks_per_step(void) {
+    // Mirrors get_step_duration: binary resolutions divide the 96-clock bar
+    // by a power of 2, the ternary variants are 1.5x faster
+    bool    is_binary     = sequencer_config.resolution % 2 == 0;
+    uint8_t binary_clocks = 96 / (2 << (sequencer_config.resolution / 2));
+    return is_binary ? binary_clocks : 2 * binary_clocks / 3;
+}
+
+void sequencer_midi_clock_tick(void) {
+    if (!sequencer_clock_slaved || !sequencer_clock_running || !sequencer_config.enabled) {
+        return;
+    }
+
+    if (++sequencer_clock_count >= sequencer_get_clocks_per_step()) {
+        sequencer_clock_count = 0;
+        sequencer_clock_pending++;
+    }
+}
+
+void sequencer_midi_clock_start(void) {
+    sequencer_clock_slaved  = true;
+    sequencer_clock_running = true;
+    sequencer_clock_pending = 0;
+    // The first clock tick after a start message is the downbeat: park one
+    // tick before a step boundary, one step before the top of the pattern
+    sequencer_clock_count                 = sequencer_get_clocks_per_step() - 1;
+    sequencer_internal_state.current_step = SEQUENCER_STEPS - 1;
+}
+
+void sequencer_midi_clock_continue(void) {
+    sequencer_clock_slaved  = true;
+    sequencer_clock_running = true;
+}
+
+void sequencer_midi_clock_stop(void) { sequencer_clock_running = false; }
+#endif
+
 bool is_sequencer_on(void) { return sequencer_config.enabled; }
 
 void sequencer_on(void) {
@@ -43,6 +94,12 @@ void sequencer_on(void) {
     sequencer_internal_state.current_step  = 0;
     sequencer_internal_state.timer         = timer_read();
     sequencer_internal_state.phase         = SEQUENCER_PHASE_ATTACK;
+#ifdef SEQUENCER_MIDI_CLOCK
+    sequencer_clock_slaved  = false;
+    sequencer_clock_running = false;
+    sequencer_clock_count   = 0;
+    sequencer_clock_pending = 0;
+#endif
 }
 
 void sequencer_off(void) {
@@ -169,12 +226,17 @@ void sequencer_phase_attack(void) {
         sequencer_internal_state.timer = timer_read();
     }
 
-    if (timer_elapsed(sequencer_internal_state.timer) < sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
+    // The throttle slots only matter for tracks that actually emit a note;
+    // tracks with nothing programmed on this step advance without waiting,
+    // so silent tracks cost a single pass instead of a throttle delay
+    bool has_note = is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track);
+
+    if (has_note && timer_elapsed(sequencer_internal_state.timer) < sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
         return;
     }
 
 #if defined(MIDI_ENABLE) || defined(MIDI_MOCKED)
-    if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
+    if (has_note) {
         process_midi_basic_noteon(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
     }
 #endif
@@ -187,11 +249,13 @@ void sequencer_phase_attack(void) {
 }
 
 void sequencer_phase_release(void) {
-    if (timer_elapsed(sequencer_internal_state.timer) < SEQUENCER_PHASE_RELEASE_TIMEOUT + sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
+    bool has_note = is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track);
+
+    if (has_note && timer_elapsed(sequencer_internal_state.timer) < SEQUENCER_PHASE_RELEASE_TIMEOUT + sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
         return;
     }
 #if defined(MIDI_ENABLE) || defined(MIDI_MOCKED)
-    if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
+    if (has_note) {
         process_midi_basic_noteoff(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
     }
 #endif
@@ -203,9 +267,20 @@ void sequencer_phase_release(void) {
 }
 
 void sequencer_phase_pause(void) {
+#ifdef SEQUENCER_MIDI_CLOCK
+    if (sequencer_clock_slaved) {
+        if (sequencer_clock_pending == 0) {
+            return;
+        }
+        sequencer_clock_pending--;
+    } else if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
+        return;
+    }
+#else
     if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
         return;
     }
+#endif
 
     sequencer_internal_state.current_step = (sequencer_internal_state.current_step + 1) % SEQUENCER_STEPS;
     sequencer_internal_state.phase        = SEQUENCER_PHASE_ATTACK;
@@ -231,7 +306,21 @@ void sequencer_task(void) {
 
 uint16_t sequencer_get_beat_duration(void) { return get_beat_duration(sequencer_config.tempo); }
 
-uint16_t sequencer_get_step_duration(void) { return get_step_duration(sequencer_config.tempo, sequencer_config.resolution); }
+uint16_t sequencer_get_step_duration(void) {
+    // Recompute only when tempo or resolution changed, so the polling path
+    // pays two compares instead of the division chain in get_step_duration
+    static uint8_t                cached_tempo         = 0;
+    static sequencer_resolution_t cached_resolution    = SEQUENCER_RESOLUTIONS;
+    static uint16_t               cached_step_duration = 0;
+
+    if (sequencer_config.tempo != cached_tempo || sequencer_config.resolution != cached_resolution) {
+        cached_tempo         = sequencer_config.tempo;
+        cached_resolution    = sequencer_config.resolution;
+        cached_step_duration = get_step_duration(cached_tempo, cached_resolution);
+    }
+
+    return cached_step_duration;
+}
 
 uint16_t get_beat_duration(uint8_t tempo) {
     // Don’t crash in the unlikely case where the given tempo is 0
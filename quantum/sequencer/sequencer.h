@@ -119,4 +119,17 @@ uint16_t sequencer_get_step_duration(void);
 uint16_t get_beat_duration(uint8_t tempo);
 uint16_t get_step_duration(uint8_t tempo, sequencer_resolution_t resolution);
 
+#ifdef SEQUENCER_MIDI_CLOCK
+/**
+ * MIDI-clock slave mode: feed these from the realtime input path. 24ppqn
+ * clock ticks drive the step boundaries once a start or continue message has
+ * been seen; stop freezes the pattern in place. Until the first start or
+ * continue message arrives the sequencer free-runs on its internal timer.
+ */
+void sequencer_midi_clock_tick(void);
+void sequencer_midi_clock_start(void);
+void sequencer_midi_clock_continue(void);
+void sequencer_midi_clock_stop(void);
+#endif
+
 void sequencer_task(void);
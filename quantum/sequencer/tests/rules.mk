@@ -2,7 +2,7 @@
 # - it is consistent with the serial_link example that is used as a reference in the Unit Testing article (https://docs.qmk.fm/#/unit_testing?id=adding-tests-for-new-or-existing-features)
 # - Neither `make test:sequencer` or `make test:SEQUENCER` work when using SCREAMING_SNAKE_CASE
 
-sequencer_DEFS := -DNO_DEBUG -DMIDI_MOCKED
+sequencer_DEFS := -DNO_DEBUG -DMIDI_MOCKED -DSEQUENCER_MIDI_CLOCK
 
 sequencer_SRC := \
 	$(QUANTUM_PATH)/sequencer/tests/midi_mock.c \
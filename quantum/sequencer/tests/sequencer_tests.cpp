@@ -588,3 +588,102 @@ TEST_F(SequencerTest, TestMatrixScanSequencerShouldLoopOnceSequenceIsOver) {
     EXPECT_EQ(sequencer_internal_state.current_track, 1);
     EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_ATTACK);
 }
+
+TEST_F(SequencerTest, TestMidiClockStartParksBeforeTheDownbeat) {
+    setUpMatrixScanSequencerTest();
+
+    sequencer_internal_state.current_step  = 5;
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+
+    sequencer_midi_clock_start();
+
+    // Wall-clock time no longer advances the pattern while slaved
+    advance_time(1000);
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, SEQUENCER_STEPS - 1);
+    EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_PAUSE);
+
+    // The first clock tick after a start message is the downbeat
+    sequencer_midi_clock_tick();
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+    EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_ATTACK);
+
+    // Resets the slaved state
+    sequencer_on();
+    sequencer_off();
+}
+
+TEST_F(SequencerTest, TestMidiClockSixTicksPerSixteenthStep) {
+    setUpMatrixScanSequencerTest();
+
+    // Clear the pattern so the attack/release phases advance without
+    // waiting on the throttle slots
+    sequencer_config.steps[0] = 0;
+    sequencer_config.steps[2] = 0;
+
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+
+    sequencer_midi_clock_start();
+    sequencer_midi_clock_tick();
+    for (int i = 0; i < 2 * SEQUENCER_TRACKS + 2; i++) {
+        sequencer_task();
+    }
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+
+    // A 16th step at 24ppqn lasts 6 clock ticks: 5 are not enough
+    for (int tick = 0; tick < 5; tick++) {
+        sequencer_midi_clock_tick();
+    }
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+
+    sequencer_midi_clock_tick();
+    for (int i = 0; i < 2 * SEQUENCER_TRACKS + 2; i++) {
+        sequencer_task();
+    }
+    EXPECT_EQ(sequencer_internal_state.current_step, 1);
+
+    sequencer_on();
+    sequencer_off();
+}
+
+TEST_F(SequencerTest, TestMidiClockStopFreezesThePattern) {
+    setUpMatrixScanSequencerTest();
+
+    sequencer_config.steps[0] = 0;
+    sequencer_config.steps[2] = 0;
+
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+
+    sequencer_midi_clock_start();
+    sequencer_midi_clock_tick();
+    for (int i = 0; i < 2 * SEQUENCER_TRACKS + 2; i++) {
+        sequencer_task();
+    }
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+
+    // Ticks are ignored while stopped, even if the host keeps sending them
+    sequencer_midi_clock_stop();
+    for (int tick = 0; tick < 12; tick++) {
+        sequencer_midi_clock_tick();
+    }
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 0);
+
+    // Continue resumes from where the pattern stopped
+    sequencer_midi_clock_continue();
+    for (int tick = 0; tick < 6; tick++) {
+        sequencer_midi_clock_tick();
+    }
+    for (int i = 0; i < 2 * SEQUENCER_TRACKS + 2; i++) {
+        sequencer_task();
+    }
+    EXPECT_EQ(sequencer_internal_state.current_step, 1);
+
+    sequencer_on();
+    sequencer_off();
+}
@@ -26,6 +26,7 @@ SOFTWARE.
 #include "serial_link/protocol/frame_validator.h"
 #include "serial_link/protocol/physical.h"
 #include <stdbool.h>
+#include <string.h>
 
 // This implements the "Consistent overhead byte stuffing protocol"
 // https://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
@@ -97,6 +98,41 @@ void byte_stuffer_recv_byte(uint8_t link, uint8_t data) {
     }
 }
 
+void byte_stuffer_recv_data(uint8_t link, const uint8_t* data, uint16_t size) {
+    byte_stuffer_state_t* state = &states[link];
+    const uint8_t*        end   = data + size;
+    while (data < end) {
+        // Between two stuffing codes there's a run of next_zero - 1 plain data
+        // bytes, which can be appended in one go instead of being fed through
+        // the state machine one byte at a time
+        if (state->next_zero > 1 && state->data_pos < MAX_FRAME_SIZE && *data != 0) {
+            uint16_t run = state->next_zero - 1;
+            if (run > end - data) {
+                run = end - data;
+            }
+            if (run > MAX_FRAME_SIZE - state->data_pos) {
+                run = MAX_FRAME_SIZE - state->data_pos;
+            }
+            // An unexpected zero terminates the run early, the byte itself is
+            // handled below as an invalid frame
+            const uint8_t* zero = memchr(data, 0, run);
+            if (zero) {
+                run = zero - data;
+            }
+            if (run > 0) {
+                memcpy(state->data + state->data_pos, data, run);
+                state->data_pos += run;
+                state->next_zero -= run;
+                data += run;
+                continue;
+            }
+        }
+        // Frame starts, stuffing codes, frame endings and overflows are rare,
+        // so they can take the slow path
+        byte_stuffer_recv_byte(link, *data++);
+    }
+}
+
 static void send_block(uint8_t link, uint8_t* start, uint8_t* end, uint8_t num_non_zero) {
     send_data(link, &num_non_zero, 1);
     if (end > start) {
@@ -42,7 +42,9 @@ typedef enum {
 typedef struct {
     remote_object_type object_type;
     uint16_t           object_size;
-    uint8_t            buffer[] __attribute__((aligned(4)));
+    // Zero-length rather than a flexible array member, as the helper structs
+    // below embed this one in front of their actual buffer storage
+    uint8_t            buffer[0] __attribute__((aligned(4)));
 } remote_object_t;
 
 #define REMOTE_OBJECT_SIZE(objectsize) (sizeof(triple_buffer_object_t) + objectsize * 3)
@@ -62,15 +62,10 @@ static SerialConfig config = {.sc_speed = SERIAL_LINK_BAUD};
 //#define DEBUG_LINK_ERRORS
 
 static uint32_t read_from_serial(SerialDriver* driver, uint8_t link) {
-    const uint32_t buffer_size = 16;
+    const uint32_t buffer_size = 64;
     uint8_t        buffer[buffer_size];
     uint32_t       bytes_read = sdAsynchronousRead(driver, buffer, buffer_size);
-    uint8_t*       current    = buffer;
-    uint8_t*       end        = current + bytes_read;
-    while (current < end) {
-        byte_stuffer_recv_byte(link, *current);
-        current++;
-    }
+    byte_stuffer_recv_data(link, buffer, bytes_read);
     return bytes_read;
 }
 
@@ -448,3 +448,74 @@ TEST_F(ByteStuffer, sends_and_receives_full_roundtrip_254_bytes_and_then_zero) {
         byte_stuffer_recv_byte(1, d);
     }
 }
+
+TEST_F(ByteStuffer, batch_receives_single_byte_valid_frame) {
+    uint8_t expected[] = {0x37};
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected)));
+    uint8_t stuffed[] = {2, 0x37, 0};
+    byte_stuffer_recv_data(0, stuffed, sizeof(stuffed));
+}
+
+TEST_F(ByteStuffer, batch_receives_valid_frame_with_zeroes) {
+    uint8_t expected[] = {5, 0, 3, 0};
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected)));
+    uint8_t stuffed[] = {2, 5, 2, 3, 1, 0};
+    byte_stuffer_recv_data(0, stuffed, sizeof(stuffed));
+}
+
+TEST_F(ByteStuffer, batch_receives_two_frames_in_one_buffer) {
+    uint8_t expected1[] = {5, 0};
+    uint8_t expected2[] = {3};
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected1)));
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected2)));
+    uint8_t stuffed[] = {2, 5, 1, 0, 2, 3, 0};
+    byte_stuffer_recv_data(1, stuffed, sizeof(stuffed));
+}
+
+TEST_F(ByteStuffer, batch_receives_valid_frame_after_unexpected_zero) {
+    uint8_t expected[] = {5, 7};
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected)));
+    uint8_t stuffed[] = {3, 1, 0, 3, 5, 7, 0};
+    byte_stuffer_recv_data(1, stuffed, sizeof(stuffed));
+}
+
+TEST_F(ByteStuffer, batch_and_byte_receive_can_be_interleaved) {
+    uint8_t expected[] = {5, 0, 3, 0};
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(expected)));
+    uint8_t stuffed[] = {2, 5, 2, 3, 1, 0};
+    byte_stuffer_recv_byte(0, stuffed[0]);
+    byte_stuffer_recv_data(0, stuffed + 1, 2);
+    byte_stuffer_recv_byte(0, stuffed[3]);
+    byte_stuffer_recv_data(0, stuffed + 4, 2);
+}
+
+TEST_F(ByteStuffer, batch_sends_and_receives_full_roundtrip_256_bytes) {
+    uint8_t original_data[256];
+    int     i;
+    for (i = 0; i < 254; i++) {
+        original_data[i] = i + 1;
+    }
+    original_data[254] = 22;
+    original_data[255] = 23;
+    byte_stuffer_send_frame(0, original_data, sizeof(original_data));
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).With(Args<1, 2>(ElementsAreArray(original_data)));
+    // Feed the stuffed stream in chunks, the way the physical layer drains
+    // its receive queue
+    size_t pos = 0;
+    while (pos < sent_data.size()) {
+        size_t chunk = std::min<size_t>(64, sent_data.size() - pos);
+        byte_stuffer_recv_data(1, sent_data.data() + pos, chunk);
+        pos += chunk;
+    }
+}
+
+TEST_F(ByteStuffer, batch_doesnt_recv_a_frame_thats_too_long) {
+    EXPECT_CALL(*this, validator_recv_frame(_, _, _)).Times(0);
+    std::vector<uint8_t> stuffed;
+    stuffed.push_back(1);
+    for (int i = 0; i < MAX_FRAME_SIZE + 1; i++) {
+        stuffed.push_back(1);
+    }
+    stuffed.push_back(0);
+    byte_stuffer_recv_data(0, stuffed.data(), stuffed.size());
+}
@@ -22,6 +22,7 @@
 #include "quantum.h"
 #include "wait.h"
 #include "usb_util.h"
+#include "perf_counter.h"
 
 #ifdef EE_HANDS
 #    include "eeconfig.h"
@@ -56,13 +57,38 @@ static uint8_t connection_errors = 0;
 
 volatile bool isLeftHand = true;
 
+#ifdef SPLIT_LINK_DETECT
+#    if !defined(SPLIT_USB_DETECT)
+#        error "SPLIT_LINK_DETECT only makes sense together with SPLIT_USB_DETECT"
+#    endif
+#    if defined(DISABLE_SYNC_TIMER)
+#        error "SPLIT_LINK_DETECT requires the split sync timer"
+#    endif
+
+// The transport writes into shared memory from interrupt context, so the
+// probe has to re-read the actual memory every time
+static inline uint32_t peek_sync_timer(void) { return *(volatile uint32_t *)&split_shmem->sync_timer; }
+#endif  // SPLIT_LINK_DETECT
+
 #if defined(SPLIT_USB_DETECT)
 static bool usbIsActive(void) {
+#    ifdef SPLIT_LINK_DETECT
+    uint32_t initial_sync_timer = peek_sync_timer();
+#    endif  // SPLIT_LINK_DETECT
     for (uint8_t i = 0; i < (SPLIT_USB_TIMEOUT / SPLIT_USB_TIMEOUT_POLL); i++) {
         // This will return true if a USB connection has been established
         if (usb_connected_state()) {
             return true;
         }
+#    ifdef SPLIT_LINK_DETECT
+        // A running master refreshes the synchronized timer at least every
+        // FORCED_SYNC_THROTTLE_MS; traffic on the link means the other half
+        // owns USB, so the slave role can be assumed right away instead of
+        // sitting out the rest of the USB timeout
+        if (peek_sync_timer() != initial_sync_timer) {
+            return false;
+        }
+#    endif  // SPLIT_LINK_DETECT
         wait_ms(SPLIT_USB_TIMEOUT_POLL);
     }
     return false;
@@ -130,6 +156,14 @@ __attribute__((weak)) bool is_keyboard_master(void) {
 
 // this code runs before the keyboard is fully initialized
 void split_pre_init(void) {
+#ifdef SPLIT_LINK_DETECT
+    // Bring the transport up in target mode before the role is decided, so
+    // that traffic from an already-running master can settle the role well
+    // before the USB timeout expires. If this half turns out to be the
+    // master, transport_master_init() below reconfigures the driver.
+    transport_slave_init();
+#endif  // SPLIT_LINK_DETECT
+
     isLeftHand = is_keyboard_left();
 
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLED_SPLIT)
@@ -153,9 +187,11 @@ void split_pre_init(void) {
 //   - avoids race condition during matrix_init_quantum where slave can start
 //     receiving before the init process has completed
 void split_post_init(void) {
+#ifndef SPLIT_LINK_DETECT
     if (!is_keyboard_master()) {
         transport_slave_init();
     }
+#endif  // SPLIT_LINK_DETECT
 }
 
 bool is_transport_connected(void) { return connection_errors < SPLIT_MAX_CONNECTION_ERRORS; }
@@ -171,7 +207,13 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
     }
 #endif  // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
 
+    PERF_COUNT(PERF_SPLIT_TRANSACTIONS);
+    PERF_TIMER_START(PERF_TIMER_TRANSPORT);
     __attribute__((unused)) bool okay = transport_master(master_matrix, slave_matrix);
+    PERF_TIMER_STOP(PERF_TIMER_TRANSPORT);
+    if (!okay) {
+        PERF_COUNT(PERF_SPLIT_ERRORS);
+    }
 #if SPLIT_MAX_CONNECTION_ERRORS > 0
     if (!okay) {
         if (connection_errors < UINT8_MAX) {
@@ -24,6 +24,14 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_MATRIX_DELTA
+    GET_SLAVE_MATRIX_DELTA,
+#endif  // SPLIT_MATRIX_DELTA
+
+#ifdef SPLIT_MATRIX_TIMESTAMP
+    GET_SLAVE_MATRIX_TIMESTAMP,
+#endif  // SPLIT_MATRIX_TIMESTAMP
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif  // SPLIT_TRANSPORT_MIRROR
@@ -33,6 +41,11 @@ enum serial_transaction_id {
     GET_ENCODERS_DATA,
 #endif  // ENCODER_ENABLE
 
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    GET_POINTING_PENDING,
+    GET_POINTING_DATA,
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
 #ifndef DISABLE_SYNC_TIMER
     PUT_SYNC_TIMER,
 #endif  // DISABLE_SYNC_TIMER
@@ -74,6 +87,11 @@ enum serial_transaction_id {
     PUT_OLED,
 #endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+    PUT_OLED_MIRROR_INFO,
+    PUT_OLED_MIRROR_DATA,
+#endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
     PUT_ST7565,
 #endif  // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
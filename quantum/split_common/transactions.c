@@ -26,6 +26,10 @@
 #include "split_util.h"
 #include "transaction_id_define.h"
 
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#    include "pointing_device.h"
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
 #define SYNC_TIMER_OFFSET 2
 
 #ifndef FORCED_SYNC_THROTTLE_MS
@@ -54,18 +58,68 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
+#ifndef SPLIT_TRANSACTION_RETRIES
+#    define SPLIT_TRANSACTION_RETRIES 10
+#endif  // SPLIT_TRANSACTION_RETRIES
+
+#ifdef SPLIT_LINK_STATS
+static split_link_stats_t link_stats;
+
+split_link_stats_t *split_link_stats(void) { return &link_stats; }
+
+#    define LINK_STATS_INC(field) link_stats.field++
+#else  // SPLIT_LINK_STATS
+#    define LINK_STATS_INC(field)
+#endif  // SPLIT_LINK_STATS
+
+#ifdef SPLIT_ADAPTIVE_RETRY
+// Additive increase/multiplicative decrease of the per-transaction retry
+// budget: halved while errors persist, so a bad link doesn't stall the scan
+// loop retrying, and recovered one attempt per successful transaction.
+static uint8_t adaptive_retry_budget = SPLIT_TRANSACTION_RETRIES;
+#endif  // SPLIT_ADAPTIVE_RETRY
+
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
+    int num_retries = is_transport_connected() ? SPLIT_TRANSACTION_RETRIES : 1;
+#ifdef SPLIT_ADAPTIVE_RETRY
+    if (num_retries > adaptive_retry_budget) {
+        num_retries = adaptive_retry_budget;
+    }
+#endif  // SPLIT_ADAPTIVE_RETRY
+#ifdef SPLIT_LINK_STATS
+    uint16_t rtt_start = timer_read();
+#endif  // SPLIT_LINK_STATS
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
+            LINK_STATS_INC(retries);
         }
         bool this_okay = true;
         ATOMIC_BLOCK_FORCEON { this_okay = handler(master_matrix, slave_matrix); };
-        if (this_okay) return true;
+        if (this_okay) {
+#ifdef SPLIT_LINK_STATS
+            link_stats.transactions++;
+            link_stats.last_rtt_ms = timer_elapsed(rtt_start);
+            if (link_stats.last_rtt_ms > link_stats.max_rtt_ms) {
+                link_stats.max_rtt_ms = link_stats.last_rtt_ms;
+            }
+#endif  // SPLIT_LINK_STATS
+#ifdef SPLIT_ADAPTIVE_RETRY
+            if (adaptive_retry_budget < SPLIT_TRANSACTION_RETRIES) {
+                adaptive_retry_budget++;
+            }
+#endif  // SPLIT_ADAPTIVE_RETRY
+            return true;
+        }
     }
+    LINK_STATS_INC(failures);
+#ifdef SPLIT_ADAPTIVE_RETRY
+    if (adaptive_retry_budget > 2) {
+        adaptive_retry_budget /= 2;
+    }
+#endif  // SPLIT_ADAPTIVE_RETRY
     dprintf("Failed to execute %s\n", prefix);
     return false;
 }
@@ -85,7 +139,10 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
+        if (okay && curr_checksum != crc8(equiv_shmem, length)) {
+            LINK_STATS_INC(checksum_mismatches);
+            okay = false;
+        }
         if (okay) {
             *last_update = timer_read32();
         }
@@ -114,32 +171,150 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_MATRIX_TIMESTAMP
+
+static uint16_t slave_matrix_timestamp;
+
+uint16_t split_slave_scan_timestamp(void) { return slave_matrix_timestamp; }
+
+// Pick up the slave's commit time whenever the received matrix actually
+// differs from the previous state, so key events from the other half can be
+// stamped with the time they were registered there.
+static bool slave_matrix_fetch_timestamp(const matrix_row_t last_matrix[], const matrix_row_t temp_matrix[]) {
+    if (memcmp(last_matrix, temp_matrix, sizeof(matrix_row_t) * ((MATRIX_ROWS) / 2)) == 0) {
+        return true;
+    }
+    return transport_read(GET_SLAVE_MATRIX_TIMESTAMP, &slave_matrix_timestamp, sizeof(slave_matrix_timestamp));
+}
+
+#endif  // SPLIT_MATRIX_TIMESTAMP
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};  // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];        // holding area while we test whether or not checksum is correct
 
+#ifdef SPLIT_MATRIX_DELTA
+    uint8_t curr_checksum;
+    bool    okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    if (okay && (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(last_matrix, sizeof(last_matrix)))) {
+        // Try to reproduce the slave's state from just the changed rows first
+        split_slave_matrix_delta_t delta;
+        bool                       applied = false;
+        okay &= transport_read(GET_SLAVE_MATRIX_DELTA, &delta, sizeof(delta));
+        if (okay && delta.rows != SPLIT_MATRIX_DELTA_OVERFLOW) {
+            memcpy(temp_matrix, last_matrix, sizeof(temp_matrix));
+            uint8_t value_index = 0;
+            for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+                if (delta.rows & (1 << row)) {
+                    temp_matrix[row] = delta.values[value_index++];
+                }
+            }
+            applied = curr_checksum == crc8(temp_matrix, sizeof(temp_matrix));
+        }
+        // Fall back to mirroring the full matrix whenever the delta frame
+        // overflowed or did not match the checksum (e.g. after a reconnect)
+        if (okay && !applied) {
+            okay &= transport_read(GET_SLAVE_MATRIX_DATA, temp_matrix, sizeof(temp_matrix));
+            if (okay && curr_checksum != crc8(temp_matrix, sizeof(temp_matrix))) {
+                LINK_STATS_INC(checksum_mismatches);
+                okay = false;
+            }
+        }
+        if (okay) {
+            last_update = timer_read32();
+#    ifdef SPLIT_MATRIX_TIMESTAMP
+            okay &= slave_matrix_fetch_timestamp(last_matrix, temp_matrix);
+#    endif  // SPLIT_MATRIX_TIMESTAMP
+            // Checksum matches the reconstructed data, save as the last matrix state
+            memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        }
+    }
+#else   // SPLIT_MATRIX_DELTA
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
+#    ifdef SPLIT_MATRIX_TIMESTAMP
+        okay &= slave_matrix_fetch_timestamp(last_matrix, temp_matrix);
+#    endif  // SPLIT_MATRIX_TIMESTAMP
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
     }
+#endif  // SPLIT_MATRIX_DELTA
     // Copy out the last-known-good matrix state to the slave matrix
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_MATRIX_TIMESTAMP
+    // Latch the commit time in the synchronized timer domain, before the
+    // master gets a chance to pick the change up.
+    if (memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) != 0) {
+        split_shmem->smatrix.timestamp = sync_timer_read();
+    }
+#endif  // SPLIT_MATRIX_TIMESTAMP
+#ifdef SPLIT_MATRIX_DELTA
+    uint8_t pending = split_shmem->smatrix.delta_pending;
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        if (split_shmem->smatrix.matrix[row] != slave_matrix[row]) {
+            pending |= 1 << row;
+        }
+    }
+    split_shmem->smatrix.delta_pending = pending;
+#endif  // SPLIT_MATRIX_DELTA
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef SPLIT_MATRIX_DELTA
+    // Pack the frame the master picks up when the checksum signals a change
+    split_slave_matrix_delta_t *delta       = &split_shmem->smatrix.delta;
+    uint8_t                     value_index = 0;
+    delta->rows                             = pending;
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        if (pending & (1 << row)) {
+            if (value_index == SPLIT_MATRIX_DELTA_ROWS) {
+                delta->rows = SPLIT_MATRIX_DELTA_OVERFLOW;
+                break;
+            }
+            delta->values[value_index++] = slave_matrix[row];
+        }
+    }
+#endif  // SPLIT_MATRIX_DELTA
+}
+
+#ifdef SPLIT_MATRIX_DELTA
+
+static void slave_matrix_delta_read_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // The rows handed to the master are no longer pending; an overflowed
+    // frame carries no rows, the full read that follows it clears instead.
+    if (split_shmem->smatrix.delta.rows != SPLIT_MATRIX_DELTA_OVERFLOW) {
+        split_shmem->smatrix.delta_pending &= ~split_shmem->smatrix.delta.rows;
+    }
 }
 
+static void slave_matrix_full_read_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) { split_shmem->smatrix.delta_pending = 0; }
+
+#endif  // SPLIT_MATRIX_DELTA
+
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#ifdef SPLIT_MATRIX_TIMESTAMP
+#define TRANSACTIONS_SLAVE_MATRIX_TIMESTAMP_REGISTRATIONS [GET_SLAVE_MATRIX_TIMESTAMP] = trans_target2initiator_initializer(smatrix.timestamp),
+#else
+#define TRANSACTIONS_SLAVE_MATRIX_TIMESTAMP_REGISTRATIONS
+#endif
+#ifdef SPLIT_MATRIX_DELTA
+#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer_cb(smatrix.matrix, slave_matrix_full_read_callback), \
+    [GET_SLAVE_MATRIX_DELTA]    = trans_target2initiator_initializer_cb(smatrix.delta, slave_matrix_delta_read_callback), \
+    TRANSACTIONS_SLAVE_MATRIX_TIMESTAMP_REGISTRATIONS
+#else
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    TRANSACTIONS_SLAVE_MATRIX_TIMESTAMP_REGISTRATIONS
+#endif
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -208,6 +383,84 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 
 #endif  // ENCODER_ENABLE
 
+////////////////////////////////////////////////////
+// Pointing device
+
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+// Deltas reported on the slave since the master last picked them up
+static report_mouse_t pointing_accumulator;
+
+static int8_t add_mouse_axis(int8_t current, int8_t delta) {
+    int16_t sum = (int16_t)current + delta;
+    if (sum > INT8_MAX) return INT8_MAX;
+    if (sum < INT8_MIN) return INT8_MIN;
+    return (int8_t)sum;
+}
+
+void split_pointing_accumulate(report_mouse_t report) {
+    // The latch callback below runs from the transport's interrupt context,
+    // so accumulation has to be atomic against it
+    ATOMIC_BLOCK_FORCEON {
+        pointing_accumulator.x       = add_mouse_axis(pointing_accumulator.x, report.x);
+        pointing_accumulator.y       = add_mouse_axis(pointing_accumulator.y, report.y);
+        pointing_accumulator.v       = add_mouse_axis(pointing_accumulator.v, report.v);
+        pointing_accumulator.h       = add_mouse_axis(pointing_accumulator.h, report.h);
+        pointing_accumulator.buttons = report.buttons;
+        split_shmem->pointing.pending = true;
+    };
+}
+
+// Runs on the slave just before the report buffer is handed to the master:
+// latch the accumulated deltas into the served buffer and consume them, so
+// each delta crosses the link exactly once
+static void pointing_read_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_shmem->pointing.report  = pointing_accumulator;
+    pointing_accumulator.x        = 0;
+    pointing_accumulator.y        = 0;
+    pointing_accumulator.v        = 0;
+    pointing_accumulator.h        = 0;
+    split_shmem->pointing.pending = false;
+}
+
+static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t pending;
+    bool    okay = transport_read(GET_POINTING_PENDING, &pending, sizeof(pending));
+    if (okay && pending) {
+        report_mouse_t slave_report;
+        okay &= transport_read(GET_POINTING_DATA, &slave_report, sizeof(slave_report));
+        if (okay) {
+            // Merge the slave's deltas into the master's report; slave button
+            // state replaces whatever it contributed last time, so releases
+            // propagate without clobbering master-side buttons
+            static uint8_t last_slave_buttons = 0;
+            report_mouse_t report             = pointing_device_get_report();
+            report.x                          = add_mouse_axis(report.x, slave_report.x);
+            report.y                          = add_mouse_axis(report.y, slave_report.y);
+            report.v                          = add_mouse_axis(report.v, slave_report.v);
+            report.h                          = add_mouse_axis(report.h, slave_report.h);
+            report.buttons                    = (report.buttons & ~last_slave_buttons) | slave_report.buttons;
+            last_slave_buttons                = slave_report.buttons;
+            pointing_device_set_report(report);
+        }
+    }
+    return okay;
+}
+
+// clang-format off
+#    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
+#    define TRANSACTIONS_POINTING_REGISTRATIONS \
+    [GET_POINTING_PENDING] = trans_target2initiator_initializer(pointing.pending), \
+    [GET_POINTING_DATA]    = trans_target2initiator_initializer_cb(pointing.report, pointing_read_callback),
+// clang-format on
+
+#else  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+#    define TRANSACTIONS_POINTING_MASTER()
+#    define TRANSACTIONS_POINTING_REGISTRATIONS
+
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
 ////////////////////////////////////////////////////
 // Sync timer
 
@@ -547,6 +800,97 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 
 #endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+////////////////////////////////////////////////////
+// OLED mirror
+
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
+// Encode src as (run, value) pairs; returns 0 when the encoding would not
+// beat sending the block raw, so the caller falls back to an uncompressed
+// transfer. OLED content is dominated by long runs (blank areas, filled
+// bars), which collapse to a couple of bytes each.
+static uint8_t oled_mirror_rle_encode(const uint8_t *src, uint8_t src_length, uint8_t *dst) {
+    uint8_t out = 0;
+    uint8_t in  = 0;
+    while (in < src_length) {
+        uint8_t value = src[in];
+        uint8_t run   = 1;
+        while (in + run < src_length && src[in + run] == value && run < UINT8_MAX) {
+            run++;
+        }
+        if (out + 2 >= src_length) {
+            return 0;
+        }
+        dst[out++] = run;
+        dst[out++] = value;
+        in += run;
+    }
+    return out;
+}
+
+static bool oled_mirror_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t next_block = 0;
+
+    if (!oled_mirror_dirty) {
+        return true;
+    }
+    // One block per pass, round-robin, so a full-frame redraw is spread
+    // across scan cycles instead of monopolizing the link
+    while (!(oled_mirror_dirty & ((OLED_BLOCK_TYPE)1 << next_block))) {
+        next_block = (next_block + 1) % OLED_BLOCK_COUNT;
+    }
+
+    oled_buffer_reader_t     reader = oled_read_raw(next_block * OLED_BLOCK_SIZE);
+    uint8_t                  payload[OLED_BLOCK_SIZE];
+    split_oled_mirror_sync_t info;
+    info.block  = next_block;
+    info.length = oled_mirror_rle_encode(reader.current_element, OLED_BLOCK_SIZE, payload);
+
+    uint8_t send_length = info.length;
+    if (send_length == 0) {
+        memcpy(payload, reader.current_element, OLED_BLOCK_SIZE);
+        send_length = OLED_BLOCK_SIZE;
+    }
+
+    bool okay = transport_write(PUT_OLED_MIRROR_INFO, &info, sizeof(info));
+    if (okay) {
+        // Same sequence as the RPC path: the info transaction has told the
+        // slave how many payload bytes follow, shrink the local side to match
+        split_transaction_table[PUT_OLED_MIRROR_DATA].initiator2target_buffer_size = send_length;
+        okay &= transport_write(PUT_OLED_MIRROR_DATA, payload, send_length);
+    }
+    if (okay) {
+        oled_mirror_dirty &= ~((OLED_BLOCK_TYPE)1 << next_block);
+        next_block = (next_block + 1) % OLED_BLOCK_COUNT;
+    }
+    return okay;
+}
+
+static void oled_mirror_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t length                                                             = split_shmem->oled_mirror_info.length;
+    split_transaction_table[PUT_OLED_MIRROR_DATA].initiator2target_buffer_size = (length == 0) ? OLED_BLOCK_SIZE : length;
+}
+
+static void oled_mirror_data_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // Decode into the local oled_buffer; the next render pass pushes it to
+    // the panel through the normal dirty-block machinery
+    oled_mirror_write_block(split_shmem->oled_mirror_info.block, split_shmem->oled_mirror_data, split_shmem->oled_mirror_info.length);
+}
+
+// clang-format off
+#    define TRANSACTIONS_OLED_MIRROR_MASTER() TRANSACTION_HANDLER_MASTER(oled_mirror)
+#    define TRANSACTIONS_OLED_MIRROR_REGISTRATIONS \
+    [PUT_OLED_MIRROR_INFO] = trans_initiator2target_initializer_cb(oled_mirror_info, oled_mirror_info_callback), \
+    [PUT_OLED_MIRROR_DATA] = trans_initiator2target_initializer_cb(oled_mirror_data, oled_mirror_data_callback),
+// clang-format on
+
+#else  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
+#    define TRANSACTIONS_OLED_MIRROR_MASTER()
+#    define TRANSACTIONS_OLED_MIRROR_REGISTRATIONS
+
+#endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
 ////////////////////////////////////////////////////
 // ST7565
 
@@ -578,6 +922,73 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #endif  // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
+////////////////////////////////////////////////////
+// Sync scheduling
+
+#ifdef SPLIT_SYNC_SCHEDULE
+
+#    ifndef SPLIT_SYNC_BUDGET
+#        define SPLIT_SYNC_BUDGET 2
+#    endif  // SPLIT_SYNC_BUDGET
+
+typedef bool (*split_sync_handler_t)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+typedef struct _split_sync_entry_t {
+    const char *         name;
+    split_sync_handler_t handler;
+} split_sync_entry_t;
+
+// Lower-priority syncs, serviced round-robin across scan cycles on a
+// per-cycle budget. Input state (slave matrix, encoders) is not listed here;
+// it is always serviced first, so a slow display or lighting sync can no
+// longer delay matrix retrieval.
+static const split_sync_entry_t split_sync_schedule[] = {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    {"master_matrix", master_matrix_handlers_master},
+#    endif  // SPLIT_TRANSPORT_MIRROR
+#    ifndef DISABLE_SYNC_TIMER
+    {"sync_timer", sync_timer_handlers_master},
+#    endif  // DISABLE_SYNC_TIMER
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    {"layer_state", layer_state_handlers_master},
+#    endif  // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_LED_STATE_ENABLE
+    {"led_state", led_state_handlers_master},
+#    endif  // SPLIT_LED_STATE_ENABLE
+#    ifdef SPLIT_MODS_ENABLE
+    {"mods", mods_handlers_master},
+#    endif  // SPLIT_MODS_ENABLE
+#    ifdef BACKLIGHT_ENABLE
+    {"backlight", backlight_handlers_master},
+#    endif  // BACKLIGHT_ENABLE
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    {"rgblight", rgblight_handlers_master},
+#    endif  // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+    {"led_matrix", led_matrix_handlers_master},
+#    endif  // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+    {"rgb_matrix", rgb_matrix_handlers_master},
+#    endif  // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    {"wpm", wpm_handlers_master},
+#    endif  // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+    {"oled", oled_handlers_master},
+#    endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+    {"oled_mirror", oled_mirror_handlers_master},
+#    endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    {"st7565", st7565_handlers_master},
+#    endif  // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    {NULL, NULL},  // terminator, so the schedule is never an empty array
+};
+
+static const uint8_t split_sync_schedule_length = (sizeof(split_sync_schedule) / sizeof(split_sync_schedule[0])) - 1;
+
+#endif  // SPLIT_SYNC_SCHEDULE
+
 ////////////////////////////////////////////////////
 
 uint8_t                  dummy;
@@ -593,6 +1004,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
+    TRANSACTIONS_POINTING_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
     TRANSACTIONS_LAYER_STATE_REGISTRATIONS
     TRANSACTIONS_LED_STATE_REGISTRATIONS
@@ -603,6 +1015,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
+    TRANSACTIONS_OLED_MIRROR_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
 // clang-format on
 
@@ -615,9 +1028,28 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_SYNC_SCHEDULE
+    static uint8_t next_sync = 0;
+
+    // Input state always goes first, unconditionally
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
+
+    // Service the remaining syncs round-robin, at most SPLIT_SYNC_BUDGET of
+    // them per cycle
+    for (uint8_t budget = 0; budget < (SPLIT_SYNC_BUDGET) && budget < split_sync_schedule_length; budget++) {
+        const split_sync_entry_t *entry = &split_sync_schedule[next_sync];
+        if (++next_sync >= split_sync_schedule_length) {
+            next_sync = 0;
+        }
+        if (!transaction_handler_master(master_matrix, slave_matrix, entry->name, entry->handler)) return false;
+    }
+#else   // SPLIT_SYNC_SCHEDULE
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -628,7 +1060,9 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_RGB_MATRIX_MASTER();
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
+    TRANSACTIONS_OLED_MIRROR_MASTER();
     TRANSACTIONS_ST7565_MASTER();
+#endif  // SPLIT_SYNC_SCHEDULE
     return true;
 }
 
@@ -46,6 +46,31 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+#ifdef SPLIT_MATRIX_TIMESTAMP
+// Sync-timer time at which the slave half last committed a debounced change
+uint16_t split_slave_scan_timestamp(void);
+#endif  // SPLIT_MATRIX_TIMESTAMP
+
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#    include "report.h"
+// Called on the slave side to queue pointing deltas for the master's next fetch
+void split_pointing_accumulate(report_mouse_t report);
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+#ifdef SPLIT_LINK_STATS
+// Link quality counters, maintained on the master side
+typedef struct _split_link_stats_t {
+    uint32_t transactions;         // master-side transactions that completed successfully
+    uint32_t retries;              // extra attempts needed before a transaction went through
+    uint32_t failures;             // transactions dropped after exhausting all retries
+    uint32_t checksum_mismatches;  // slave data reads whose checksum did not match
+    uint16_t last_rtt_ms;          // duration of the most recent successful transaction
+    uint16_t max_rtt_ms;           // worst transaction duration seen since boot
+} split_link_stats_t;
+
+split_link_stats_t *split_link_stats(void);
+#endif  // SPLIT_LINK_STATS
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -53,9 +53,38 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif  // RGBLIGHT_ENABLE
 
+#ifdef SPLIT_MATRIX_DELTA
+#    ifndef SPLIT_MATRIX_DELTA_ROWS
+#        define SPLIT_MATRIX_DELTA_ROWS 2
+#    endif  // SPLIT_MATRIX_DELTA_ROWS
+
+// Sentinel row bitmap signalling that more rows changed than fit in the
+// delta frame, and the master has to fall back to a full matrix read.
+#    define SPLIT_MATRIX_DELTA_OVERFLOW 0xFF
+
+// Ensure the changed-row bitmap can address every row of one half
+_Static_assert((MATRIX_ROWS) / 2 <= 8, "SPLIT_MATRIX_DELTA supports at most 8 rows per half");
+
+typedef struct _split_slave_matrix_delta_t {
+    uint8_t      rows;  // bitmap of the rows carried in this frame
+    matrix_row_t values[SPLIT_MATRIX_DELTA_ROWS];
+} split_slave_matrix_delta_t;
+#endif  // SPLIT_MATRIX_DELTA
+
+#if defined(SPLIT_MATRIX_TIMESTAMP) && defined(DISABLE_SYNC_TIMER)
+#    error "SPLIT_MATRIX_TIMESTAMP requires the split sync timer"
+#endif
+
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#ifdef SPLIT_MATRIX_DELTA
+    split_slave_matrix_delta_t delta;
+    uint8_t                    delta_pending;  // rows changed since the last acknowledged read, slave-side only
+#endif  // SPLIT_MATRIX_DELTA
+#ifdef SPLIT_MATRIX_TIMESTAMP
+    uint16_t timestamp;  // sync-timer time of the last committed change
+#endif  // SPLIT_MATRIX_TIMESTAMP
 } split_slave_matrix_sync_t;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -71,6 +100,14 @@ typedef struct _split_slave_encoder_sync_t {
 } split_slave_encoder_sync_t;
 #endif  // ENCODER_ENABLE
 
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#    include "report.h"
+typedef struct _split_slave_pointing_sync_t {
+    uint8_t        pending;  // set when the slave has unreported motion or button changes
+    report_mouse_t report;
+} split_slave_pointing_sync_t;
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 typedef struct _split_layers_sync_t {
     layer_state_t layer_state;
@@ -106,6 +143,15 @@ typedef struct _split_mods_sync_t {
 } split_mods_sync_t;
 #endif  // SPLIT_MODS_ENABLE
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+#    include "oled_driver.h"
+
+typedef struct _split_oled_mirror_sync_t {
+    uint8_t block;   // oled_buffer block index carried by the data transaction
+    uint8_t length;  // RLE payload length, 0 = raw uncompressed block
+} split_oled_mirror_sync_t;
+#endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 typedef struct _rpc_sync_info_t {
     int8_t  transaction_id;
@@ -129,6 +175,10 @@ typedef struct _split_shared_memory_t {
     split_slave_encoder_sync_t encoders;
 #endif  // ENCODER_ENABLE
 
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    split_slave_pointing_sync_t pointing;
+#endif  // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
 #ifndef DISABLE_SYNC_TIMER
     uint32_t sync_timer;
 #endif  // DISABLE_SYNC_TIMER
@@ -169,6 +219,11 @@ typedef struct _split_shared_memory_t {
     uint8_t current_oled_state;
 #endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+    split_oled_mirror_sync_t oled_mirror_info;
+    uint8_t                  oled_mirror_data[OLED_BLOCK_SIZE];
+#endif  // defined(OLED_ENABLE) && defined(SPLIT_OLED_MIRROR)
+
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
     uint8_t current_st7565_state;
 #endif  // ST7565_ENABLE(OLED_ENABLE) && defined(SPLIT_ST7565_ENABLE)
@@ -0,0 +1,99 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Tap-hold decision recorder (TAPPING_TRACE_ENABLE = yes)
+ *
+ * Every time a dual-role key settles as a tap or a hold, the keycode,
+ * the press-to-settlement interval, the settling rule and the waiting
+ * buffer occupancy are appended to a small RAM ring, retrievable over
+ * raw HID. Mining a few minutes of real typing answers the questions
+ * TAPPING_TERM / PERMISSIVE_HOLD tuning otherwise guesses at: how close
+ * each key's taps come to the term, and which rule actually settles the
+ * holds.
+ */
+
+#include <string.h>
+
+#include "tapping_trace.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static tapping_trace_entry_t trace_ring[TAPPING_TRACE_RING_SIZE];
+/* next slot to write; wraps, overwriting the oldest entry */
+static uint8_t trace_head;
+/* number of valid entries, saturates at TAPPING_TRACE_RING_SIZE */
+static uint8_t trace_count;
+
+void tapping_trace_record(uint16_t keycode, uint8_t outcome, uint16_t duration, uint8_t buffered) {
+    tapping_trace_entry_t *entry = &trace_ring[trace_head];
+    entry->keycode               = keycode;
+    entry->duration              = duration;
+    entry->outcome               = outcome;
+    entry->buffered              = buffered;
+
+    trace_head = (trace_head + 1) % TAPPING_TRACE_RING_SIZE;
+    if (trace_count < TAPPING_TRACE_RING_SIZE) {
+        trace_count++;
+    }
+}
+
+/* index 0 is the oldest recorded entry */
+const tapping_trace_entry_t *tapping_trace_entry(uint8_t index) {
+    if (index >= trace_count) return NULL;
+    uint8_t oldest = (trace_head + TAPPING_TRACE_RING_SIZE - trace_count) % TAPPING_TRACE_RING_SIZE;
+    return &trace_ring[(oldest + index) % TAPPING_TRACE_RING_SIZE];
+}
+
+uint8_t tapping_trace_count(void) { return trace_count; }
+
+#ifdef RAW_ENABLE
+bool tapping_trace_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != TAPPING_TRACE_HID_ID) return false;
+
+    switch (data[1]) {
+        case id_tapping_trace_get: {
+            /* [id, get, start] -> total count in data[3], then as many
+             * 6-byte entries from `start` as fit in the packet */
+            uint8_t  start = data[2];
+            uint8_t *p     = &data[4];
+            if (length >= 4) {
+                data[3] = trace_count;
+                while (start < trace_count && (uint8_t)(p - data) + 6 <= length) {
+                    const tapping_trace_entry_t *entry = tapping_trace_entry(start);
+                    *p++                               = (uint8_t)(entry->keycode & 0xFF);
+                    *p++                               = (uint8_t)(entry->keycode >> 8);
+                    *p++                               = (uint8_t)(entry->duration & 0xFF);
+                    *p++                               = (uint8_t)(entry->duration >> 8);
+                    *p++                               = entry->outcome;
+                    *p++                               = entry->buffered;
+                    start++;
+                }
+            }
+            break;
+        }
+        case id_tapping_trace_reset:
+            memset(trace_ring, 0, sizeof(trace_ring));
+            trace_head  = 0;
+            trace_count = 0;
+            break;
+    }
+
+    /* echo the (possibly filled-in) packet back as the reply */
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
@@ -0,0 +1,65 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Number of decisions kept in the RAM ring; older entries are overwritten.
+ * Each entry is 6 bytes. */
+#ifndef TAPPING_TRACE_RING_SIZE
+#    define TAPPING_TRACE_RING_SIZE 32
+#endif
+
+/* How a dual-role key was settled. */
+enum tapping_trace_outcome {
+    TAPPING_TRACE_TAP = 0,         /* released within the tapping term */
+    TAPPING_TRACE_HOLD_TIMEOUT,    /* tapping term expired while held */
+    TAPPING_TRACE_HOLD_PERMISSIVE, /* another key was typed (press + release) inside the term */
+    TAPPING_TRACE_HOLD_INTERRUPT,  /* another key was pressed inside the term (hold on other key press) */
+};
+
+/* One settled decision. `duration` is the time in ms from the dual-role
+ * key's press to the event that settled it; `buffered` is the waiting
+ * buffer occupancy at that moment. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t duration;
+    uint8_t  outcome;
+    uint8_t  buffered;
+} tapping_trace_entry_t;
+
+/* First byte of a raw HID packet addressed to the tracer. Chosen high to
+ * stay clear of VIA's command range (0xE7 is the latency tracer). */
+#define TAPPING_TRACE_HID_ID 0xE6
+
+enum tapping_trace_hid_command {
+    id_tapping_trace_get   = 0x01, /* [id, get, start] -> [id, get, start, total, entries...] */
+    id_tapping_trace_reset = 0x02, /* clear the ring */
+};
+
+/* instrumentation hook, called from action_tapping.c when a key settles */
+void tapping_trace_record(uint16_t keycode, uint8_t outcome, uint16_t duration, uint8_t buffered);
+
+/* direct access for on-device consumers; returns NULL past the end */
+const tapping_trace_entry_t *tapping_trace_entry(uint8_t index);
+uint8_t                      tapping_trace_count(void);
+
+#ifdef RAW_ENABLE
+/* Call from raw_hid_receive_kb(); returns true if the packet was consumed. */
+bool tapping_trace_hid_receive(uint8_t *data, uint8_t length);
+#endif
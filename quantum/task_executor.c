@@ -0,0 +1,104 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "task_executor.h"
+#include "keyboard.h"
+#include "timer.h"
+#include "debug.h"
+
+typedef struct {
+    task_executor_fn_t fn;
+    uint16_t           interval_ms;
+    uint16_t           budget_us;
+    uint16_t           last_run;
+    uint32_t           last_runtime_us;
+    uint32_t           runs;
+    uint8_t            priority;
+    uint8_t            throttle_shift;
+} executor_task_t;
+
+static executor_task_t tasks[TASK_EXECUTOR_MAX_TASKS];
+/* slot indices sorted by priority; ids handed out stay stable */
+static uint8_t run_order[TASK_EXECUTOR_MAX_TASKS];
+static uint8_t task_count = 0;
+
+int8_t task_executor_register(task_executor_fn_t fn, uint16_t interval_ms, uint8_t priority, uint16_t budget_us) {
+    if (!fn || task_count >= TASK_EXECUTOR_MAX_TASKS) {
+        return -1;
+    }
+    uint8_t          id = task_count++;
+    executor_task_t *t  = &tasks[id];
+    t->fn               = fn;
+    t->interval_ms      = interval_ms;
+    t->budget_us        = budget_us;
+    t->priority         = priority;
+    t->last_run         = timer_read();
+
+    /* insert into the run order, keeping equal priorities in
+     * registration order */
+    uint8_t pos = id;
+    while (pos > 0 && tasks[run_order[pos - 1]].priority > priority) {
+        run_order[pos] = run_order[pos - 1];
+        pos--;
+    }
+    run_order[pos] = id;
+    return (int8_t)id;
+}
+
+static inline uint16_t effective_interval(const executor_task_t *t) {
+    if (!t->throttle_shift) {
+        return t->interval_ms;
+    }
+    /* a throttled every-pass task backs off as if its interval were 1ms */
+    uint16_t base = t->interval_ms ? t->interval_ms : 1;
+    return base << t->throttle_shift;
+}
+
+void task_executor_run(void) {
+    uint16_t now = timer_read();
+    for (uint8_t i = 0; i < task_count; i++) {
+        executor_task_t *t = &tasks[run_order[i]];
+        if (TIMER_DIFF_16(now, t->last_run) < effective_interval(t)) {
+            continue;
+        }
+        t->last_run = now;
+
+        uint32_t start = scan_profile_timer_read_us();
+        t->fn();
+        uint32_t duration = scan_profile_timer_read_us() - start;
+
+        t->last_runtime_us = duration;
+        t->runs++;
+        if (t->budget_us && duration > t->budget_us) {
+            if (t->throttle_shift < TASK_EXECUTOR_THROTTLE_MAX_SHIFT) {
+                t->throttle_shift++;
+                dprintf("task_executor: task %u over budget (%luus), throttled x%u\n", run_order[i], duration, 1 << t->throttle_shift);
+            }
+        } else if (t->throttle_shift) {
+            t->throttle_shift--;
+        }
+    }
+}
+
+bool task_executor_get_stats(int8_t id, task_executor_stats_t *stats) {
+    if (id < 0 || id >= task_count) {
+        return false;
+    }
+    stats->runs            = tasks[id].runs;
+    stats->last_runtime_us = tasks[id].last_runtime_us;
+    stats->throttle_shift  = tasks[id].throttle_shift;
+    return true;
+}
@@ -0,0 +1,60 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Cooperative task executor (TASK_EXECUTOR_ENABLE = yes)
+ *
+ * Subsystems register a task with a minimum interval, a priority and a
+ * runtime budget; task_executor_run() then runs only the tasks that are
+ * due on a given scan pass, highest priority first. Each run is timed,
+ * and a task that blows its budget has its effective interval doubled
+ * (up to interval << TASK_EXECUTOR_THROTTLE_MAX_SHIFT), backing off
+ * again one step per in-budget run. This keeps a slow cosmetic task
+ * from stealing scan passes from the matrix at a high target scan rate.
+ */
+
+#ifndef TASK_EXECUTOR_MAX_TASKS
+#    define TASK_EXECUTOR_MAX_TASKS 8
+#endif
+
+/* largest throttle factor applied to an over-budget task: 1 << 4 = 16x */
+#ifndef TASK_EXECUTOR_THROTTLE_MAX_SHIFT
+#    define TASK_EXECUTOR_THROTTLE_MAX_SHIFT 4
+#endif
+
+typedef void (*task_executor_fn_t)(void);
+
+typedef struct {
+    uint32_t runs;            /* times the task has actually run */
+    uint32_t last_runtime_us; /* duration of the most recent run */
+    uint8_t  throttle_shift;  /* current backoff: interval is scaled by 1 << shift */
+} task_executor_stats_t;
+
+/* Register a task. interval_ms 0 means "every pass". Lower priority
+ * values run first. budget_us 0 disables throttling for the task.
+ * Returns a task id for task_executor_get_stats(), or -1 if the table
+ * is full. */
+int8_t task_executor_register(task_executor_fn_t fn, uint16_t interval_ms, uint8_t priority, uint16_t budget_us);
+
+/* Run every registered task that is due, in priority order. */
+void task_executor_run(void);
+
+/* Per-task runtime statistics; returns false for an invalid id. */
+bool task_executor_get_stats(int8_t id, task_executor_stats_t *stats);
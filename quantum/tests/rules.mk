@@ -0,0 +1,4 @@
+triple_buffer_DEFS := -DIGNORE_ATOMIC_BLOCK
+
+triple_buffer_SRC := \
+	$(QUANTUM_PATH)/tests/triple_buffer_tests.cpp
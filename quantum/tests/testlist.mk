@@ -0,0 +1 @@
+TEST_LIST += triple_buffer
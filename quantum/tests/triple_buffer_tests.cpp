@@ -0,0 +1,94 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+extern "C" {
+#include "triple_buffer.h"
+}
+
+struct test_object {
+    uint32_t value;
+};
+
+class TripleBuffer : public ::testing::Test {
+   public:
+    TripleBuffer() { tbuf_init(&buffer); }
+
+    TRIPLE_BUFFER_T(test_object) buffer;
+};
+
+TEST_F(TripleBuffer, read_returns_null_when_nothing_was_written) { EXPECT_EQ(tbuf_read(&buffer), nullptr); }
+
+TEST_F(TripleBuffer, reads_the_written_value) {
+    test_object obj = {42};
+    tbuf_write(&buffer, obj);
+    test_object* read = tbuf_read(&buffer);
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->value, 42u);
+}
+
+TEST_F(TripleBuffer, second_read_returns_null) {
+    test_object obj = {42};
+    tbuf_write(&buffer, obj);
+    EXPECT_NE(tbuf_read(&buffer), nullptr);
+    EXPECT_EQ(tbuf_read(&buffer), nullptr);
+}
+
+TEST_F(TripleBuffer, reads_the_latest_of_several_writes) {
+    test_object obj = {1};
+    tbuf_write(&buffer, obj);
+    obj.value = 2;
+    tbuf_write(&buffer, obj);
+    obj.value = 3;
+    tbuf_write(&buffer, obj);
+    test_object* read = tbuf_read(&buffer);
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->value, 3u);
+    EXPECT_EQ(tbuf_read(&buffer), nullptr);
+}
+
+TEST_F(TripleBuffer, writing_does_not_disturb_an_outstanding_read) {
+    test_object obj = {7};
+    tbuf_write(&buffer, obj);
+    test_object* read = tbuf_read(&buffer);
+    ASSERT_NE(read, nullptr);
+    for (uint32_t i = 0; i < 16; i++) {
+        obj.value = i;
+        tbuf_write(&buffer, obj);
+        EXPECT_EQ(read->value, 7u);
+    }
+    test_object* next = tbuf_read(&buffer);
+    ASSERT_NE(next, nullptr);
+    EXPECT_EQ(next->value, 15u);
+}
+
+TEST_F(TripleBuffer, alternating_writes_and_reads) {
+    test_object obj = {0};
+    for (uint32_t i = 0; i < 16; i++) {
+        obj.value = i;
+        tbuf_write(&buffer, obj);
+        test_object* read = tbuf_read(&buffer);
+        ASSERT_NE(read, nullptr);
+        EXPECT_EQ(read->value, i);
+    }
+}
+
+TEST_F(TripleBuffer, begin_write_can_be_abandoned) {
+    test_object* slot = tbuf_begin_write(&buffer);
+    slot->value       = 99;
+    // No tbuf_end_write, so nothing is published
+    EXPECT_EQ(tbuf_read(&buffer), nullptr);
+}
@@ -0,0 +1,92 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timeout_wheel.h"
+#include "timer.h"
+
+static timeout_wheel_timer_t *slots[TIMEOUT_WHEEL_SLOTS];
+static uint8_t                slot_count = 0;
+
+// earliest armed deadline, maintained on arm/cancel so the task does one compare
+static bool     wheel_armed    = false;
+static uint16_t wheel_deadline = 0;
+
+static void wheel_track(timeout_wheel_timer_t *timer) {
+    for (uint8_t i = 0; i < slot_count; i++) {
+        if (slots[i] == timer) {
+            return;
+        }
+    }
+    if (slot_count < TIMEOUT_WHEEL_SLOTS) {
+        slots[slot_count++] = timer;
+    }
+}
+
+static void wheel_recompute(void) {
+    wheel_armed = false;
+    for (uint8_t i = 0; i < slot_count; i++) {
+        timeout_wheel_timer_t *timer = slots[i];
+        if (!timer->armed) {
+            continue;
+        }
+        if (!wheel_armed || timer_expired(wheel_deadline, timer->deadline)) {
+            wheel_deadline = timer->deadline;
+        }
+        wheel_armed = true;
+    }
+}
+
+void timeout_wheel_arm(timeout_wheel_timer_t *timer, timeout_wheel_callback_t callback, uint16_t deadline) {
+    timer->callback = callback;
+    timer->deadline = deadline;
+    timer->armed    = true;
+    wheel_track(timer);
+    /* Re-arming later than before can leave the cached deadline early; the
+     * task re-checks each timer before firing, so that only costs one
+     * spurious wakeup. */
+    if (!wheel_armed || timer_expired(wheel_deadline, deadline)) {
+        wheel_deadline = deadline;
+    }
+    wheel_armed = true;
+}
+
+void timeout_wheel_arm_earliest(timeout_wheel_timer_t *timer, timeout_wheel_callback_t callback, uint16_t deadline) {
+    if (timer->armed && !timer_expired(timer->deadline, deadline)) {
+        return;  // existing deadline is already earlier
+    }
+    timeout_wheel_arm(timer, callback, deadline);
+}
+
+void timeout_wheel_cancel(timeout_wheel_timer_t *timer) {
+    timer->armed = false;
+    wheel_recompute();
+}
+
+void timeout_wheel_task(void) {
+    if (!wheel_armed || !timer_expired(timer_read(), wheel_deadline)) {
+        return;
+    }
+
+    uint16_t now = timer_read();
+    for (uint8_t i = 0; i < slot_count; i++) {
+        timeout_wheel_timer_t *timer = slots[i];
+        if (timer->armed && timer_expired(now, timer->deadline)) {
+            timer->armed = false;
+            timer->callback();  // may re-arm this or any other timer
+        }
+    }
+    wheel_recompute();
+}
@@ -0,0 +1,58 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Shared timeout registry for the timed key-processing features (tap dance,
+ * combos, leader). Each feature arms one deadline instead of comparing
+ * timer_read() against its own term every matrix scan; the registry caches
+ * the earliest armed deadline, so the per-scan cost is a single compare no
+ * matter how many timed features are enabled. Expiry callbacks re-check
+ * their own state (firing early or with a stale deadline is safe) and may
+ * re-arm from inside the callback.
+ *
+ * Timers are identified by a caller-owned timeout_wheel_timer_t and are
+ * registered on first arm; TIMEOUT_WHEEL_SLOTS (default 4) bounds how many
+ * distinct timers the registry tracks, so raise it if keyboard code adds
+ * its own. Deadlines are absolute timer_read() values. */
+
+#ifndef TIMEOUT_WHEEL_SLOTS
+#    define TIMEOUT_WHEEL_SLOTS 4
+#endif
+
+typedef void (*timeout_wheel_callback_t)(void);
+
+typedef struct {
+    uint16_t                 deadline;
+    bool                     armed;
+    timeout_wheel_callback_t callback;
+} timeout_wheel_timer_t;
+
+/* Arm (or re-arm) a timer; the callback runs once after the deadline passes. */
+void timeout_wheel_arm(timeout_wheel_timer_t *timer, timeout_wheel_callback_t callback, uint16_t deadline);
+
+/* As timeout_wheel_arm(), but keeps the timer's existing deadline when that
+ * one is earlier - for features tracking several concurrent terms with one
+ * timer. */
+void timeout_wheel_arm_earliest(timeout_wheel_timer_t *timer, timeout_wheel_callback_t callback, uint16_t deadline);
+
+void timeout_wheel_cancel(timeout_wheel_timer_t *timer);
+
+/* Called from matrix_scan_quantum() in place of the per-feature task polls. */
+void timeout_wheel_task(void);
@@ -0,0 +1,127 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* Hardware trace markers for scope-based timing verification.
+ *
+ * Where variable_trace reports through console prints (milliseconds of
+ * formatting on the hot path), these markers are a single GPIO write on
+ * entry and exit of a traced region, observable on a logic analyzer or
+ * oscilloscope with nanosecond resolution and zero cost to the timing
+ * being measured. On AVR a compile-time-constant pin compiles to one
+ * sbi/cbi instruction; on ChibiOS targets defining TRACE_PROBE_ITM the
+ * markers are emitted as ITM stimulus-port bytes over SWO instead, which
+ * needs no spare pins.
+ *
+ * Enable with TRACE_PROBE_ENABLE = yes in rules.mk, map channels to pins
+ * in config.h (TRACE_PROBE_PIN_0..2) and opt into the built-in marker
+ * sites with TRACE_PROBE_MATRIX_SCAN, TRACE_PROBE_DEBOUNCE and
+ * TRACE_PROBE_USB_SUBMIT. TRACE_PROBE_HIGH/LOW/PULSE are available for
+ * marking custom regions.
+ */
+
+#ifdef TRACE_PROBE_ENABLE
+
+// Channel assignments of the built-in marker sites
+#    define TRACE_PROBE_CHANNEL_SCAN 0
+#    define TRACE_PROBE_CHANNEL_DEBOUNCE 1
+#    define TRACE_PROBE_CHANNEL_USB 2
+
+#    if defined(PROTOCOL_CHIBIOS) && defined(TRACE_PROBE_ITM)
+#        include <hal.h>
+
+// One byte per edge on the channel's stimulus port: 0x01 marks region
+// entry, 0x00 region exit. Silently drops the write when the debug probe
+// has not enabled ITM or the port, so an unattached board runs normally.
+static inline void trace_probe_itm(uint8_t channel, uint8_t byte) {
+    if ((ITM->TCR & ITM_TCR_ITMENA_Msk) && (ITM->TER & (1UL << channel))) {
+        while (ITM->PORT[channel].u32 == 0) {
+        }
+        ITM->PORT[channel].u8 = byte;
+    }
+}
+
+#        define TRACE_PROBE_INIT()
+#        define TRACE_PROBE_HIGH(channel) trace_probe_itm((channel), 0x01)
+#        define TRACE_PROBE_LOW(channel) trace_probe_itm((channel), 0x00)
+#    else
+#        include "gpio.h"
+
+// Two-level expansion so channel macros resolve before pasting
+#        define TRACE_PROBE_PIN_PASTE(channel) TRACE_PROBE_PIN_##channel
+#        define TRACE_PROBE_PIN(channel) TRACE_PROBE_PIN_PASTE(channel)
+
+static inline void trace_probe_init(void) {
+#        ifdef TRACE_PROBE_PIN_0
+    setPinOutput(TRACE_PROBE_PIN_0);
+    writePinLow(TRACE_PROBE_PIN_0);
+#        endif
+#        ifdef TRACE_PROBE_PIN_1
+    setPinOutput(TRACE_PROBE_PIN_1);
+    writePinLow(TRACE_PROBE_PIN_1);
+#        endif
+#        ifdef TRACE_PROBE_PIN_2
+    setPinOutput(TRACE_PROBE_PIN_2);
+    writePinLow(TRACE_PROBE_PIN_2);
+#        endif
+}
+
+#        define TRACE_PROBE_INIT() trace_probe_init()
+#        define TRACE_PROBE_HIGH(channel) writePinHigh(TRACE_PROBE_PIN(channel))
+#        define TRACE_PROBE_LOW(channel) writePinLow(TRACE_PROBE_PIN(channel))
+#    endif
+
+#    define TRACE_PROBE_PULSE(channel) \
+        do {                           \
+            TRACE_PROBE_HIGH(channel); \
+            TRACE_PROBE_LOW(channel);  \
+        } while (0)
+
+#else
+
+#    define TRACE_PROBE_INIT()
+#    define TRACE_PROBE_HIGH(channel)
+#    define TRACE_PROBE_LOW(channel)
+#    define TRACE_PROBE_PULSE(channel)
+
+#endif  // TRACE_PROBE_ENABLE
+
+// Built-in marker sites, each individually opt-in so untraced regions
+// compile to nothing
+#if defined(TRACE_PROBE_ENABLE) && defined(TRACE_PROBE_MATRIX_SCAN)
+#    define TRACE_SCAN_START() TRACE_PROBE_HIGH(TRACE_PROBE_CHANNEL_SCAN)
+#    define TRACE_SCAN_END() TRACE_PROBE_LOW(TRACE_PROBE_CHANNEL_SCAN)
+#else
+#    define TRACE_SCAN_START()
+#    define TRACE_SCAN_END()
+#endif
+
+#if defined(TRACE_PROBE_ENABLE) && defined(TRACE_PROBE_DEBOUNCE)
+#    define TRACE_DEBOUNCE_START() TRACE_PROBE_HIGH(TRACE_PROBE_CHANNEL_DEBOUNCE)
+#    define TRACE_DEBOUNCE_END() TRACE_PROBE_LOW(TRACE_PROBE_CHANNEL_DEBOUNCE)
+#else
+#    define TRACE_DEBOUNCE_START()
+#    define TRACE_DEBOUNCE_END()
+#endif
+
+#if defined(TRACE_PROBE_ENABLE) && defined(TRACE_PROBE_USB_SUBMIT)
+#    define TRACE_USB_SUBMIT_START() TRACE_PROBE_HIGH(TRACE_PROBE_CHANNEL_USB)
+#    define TRACE_USB_SUBMIT_END() TRACE_PROBE_LOW(TRACE_PROBE_CHANNEL_USB)
+#else
+#    define TRACE_USB_SUBMIT_START()
+#    define TRACE_USB_SUBMIT_END()
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include "atomic_util.h"
+
+// A typed single-producer/single-consumer channel carrying the latest value
+// of an object, implemented with triple buffering (the same scheme as
+// serial_link's triple_buffered_object, extracted for general use).
+//
+// Unlike ring_buffer.h, which queues every byte of a stream, a triple buffer
+// never blocks and never overflows: the producer always has a free slot to
+// write into, and the consumer always reads the most recently published
+// value, skipping stale ones. Use it for state snapshots (reports, matrices)
+// where only the newest value matters; use a ring buffer for streams.
+//
+// The index swaps in tbuf_end_write()/tbuf_read() run inside
+// ATOMIC_BLOCK_FORCEON, so like the other users of that macro they must be
+// called from a context where forcing interrupts back on is safe. Writing
+// and reading the slots themselves needs no locking.
+//
+// Usage:
+//     static TRIPLE_BUFFER_T(report_mouse_t) report_buffer;
+//     ...
+//     tbuf_init(&report_buffer);
+//     tbuf_write(&report_buffer, report);   // producer
+//     report_mouse_t* latest = tbuf_read(&report_buffer);
+//     if (latest) { ... }                   // consumer, NULL if nothing new
+
+typedef struct {
+    // Bits 0-1: read index, 2-3: write index, 4-5: shared index, 6: data available
+    uint8_t state;
+} tbuf_state_t;
+
+#define TRIPLE_BUFFER_T(type) \
+    struct {                  \
+        tbuf_state_t state;   \
+        type         slots[3]; \
+    }
+
+static inline void tbuf_init_internal(tbuf_state_t* tb) { tb->state = (2 << 4) | (0 << 2) | 1; }
+
+static inline uint8_t tbuf_write_index_internal(tbuf_state_t* tb) { return (tb->state >> 2) & 3; }
+
+static inline void tbuf_publish_internal(tbuf_state_t* tb) {
+    ATOMIC_BLOCK_FORCEON {
+        uint8_t state  = tb->state;
+        uint8_t write  = (state >> 2) & 3;
+        uint8_t shared = (state >> 4) & 3;
+        // Swap the write and shared slots and flag the new data
+        tb->state = (uint8_t)((1 << 6) | (write << 4) | (shared << 2) | (state & 3));
+    }
+}
+
+static inline int8_t tbuf_consume_internal(tbuf_state_t* tb) {
+    int8_t index = -1;
+    ATOMIC_BLOCK_FORCEON {
+        uint8_t state = tb->state;
+        if (state & (1 << 6)) {
+            uint8_t read   = state & 3;
+            uint8_t shared = (state >> 4) & 3;
+            // Swap the read and shared slots and consume the flag
+            tb->state = (uint8_t)((read << 4) | (state & (3 << 2)) | shared);
+            index     = (int8_t)shared;
+        }
+    }
+    return index;
+}
+
+// Static initializer, equivalent to calling tbuf_init() on a zeroed buffer
+#define TRIPLE_BUFFER_INIT \
+    { .state = {(2 << 4) | 1} }
+
+#define tbuf_init(tbuf) tbuf_init_internal(&(tbuf)->state)
+
+#define tbuf_begin_write(tbuf) (&(tbuf)->slots[tbuf_write_index_internal(&(tbuf)->state)])
+
+#define tbuf_end_write(tbuf) tbuf_publish_internal(&(tbuf)->state)
+
+#define tbuf_write(tbuf, value)              \
+    do {                                     \
+        *tbuf_begin_write(tbuf) = (value);   \
+        tbuf_end_write(tbuf);                \
+    } while (0)
+
+#define tbuf_read(tbuf)                                                    \
+    ({                                                                     \
+        int8_t tbuf_index__ = tbuf_consume_internal(&(tbuf)->state);       \
+        tbuf_index__ < 0 ? (typeof(&(tbuf)->slots[0]))0 : &(tbuf)->slots[tbuf_index__]; \
+    })
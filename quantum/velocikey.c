@@ -2,6 +2,9 @@
 #include "timer.h"
 #include "eeconfig.h"
 #include "eeprom.h"
+#ifdef WPM_ENABLE
+#    include "wpm.h"
+#endif
 
 #ifndef MIN
 #    define MIN(a, b) (((a) < (b)) ? (a) : (b))
@@ -11,16 +14,35 @@
 #endif
 
 #define TYPING_SPEED_MAX_VALUE 200
-uint8_t typing_speed = 0;
 
-bool velocikey_enabled(void) { return eeprom_read_byte(EECONFIG_VELOCIKEY) == 1; }
+bool velocikey_enabled(void) { return eeconfig_read_byte(EECONFIG_VELOCIKEY) == 1; }
 
 void velocikey_toggle(void) {
     if (velocikey_enabled())
-        eeprom_update_byte(EECONFIG_VELOCIKEY, 0);
+        eeconfig_update_byte(EECONFIG_VELOCIKEY, 0);
     else
-        eeprom_update_byte(EECONFIG_VELOCIKEY, 1);
+        eeconfig_update_byte(EECONFIG_VELOCIKEY, 1);
+}
+
+#ifdef WPM_ENABLE
+/* With the WPM engine enabled there is no second speed tracker: the speed is
+ * derived from wpm.c's fixed-point EMA, which is already updated per
+ * keystroke and decayed on idle. The accelerate/decelerate hooks stay as
+ * no-ops so call sites are identical either way. */
+#    ifndef VELOCIKEY_WPM_MAX
+#        define VELOCIKEY_WPM_MAX 150
+#    endif
+
+void velocikey_accelerate(void) {}
+
+void velocikey_decelerate(void) {}
+
+uint8_t velocikey_get_speed(void) {
+    uint16_t wpm = MIN(get_current_wpm(), VELOCIKEY_WPM_MAX);
+    return (wpm * 255) / VELOCIKEY_WPM_MAX;
 }
+#else
+uint8_t typing_speed = 0;
 
 void velocikey_accelerate(void) {
     if (typing_speed < TYPING_SPEED_MAX_VALUE) typing_speed += (TYPING_SPEED_MAX_VALUE / 100);
@@ -39,4 +61,7 @@ void velocikey_decelerate(void) {
     }
 }
 
-uint8_t velocikey_match_speed(uint8_t minValue, uint8_t maxValue) { return MAX(minValue, maxValue - (maxValue - minValue) * ((float)typing_speed / TYPING_SPEED_MAX_VALUE)); }
+uint8_t velocikey_get_speed(void) { return ((uint16_t)typing_speed * 255) / TYPING_SPEED_MAX_VALUE; }
+#endif
+
+uint8_t velocikey_match_speed(uint8_t minValue, uint8_t maxValue) { return MAX(minValue, maxValue - ((maxValue - minValue) * (uint16_t)velocikey_get_speed()) / 255); }
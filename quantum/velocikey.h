@@ -7,4 +7,5 @@ bool    velocikey_enabled(void);
 void    velocikey_toggle(void);
 void    velocikey_accelerate(void);
 void    velocikey_decelerate(void);
+uint8_t velocikey_get_speed(void);
 uint8_t velocikey_match_speed(uint8_t minValue, uint8_t maxValue);
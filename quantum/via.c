@@ -38,6 +38,8 @@
 #    define VIA_QMK_RGBLIGHT_ENABLE
 #endif
 
+#include <string.h>
+
 #include "quantum.h"
 
 #include "via.h"
@@ -48,6 +50,10 @@
 #include "version.h"  // for QMK_BUILDDATE used in EEPROM magic
 #include "via_ensure_keycode.h"
 
+#ifdef VIA_BULK_TRANSFER
+#    include "crc.h"
+#endif
+
 // Forward declare some helpers.
 #if defined(VIA_QMK_BACKLIGHT_ENABLE)
 void via_qmk_backlight_set_value(uint8_t *data);
@@ -62,25 +68,26 @@ void via_qmk_rgblight_get_value(uint8_t *data);
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
-    char *  p      = QMK_BUILDDATE;  // e.g. "2019-11-05-11:29:54"
-    uint8_t magic0 = ((p[2] & 0x0F) << 4) | (p[3] & 0x0F);
-    uint8_t magic1 = ((p[5] & 0x0F) << 4) | (p[6] & 0x0F);
-    uint8_t magic2 = ((p[8] & 0x0F) << 4) | (p[9] & 0x0F);
-
-    return (eeprom_read_byte((void *)VIA_EEPROM_MAGIC_ADDR + 0) == magic0 && eeprom_read_byte((void *)VIA_EEPROM_MAGIC_ADDR + 1) == magic1 && eeprom_read_byte((void *)VIA_EEPROM_MAGIC_ADDR + 2) == magic2);
+    char *  p        = QMK_BUILDDATE;  // e.g. "2019-11-05-11:29:54"
+    uint8_t magic[3] = {((p[2] & 0x0F) << 4) | (p[3] & 0x0F), ((p[5] & 0x0F) << 4) | (p[6] & 0x0F), ((p[8] & 0x0F) << 4) | (p[9] & 0x0F)};
+
+    // one block read instead of three byte reads: on external (I2C/SPI)
+    // EEPROMs each byte read is its own bus transaction
+    uint8_t stored[3];
+    eeprom_read_block(stored, (void *)VIA_EEPROM_MAGIC_ADDR, sizeof(stored));
+    return memcmp(stored, magic, sizeof(stored)) == 0;
 }
 
 // Sets VIA/keyboard level usage of EEPROM to valid/invalid
 // Keyboard level code (eg. via_init_kb()) should not call this
 void via_eeprom_set_valid(bool valid) {
-    char *  p      = QMK_BUILDDATE;  // e.g. "2019-11-05-11:29:54"
-    uint8_t magic0 = ((p[2] & 0x0F) << 4) | (p[3] & 0x0F);
-    uint8_t magic1 = ((p[5] & 0x0F) << 4) | (p[6] & 0x0F);
-    uint8_t magic2 = ((p[8] & 0x0F) << 4) | (p[9] & 0x0F);
-
-    eeprom_update_byte((void *)VIA_EEPROM_MAGIC_ADDR + 0, valid ? magic0 : 0xFF);
-    eeprom_update_byte((void *)VIA_EEPROM_MAGIC_ADDR + 1, valid ? magic1 : 0xFF);
-    eeprom_update_byte((void *)VIA_EEPROM_MAGIC_ADDR + 2, valid ? magic2 : 0xFF);
+    char *  p        = QMK_BUILDDATE;  // e.g. "2019-11-05-11:29:54"
+    uint8_t magic[3] = {((p[2] & 0x0F) << 4) | (p[3] & 0x0F), ((p[5] & 0x0F) << 4) | (p[6] & 0x0F), ((p[8] & 0x0F) << 4) | (p[9] & 0x0F)};
+
+    if (!valid) {
+        memset(magic, 0xFF, sizeof(magic));
+    }
+    eeprom_update_block(magic, (void *)VIA_EEPROM_MAGIC_ADDR, sizeof(magic));
 }
 
 // Override this at the keyboard code level to check
@@ -120,25 +127,24 @@ void eeconfig_init_via(void) {
 // This is generalized so the layout options EEPROM usage can be
 // variable, between 1 and 4 bytes.
 uint32_t via_get_layout_options(void) {
+    // Stored most significant byte first; fetched as one block transaction
+    uint8_t bytes[VIA_EEPROM_LAYOUT_OPTIONS_SIZE];
+    eeprom_read_block(bytes, (void *)VIA_EEPROM_LAYOUT_OPTIONS_ADDR, sizeof(bytes));
     uint32_t value = 0;
-    // Start at the most significant byte
-    void *source = (void *)(VIA_EEPROM_LAYOUT_OPTIONS_ADDR);
     for (uint8_t i = 0; i < VIA_EEPROM_LAYOUT_OPTIONS_SIZE; i++) {
-        value = value << 8;
-        value |= eeprom_read_byte(source);
-        source++;
+        value = (value << 8) | bytes[i];
     }
     return value;
 }
 
 void via_set_layout_options(uint32_t value) {
-    // Start at the least significant byte
-    void *target = (void *)(VIA_EEPROM_LAYOUT_OPTIONS_ADDR + VIA_EEPROM_LAYOUT_OPTIONS_SIZE - 1);
+    // Stored most significant byte first; written as one block transaction
+    uint8_t bytes[VIA_EEPROM_LAYOUT_OPTIONS_SIZE];
     for (uint8_t i = 0; i < VIA_EEPROM_LAYOUT_OPTIONS_SIZE; i++) {
-        eeprom_update_byte(target, value & 0xFF);
-        value = value >> 8;
-        target--;
+        bytes[VIA_EEPROM_LAYOUT_OPTIONS_SIZE - 1 - i] = value & 0xFF;
+        value >>= 8;
     }
+    eeprom_update_block(bytes, (void *)VIA_EEPROM_LAYOUT_OPTIONS_ADDR, sizeof(bytes));
 }
 
 // Called by QMK core to process VIA-specific keycodes.
@@ -180,6 +186,122 @@ bool process_record_via(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+#ifdef VIA_BULK_TRANSFER
+
+// The bulk transfer extension moves the dynamic keymap buffer as a stream
+// of raw HID reports instead of one 28-byte request/response round trip per
+// chunk. Payloads are RLE-compressed over runs of zero bytes (KC_NO is
+// 0x0000, so sparse layers collapse to a handful of run tokens): a non-zero
+// byte is a literal, 0x00 is followed by the run length (1-255).
+//
+// Data report layout:
+//   data[0]          command ID
+//   data[1]          id_bulk_data
+//   data[2]          sequence number
+//   data[3]          payload length
+//   data[4..]        payload
+//   data[length-1]   CRC8 over data[0..length-2]
+
+// Flush a partially filled data report to the host.
+static void via_bulk_read_flush(uint8_t *data, uint8_t length, uint8_t *seq, uint8_t *fill) {
+    if (*fill == 0) {
+        return;
+    }
+    data[0] = id_dynamic_keymap_bulk_read;
+    data[1] = id_bulk_data;
+    data[2] = (*seq)++;
+    data[3] = *fill;
+    // Zero the unused tail so the CRC is deterministic
+    for (uint8_t i = 4 + *fill; i < length - 1; i++) {
+        data[i] = 0;
+    }
+    data[length - 1] = crc8(data, length - 1);
+    raw_hid_send(data, length);
+    *fill = 0;
+}
+
+// Append one compressed byte, flushing the report when it fills.
+static void via_bulk_read_put(uint8_t *data, uint8_t length, uint8_t *seq, uint8_t *fill, uint8_t byte) {
+    data[4 + (*fill)++] = byte;
+    if (*fill == length - 5) {
+        via_bulk_read_flush(data, length, seq, fill);
+    }
+}
+
+// Stream `size` bytes of the dynamic keymap buffer starting at `offset`.
+// Returns the number of data reports sent and the compressed byte count.
+static uint8_t via_bulk_read(uint8_t *data, uint8_t length, uint16_t offset, uint16_t size, uint16_t *compressed_size) {
+    uint8_t  chunk[16];
+    uint8_t  seq   = 0;
+    uint8_t  fill  = 0;
+    uint16_t run   = 0;
+    uint16_t total = 0;
+
+    while (size > 0) {
+        uint8_t chunk_length = size < sizeof(chunk) ? size : sizeof(chunk);
+        dynamic_keymap_get_buffer(offset, chunk_length, chunk);
+        for (uint8_t i = 0; i < chunk_length; i++) {
+            if (chunk[i] == 0) {
+                if (run == 255) {
+                    via_bulk_read_put(data, length, &seq, &fill, 0x00);
+                    via_bulk_read_put(data, length, &seq, &fill, 255);
+                    total += 2;
+                    run = 0;
+                }
+                run++;
+            } else {
+                if (run > 0) {
+                    via_bulk_read_put(data, length, &seq, &fill, 0x00);
+                    via_bulk_read_put(data, length, &seq, &fill, run);
+                    total += 2;
+                    run = 0;
+                }
+                via_bulk_read_put(data, length, &seq, &fill, chunk[i]);
+                total++;
+            }
+        }
+        offset += chunk_length;
+        size -= chunk_length;
+    }
+    if (run > 0) {
+        via_bulk_read_put(data, length, &seq, &fill, 0x00);
+        via_bulk_read_put(data, length, &seq, &fill, run);
+        total += 2;
+    }
+    via_bulk_read_flush(data, length, &seq, &fill);
+    *compressed_size = total;
+    return seq;
+}
+
+// Bulk write state, set up by id_bulk_start and consumed per data report
+static uint16_t via_bulk_write_offset;
+static uint16_t via_bulk_write_remaining;
+static uint8_t  via_bulk_write_seq;
+static bool     via_bulk_write_escape;  // a zero-run length byte is pending in the next report
+
+// Decompress one report's payload into the dynamic keymap buffer. Run
+// tokens may straddle a report boundary, hence the escape carry above.
+static void via_bulk_write_bytes(const uint8_t *payload, uint8_t payload_length) {
+    for (uint8_t i = 0; i < payload_length && via_bulk_write_remaining > 0; i++) {
+        uint8_t byte = payload[i];
+        if (via_bulk_write_escape) {
+            uint8_t zero = 0;
+            while (byte-- > 0 && via_bulk_write_remaining > 0) {
+                dynamic_keymap_set_buffer(via_bulk_write_offset++, 1, &zero);
+                via_bulk_write_remaining--;
+            }
+            via_bulk_write_escape = false;
+        } else if (byte == 0) {
+            via_bulk_write_escape = true;
+        } else {
+            dynamic_keymap_set_buffer(via_bulk_write_offset++, 1, &byte);
+            via_bulk_write_remaining--;
+        }
+    }
+}
+
+#endif  // VIA_BULK_TRANSFER
+
 // Keyboard level code can override this to handle custom messages from VIA.
 // See raw_hid_receive() implementation.
 // DO NOT call raw_hid_send() in the override function.
@@ -373,6 +495,54 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_buffer(offset, size, &command_data[3]);
             break;
         }
+#ifdef VIA_BULK_TRANSFER
+        case id_dynamic_keymap_bulk_read: {
+            if (command_data[0] != id_bulk_start) {
+                *command_id = id_unhandled;
+                break;
+            }
+            uint16_t offset          = (command_data[1] << 8) | command_data[2];
+            uint16_t size            = (command_data[3] << 8) | command_data[4];
+            uint16_t compressed_size = 0;
+            uint8_t  report_count    = via_bulk_read(data, length, offset, size, &compressed_size);
+            // The streamed data reports went out above; rebuild the start
+            // report as a trailer so the host knows the stream is complete
+            data[0]         = id_dynamic_keymap_bulk_read;
+            command_data[0] = id_bulk_start;
+            command_data[1] = report_count;
+            command_data[2] = compressed_size >> 8;
+            command_data[3] = compressed_size & 0xFF;
+            break;
+        }
+        case id_dynamic_keymap_bulk_write: {
+            switch (command_data[0]) {
+                case id_bulk_start: {
+                    via_bulk_write_offset    = (command_data[1] << 8) | command_data[2];
+                    via_bulk_write_remaining = (command_data[3] << 8) | command_data[4];
+                    via_bulk_write_seq       = 0;
+                    via_bulk_write_escape    = false;
+                    break;
+                }
+                case id_bulk_data: {
+                    if (data[length - 1] != crc8(data, length - 1) || command_data[1] != via_bulk_write_seq || command_data[2] > length - 5) {
+                        // Corrupted or out-of-order report -- abort the
+                        // transfer; the host restarts with id_bulk_start
+                        via_bulk_write_remaining = 0;
+                        *command_id              = id_unhandled;
+                        break;
+                    }
+                    via_bulk_write_seq++;
+                    via_bulk_write_bytes(&command_data[3], command_data[2]);
+                    break;
+                }
+                default: {
+                    *command_id = id_unhandled;
+                    break;
+                }
+            }
+            break;
+        }
+#endif  // VIA_BULK_TRANSFER
         default: {
             // The command ID is not known
             // Return the unhandled state
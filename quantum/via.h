@@ -78,9 +78,20 @@ enum via_command_id {
     id_dynamic_keymap_get_layer_count       = 0x11,
     id_dynamic_keymap_get_buffer            = 0x12,
     id_dynamic_keymap_set_buffer            = 0x13,
+    // Opt-in extension (VIA_BULK_TRANSFER_ENABLE) used by provisioning
+    // tools for fast full-keymap sync. The stock configurator never sends
+    // these, so they do not affect VIA_PROTOCOL_VERSION.
+    id_dynamic_keymap_bulk_read             = 0x14,
+    id_dynamic_keymap_bulk_write            = 0x15,
     id_unhandled                            = 0xFF,
 };
 
+// Sub-commands for the bulk transfer extension
+enum via_bulk_id {
+    id_bulk_start = 0x01,  //
+    id_bulk_data  = 0x02,
+};
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,  //
     id_layout_options      = 0x02,
@@ -0,0 +1,122 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "watchdog.h"
+#include <string.h>
+
+#ifdef __AVR__
+#    include <avr/io.h>
+#    include <avr/wdt.h>
+#    ifndef WATCHDOG_TIMEOUT
+#        define WATCHDOG_TIMEOUT WDTO_500MS
+#    endif
+#endif
+
+#define WATCHDOG_STATE_MAGIC 0x57D09A7E
+
+/* Lives in .noinit so it survives a watchdog (or any other) reset without
+ * being zeroed by the startup code; the magic guards against interpreting
+ * power-up garbage. Power loss clears everything, which is fine - the
+ * counters describe the current powered session. */
+typedef struct {
+    uint32_t         magic;
+    volatile uint8_t current;
+    uint8_t          fired_subsystem;
+    uint16_t         fired_count;
+    uint16_t         stall_counts[WD_SUBSYSTEM_COUNT];
+} watchdog_state_t;
+
+static watchdog_state_t watchdog_state __attribute__((section(".noinit")));
+
+/* this-boot view of the attribution, valid after watchdog_init() */
+static bool    watchdog_fired_this_boot = false;
+static uint8_t watchdog_fired_at        = WD_SUBSYSTEM_NONE;
+
+__attribute__((weak)) void watchdog_hw_init(void) {
+#ifdef __AVR__
+    wdt_reset();
+    wdt_enable(WATCHDOG_TIMEOUT);
+#endif
+}
+
+__attribute__((weak)) void watchdog_hw_feed(void) {
+#ifdef __AVR__
+    wdt_reset();
+    /* the suspend code borrows the WDT as a wake timer and disables it on
+     * resume; re-arm when that happened */
+#    if defined(WDTCSR)
+    if (!(WDTCSR & _BV(WDE))) {
+        wdt_enable(WATCHDOG_TIMEOUT);
+    }
+#    elif defined(WDTCR)
+    if (!(WDTCR & _BV(WDE))) {
+        wdt_enable(WATCHDOG_TIMEOUT);
+    }
+#    endif
+#endif
+}
+
+__attribute__((weak)) bool watchdog_hw_fired(void) {
+#ifdef __AVR__
+    /* WDRF must be cleared in any case, or the next watchdog timeout after
+     * wdt_disable() would reset immediately. A bootloader that clears MCUSR
+     * before us hides the flag, leaving the reset unattributed. */
+    uint8_t mcusr = MCUSR;
+    MCUSR &= ~_BV(WDRF);
+    return (mcusr & _BV(WDRF)) != 0;
+#else
+    return false;
+#endif
+}
+
+void watchdog_init(void) {
+    bool fired = watchdog_hw_fired();
+
+    if (watchdog_state.magic != WATCHDOG_STATE_MAGIC) {
+        /* first power-up (or the region moved): nothing to attribute */
+        memset(&watchdog_state, 0, sizeof(watchdog_state));
+        watchdog_state.magic = WATCHDOG_STATE_MAGIC;
+        fired                = false;
+    }
+
+    if (fired) {
+        watchdog_fired_this_boot       = true;
+        watchdog_fired_at              = watchdog_state.current;
+        watchdog_state.fired_subsystem = watchdog_state.current;
+        watchdog_state.fired_count++;
+        if (watchdog_state.current < WD_SUBSYSTEM_COUNT) {
+            watchdog_state.stall_counts[watchdog_state.current]++;
+        }
+    }
+
+    watchdog_state.current = WD_SUBSYSTEM_NONE;
+    watchdog_hw_init();
+}
+
+void watchdog_mark(uint8_t subsystem) { watchdog_state.current = subsystem; }
+
+void watchdog_feed(void) {
+    watchdog_state.current = WD_SUBSYSTEM_NONE;
+    watchdog_hw_feed();
+}
+
+bool watchdog_fired(void) { return watchdog_fired_this_boot; }
+
+uint8_t watchdog_fired_subsystem(void) { return watchdog_fired_at; }
+
+uint16_t watchdog_fired_count(void) { return watchdog_state.fired_count; }
+
+uint16_t watchdog_stall_count(uint8_t subsystem) { return subsystem < WD_SUBSYSTEM_COUNT ? watchdog_state.stall_counts[subsystem] : 0; }
@@ -0,0 +1,73 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Per-subsystem watchdog with stall attribution (WATCHDOG_ENABLE)
+ *
+ * keyboard_task() marks which subsystem is about to run and feeds the
+ * hardware watchdog once per pass. When a blocking driver stalls the scan
+ * loop (an I2C timeout, a split-serial retry storm) the watchdog resets the
+ * board instead of leaving it frozen, and the mark survives the reset in a
+ * noinit RAM region, so the next boot can attribute the stall to the
+ * subsystem that was executing. Per-subsystem stall counters accumulate in
+ * the same region until power-off and are emitted through the telemetry
+ * surface (TELEMETRY_WATCHDOG records), so intermittent fleet freezes can be
+ * localized without shipping boards back.
+ *
+ * The hardware backend is provided for AVR (<avr/wdt.h>, WATCHDOG_TIMEOUT
+ * defaults to WDTO_500MS); other platforms get weak no-op hooks to override
+ * with their own watchdog driver. Note that a bootloader that clears MCUSR
+ * hides the watchdog-reset flag from us, in which case stalls still reset
+ * the board but go unattributed.
+ */
+
+enum watchdog_subsystem {
+    WD_SUBSYSTEM_NONE = 0, /* between passes / outside keyboard_task */
+    WD_SUBSYSTEM_MATRIX,   /* matrix scan, incl. split transport and debounce */
+    WD_SUBSYSTEM_ACTION,   /* key event processing and user hooks */
+    WD_SUBSYSTEM_COSMETICS, /* lighting, OLED and other display work */
+    WD_SUBSYSTEM_ENCODER,
+    WD_SUBSYSTEM_MOUSE,    /* mousekey / PS2 / serial / ADB mouse tasks */
+    WD_SUBSYSTEM_POINTING, /* pointing device driver */
+    WD_SUBSYSTEM_HOUSEKEEPING, /* remaining periodic tasks at the tail of the pass */
+    WD_SUBSYSTEM_COUNT
+};
+
+/* attribute any pending watchdog reset, then arm the hardware watchdog */
+void watchdog_init(void);
+
+/* record the subsystem about to execute; a single byte store */
+void watchdog_mark(uint8_t subsystem);
+
+/* end of a keyboard_task() pass: clear the mark and feed the hardware */
+void watchdog_feed(void);
+
+/* true when this boot was caused by the watchdog, and where it hit */
+bool    watchdog_fired(void);
+uint8_t watchdog_fired_subsystem(void);
+
+/* counters accumulated across watchdog resets since power-on */
+uint16_t watchdog_fired_count(void);
+uint16_t watchdog_stall_count(uint8_t subsystem);
+
+/* platform hooks; AVR implementations provided, weak no-ops elsewhere */
+void watchdog_hw_init(void);
+void watchdog_hw_feed(void);
+bool watchdog_hw_fired(void);
@@ -17,18 +17,30 @@
 
 #include "wpm.h"
 
-#include <math.h>
-
 // WPM Stuff
-static uint8_t  current_wpm = 0;
-static uint16_t wpm_timer   = 0;
+// The rate is kept in 8.8 fixed point so the EMA retains fractional
+// progress between keystrokes; the smoothing factor is a power of two
+// (1 / (1 << WPM_SMOOTHING_SHIFT)) so each update is a shift and an add.
+static uint16_t current_wpm_fixed = 0;
+static uint16_t wpm_timer         = 0;
+static bool     wpm_dirty         = false;
+
+static void wpm_set_fixed(uint16_t new_wpm_fixed) {
+    if ((new_wpm_fixed >> 8) != (current_wpm_fixed >> 8)) {
+        wpm_dirty = true;
+    }
+    current_wpm_fixed = new_wpm_fixed;
+}
 
-// This smoothing is 40 keystrokes
-static const float wpm_smoothing = WPM_SMOOTHING;
+void set_current_wpm(uint8_t new_wpm) { wpm_set_fixed((uint16_t)new_wpm << 8); }
 
-void set_current_wpm(uint8_t new_wpm) { current_wpm = new_wpm; }
+uint8_t get_current_wpm(void) { return current_wpm_fixed >> 8; }
 
-uint8_t get_current_wpm(void) { return current_wpm; }
+bool wpm_changed(void) {
+    bool changed = wpm_dirty;
+    wpm_dirty    = false;
+    return changed;
+}
 
 bool wpm_keycode(uint16_t keycode) { return wpm_keycode_kb(keycode); }
 
@@ -68,6 +80,19 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 }
 #endif
 
+// steps the EMA one sample towards target_wpm
+static void wpm_ema_step(uint8_t target_wpm) {
+    // the true difference spans +/-65280 in 8.8, so it must be computed in
+    // 32 bits; an int16_t wraps whenever the gap exceeds ~128 WPM
+    int32_t delta = (int32_t)((uint16_t)target_wpm << 8) - current_wpm_fixed;
+    int32_t step  = delta >> WPM_SMOOTHING_SHIFT;
+    if (step == 0 && delta != 0) {
+        // never stall short of the target on sub-step deltas
+        step = delta > 0 ? 1 : -1;
+    }
+    wpm_set_fixed(current_wpm_fixed + step);
+}
+
 void update_wpm(uint16_t keycode) {
     if (wpm_keycode(keycode)) {
         if (wpm_timer > 0) {
@@ -75,17 +100,18 @@ void update_wpm(uint16_t keycode) {
             if (latest_wpm > UINT8_MAX) {
                 latest_wpm = UINT8_MAX;
             }
-            current_wpm += ceilf((latest_wpm - current_wpm) * wpm_smoothing);
+            wpm_ema_step(latest_wpm);
         }
         wpm_timer = timer_read();
     }
 #ifdef WPM_ALLOW_COUNT_REGRESSION
     uint8_t regress = wpm_regress_count(keycode);
     if (regress) {
-        if (current_wpm < regress) {
-            current_wpm = 0;
+        uint16_t regress_fixed = (uint16_t)regress << 8;
+        if (current_wpm_fixed < regress_fixed) {
+            wpm_set_fixed(0);
         } else {
-            current_wpm -= regress;
+            wpm_set_fixed(current_wpm_fixed - regress_fixed);
         }
         wpm_timer = timer_read();
     }
@@ -94,7 +120,7 @@ void update_wpm(uint16_t keycode) {
 
 void decay_wpm(void) {
     if (timer_elapsed(wpm_timer) > 1000) {
-        current_wpm += (-current_wpm) * wpm_smoothing;
+        wpm_ema_step(0);
         wpm_timer = timer_read();
     }
 }
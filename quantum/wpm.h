@@ -22,8 +22,10 @@
 #ifndef WPM_ESTIMATED_WORD_SIZE
 #    define WPM_ESTIMATED_WORD_SIZE 5
 #endif
-#ifndef WPM_SMOOTHING
-#    define WPM_SMOOTHING 0.0487
+// EMA smoothing factor is 1 / (1 << WPM_SMOOTHING_SHIFT); the default of 4
+// (1/16) smooths over roughly 30 keystrokes
+#ifndef WPM_SMOOTHING_SHIFT
+#    define WPM_SMOOTHING_SHIFT 4
 #endif
 
 bool wpm_keycode(uint16_t keycode);
@@ -36,6 +38,7 @@ uint8_t wpm_regress_count(uint16_t keycode);
 
 void    set_current_wpm(uint8_t);
 uint8_t get_current_wpm(void);
+bool    wpm_changed(void);
 void    update_wpm(uint16_t);
 
 void decay_wpm(void);
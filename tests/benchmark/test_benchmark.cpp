@@ -0,0 +1,156 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Full-stack soak benchmark (`make test:benchmark`). Each scenario pumps a
+ * deterministic typing trace through keyboard_task() - single-key typing,
+ * six-key rollover bursts, mod-tap taps and combo chords - and reports
+ * wall-clock ns per scan and per keystroke, so changes to action.c or
+ * process_keycode show up as a cost delta between two runs. For cycle
+ * counts rather than wall clock, run the binary under `perf stat`.
+ *
+ * Like the debounce benchmarks, the numbers are informational: the only
+ * assertions are the fixture's own cleanup checks, so CI stays green on
+ * slow or noisy machines.
+ */
+
+#include "test_common.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+class Benchmark : public TestFixture {};
+
+namespace {
+
+struct BenchResult {
+    double   ns_total;
+    unsigned scans;
+    unsigned events;
+};
+
+void report(const char *name, const BenchResult &result) {
+    std::cout << "[ BENCH    ] " << name << ": " << std::fixed << std::setprecision(1) << result.ns_total / result.scans << " ns/scan, " << (result.events ? result.ns_total / result.events : 0.0) << " ns/keystroke (" << result.scans << " scans, " << result.events << " events)" << std::endl;
+}
+
+/* run `scans` scan passes while `step` injects matrix edges; returns the
+ * wall-clock cost with event edges counted by the caller */
+template <typename Step>
+BenchResult soak(unsigned scans, unsigned events_per_cycle, unsigned cycle_scans, Step step) {
+    BenchResult result = {0, scans, scans / cycle_scans * events_per_cycle};
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned scan = 0; scan < scans; scan++) {
+        step(scan % cycle_scans);
+        keyboard_task();
+        advance_time(1);
+    }
+    result.ns_total = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+} // namespace
+
+TEST_F(Benchmark, IdleScan) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    soak(1000, 0, 1, [](unsigned) {}); /* warm-up */
+    report("idle scan", soak(20000, 0, 1, [](unsigned) {}));
+}
+
+TEST_F(Benchmark, SingleKeyTyping) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* one press and one release edge every four scans, rotating over the
+     * home row like a steady typist */
+    auto step = [](unsigned phase) {
+        static unsigned col = 0;
+        if (phase == 0) {
+            press_key(col, 0);
+        } else if (phase == 2) {
+            release_key(col, 0);
+            col = (col + 1) % 9; /* col 9 is the mod-tap, covered separately */
+        }
+    };
+    soak(1000, 2, 4, step); /* warm-up */
+    report("single-key typing", soak(20000, 2, 4, step));
+}
+
+TEST_F(Benchmark, RolloverBurst) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* six keys go down on consecutive scans, then come back up the same
+     * way - the worst case the report builder and action_exec see from
+     * fast rolled chords */
+    auto step = [](unsigned phase) {
+        if (phase < 6) {
+            press_key(phase, 1);
+        } else if (phase >= 8 && phase < 14) {
+            release_key(phase - 8, 1);
+        }
+    };
+    soak(1024, 12, 16, step); /* warm-up */
+    report("6-key rollover burst", soak(20000, 12, 16, step));
+}
+
+TEST_F(Benchmark, ModTapTaps) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* quick taps of SFT_T(KC_P): each edge runs the tapping state machine,
+     * and the gap lets the tap settle well inside the term */
+    auto step = [](unsigned phase) {
+        if (phase == 0) {
+            press_key(9, 0);
+        } else if (phase == 2) {
+            release_key(9, 0);
+        }
+    };
+    soak(1000, 2, 10, step); /* warm-up */
+    report("mod-tap taps", soak(20000, 2, 10, step));
+
+    idle_for(TAPPING_TERM + 10);
+}
+
+TEST_F(Benchmark, ComboChords) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* both combo keys land on the same scan, so every cycle exercises the
+     * combo buffer fill, match and flush */
+    auto step = [](unsigned phase) {
+        if (phase == 0) {
+            press_key(0, 0);
+            press_key(1, 0);
+        } else if (phase == 4) {
+            release_key(0, 0);
+            release_key(1, 0);
+        }
+    };
+    soak(1000, 4, 8, step); /* warm-up */
+    report("combo chords", soak(20000, 4, 8, step));
+}
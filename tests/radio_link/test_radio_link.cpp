@@ -0,0 +1,101 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "radio_link.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class RadioLink : public TestFixture {};
+
+TEST_F(RadioLink, ReportIsHeldUntilTheLatencyWindowExpires) {
+    TestDriver driver;
+    run_one_scan_loop();  // first pass wraps the freshly installed driver
+
+    press_key(0, 0);
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    idle_for(RADIO_LINK_LATENCY_MS);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    release_key(0, 0);
+    idle_for(RADIO_LINK_LATENCY_MS + 1);
+}
+
+TEST_F(RadioLink, TapWithinOneWindowKeepsBothEdgesInOrder) {
+    TestDriver driver;
+    run_one_scan_loop();
+
+    press_key(0, 0);
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    run_one_scan_loop();
+    release_key(0, 0);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    // both edges ride the same frame, press first
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    }
+    idle_for(RADIO_LINK_LATENCY_MS);
+}
+
+TEST_F(RadioLink, ZeroLatencyRestoresPerEventTransmission) {
+    TestDriver driver;
+    run_one_scan_loop();
+    radio_link_set_latency(0);
+
+    press_key(1, 0);
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    release_key(1, 0);
+    run_one_scan_loop();
+
+    radio_link_set_latency(RADIO_LINK_LATENCY_MS);
+}
+
+TEST_F(RadioLink, BatchedFramesAreCountedAgainstReports) {
+    TestDriver driver;
+    run_one_scan_loop();
+
+    uint16_t frames_before  = radio_link_frame_count();
+    uint16_t reports_before = radio_link_report_count();
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(2);
+    press_key(0, 0);
+    run_one_scan_loop();
+    release_key(0, 0);
+    run_one_scan_loop();
+    idle_for(RADIO_LINK_LATENCY_MS);
+
+    EXPECT_EQ(radio_link_frame_count() - frames_before, 1);
+    EXPECT_EQ(radio_link_report_count() - reports_before, 2);
+}
@@ -0,0 +1,125 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "task_executor.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+// The executor has no unregister; tasks registered by earlier tests keep
+// running in later ones. Each test gates its task bodies on this phase
+// marker so leftovers are harmless no-ops.
+static int              test_phase = 0;
+static int              count_every, count_slow;
+static std::vector<int> run_log;
+static bool             heavy_run_expensive;
+
+static void task_every_pass(void) {
+    if (test_phase == 1) count_every++;
+}
+static void task_every_10ms(void) {
+    if (test_phase == 1) count_slow++;
+}
+
+static void log_a(void) {
+    if (test_phase == 2) run_log.push_back('A');
+}
+static void log_b(void) {
+    if (test_phase == 2) run_log.push_back('B');
+}
+static void log_c(void) {
+    if (test_phase == 2) run_log.push_back('C');
+}
+
+static void heavy_task(void) {
+    if (test_phase == 3 && heavy_run_expensive) {
+        // fake timer: pretend the task body took 2ms (2000us)
+        advance_time(2);
+    }
+}
+
+TEST(TaskExecutor, RunsTasksAtTheirInterval) {
+    test_phase  = 1;
+    count_every = count_slow = 0;
+    set_time(10000);
+
+    ASSERT_GE(task_executor_register(task_every_pass, 0, 1, 0), 0);
+    ASSERT_GE(task_executor_register(task_every_10ms, 10, 1, 0), 0);
+
+    for (int i = 0; i < 25; i++) {
+        task_executor_run();
+        advance_time(1);
+    }
+
+    EXPECT_EQ(count_every, 25);
+    EXPECT_EQ(count_slow, 2);  // due at +10ms and +20ms
+}
+
+TEST(TaskExecutor, RunsInPriorityOrderStableWithinPriority) {
+    test_phase = 2;
+    run_log.clear();
+    set_time(20000);
+
+    task_executor_register(log_c, 0, 5, 0);
+    task_executor_register(log_a, 0, 1, 0);
+    task_executor_register(log_b, 0, 5, 0);
+
+    task_executor_run();
+
+    ASSERT_EQ(run_log.size(), 3u);
+    EXPECT_EQ(run_log[0], 'A');  // lowest priority value first
+    EXPECT_EQ(run_log[1], 'C');  // equal priorities keep registration order
+    EXPECT_EQ(run_log[2], 'B');
+}
+
+TEST(TaskExecutor, OverBudgetTaskIsThrottledAndRecovers) {
+    test_phase          = 3;
+    heavy_run_expensive = true;
+    set_time(30000);
+
+    int8_t id = task_executor_register(heavy_task, 5, 1, 1000);
+    ASSERT_GE(id, 0);
+
+    // first due run blows the 1000us budget and earns a backoff step
+    advance_time(5);
+    task_executor_run();
+
+    task_executor_stats_t stats;
+    ASSERT_TRUE(task_executor_get_stats(id, &stats));
+    EXPECT_EQ(stats.runs, 1u);
+    EXPECT_GT(stats.last_runtime_us, 1000u);
+    EXPECT_EQ(stats.throttle_shift, 1);
+
+    // while throttled the effective interval is 10ms, so the nominal 5ms
+    // slot is skipped (the heavy run itself already consumed 2ms)
+    heavy_run_expensive = false;
+    advance_time(5);
+    task_executor_run();
+    ASSERT_TRUE(task_executor_get_stats(id, &stats));
+    EXPECT_EQ(stats.runs, 1u);
+
+    // back under budget, the backoff decays and the task runs again
+    advance_time(5);
+    task_executor_run();
+    ASSERT_TRUE(task_executor_get_stats(id, &stats));
+    EXPECT_EQ(stats.runs, 2u);
+    EXPECT_EQ(stats.throttle_shift, 0);
+}
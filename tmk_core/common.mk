@@ -16,6 +16,21 @@ TMK_COMMON_SRC +=	\
 
 SHARED_EP_ENABLE = no
 MOUSE_SHARED_EP ?= yes
+
+ifeq ($(strip $(USB_ENDPOINT_CONSOLIDATE)), yes)
+    # Fold every report the host allows onto the shared endpoint and spend
+    # the freed endpoint memory double-banking the keyboard IN endpoint.
+    # The keyboard keeps its own endpoint for boot protocol compatibility.
+    MOUSE_SHARED_EP = yes
+    ifeq ($(strip $(DIGITIZER_ENABLE)), yes)
+        DIGITIZER_SHARED_EP = yes
+    endif
+    TMK_COMMON_DEFS += -DKEYBOARD_IN_DOUBLE_BANK
+else ifeq ($(strip $(KEYBOARD_IN_DOUBLE_BANK)), yes)
+    # Double banking alone, without consolidating the other interfaces
+    TMK_COMMON_DEFS += -DKEYBOARD_IN_DOUBLE_BANK
+endif
+
 ifeq ($(strip $(KEYBOARD_SHARED_EP)), yes)
     TMK_COMMON_DEFS += -DKEYBOARD_SHARED_EP
     SHARED_EP_ENABLE = yes
@@ -40,6 +55,20 @@ endif
 
 ifeq ($(strip $(RAW_ENABLE)), yes)
     TMK_COMMON_DEFS += -DRAW_ENABLE
+    ifeq ($(strip $(RAW_HID_DEFERRED)), yes)
+        TMK_COMMON_DEFS += -DRAW_HID_DEFERRED
+        TMK_COMMON_SRC += $(COMMON_DIR)/raw_hid_queue.c
+    endif
+endif
+
+ifeq ($(strip $(RADIO_LINK_ENABLE)), yes)
+    TMK_COMMON_DEFS += -DRADIO_LINK_ENABLE
+    TMK_COMMON_SRC += $(COMMON_DIR)/radio_link.c
+endif
+
+ifeq ($(strip $(SUSPEND_BUFFER_RECLAIM_ENABLE)), yes)
+    TMK_COMMON_DEFS += -DSUSPEND_BUFFER_RECLAIM
+    TMK_COMMON_SRC += $(COMMON_DIR)/suspend_buffers.c
 endif
 
 ifeq ($(strip $(CONSOLE_ENABLE)), yes)
@@ -77,6 +106,14 @@ ifeq ($(strip $(NO_SUSPEND_POWER_DOWN)), yes)
     TMK_COMMON_DEFS += -DNO_SUSPEND_POWER_DOWN
 endif
 
+ifeq ($(strip $(MATRIX_DMA_SAMPLING_ENABLE)), yes)
+    ifneq ($(PLATFORM),CHIBIOS)
+        $(error MATRIX_DMA_SAMPLING_ENABLE is only supported on ChibiOS)
+    endif
+    TMK_COMMON_SRC += $(PLATFORM_COMMON_DIR)/matrix_dma.c
+    TMK_COMMON_DEFS += -DMATRIX_DMA_SAMPLING_ENABLE
+endif
+
 ifeq ($(strip $(BLUETOOTH_ENABLE)), yes)
     TMK_COMMON_DEFS += -DBLUETOOTH_ENABLE
 	TMK_COMMON_DEFS += -DNO_USB_STARTUP_CHECK
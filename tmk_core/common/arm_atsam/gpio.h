@@ -69,3 +69,20 @@ typedef uint8_t pin_t;
 #define readPin(pin) ((PORT->Group[SAMD_PORT(pin)].IN.reg & SAMD_PIN_MASK(pin)) != 0)
 
 #define togglePin(pin) (PORT->Group[SAMD_PORT(pin)].OUTTGL.reg = SAMD_PIN_MASK(pin))
+
+/* Operation of GPIO by pre-resolved handle.
+ *
+ * A pin_fast_t caches the port group index and bit mask once, so hot loops
+ * skip the shift/mask decode on every access. Writes use the set/clear
+ * registers and are atomic. */
+
+typedef struct {
+    uint8_t  group;
+    uint32_t mask;
+} pin_fast_t;
+
+static inline pin_fast_t pinFastResolve(pin_t pin) { return (pin_fast_t){SAMD_PORT(pin), SAMD_PIN_MASK(pin)}; }
+
+#define readPinFast(handle) ((PORT->Group[(handle).group].IN.reg & (handle).mask) != 0)
+#define writePinFastHigh(handle) (PORT->Group[(handle).group].OUTSET.reg = (handle).mask)
+#define writePinFastLow(handle) (PORT->Group[(handle).group].OUTCLR.reg = (handle).mask)
@@ -41,9 +41,32 @@ typedef uint8_t port_data_t;
 
 #define readPort(port) PINx_ADDRESS(port)
 
+/* mask of a pin's bit within its port's data register */
+#define pinToBitMask(pin) ((port_data_t)_BV((pin)&0xF))
+
 #define setPortBitInput(port, bit) (DDRx_ADDRESS(port) &= ~_BV((bit)&0xF), PORTx_ADDRESS(port) &= ~_BV((bit)&0xF))
 #define setPortBitInputHigh(port, bit) (DDRx_ADDRESS(port) &= ~_BV((bit)&0xF), PORTx_ADDRESS(port) |= _BV((bit)&0xF))
 #define setPortBitOutput(port, bit) (DDRx_ADDRESS(port) |= _BV((bit)&0xF))
 
 #define writePortBitLow(port, bit) (PORTx_ADDRESS(port) &= ~_BV((bit)&0xF))
 #define writePortBitHigh(port, bit) (PORTx_ADDRESS(port) |= _BV((bit)&0xF))
+
+/* Operation of GPIO by pre-resolved handle.
+ *
+ * The pin macros above re-derive the SFR address and bit mask from the pin
+ * number on every access; with a runtime pin table (split right halves,
+ * loops over pin arrays) that arithmetic ends up in the hot path. A
+ * pin_fast_t stores the register addresses and mask once, so each access
+ * is a single indirect load or read-modify-write. */
+
+typedef struct {
+    volatile uint8_t *pin_reg;  /* PINx: input */
+    volatile uint8_t *port_reg; /* PORTx: output/pull-up */
+    uint8_t           mask;
+} pin_fast_t;
+
+static inline pin_fast_t pinFastResolve(pin_t pin) { return (pin_fast_t){&PINx_ADDRESS(pin), &PORTx_ADDRESS(pin), (uint8_t)_BV((pin)&0xF)}; }
+
+#define readPinFast(handle) ((bool)(*(handle).pin_reg & (handle).mask))
+#define writePinFastHigh(handle) (*(handle).port_reg |= (handle).mask)
+#define writePinFastLow(handle) (*(handle).port_reg &= ~(handle).mask)
@@ -8,6 +8,9 @@
 #include "timer.h"
 #include "led.h"
 #include "host.h"
+#ifdef SUSPEND_FAST_WAKEUP
+#    include "debug.h"
+#endif
 
 #ifdef PROTOCOL_LUFA
 #    include "lufa.h"
@@ -61,7 +64,18 @@ __attribute__((weak)) void suspend_power_down_user(void) {}
  */
 __attribute__((weak)) void suspend_power_down_kb(void) { suspend_power_down_user(); }
 
-#if !defined(NO_SUSPEND_POWER_DOWN) && defined(WDT_vect)
+#ifdef SUSPEND_FAST_WAKEUP
+/* timestamp of the keypress that satisfied the wakeup condition */
+static uint16_t suspend_wakeup_timestamp = 0;
+/* cosmetic re-init still owed to the main loop */
+static bool suspend_wakeup_pending = false;
+/* measured press-to-first-task latency of the last resume, in ms */
+static uint16_t suspend_wakeup_latency = 0;
+
+uint16_t suspend_last_wakeup_latency(void) { return suspend_wakeup_latency; }
+#endif
+
+#if !defined(NO_SUSPEND_POWER_DOWN) && defined(WDT_vect) && !(defined(SUSPEND_FAST_WAKEUP) && defined(MATRIX_INTERRUPT_SCAN))
 
 // clang-format off
 #define wdt_intr_enable(value) \
@@ -170,8 +184,15 @@ void suspend_power_down(void) {
     rgb_matrix_set_suspend_state(true);
 #    endif
 
+    // park subsystems whose buffers need not survive the sleep
+    suspend_buffers_release();
+
     // Enter sleep state if possible (ie, the MCU has a watchdog timeout interrupt)
-#    if defined(WDT_vect)
+#    if defined(SUSPEND_FAST_WAKEUP) && defined(MATRIX_INTERRUPT_SCAN)
+    // pin-change wake: the keypress itself wakes the MCU instead of the
+    // next 15ms watchdog tick, and the scan context stays warm
+    matrix_interrupt_sleep();
+#    elif defined(WDT_vect)
     power_down(WDTO_15MS);
 #    endif
 #endif
@@ -184,7 +205,12 @@ bool                       suspend_wakeup_condition(void) {
     matrix_scan();
     matrix_power_down();
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
-        if (matrix_get_row(r)) return true;
+        if (matrix_get_row(r)) {
+#ifdef SUSPEND_FAST_WAKEUP
+            suspend_wakeup_timestamp = timer_read();
+#endif
+            return true;
+        }
     }
     return false;
 }
@@ -209,30 +235,74 @@ void suspend_wakeup_init(void) {
     // clear keyboard state
     clear_keyboard();
 
+#ifdef SUSPEND_FAST_WAKEUP
+    // leave the cosmetic re-init to suspend_wakeup_task() so the wake
+    // keystroke is scanned and reported first
+    suspend_wakeup_pending = true;
+#else
     // Turn on backlight
-#ifdef BACKLIGHT_ENABLE
+#    ifdef BACKLIGHT_ENABLE
     backlight_init();
-#endif
+#    endif
 
     // Restore LED indicators
     led_set(host_keyboard_leds());
 
     // Wake up underglow
-#if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
+#    if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
     rgblight_wakeup();
-#endif
+#    endif
 
-#if defined(LED_MATRIX_ENABLE)
+#    if defined(LED_MATRIX_ENABLE)
     led_matrix_set_suspend_state(false);
-#endif
-#if defined(RGB_MATRIX_ENABLE)
+#    endif
+#    if defined(RGB_MATRIX_ENABLE)
     rgb_matrix_set_suspend_state(false);
+#    endif
+
+    // rebuild any buffers declared expendable across the sleep
+    suspend_buffers_restore();
 #endif
 
     suspend_wakeup_init_kb();
 }
 
-#if !defined(NO_SUSPEND_POWER_DOWN) && defined(WDT_vect)
+#ifdef SUSPEND_FAST_WAKEUP
+/** \brief deferred cosmetic re-init after wakeup
+ *
+ * Runs from keyboard_task() on the first pass after resume, once the wake
+ * keystroke has already been scanned and reported.
+ */
+void suspend_wakeup_task(void) {
+    if (!suspend_wakeup_pending) return;
+    suspend_wakeup_pending = false;
+
+    suspend_wakeup_latency = timer_elapsed(suspend_wakeup_timestamp);
+    dprintf("resume: %ums\n", suspend_wakeup_latency);
+
+#    ifdef BACKLIGHT_ENABLE
+    backlight_init();
+#    endif
+
+    led_set(host_keyboard_leds());
+
+#    if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
+    rgblight_wakeup();
+#    endif
+
+#    if defined(LED_MATRIX_ENABLE)
+    led_matrix_set_suspend_state(false);
+#    endif
+#    if defined(RGB_MATRIX_ENABLE)
+    rgb_matrix_set_suspend_state(false);
+#    endif
+
+    // rebuild any buffers declared expendable across the sleep
+    suspend_buffers_restore();
+}
+#endif
+
+#if !defined(NO_SUSPEND_POWER_DOWN) && defined(WDT_vect) && !(defined(SUSPEND_FAST_WAKEUP) && defined(MATRIX_INTERRUPT_SCAN))
 /* watchdog timeout */
 ISR(WDT_vect) {
     // compensate timer for sleep
@@ -621,7 +621,10 @@ uint16_t EEPROM_ReadDataWord(uint16_t Address) {
 
 /*****************************************************************************
  *  Wrap library in AVR style functions.
+ *  Not compiled when the pluggable EEPROM_DRIVER framework provides these
+ *  (the journal driver adapts EEPROM_* directly, see drivers/eeprom).
  *******************************************************************************/
+#ifndef EEPROM_DRIVER
 uint8_t eeprom_read_byte(const uint8_t *Address) { return EEPROM_ReadDataByte((const uintptr_t)Address); }
 
 void eeprom_write_byte(uint8_t *Address, uint8_t Value) { EEPROM_WriteDataByte((uintptr_t)Address, Value); }
@@ -722,5 +725,6 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         eeprom_write_byte(dest, *src);
     }
 }
+#endif  // EEPROM_DRIVER
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) { eeprom_write_block(buf, addr, len); }
@@ -41,6 +41,9 @@ typedef uint16_t port_data_t;
 
 #define readPort(pin) palReadPort(PAL_PORT(pin))
 
+/* mask of a pin's bit within its port's data register */
+#define pinToBitMask(pin) ((port_data_t)(1ul << PAL_PAD(pin)))
+
 #define setPortBitInput(pin, bit) palSetPadMode(PAL_PORT(pin), bit, PAL_MODE_INPUT)
 #define setPortBitInputHigh(pin, bit) palSetPadMode(PAL_PORT(pin), bit, PAL_MODE_INPUT_PULLUP)
 #define setPortBitInputLow(pin, bit) palSetPadMode(PAL_PORT(pin), bit, PAL_MODE_INPUT_PULLDOWN)
@@ -48,3 +51,20 @@ typedef uint16_t port_data_t;
 
 #define writePortBitLow(pin, bit) palClearLine(PAL_LINE(PAL_PORT(pin), bit))
 #define writePortBitHigh(pin, bit) palSetLine(PAL_LINE(PAL_PORT(pin), bit))
+
+/* Operation of GPIO by pre-resolved handle.
+ *
+ * A pin_fast_t caches the port base and bit mask once, so hot loops skip
+ * the per-access line decode inside the PAL macros. The writes go through
+ * palSetPort/palClearPort, which on STM32 hit BSRR/BRR and stay atomic. */
+
+typedef struct {
+    ioportid_t   port;
+    ioportmask_t mask;
+} pin_fast_t;
+
+static inline pin_fast_t pinFastResolve(pin_t pin) { return (pin_fast_t){PAL_PORT(pin), (ioportmask_t)(1ul << PAL_PAD(pin))}; }
+
+#define readPinFast(handle) ((bool)(palReadPort((handle).port) & (handle).mask))
+#define writePinFastHigh(handle) palSetPort((handle).port, (handle).mask)
+#define writePinFastLow(handle) palClearPort((handle).port, (handle).mask)
@@ -0,0 +1,119 @@
+/* Copyright 2021 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* DMA-driven sampling engine for direct-pin matrices.
+ *
+ * A general-purpose timer paces a circular DMA stream that copies the GPIO
+ * input data register into RAM in the background; matrix_read_cols_on_row()
+ * then decodes the most recent sample without touching the GPIO bus at all.
+ * This requires every direct pin to live on a single GPIO port.
+ *
+ * Configuration (config.h):
+ *   MATRIX_DMA_TIMER      GPT driver pacing the samples  (default GPTD6)
+ *   MATRIX_DMA_STREAM     DMA stream fed by that timer's update event
+ *   MATRIX_DMA_CHANNEL    DMA channel/request of the update event
+ *   MATRIX_DMA_SAMPLE_HZ  sample rate                    (default 8000)
+ */
+
+#include <hal.h>
+#include "matrix.h"
+#include "quantum.h"
+
+#ifndef DIRECT_PINS
+#    error "MATRIX_DMA_SAMPLING_ENABLE only supports DIRECT_PINS matrices"
+#endif
+
+#if !defined(STM32)
+#    error "MATRIX_DMA_SAMPLING_ENABLE is currently only implemented for STM32 targets"
+#endif
+
+#ifndef MATRIX_DMA_TIMER
+#    define MATRIX_DMA_TIMER GPTD6
+#endif
+
+#ifndef MATRIX_DMA_SAMPLE_HZ
+#    define MATRIX_DMA_SAMPLE_HZ 8000
+#endif
+
+#ifndef MATRIX_DMA_STREAM
+#    error "MATRIX_DMA_STREAM must name the DMA stream wired to MATRIX_DMA_TIMER's update event"
+#endif
+
+#ifndef MATRIX_DMA_CHANNEL
+#    define MATRIX_DMA_CHANNEL 0
+#endif
+
+// Two slots so the CPU can always read the completed one while the DMA is
+// filling the other.
+#define MATRIX_DMA_BUFFER_LEN 2
+
+static const pin_t dma_direct_pins[MATRIX_ROWS][MATRIX_COLS] = DIRECT_PINS;
+
+static volatile uint16_t          matrix_dma_samples[MATRIX_DMA_BUFFER_LEN];
+static const stm32_dma_stream_t *matrix_dma_stream;
+
+static const GPTConfig matrix_dma_gpt_config = {
+    .frequency = MATRIX_DMA_SAMPLE_HZ,
+    .callback  = NULL,
+};
+
+static uint16_t matrix_dma_latest_sample(void) {
+    // The slot the DMA is *not* currently writing holds the newest
+    // completed sample.
+    size_t remaining = dmaStreamGetTransactionSize(matrix_dma_stream);
+    size_t filling   = MATRIX_DMA_BUFFER_LEN - remaining;
+    return matrix_dma_samples[(filling + MATRIX_DMA_BUFFER_LEN - 1) % MATRIX_DMA_BUFFER_LEN];
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = dma_direct_pins[row][col];
+            if (pin != NO_PIN) {
+                setPinInputHigh(pin);
+            }
+        }
+    }
+
+    matrix_dma_stream = dmaStreamAlloc(MATRIX_DMA_STREAM, STM32_DMA_CR_PL(0), NULL, NULL);
+    osalDbgAssert(matrix_dma_stream != NULL, "matrix DMA stream already in use");
+
+    dmaStreamSetPeripheral(matrix_dma_stream, &(PAL_PORT(dma_direct_pins[0][0])->IDR));
+    dmaStreamSetMemory0(matrix_dma_stream, matrix_dma_samples);
+    dmaStreamSetTransactionSize(matrix_dma_stream, MATRIX_DMA_BUFFER_LEN);
+    dmaStreamSetMode(matrix_dma_stream, STM32_DMA_CR_CHSEL(MATRIX_DMA_CHANNEL) | STM32_DMA_CR_DIR_P2M | STM32_DMA_CR_PSIZE_HWORD | STM32_DMA_CR_MSIZE_HWORD | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC);
+    dmaStreamEnable(matrix_dma_stream);
+
+    // Pace the stream from the timer's update event.
+    gptStart(&MATRIX_DMA_TIMER, &matrix_dma_gpt_config);
+    (&MATRIX_DMA_TIMER)->tim->DIER |= STM32_TIM_DIER_UDE;
+    gptStartContinuous(&MATRIX_DMA_TIMER, 1);
+}
+
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    uint16_t     port_value        = matrix_dma_latest_sample();
+    matrix_row_t current_row_value = 0;
+
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        pin_t pin = dma_direct_pins[current_row][col_index];
+        if (pin != NO_PIN && !(port_value & (1u << PAL_PAD(pin)))) {
+            current_row_value |= row_shifter;
+        }
+    }
+
+    current_matrix[current_row] = current_row_value;
+}
@@ -11,6 +11,10 @@
 #include "suspend.h"
 #include "led.h"
 #include "wait.h"
+#ifdef SUSPEND_FAST_WAKEUP
+#    include "timer.h"
+#    include "debug.h"
+#endif
 
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
@@ -94,6 +98,9 @@ void suspend_power_down(void) {
     stop_all_notes();
 #endif /* AUDIO_ENABLE */
 
+    // park subsystems whose buffers need not survive the sleep
+    suspend_buffers_release();
+
     suspend_power_down_kb();
     // on AVR, this enables the watchdog for 15ms (max), and goes to
     // SLEEP_MODE_PWR_DOWN
@@ -107,12 +114,28 @@ void suspend_power_down(void) {
  */
 __attribute__((weak)) void matrix_power_up(void) {}
 __attribute__((weak)) void matrix_power_down(void) {}
-bool                       suspend_wakeup_condition(void) {
+#ifdef SUSPEND_FAST_WAKEUP
+/* timestamp of the keypress that satisfied the wakeup condition */
+static uint16_t suspend_wakeup_timestamp = 0;
+/* cosmetic re-init still owed to the main loop */
+static bool suspend_wakeup_pending = false;
+/* measured press-to-first-task latency of the last resume, in ms */
+static uint16_t suspend_wakeup_latency = 0;
+
+uint16_t suspend_last_wakeup_latency(void) { return suspend_wakeup_latency; }
+#endif
+
+bool suspend_wakeup_condition(void) {
     matrix_power_up();
     matrix_scan();
     matrix_power_down();
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
-        if (matrix_get_row(r)) return true;
+        if (matrix_get_row(r)) {
+#ifdef SUSPEND_FAST_WAKEUP
+            suspend_wakeup_timestamp = timer_read();
+#endif
+            return true;
+        }
     }
     return false;
 }
@@ -151,19 +174,64 @@ void suspend_wakeup_init(void) {
     host_system_send(0);
     host_consumer_send(0);
 #endif /* EXTRAKEY_ENABLE */
-#ifdef BACKLIGHT_ENABLE
+#ifdef SUSPEND_FAST_WAKEUP
+    // leave the cosmetic re-init to suspend_wakeup_task() -- this function
+    // may run from ISR context, and deferring it also lets the wake
+    // keystroke be scanned and reported first
+    suspend_wakeup_pending = true;
+#else
+#    ifdef BACKLIGHT_ENABLE
     backlight_init();
-#endif /* BACKLIGHT_ENABLE */
+#    endif /* BACKLIGHT_ENABLE */
     led_set(host_keyboard_leds());
-#if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
+#    if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
     rgblight_wakeup();
-#endif
+#    endif
 
-#if defined(LED_MATRIX_ENABLE)
+#    if defined(LED_MATRIX_ENABLE)
     led_matrix_set_suspend_state(false);
-#endif
-#if defined(RGB_MATRIX_ENABLE)
+#    endif
+#    if defined(RGB_MATRIX_ENABLE)
     rgb_matrix_set_suspend_state(false);
+#    endif
+
+    // rebuild any buffers declared expendable across the sleep
+    suspend_buffers_restore();
 #endif
     suspend_wakeup_init_kb();
 }
+
+#ifdef SUSPEND_FAST_WAKEUP
+/** \brief deferred cosmetic re-init after wakeup
+ *
+ * Runs from keyboard_task() on the first pass after resume, once the wake
+ * keystroke has already been scanned and reported.
+ */
+void suspend_wakeup_task(void) {
+    if (!suspend_wakeup_pending) return;
+    suspend_wakeup_pending = false;
+
+    suspend_wakeup_latency = timer_elapsed(suspend_wakeup_timestamp);
+    dprintf("resume: %ums\n", suspend_wakeup_latency);
+
+#    ifdef BACKLIGHT_ENABLE
+    backlight_init();
+#    endif
+
+    led_set(host_keyboard_leds());
+
+#    if defined(RGBLIGHT_SLEEP) && defined(RGBLIGHT_ENABLE)
+    rgblight_wakeup();
+#    endif
+
+#    if defined(LED_MATRIX_ENABLE)
+    led_matrix_set_suspend_state(false);
+#    endif
+#    if defined(RGB_MATRIX_ENABLE)
+    rgb_matrix_set_suspend_state(false);
+#    endif
+
+    // rebuild any buffers declared expendable across the sleep
+    suspend_buffers_restore();
+}
+#endif
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 //#include <avr/interrupt.h>
 #include "keyboard.h"
 #include "keycode.h"
@@ -23,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "debug.h"
 #include "digitizer.h"
+#include "trace_probe.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -32,8 +34,19 @@ extern keymap_config_t keymap_config;
 static host_driver_t *driver;
 static uint16_t       last_system_report   = 0;
 static uint16_t       last_consumer_report = 0;
+#ifdef HID_REPORT_DIFF
+static report_keyboard_t last_keyboard_report;
+static report_mouse_t    last_mouse_report;
+#endif
 
-void host_set_driver(host_driver_t *d) { driver = d; }
+void host_set_driver(host_driver_t *d) {
+    driver = d;
+#ifdef HID_REPORT_DIFF
+    /* a new driver (or a resumed host) has no idea what we last sent */
+    memset(&last_keyboard_report, 0, sizeof(last_keyboard_report));
+    memset(&last_mouse_report, 0, sizeof(last_mouse_report));
+#endif
+}
 
 host_driver_t *host_get_driver(void) { return driver; }
 
@@ -69,7 +82,15 @@ void host_keyboard_send(report_keyboard_t *report) {
         report->report_id = REPORT_ID_KEYBOARD;
 #endif
     }
+#ifdef HID_REPORT_DIFF
+    /* drop exact duplicates; mod-then-key sequences that resolve to the same
+     * wire image within one frame end up as a single transmission */
+    if (memcmp(report, &last_keyboard_report, sizeof(report_keyboard_t)) == 0) return;
+    last_keyboard_report = *report;
+#endif
+    TRACE_USB_SUBMIT_START();
     (*driver->send_keyboard)(report);
+    TRACE_USB_SUBMIT_END();
 
     if (debug_keyboard) {
         dprint("keyboard_report: ");
@@ -84,6 +105,12 @@ void host_mouse_send(report_mouse_t *report) {
     if (!driver) return;
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
+#endif
+#ifdef HID_REPORT_DIFF
+    /* x/y/v/h are relative deltas, so any motion must go out; only a report
+     * with no motion and unchanged buttons carries no new information */
+    if (report->x == 0 && report->y == 0 && report->v == 0 && report->h == 0 && report->buttons == last_mouse_report.buttons) return;
+    last_mouse_report = *report;
 #endif
     (*driver->send_mouse)(report);
 }
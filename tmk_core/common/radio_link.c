@@ -0,0 +1,179 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "radio_link.h"
+#include "host.h"
+#include "report.h"
+#include "timer.h"
+
+enum radio_link_entry_type {
+    RADIO_LINK_KEYBOARD,
+    RADIO_LINK_MOUSE,
+    RADIO_LINK_SYSTEM,
+    RADIO_LINK_CONSUMER,
+};
+
+typedef struct {
+    uint8_t type;
+    union {
+        report_keyboard_t keyboard;
+        report_mouse_t    mouse;
+        uint16_t          extra; /* system/consumer usage */
+    } u;
+} radio_link_entry_t;
+
+/* a single ordered queue across all report types, so a mouse click between
+ * two key events is replayed to the host in the order it happened */
+static radio_link_entry_t queue[RADIO_LINK_QUEUE_SIZE];
+static uint8_t            queue_count = 0;
+
+static host_driver_t *underlying = NULL;
+static uint16_t       window_start;
+static bool           window_open  = false;
+static uint8_t        latency_ms   = RADIO_LINK_LATENCY_MS;
+static uint16_t       frame_count  = 0;
+static uint16_t       report_count = 0;
+
+static void flush_now(void) {
+    if (!queue_count) {
+        return;
+    }
+    window_open = false;
+    if (!underlying) {
+        queue_count = 0;
+        return;
+    }
+    for (uint8_t i = 0; i < queue_count; i++) {
+        radio_link_entry_t *e = &queue[i];
+        switch (e->type) {
+            case RADIO_LINK_KEYBOARD:
+                (*underlying->send_keyboard)(&e->u.keyboard);
+                break;
+            case RADIO_LINK_MOUSE:
+                (*underlying->send_mouse)(&e->u.mouse);
+                break;
+            case RADIO_LINK_SYSTEM:
+                (*underlying->send_system)(e->u.extra);
+                break;
+            case RADIO_LINK_CONSUMER:
+                (*underlying->send_consumer)(e->u.extra);
+                break;
+        }
+        report_count++;
+    }
+    frame_count++;
+    queue_count = 0;
+}
+
+static radio_link_entry_t *enqueue(uint8_t type) {
+    /* a full queue wakes the radio early rather than dropping an edge */
+    if (queue_count == RADIO_LINK_QUEUE_SIZE) {
+        flush_now();
+    }
+    if (!window_open) {
+        window_start = timer_read();
+        window_open  = true;
+    }
+    radio_link_entry_t *e = &queue[queue_count++];
+    e->type               = type;
+    return e;
+}
+
+static int8_t clamp_delta(int16_t v) { return v > 127 ? 127 : (v < -127 ? -127 : (int8_t)v); }
+
+static void radio_send_keyboard(report_keyboard_t *report) {
+    if (!latency_ms) {
+        flush_now();
+        if (underlying) (*underlying->send_keyboard)(report);
+        return;
+    }
+    enqueue(RADIO_LINK_KEYBOARD)->u.keyboard = *report;
+}
+
+static void radio_send_mouse(report_mouse_t *report) {
+    if (!latency_ms) {
+        flush_now();
+        if (underlying) (*underlying->send_mouse)(report);
+        return;
+    }
+    /* deltas are relative: merge into the newest pending mouse report as
+     * long as no button edge separates them */
+    if (queue_count) {
+        radio_link_entry_t *tail = &queue[queue_count - 1];
+        if (tail->type == RADIO_LINK_MOUSE && tail->u.mouse.buttons == report->buttons) {
+            tail->u.mouse.x = clamp_delta((int16_t)tail->u.mouse.x + report->x);
+            tail->u.mouse.y = clamp_delta((int16_t)tail->u.mouse.y + report->y);
+            tail->u.mouse.v = clamp_delta((int16_t)tail->u.mouse.v + report->v);
+            tail->u.mouse.h = clamp_delta((int16_t)tail->u.mouse.h + report->h);
+            return;
+        }
+    }
+    enqueue(RADIO_LINK_MOUSE)->u.mouse = *report;
+}
+
+static void radio_send_system(uint16_t usage) {
+    if (!latency_ms) {
+        flush_now();
+        if (underlying) (*underlying->send_system)(usage);
+        return;
+    }
+    enqueue(RADIO_LINK_SYSTEM)->u.extra = usage;
+}
+
+static void radio_send_consumer(uint16_t usage) {
+    if (!latency_ms) {
+        flush_now();
+        if (underlying) (*underlying->send_consumer)(usage);
+        return;
+    }
+    enqueue(RADIO_LINK_CONSUMER)->u.extra = usage;
+}
+
+/* LED state is polled from the transport, not transmitted; pass through */
+static uint8_t radio_keyboard_leds(void) { return underlying ? (*underlying->keyboard_leds)() : 0; }
+
+static host_driver_t batching_driver = {radio_keyboard_leds, radio_send_keyboard, radio_send_mouse, radio_send_system, radio_send_consumer};
+
+void radio_link_task(void) {
+    /* wrap whatever driver the protocol installed; done lazily so this
+     * works regardless of when the transport comes up (or is replaced,
+     * e.g. a USB/BLE switch re-running host_set_driver()) */
+    host_driver_t *active = host_get_driver();
+    if (active && active != &batching_driver) {
+        underlying = active;
+        host_set_driver(&batching_driver);
+    }
+
+    if (window_open && timer_elapsed(window_start) >= latency_ms) {
+        flush_now();
+    }
+}
+
+void radio_link_flush(void) { flush_now(); }
+
+void radio_link_set_latency(uint8_t ms) {
+    latency_ms = ms;
+    if (!ms) {
+        flush_now();
+    }
+}
+
+uint8_t radio_link_get_latency(void) { return latency_ms; }
+
+uint16_t radio_link_frame_count(void) { return frame_count; }
+
+uint16_t radio_link_report_count(void) { return report_count; }
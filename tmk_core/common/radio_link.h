@@ -0,0 +1,56 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Batching link layer for radio transports (RADIO_LINK_ENABLE = yes)
+ *
+ * Wraps the active host driver and coalesces HID reports into frames:
+ * reports produced within RADIO_LINK_LATENCY_MS of the first pending one
+ * are held and transmitted back to back in a single flush, so a radio
+ * transport pays for one wakeup per frame instead of one per event.
+ * Consecutive mouse reports with unchanged buttons are merged by summing
+ * their deltas; everything else is queued in arrival order, so no report
+ * edge (press/release, consumer usage on/off) is ever lost to
+ * coalescing. The latency dial trades responsiveness against radio-on
+ * time and can be changed at runtime; 0 restores per-event transmission.
+ */
+
+#ifndef RADIO_LINK_LATENCY_MS
+#    define RADIO_LINK_LATENCY_MS 15
+#endif
+
+#ifndef RADIO_LINK_QUEUE_SIZE
+#    define RADIO_LINK_QUEUE_SIZE 8
+#endif
+
+/* wraps the current host driver on first call, then flushes due frames;
+ * called once per keyboard_task() pass */
+void radio_link_task(void);
+
+/* transmit everything pending now, regardless of the latency window */
+void radio_link_flush(void);
+
+/* the latency/power dial, in ms; 0 = transmit every report immediately */
+void    radio_link_set_latency(uint8_t ms);
+uint8_t radio_link_get_latency(void);
+
+/* frames transmitted and reports carried, for measuring the batching ratio */
+uint16_t radio_link_frame_count(void);
+uint16_t radio_link_report_count(void);
@@ -1,5 +1,19 @@
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
+
 void raw_hid_receive(uint8_t *data, uint8_t length);
 
 void raw_hid_send(uint8_t *data, uint8_t length);
+
+#ifdef RAW_HID_DEFERRED
+/* called by the protocol layer to queue an inbound packet for dispatch */
+void raw_hid_queue_receive(uint8_t *data, uint8_t length);
+
+/* queue an outbound report; returns false when the queue is full */
+bool raw_hid_send_deferred(uint8_t *data, uint8_t length);
+
+/* dispatch queued commands and flush queued replies; runs in keyboard_task() */
+void raw_hid_queue_task(void);
+#endif
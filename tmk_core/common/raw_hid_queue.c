@@ -0,0 +1,91 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Deferred raw HID dispatch (RAW_HID_DEFERRED).
+ *
+ * The protocol layer queues inbound packets here instead of running
+ * raw_hid_receive() in the USB receive path, and keyboard_task() dispatches
+ * one command per pass, so long-running handlers (EEPROM dumps, bulk keymap
+ * transfers) no longer stall USB servicing.  Handlers may still reply inline
+ * with raw_hid_send(); code that produces reports outside a handler (scan
+ * statistics, link telemetry) queues them with raw_hid_send_deferred() and
+ * they are flushed one report per pass.
+ *
+ * All queue accesses happen at thread level -- the USB polling task and
+ * keyboard_task() run on the same thread on every supported protocol -- so
+ * no locking is required.
+ */
+
+#include <string.h>
+#include "raw_hid.h"
+
+/* must match RAW_EPSIZE of the protocol in use */
+#ifndef RAW_HID_REPORT_SIZE
+#    define RAW_HID_REPORT_SIZE 32
+#endif
+/* inbound commands waiting for dispatch */
+#ifndef RAW_HID_RX_QUEUE_DEPTH
+#    define RAW_HID_RX_QUEUE_DEPTH 2
+#endif
+/* outbound reports waiting for the endpoint */
+#ifndef RAW_HID_TX_QUEUE_DEPTH
+#    define RAW_HID_TX_QUEUE_DEPTH 4
+#endif
+
+static uint8_t rx_queue[RAW_HID_RX_QUEUE_DEPTH][RAW_HID_REPORT_SIZE];
+static uint8_t rx_head = 0;
+static uint8_t rx_tail = 0;
+
+static uint8_t tx_queue[RAW_HID_TX_QUEUE_DEPTH][RAW_HID_REPORT_SIZE];
+static uint8_t tx_head = 0;
+static uint8_t tx_tail = 0;
+
+void raw_hid_queue_receive(uint8_t *data, uint8_t length) {
+    if (length > RAW_HID_REPORT_SIZE) return;
+    uint8_t next = (rx_tail + 1) % RAW_HID_RX_QUEUE_DEPTH;
+    if (next == rx_head) {
+        // queue full: drop the packet; raw HID protocols are host-driven
+        // and the host retries unanswered commands
+        return;
+    }
+    memcpy(rx_queue[rx_tail], data, length);
+    rx_tail = next;
+}
+
+bool raw_hid_send_deferred(uint8_t *data, uint8_t length) {
+    if (length != RAW_HID_REPORT_SIZE) return false;
+    uint8_t next = (tx_tail + 1) % RAW_HID_TX_QUEUE_DEPTH;
+    if (next == tx_head) return false;
+    memcpy(tx_queue[tx_tail], data, length);
+    tx_tail = next;
+    return true;
+}
+
+void raw_hid_queue_task(void) {
+    // dispatch one inbound command per pass; the handler gets a mutable
+    // buffer and may reply inline with raw_hid_send(), exactly as when
+    // called from the USB receive path
+    if (rx_head != rx_tail) {
+        raw_hid_receive(rx_queue[rx_head], RAW_HID_REPORT_SIZE);
+        rx_head = (rx_head + 1) % RAW_HID_RX_QUEUE_DEPTH;
+    }
+
+    // flush one queued reply per pass to pace the endpoint
+    if (tx_head != tx_tail) {
+        raw_hid_send(tx_queue[tx_head], RAW_HID_REPORT_SIZE);
+        tx_head = (tx_head + 1) % RAW_HID_TX_QUEUE_DEPTH;
+    }
+}
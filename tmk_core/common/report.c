@@ -31,6 +31,17 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+#ifdef NKRO_ENABLE
+/* word-wide load of the NKRO bitset; nkro.bits sits behind the report ID
+ * byte, so it carries no alignment guarantee -- memcpy lets the compiler
+ * emit whatever unaligned access the target supports */
+static inline uint32_t nkro_load_word(const uint8_t* p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+#endif
+
 /** \brief has_anykey
  *
  * FIXME: Needs doc
@@ -43,6 +54,18 @@ uint8_t has_anykey(report_keyboard_t* keyboard_report) {
     if (keyboard_protocol && keymap_config.nkro) {
         p  = keyboard_report->nkro.bits;
         lp = sizeof(keyboard_report->nkro.bits);
+        /* the bitset is mostly zero; scan it a word at a time and only count
+         * bytes inside words that have bits set, leaving the tail (and the
+         * 6KRO key array) to the byte loop below */
+        while (lp >= sizeof(uint32_t)) {
+            uint32_t w = nkro_load_word(p);
+            while (w) {
+                if ((uint8_t)w) cnt++;
+                w >>= 8;
+            }
+            p += sizeof(uint32_t);
+            lp -= sizeof(uint32_t);
+        }
     }
 #endif
     while (lp--) {
@@ -59,6 +82,9 @@ uint8_t get_first_key(report_keyboard_t* keyboard_report) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         uint8_t i = 0;
+        /* skip empty words, then locate the first set byte within the word */
+        for (; i + sizeof(uint32_t) <= KEYBOARD_REPORT_BITS && !nkro_load_word(&keyboard_report->nkro.bits[i]); i += sizeof(uint32_t))
+            ;
         for (; i < KEYBOARD_REPORT_BITS && !keyboard_report->nkro.bits[i]; i++)
             ;
         return i << 3 | biton(keyboard_report->nkro.bits[i]);
@@ -13,6 +13,43 @@ void suspend_wakeup_init_kb(void);
 void suspend_power_down_user(void);
 void suspend_power_down_kb(void);
 
+#ifdef SUSPEND_BUFFER_RECLAIM
+/* Marks a buffer whose contents may be lost while suspended: deep-sleep
+ * keyboard code can place this section in a non-retained SRAM bank (or
+ * simply not preserve it across STOP mode), because every participating
+ * subsystem rebuilds its buffer in suspend_buffers_restore(). On AVR the
+ * section aliases .noinit; elsewhere the keyboard's linker script decides
+ * where .suspend_expendable lives. */
+#    ifndef SUSPEND_EXPENDABLE_BSS
+#        if defined(__AVR__)
+#            define SUSPEND_EXPENDABLE_BSS __attribute__((section(".noinit")))
+#        else
+#            define SUSPEND_EXPENDABLE_BSS __attribute__((section(".suspend_expendable")))
+#        endif
+#    endif
+
+/* called by the platform suspend code around the suspend loop */
+void suspend_buffers_release(void);
+void suspend_buffers_restore(void);
+
+/* keyboard/user hooks for their own expendable buffers */
+void suspend_buffers_release_user(void);
+void suspend_buffers_release_kb(void);
+void suspend_buffers_restore_user(void);
+void suspend_buffers_restore_kb(void);
+#else
+#    define SUSPEND_EXPENDABLE_BSS
+#    define suspend_buffers_release()
+#    define suspend_buffers_restore()
+#endif
+
+#ifdef SUSPEND_FAST_WAKEUP
+/* deferred cosmetic re-init; runs from keyboard_task() after resume */
+void suspend_wakeup_task(void);
+/* press-to-first-task latency of the last resume, in ms */
+uint16_t suspend_last_wakeup_latency(void);
+#endif
+
 #ifndef USB_SUSPEND_WAKEUP_DELAY
 #    define USB_SUSPEND_WAKEUP_DELAY 0
 #endif
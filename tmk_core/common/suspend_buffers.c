@@ -0,0 +1,65 @@
+/* Copyright 2021
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Expendable-buffer suspend protocol (SUSPEND_BUFFER_RECLAIM = yes)
+ *
+ * Static buffers can't be freed on a microcontroller, but deep sleep
+ * modes on several MCU families can retain only part of SRAM. This
+ * module defines the contract that makes that safe: buffers tagged
+ * SUSPEND_EXPENDABLE_BSS need not survive suspend, because
+ * suspend_buffers_release() parks their subsystems before sleep and
+ * suspend_buffers_restore() fully reinitializes them on wake. A
+ * keyboard's deep-sleep implementation (in suspend_power_down_kb())
+ * can then configure STOP mode with SRAM retention for everything
+ * outside the tagged section. The _kb/_user hooks let keyboards join
+ * their own buffers into the protocol.
+ */
+
+#include "suspend.h"
+
+#ifdef OLED_DRIVER_ENABLE
+#    include "oled_driver.h"
+extern oled_rotation_t oled_rotation; /* rotation chosen at the original init */
+#endif
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif
+
+__attribute__((weak)) void suspend_buffers_release_user(void) {}
+__attribute__((weak)) void suspend_buffers_release_kb(void) { suspend_buffers_release_user(); }
+__attribute__((weak)) void suspend_buffers_restore_user(void) {}
+__attribute__((weak)) void suspend_buffers_restore_kb(void) { suspend_buffers_restore_user(); }
+
+void suspend_buffers_release(void) {
+#ifdef OLED_DRIVER_ENABLE
+    /* panel off; from here the framebuffer contents are expendable */
+    oled_off();
+#endif
+    suspend_buffers_release_kb();
+}
+
+void suspend_buffers_restore(void) {
+#ifdef OLED_DRIVER_ENABLE
+    /* full re-init: reprograms the controller and clears the buffer */
+    oled_init(oled_rotation);
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    /* driver re-init rewrites control registers; effects repaint every
+     * LED on the next frame, so no framebuffer contents are needed */
+    rgb_matrix_init();
+#endif
+    suspend_buffers_restore_kb();
+}
@@ -5,3 +5,7 @@ void virtser_recv(const uint8_t ch);
 
 /* Call this to send a character over the Virtual Serial Device */
 void virtser_send(const uint8_t byte);
+
+/* Call this to send a whole buffer over the Virtual Serial Device in a
+ * single transfer */
+void virtser_send_buf(const uint8_t *data, uint8_t length);
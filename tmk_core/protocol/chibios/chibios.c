@@ -85,6 +85,43 @@ void console_task(void);
 void midi_ep_task(void);
 #endif
 
+#ifdef COSMETICS_THREAD
+/* Split-thread mode: the main thread keeps the input path (matrix scan,
+ * action processing, mice) at raised priority, and lighting/display work
+ * runs on this lower-priority thread, so a long RGB/OLED frame can no
+ * longer stretch the scan interval. Thread priorities and the working
+ * area size are overridable from config.h. */
+#    ifndef COSMETICS_THREAD_PRIORITY
+#        define COSMETICS_THREAD_PRIORITY (NORMALPRIO - 1)
+#    endif
+#    ifndef SCAN_THREAD_PRIORITY
+#        define SCAN_THREAD_PRIORITY (NORMALPRIO + 1)
+#    endif
+#    ifndef COSMETICS_THREAD_WA_SIZE
+#        define COSMETICS_THREAD_WA_SIZE 2048
+#    endif
+
+/* Serializes cosmetics passes against key-event processing. ChibiOS
+ * mutexes use priority inheritance, so the scan thread is never blocked
+ * longer than the remainder of one cosmetics pass. */
+static MUTEX_DECL(cosmetics_mutex);
+void keyboard_cosmetics_lock(void) { chMtxLock(&cosmetics_mutex); }
+void keyboard_cosmetics_unlock(void) { chMtxUnlock(&cosmetics_mutex); }
+
+static THD_WORKING_AREA(waCosmeticsThread, COSMETICS_THREAD_WA_SIZE);
+static THD_FUNCTION(CosmeticsThread, arg) {
+    (void)arg;
+    chRegSetThreadName("cosmetics");
+    while (true) {
+        keyboard_cosmetics_task();
+        /* frame pacing is handled inside the subsystems themselves; this
+         * sleep only bounds the wakeup rate, and with tickless mode active
+         * it costs a single timer alarm rather than a periodic tick */
+        chThdSleepMilliseconds(1);
+    }
+}
+#endif
+
 /* TESTING
  * Amber LED blinker thread, times are in milliseconds.
  */
@@ -164,6 +201,14 @@ void protocol_init(void) {
 
     host_driver_t *driver = NULL;
 
+#ifdef KEYBOARD_INIT_DURING_USB_STARTUP
+    /* Bring the keyboard up while the host is still enumerating: bootmagic's
+     * debounce-spaced matrix scans and split handedness detection are
+     * USB-independent, so they overlap the enumeration wait below instead of
+     * adding to it. */
+    keyboard_init();
+#endif
+
     /* Wait until the USB or serial link is active */
     while (true) {
 #if defined(WAIT_FOR_USB) || defined(SERIAL_LINK_ENABLE)
@@ -195,13 +240,22 @@ void protocol_init(void) {
     print("USB configured.\n");
 
     /* init TMK modules */
+#ifndef KEYBOARD_INIT_DURING_USB_STARTUP
     keyboard_init();
+#endif
     host_set_driver(driver);
 
 #ifdef SLEEP_LED_ENABLE
     sleep_led_init();
 #endif
 
+#ifdef COSMETICS_THREAD
+    /* started only after keyboard_init() so every lighting/display
+     * subsystem the thread touches is already initialized */
+    chThdSetPriority(SCAN_THREAD_PRIORITY);
+    chThdCreateStatic(waCosmeticsThread, sizeof(waCosmeticsThread), COSMETICS_THREAD_PRIORITY, CosmeticsThread, NULL);
+#endif
+
     print("Keyboard start.\n");
 }
 
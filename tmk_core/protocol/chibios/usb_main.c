@@ -52,6 +52,10 @@ extern keymap_config_t keymap_config;
 #    include "joystick.h"
 #endif
 
+#ifdef LATENCY_TRACE
+#    include "latency_trace.h"
+#endif
+
 /* ---------------------------------------------------------
  *       Global interface variables and declarations
  * ---------------------------------------------------------
@@ -72,7 +76,69 @@ volatile uint16_t      keyboard_idle_count                           = 0;
 static virtual_timer_t keyboard_idle_timer;
 static void            keyboard_idle_timer_cb(void *arg);
 
+#ifdef USB_REPORT_ASYNC
+/* Two driver-owned report slots with a claim/publish protocol between
+ * keyboard_task() and the USB ISR: send_keyboard() claims whichever slot the
+ * endpoint hardware cannot be reading, copies the report into it exactly once,
+ * and publishes it. The transmit - immediate when the endpoint is free, or
+ * from the IN-complete callback when it is busy - goes straight out of the
+ * published slot, so the endpoint never reads caller-owned memory and a
+ * deposited report is not copied a second time on drain. A deposit that is
+ * still waiting when the next report arrives is overwritten in place;
+ * keyboard reports carry absolute state, so collapsing to the newest one
+ * loses nothing. GET_REPORT and the idle-resend timer read the last published
+ * slot through the keyboard_report_sent alias below. */
+static report_keyboard_t keyboard_report_slots[2];
+static volatile uint8_t  keyboard_report_published     = 0;  /* slot holding the newest complete report */
+static volatile int8_t   keyboard_report_in_flight     = -1; /* slot the endpoint is reading, -1 = none */
+static volatile bool     keyboard_report_pending_valid = false;
+#    define keyboard_report_sent (keyboard_report_slots[keyboard_report_published])
+#else
 report_keyboard_t keyboard_report_sent = {{0}};
+#endif
+
+#ifdef USB_REPORT_ASYNC
+
+/* Start transmitting `report` on the endpoint the current protocol uses;
+ * must be called with the system locked */
+static void keyboard_report_transmit_I(USBDriver *usbp, report_keyboard_t *report) {
+#    ifdef NKRO_ENABLE
+    if (keymap_config.nkro && keyboard_protocol) {
+        usbStartTransmitI(usbp, SHARED_IN_EPNUM, (uint8_t *)report, sizeof(struct nkro_report));
+        return;
+    }
+#    endif
+    if (keyboard_protocol) {
+        usbStartTransmitI(usbp, KEYBOARD_IN_EPNUM, (uint8_t *)report, KEYBOARD_REPORT_SIZE);
+    } else { /* boot protocol */
+        usbStartTransmitI(usbp, KEYBOARD_IN_EPNUM, &report->mods, 8);
+    }
+}
+
+/* Drain the published slot if its target endpoint is free; called from the IN
+ * callbacks with the system locked */
+static void keyboard_report_drain_I(USBDriver *usbp) {
+#    ifdef NKRO_ENABLE
+    usbep_t target = (keymap_config.nkro && keyboard_protocol) ? SHARED_IN_EPNUM : KEYBOARD_IN_EPNUM;
+#    else
+    usbep_t target = KEYBOARD_IN_EPNUM;
+#    endif
+    if (usbGetTransmitStatusI(usbp, target)) {
+        return;
+    }
+    keyboard_report_in_flight = -1;
+    if (!keyboard_report_pending_valid) {
+        return;
+    }
+    keyboard_report_pending_valid = false;
+    keyboard_report_in_flight     = (int8_t)keyboard_report_published;
+    keyboard_report_transmit_I(usbp, &keyboard_report_slots[keyboard_report_published]);
+#    ifdef LATENCY_TRACE
+    latency_trace_report();
+#    endif
+}
+#endif /* USB_REPORT_ASYNC */
+
 #ifdef MOUSE_ENABLE
 report_mouse_t mouse_report_blank = {0};
 #endif /* MOUSE_ENABLE */
@@ -748,9 +814,15 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
 /* keyboard IN callback hander (a kbd report has made it IN) */
 #ifndef KEYBOARD_SHARED_EP
 void kbd_in_cb(USBDriver *usbp, usbep_t ep) {
+    (void)ep;
+#    ifdef USB_REPORT_ASYNC
+    osalSysLockFromISR();
+    keyboard_report_drain_I(usbp);
+    osalSysUnlockFromISR();
+#    else
     /* STUB */
     (void)usbp;
-    (void)ep;
+#    endif
 }
 #endif
 
@@ -781,6 +853,9 @@ static void keyboard_idle_timer_cb(void *arg) {
         /* TODO: are we sure we want the KBD_ENDPOINT? */
         if (!usbGetTransmitStatusI(usbp, KEYBOARD_IN_EPNUM)) {
             usbStartTransmitI(usbp, KEYBOARD_IN_EPNUM, (uint8_t *)&keyboard_report_sent, KEYBOARD_EPSIZE);
+#ifdef USB_REPORT_ASYNC
+            keyboard_report_in_flight = (int8_t)keyboard_report_published;
+#endif
         }
         /* rearm the timer */
         chVTSetI(&keyboard_idle_timer, 4 * TIME_MS2I(keyboard_idle), keyboard_idle_timer_cb, (void *)usbp);
@@ -802,6 +877,26 @@ void send_keyboard(report_keyboard_t *report) {
         goto unlock;
     }
 
+#ifdef USB_REPORT_ASYNC
+    /* Claim the slot the endpoint hardware cannot be reading: a report still
+     * waiting to drain is superseded in place, otherwise take the slot the
+     * endpoint is not transmitting from. This is the only copy the report
+     * makes on its way out; the transmit below (or the drain in the ISR)
+     * reads the slot directly. */
+    uint8_t claim;
+    if (keyboard_report_pending_valid) {
+        claim = keyboard_report_published;
+    } else if (keyboard_report_in_flight >= 0) {
+        claim = (uint8_t)keyboard_report_in_flight ^ 1;
+    } else {
+        claim = keyboard_report_published ^ 1;
+    }
+    keyboard_report_slots[claim]  = *report;
+    keyboard_report_published     = claim;
+    keyboard_report_pending_valid = false;
+    report                        = &keyboard_report_slots[claim];
+#endif
+
 #ifdef NKRO_ENABLE
     if (keymap_config.nkro && keyboard_protocol) { /* NKRO protocol */
         /* need to wait until the previous packet has made it through */
@@ -810,6 +905,13 @@ void send_keyboard(report_keyboard_t *report) {
          * this is more efficient */
         /* busy wait, should be short and not very common */
         if (usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM)) {
+#ifdef USB_REPORT_ASYNC
+            /* the slot is already filled and published; leave it for the
+             * IN-complete ISR to transmit rather than suspending the scan
+             * thread until the host polls */
+            keyboard_report_pending_valid = true;
+            goto unlock;
+#else
             /* Need to either suspend, or loop and call unlock/lock during
              * every iteration - otherwise the system will remain locked,
              * no interrupts served, so USB not going through as well.
@@ -820,6 +922,7 @@ void send_keyboard(report_keyboard_t *report) {
             if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
                 goto unlock;
             }
+#endif
         }
         usbStartTransmitI(&USB_DRIVER, SHARED_IN_EPNUM, (uint8_t *)report, sizeof(struct nkro_report));
     } else
@@ -828,6 +931,13 @@ void send_keyboard(report_keyboard_t *report) {
         /* need to wait until the previous packet has made it through */
         /* busy wait, should be short and not very common */
         if (usbGetTransmitStatusI(&USB_DRIVER, KEYBOARD_IN_EPNUM)) {
+#ifdef USB_REPORT_ASYNC
+            /* the slot is already filled and published; leave it for the
+             * IN-complete ISR to transmit rather than suspending the scan
+             * thread until the host polls */
+            keyboard_report_pending_valid = true;
+            goto unlock;
+#else
             /* Need to either suspend, or loop and call unlock/lock during
              * every iteration - otherwise the system will remain locked,
              * no interrupts served, so USB not going through as well.
@@ -838,6 +948,7 @@ void send_keyboard(report_keyboard_t *report) {
             if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
                 goto unlock;
             }
+#endif
         }
         uint8_t *data, size;
         if (keyboard_protocol) {
@@ -849,7 +960,15 @@ void send_keyboard(report_keyboard_t *report) {
         }
         usbStartTransmitI(&USB_DRIVER, KEYBOARD_IN_EPNUM, data, size);
     }
+#ifdef USB_REPORT_ASYNC
+    keyboard_report_in_flight = (int8_t)keyboard_report_published;
+#endif
+#ifdef LATENCY_TRACE
+    latency_trace_report();
+#endif
+#ifndef USB_REPORT_ASYNC
     keyboard_report_sent = *report;
+#endif
 
 unlock:
     osalSysUnlock();
@@ -902,9 +1021,15 @@ void send_mouse(report_mouse_t *report) { (void)report; }
 #ifdef SHARED_EP_ENABLE
 /* shared IN callback hander */
 void shared_in_cb(USBDriver *usbp, usbep_t ep) {
+    (void)ep;
+#    ifdef USB_REPORT_ASYNC
+    osalSysLockFromISR();
+    keyboard_report_drain_I(usbp);
+    osalSysUnlockFromISR();
+#    else
     /* STUB */
     (void)usbp;
-    (void)ep;
+#    endif
 }
 #endif
 
@@ -1046,7 +1171,11 @@ void raw_hid_task(void) {
     do {
         size_t size = chnReadTimeout(&drivers.raw_driver.driver, buffer, sizeof(buffer), TIME_IMMEDIATE);
         if (size > 0) {
+#    ifdef RAW_HID_DEFERRED
+            raw_hid_queue_receive(buffer, size);
+#    else
             raw_hid_receive(buffer, size);
+#    endif
         }
     } while (size > 0);
 }
@@ -1057,6 +1186,10 @@ void raw_hid_task(void) {
 
 void send_midi_packet(MIDI_EventPacket_t *event) { chnWrite(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t)); }
 
+#    ifdef MIDI_EVENT_BATCH
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) { chnWrite(&drivers.midi_driver.driver, (uint8_t *)events, count * sizeof(MIDI_EventPacket_t)); }
+#    endif
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     size_t size = chnReadTimeout(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t), TIME_IMMEDIATE);
     return size == sizeof(MIDI_EventPacket_t);
@@ -1078,6 +1211,8 @@ void midi_ep_task(void) {
 
 void virtser_send(const uint8_t byte) { chnWrite(&drivers.serial_driver.driver, &byte, 1); }
 
+void virtser_send_buf(const uint8_t *data, uint8_t length) { chnWrite(&drivers.serial_driver.driver, data, length); }
+
 __attribute__((weak)) void virtser_recv(uint8_t c) {
     // Ignore by default
 }
@@ -85,6 +85,10 @@ extern keymap_config_t keymap_config;
 #    include "raw_hid.h"
 #endif
 
+#ifdef LATENCY_TRACE
+#    include "latency_trace.h"
+#endif
+
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
@@ -241,7 +245,11 @@ static void raw_hid_task(void) {
         Endpoint_ClearOUT();
 
         if (data_read) {
+#    ifdef RAW_HID_DEFERRED
+            raw_hid_queue_receive(data, sizeof(data));
+#    else
             raw_hid_receive(data, sizeof(data));
+#    endif
         }
     }
 }
@@ -251,6 +259,21 @@ static void raw_hid_task(void) {
  * Console
  ******************************************************************************/
 #ifdef CONSOLE_ENABLE
+#    ifdef CONSOLE_BUFFERED
+#        ifndef CONSOLE_BUFFER_SIZE
+#            define CONSOLE_BUFFER_SIZE 128
+#        endif
+#        if CONSOLE_BUFFER_SIZE > 256
+#            error "CONSOLE_BUFFER_SIZE: must fit the ring buffer's 8-bit indices"
+#        endif
+#        define RBUF_SIZE CONSOLE_BUFFER_SIZE
+#        include "ring_buffer.h"
+/* characters dropped because the ring buffer was full; saturates */
+static uint16_t console_overflow = 0;
+
+uint16_t console_overflow_count(void) { return console_overflow; }
+#    endif
+
 /** \brief Console Task
  *
  * FIXME: Needs doc
@@ -293,6 +316,12 @@ static void Console_Task(void) {
         return;
     }
 
+#    ifdef CONSOLE_BUFFERED
+    // copy buffered sendchar() output into the bank; the report is
+    // fixed-size, so the remainder is padded with zeros below
+    while (Endpoint_IsReadWriteAllowed() && rbuf_has_data()) Endpoint_Write_8(rbuf_dequeue());
+#    endif
+
     // fill empty bank
     while (Endpoint_IsReadWriteAllowed()) Endpoint_Write_8(0);
 
@@ -438,17 +467,26 @@ void EVENT_USB_Device_WakeUp() {
 
 #ifdef SLEEP_LED_ENABLE
     sleep_led_disable();
-    // NOTE: converters may not accept this
-    led_set(host_keyboard_leds());
+    // sleep_led overwrote the lock LEDs; have keyboard_task() restore them
+    // rather than running the led_set callback chain in event context
+    keyboard_led_force_update();
 #endif
 }
 
 #ifdef CONSOLE_ENABLE
+#    ifndef CONSOLE_BUFFERED
 static bool console_flush = false;
-#    define CONSOLE_FLUSH_SET(b)                                     \
-        do {                                                         \
-            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { console_flush = b; } \
-        } while (0)
+#        define CONSOLE_FLUSH_SET(b)                                     \
+            do {                                                         \
+                ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { console_flush = b; } \
+            } while (0)
+#    endif
+#endif
+
+#if defined(CONSOLE_ENABLE) || (defined(SHARED_EP_SCHEDULER) && defined(SHARED_EP_ENABLE))
+#    if defined(SHARED_EP_SCHEDULER) && defined(SHARED_EP_ENABLE)
+static void shared_ep_flush(void);
+#    endif
 
 /** \brief Event USB Device Start Of Frame
  *
@@ -456,6 +494,16 @@ static bool console_flush = false;
  * called every 1ms
  */
 void EVENT_USB_Device_StartOfFrame(void) {
+#    if defined(SHARED_EP_SCHEDULER) && defined(SHARED_EP_ENABLE)
+    shared_ep_flush();
+#    endif
+#    ifdef CONSOLE_ENABLE
+#        ifdef CONSOLE_BUFFERED
+    // drain up to one report's worth of buffered output every frame;
+    // sendchar() never touches the endpoint, so there is no producer race
+    if (!rbuf_has_data()) return;
+    Console_Task();
+#        else
     static uint8_t count;
     if (++count % 50) return;
     count = 0;
@@ -463,10 +511,96 @@ void EVENT_USB_Device_StartOfFrame(void) {
     if (!console_flush) return;
     Console_Task();
     console_flush = false;
+#        endif
+#    endif
 }
 
 #endif
 
+/* With KEYBOARD_IN_DOUBLE_BANK the endpoint carrying the keyboard report is
+ * configured ping-pong: while the host reads one bank the firmware can
+ * already queue the next report into the other, saving up to a full frame
+ * of worst-case report latency for one extra bank of endpoint memory. */
+#ifdef KEYBOARD_IN_DOUBLE_BANK
+#    if defined(__AVR_ATmega16U2__) || defined(__AVR_ATmega32U2__) || defined(__AVR_AT90USB82__) || defined(__AVR_AT90USB162__)
+#        error "KEYBOARD_IN_DOUBLE_BANK: this controller only supports dual-bank operation on endpoints 3 and 4"
+#    endif
+#    define KEYBOARD_IN_BANKS 2
+#else
+#    define KEYBOARD_IN_BANKS 1
+#endif
+
+/* The shared endpoint gets the second bank too whenever it can carry the
+ * keyboard report - either the keyboard lives there outright, or NKRO
+ * reports are routed to it while the protocol is active. */
+#if (defined(KEYBOARD_SHARED_EP) || defined(NKRO_ENABLE)) && defined(KEYBOARD_IN_DOUBLE_BANK)
+#    define SHARED_IN_BANKS 2
+#else
+#    define SHARED_IN_BANKS 1
+#endif
+
+#ifdef __AVR__
+/* Build-time endpoint memory accounting: every configured bank is carved out
+ * of the controller's DPRAM, and LUFA only reports failure at runtime. Sum
+ * the banks here so an over-committed configuration fails the build instead. */
+#    if defined(__AVR_ATmega8U2__) || defined(__AVR_ATmega16U2__) || defined(__AVR_ATmega32U2__) || defined(__AVR_AT90USB82__) || defined(__AVR_AT90USB162__)
+#        define USB_DPRAM_SIZE 176
+#    else
+#        define USB_DPRAM_SIZE 832
+#    endif
+
+#    ifndef KEYBOARD_SHARED_EP
+#        define KEYBOARD_EP_BANK_BYTES (KEYBOARD_EPSIZE * KEYBOARD_IN_BANKS)
+#    else
+#        define KEYBOARD_EP_BANK_BYTES 0
+#    endif
+#    if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+#        define MOUSE_EP_BANK_BYTES MOUSE_EPSIZE
+#    else
+#        define MOUSE_EP_BANK_BYTES 0
+#    endif
+#    ifdef SHARED_EP_ENABLE
+#        define SHARED_EP_BANK_BYTES (SHARED_EPSIZE * SHARED_IN_BANKS)
+#    else
+#        define SHARED_EP_BANK_BYTES 0
+#    endif
+#    ifdef RAW_ENABLE
+#        define RAW_EP_BANK_BYTES (RAW_EPSIZE * 2)
+#    else
+#        define RAW_EP_BANK_BYTES 0
+#    endif
+#    ifdef CONSOLE_ENABLE
+#        define CONSOLE_EP_BANK_BYTES CONSOLE_EPSIZE
+#    else
+#        define CONSOLE_EP_BANK_BYTES 0
+#    endif
+#    ifdef MIDI_ENABLE
+#        define MIDI_EP_BANK_BYTES (MIDI_STREAM_EPSIZE * 2)
+#    else
+#        define MIDI_EP_BANK_BYTES 0
+#    endif
+#    ifdef VIRTSER_ENABLE
+#        define CDC_EP_BANK_BYTES (CDC_NOTIFICATION_EPSIZE + CDC_EPSIZE * 2)
+#    else
+#        define CDC_EP_BANK_BYTES 0
+#    endif
+#    ifdef JOYSTICK_ENABLE
+#        define JOYSTICK_EP_BANK_BYTES JOYSTICK_EPSIZE
+#    else
+#        define JOYSTICK_EP_BANK_BYTES 0
+#    endif
+#    if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+#        define DIGITIZER_EP_BANK_BYTES DIGITIZER_EPSIZE
+#    else
+#        define DIGITIZER_EP_BANK_BYTES 0
+#    endif
+
+// 64 bytes for the control endpoint
+#    define USB_DPRAM_USED (64 + KEYBOARD_EP_BANK_BYTES + MOUSE_EP_BANK_BYTES + SHARED_EP_BANK_BYTES + RAW_EP_BANK_BYTES + CONSOLE_EP_BANK_BYTES + MIDI_EP_BANK_BYTES + CDC_EP_BANK_BYTES + JOYSTICK_EP_BANK_BYTES + DIGITIZER_EP_BANK_BYTES)
+
+_Static_assert(USB_DPRAM_USED <= USB_DPRAM_SIZE, "USB endpoint banks exceed this controller's endpoint memory; disable a feature, share more endpoints (USB_ENDPOINT_CONSOLIDATE), or drop KEYBOARD_IN_DOUBLE_BANK");
+#endif
+
 /** \brief Event handler for the USB_ConfigurationChanged event.
  *
  * This is fired when the host sets the current configuration of the USB device after enumeration.
@@ -479,7 +613,7 @@ void EVENT_USB_Device_ConfigurationChanged(void) {
 
 #ifndef KEYBOARD_SHARED_EP
     /* Setup keyboard report endpoint */
-    ConfigSuccess &= Endpoint_ConfigureEndpoint((KEYBOARD_IN_EPNUM | ENDPOINT_DIR_IN), EP_TYPE_INTERRUPT, KEYBOARD_EPSIZE, 1);
+    ConfigSuccess &= Endpoint_ConfigureEndpoint((KEYBOARD_IN_EPNUM | ENDPOINT_DIR_IN), EP_TYPE_INTERRUPT, KEYBOARD_EPSIZE, KEYBOARD_IN_BANKS);
 #endif
 
 #if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
@@ -489,7 +623,7 @@ void EVENT_USB_Device_ConfigurationChanged(void) {
 
 #ifdef SHARED_EP_ENABLE
     /* Setup shared report endpoint */
-    ConfigSuccess &= Endpoint_ConfigureEndpoint((SHARED_IN_EPNUM | ENDPOINT_DIR_IN), EP_TYPE_INTERRUPT, SHARED_EPSIZE, 1);
+    ConfigSuccess &= Endpoint_ConfigureEndpoint((SHARED_IN_EPNUM | ENDPOINT_DIR_IN), EP_TYPE_INTERRUPT, SHARED_EPSIZE, SHARED_IN_BANKS);
 #endif
 
 #ifdef RAW_ENABLE
@@ -656,6 +790,107 @@ void EVENT_USB_Device_ControlRequest(void) {
 #endif
 }
 
+/*******************************************************************************
+ * Shared endpoint scheduler
+ ******************************************************************************/
+#if defined(SHARED_EP_SCHEDULER) && defined(SHARED_EP_ENABLE)
+/* Per-report-ID pending state for the shared endpoint.  When the endpoint
+ * still holds the previous report, the new one parks here instead of
+ * spin-waiting, and pending slots are flushed keyboard-first from the
+ * start-of-frame handler -- so typing never queues behind pointer updates.
+ * Slot order is transmit priority. */
+enum shared_slot {
+    SHARED_SLOT_KEYBOARD,
+#    ifdef EXTRAKEY_ENABLE
+    SHARED_SLOT_SYSTEM,
+    SHARED_SLOT_CONSUMER,
+#    endif
+#    if defined(MOUSE_ENABLE) && defined(MOUSE_SHARED_EP)
+    SHARED_SLOT_MOUSE,
+#    endif
+    SHARED_SLOT_COUNT
+};
+
+static uint8_t shared_slot_data[SHARED_SLOT_COUNT][sizeof(report_keyboard_t)];
+static uint8_t shared_slot_len[SHARED_SLOT_COUNT];
+static uint8_t shared_slot_dirty = 0;
+
+/* single attempt; false when the endpoint still holds the previous report */
+static bool shared_ep_try_write(const void *data, uint8_t length) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true;
+    Endpoint_SelectEndpoint(SHARED_IN_EPNUM);
+    if (!Endpoint_IsReadWriteAllowed()) return false;
+    Endpoint_Write_Stream_LE(data, length, NULL);
+    Endpoint_ClearIN();
+    return true;
+}
+
+static void shared_ep_send(uint8_t slot, const void *data, uint8_t length) {
+    // runs with interrupts off: the start-of-frame handler flushes pending
+    // slots from ISR context and must not interleave with this
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // this report carries absolute state, so it supersedes a pending one
+        shared_slot_dirty &= ~(1 << slot);
+        if (!shared_ep_try_write(data, length)) {
+            memcpy(shared_slot_data[slot], data, length);
+            shared_slot_len[slot] = length;
+            shared_slot_dirty |= 1 << slot;
+        }
+#    ifdef LATENCY_TRACE
+        else if (slot == SHARED_SLOT_KEYBOARD) {
+            latency_trace_report();
+        }
+#    endif
+    }
+}
+
+static void shared_ep_flush(void) {
+    if (!shared_slot_dirty) return;
+    // may run from the start-of-frame ISR while other code holds an
+    // endpoint selection, so restore it afterwards
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+    for (uint8_t slot = 0; slot < SHARED_SLOT_COUNT; slot++) {
+        if (!(shared_slot_dirty & (1 << slot))) continue;
+        if (!shared_ep_try_write(shared_slot_data[slot], shared_slot_len[slot])) break;
+        shared_slot_dirty &= ~(1 << slot);
+#    ifdef LATENCY_TRACE
+        if (slot == SHARED_SLOT_KEYBOARD) latency_trace_report();
+#    endif
+    }
+    Endpoint_SelectEndpoint(ep);
+}
+
+#    if defined(MOUSE_ENABLE) && defined(MOUSE_SHARED_EP)
+static int8_t shared_ep_add8(int8_t a, int8_t b) {
+    int16_t sum = (int16_t)a + b;
+    if (sum > 127) return 127;
+    if (sum < -127) return -127;
+    return (int8_t)sum;
+}
+
+/* x/y/v/h are relative deltas: accumulate into a pending report instead of
+ * replacing it, so no motion is lost while the endpoint is busy */
+static void shared_ep_send_mouse(report_mouse_t *report) {
+    bool merged = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (shared_slot_dirty & (1 << SHARED_SLOT_MOUSE)) {
+            report_mouse_t *pending = (report_mouse_t *)shared_slot_data[SHARED_SLOT_MOUSE];
+            pending->buttons        = report->buttons;
+            pending->x              = shared_ep_add8(pending->x, report->x);
+            pending->y              = shared_ep_add8(pending->y, report->y);
+            pending->v              = shared_ep_add8(pending->v, report->v);
+            pending->h              = shared_ep_add8(pending->h, report->h);
+            shared_ep_flush();
+            merged = true;
+        }
+    }
+    if (!merged) {
+        shared_ep_send(SHARED_SLOT_MOUSE, report, sizeof(report_mouse_t));
+    }
+}
+#    endif
+#endif
+
 /*******************************************************************************
  * Host driver
  ******************************************************************************/
@@ -698,9 +933,22 @@ static void send_keyboard(report_keyboard_t *report) {
         ep   = SHARED_IN_EPNUM;
         size = sizeof(struct nkro_report);
     }
+#endif
+#if defined(SHARED_EP_SCHEDULER) && defined(SHARED_EP_ENABLE)
+    if (ep == SHARED_IN_EPNUM) {
+        if (!keyboard_protocol) {
+            shared_ep_send(SHARED_SLOT_KEYBOARD, &report->mods, 8);
+        } else {
+            shared_ep_send(SHARED_SLOT_KEYBOARD, report, size);
+        }
+        keyboard_report_sent = *report;
+        return;
+    }
 #endif
     Endpoint_SelectEndpoint(ep);
-    /* Check if write ready for a polling interval around 10ms */
+    /* Check if write ready for a polling interval around 10ms; with
+     * KEYBOARD_IN_DOUBLE_BANK a bank is free while the previous report is
+     * still in flight, so back-to-back reports skip this wait entirely */
     while (timeout-- && !Endpoint_IsReadWriteAllowed()) _delay_us(40);
     if (!Endpoint_IsReadWriteAllowed()) return;
 
@@ -714,6 +962,9 @@ static void send_keyboard(report_keyboard_t *report) {
     /* Finalize the stream transfer to send the last packet */
     Endpoint_ClearIN();
 
+#ifdef LATENCY_TRACE
+    latency_trace_report();
+#endif
     keyboard_report_sent = *report;
 }
 
@@ -723,7 +974,9 @@ static void send_keyboard(report_keyboard_t *report) {
  */
 static void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
+#    if !(defined(SHARED_EP_SCHEDULER) && defined(MOUSE_SHARED_EP))
     uint8_t timeout = 255;
+#    endif
 
 #    ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
@@ -745,6 +998,11 @@ static void send_mouse(report_mouse_t *report) {
     }
 #    endif
 
+#    if defined(SHARED_EP_SCHEDULER) && defined(MOUSE_SHARED_EP)
+    shared_ep_send_mouse(report);
+    return;
+#    endif
+
     /* Select the Mouse Report Endpoint */
     Endpoint_SelectEndpoint(MOUSE_IN_EPNUM);
 
@@ -766,12 +1024,18 @@ static void send_mouse(report_mouse_t *report) {
  */
 #ifdef EXTRAKEY_ENABLE
 static void send_extra(uint8_t report_id, uint16_t data) {
+#    ifndef SHARED_EP_SCHEDULER
     uint8_t timeout = 255;
+#    endif
 
     if (USB_DeviceState != DEVICE_STATE_Configured) return;
 
     static report_extra_t r;
     r = (report_extra_t){.report_id = report_id, .usage = data};
+#    ifdef SHARED_EP_SCHEDULER
+    shared_ep_send(report_id == REPORT_ID_SYSTEM ? SHARED_SLOT_SYSTEM : SHARED_SLOT_CONSUMER, &r, sizeof(report_extra_t));
+    return;
+#    endif
     Endpoint_SelectEndpoint(SHARED_IN_EPNUM);
 
     /* Check if write ready for a polling interval around 10ms */
@@ -826,7 +1090,23 @@ static void send_consumer(uint16_t data) {
  * sendchar
  ******************************************************************************/
 #ifdef CONSOLE_ENABLE
-#    define SEND_TIMEOUT 5
+#    ifdef CONSOLE_BUFFERED
+/** \brief Send Char
+ *
+ * Wait-free producer side: enqueue into the ring buffer and let the
+ * start-of-frame handler drain it. Never waits on the endpoint, so heavy
+ * dprintf instrumentation does not stall the scan loop.
+ */
+int8_t sendchar(uint8_t c) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return -1;
+    if (!rbuf_enqueue(c)) {
+        if (console_overflow < UINT16_MAX) console_overflow++;
+        return -1;
+    }
+    return 0;
+}
+#    else
+#        define SEND_TIMEOUT 5
 /** \brief Send Char
  *
  * FIXME: Needs doc
@@ -887,6 +1167,7 @@ ERROR_EXIT:
     Endpoint_SelectEndpoint(ep);
     return -1;
 }
+#    endif
 #endif
 
 /*******************************************************************************
@@ -916,6 +1197,17 @@ USB_ClassInfo_MIDI_Device_t USB_MIDI_Interface = {
 
 void send_midi_packet(MIDI_EventPacket_t *event) { MIDI_Device_SendEventPacket(&USB_MIDI_Interface, event); }
 
+#    ifdef MIDI_EVENT_BATCH
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    // consecutive packets coalesce in the IN endpoint bank; flushing once at
+    // the end sends the whole batch in as few transfers as the bank allows
+    for (uint8_t i = 0; i < count; i++) {
+        MIDI_Device_SendEventPacket(&USB_MIDI_Interface, &events[i]);
+    }
+    MIDI_Device_Flush(&USB_MIDI_Interface);
+}
+#    endif
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) { return MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, event); }
 
 #endif
@@ -984,6 +1276,42 @@ void virtser_send(const uint8_t byte) {
         Endpoint_SelectEndpoint(ep);
     }
 }
+
+/** \brief Virtual Serial Send Buffer
+ *
+ * Sends a whole buffer with a single flush, rather than one transfer per byte.
+ */
+void virtser_send_buf(const uint8_t *data, uint8_t length) {
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+
+    if (cdc_device.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR) {
+        /* IN packet */
+        Endpoint_SelectEndpoint(cdc_device.Config.DataINEndpoint.Address);
+
+        if (!Endpoint_IsEnabled() || !Endpoint_IsConfigured()) {
+            Endpoint_SelectEndpoint(ep);
+            return;
+        }
+
+        while (length--) {
+            if (!Endpoint_IsReadWriteAllowed()) {
+                /* Bank is full; send it to make room for the rest */
+                CDC_Device_Flush(&cdc_device);
+                uint8_t timeout = 255;
+                while (timeout-- && !Endpoint_IsReadWriteAllowed()) _delay_us(40);
+            }
+
+            Endpoint_Write_8(*data++);
+        }
+        CDC_Device_Flush(&cdc_device);
+
+        if (Endpoint_IsINReady()) {
+            Endpoint_ClearIN();
+        }
+
+        Endpoint_SelectEndpoint(ep);
+    }
+}
 #endif
 
 void send_digitizer(report_digitizer_t *report) {
@@ -1055,6 +1383,14 @@ void protocol_init(void) {
     serial_init();
 #endif
 
+#ifdef KEYBOARD_INIT_DURING_USB_STARTUP
+    /* Bring the keyboard up while the host is still enumerating: bootmagic's
+     * debounce-spaced matrix scans and split handedness detection are
+     * USB-independent, so they overlap the enumeration wait below instead of
+     * adding to it. */
+    keyboard_init();
+#endif
+
     /* wait for USB startup & debug output */
 
 #ifdef WAIT_FOR_USB
@@ -1070,7 +1406,9 @@ void protocol_init(void) {
     USB_USBTask();
 #endif
     /* init modules */
+#ifndef KEYBOARD_INIT_DURING_USB_STARTUP
     keyboard_init();
+#endif
     host_set_driver(&lufa_driver);
 #ifdef SLEEP_LED_ENABLE
     sleep_led_init();
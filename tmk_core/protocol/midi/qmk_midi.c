@@ -7,6 +7,9 @@
 #if API_SYSEX_ENABLE
 #    include "api_sysex.h"
 #endif
+#if defined(SEQUENCER_ENABLE) && defined(SEQUENCER_MIDI_CLOCK)
+#    include "sequencer.h"
+#endif
 
 /*******************************************************************************
  * MIDI
@@ -14,6 +17,25 @@
 
 MidiDevice midi_device;
 
+#ifdef MIDI_EVENT_BATCH
+/* Events raised within one scan pass (chords press several notes) are
+ * collected here and handed to the protocol driver as one batch from
+ * midi_task(), instead of one endpoint write per event. */
+#    ifndef MIDI_EVENT_BATCH_SIZE
+#        define MIDI_EVENT_BATCH_SIZE 16
+#    endif
+static MIDI_EventPacket_t midi_event_batch[MIDI_EVENT_BATCH_SIZE];
+static uint8_t            midi_event_batch_length = 0;
+
+void midi_flush_batch(void) {
+    if (midi_event_batch_length == 0) {
+        return;
+    }
+    send_midi_packets(midi_event_batch, midi_event_batch_length);
+    midi_event_batch_length = 0;
+}
+#endif
+
 #define SYSEX_START_OR_CONT 0x40
 #define SYSEX_ENDS_IN_1 0x50
 #define SYSEX_ENDS_IN_2 0x60
@@ -72,7 +94,14 @@ static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8
         }
     }
 
+#ifdef MIDI_EVENT_BATCH
+    if (midi_event_batch_length == MIDI_EVENT_BATCH_SIZE) {
+        midi_flush_batch();
+    }
+    midi_event_batch[midi_event_batch_length++] = event;
+#else
     send_midi_packet(&event);
+#endif
 }
 
 static void usb_get_midi(MidiDevice* device) {
@@ -119,6 +148,25 @@ static void fallthrough_callback(MidiDevice* device, uint16_t cnt, uint8_t byte0
 #endif
 }
 
+#if defined(SEQUENCER_ENABLE) && defined(SEQUENCER_MIDI_CLOCK)
+static void realtime_callback(MidiDevice* device, uint8_t byte) {
+    switch (byte) {
+        case MIDI_CLOCK:
+            sequencer_midi_clock_tick();
+            break;
+        case MIDI_START:
+            sequencer_midi_clock_start();
+            break;
+        case MIDI_CONTINUE:
+            sequencer_midi_clock_continue();
+            break;
+        case MIDI_STOP:
+            sequencer_midi_clock_stop();
+            break;
+    }
+}
+#endif
+
 static void cc_callback(MidiDevice* device, uint8_t chan, uint8_t num, uint8_t val) {
     // sending it back on the next channel
     // midi_send_cc(device, (chan + 1) % 16, num, val);
@@ -170,6 +218,9 @@ void setup_midi(void) {
     midi_device_set_pre_input_process_func(&midi_device, usb_get_midi);
     midi_register_fallthrough_callback(&midi_device, fallthrough_callback);
     midi_register_cc_callback(&midi_device, cc_callback);
+#if defined(SEQUENCER_ENABLE) && defined(SEQUENCER_MIDI_CLOCK)
+    midi_register_realtime_callback(&midi_device, realtime_callback);
+#endif
 #ifdef API_SYSEX_ENABLE
     midi_register_sysex_callback(&midi_device, sysex_callback);
 #endif
@@ -7,4 +7,8 @@ extern MidiDevice midi_device;
 void              setup_midi(void);
 void              send_midi_packet(MIDI_EventPacket_t* event);
 bool              recv_midi_packet(MIDI_EventPacket_t* const event);
+#    ifdef MIDI_EVENT_BATCH
+void send_midi_packets(MIDI_EventPacket_t* events, uint8_t count);
+void midi_flush_batch(void);
+#    endif
 #endif
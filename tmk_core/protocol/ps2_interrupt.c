@@ -256,7 +256,10 @@ void ps2_host_set_led(uint8_t led) {
 /*--------------------------------------------------------------------
  * Ring buffer to store scan codes from keyboard
  *------------------------------------------------------------------*/
-#define PBUF_SIZE 32
+#ifndef PS2_PBUF_SIZE
+#    define PS2_PBUF_SIZE 32
+#endif
+#define PBUF_SIZE PS2_PBUF_SIZE
 static uint8_t     pbuf[PBUF_SIZE];
 static uint8_t     pbuf_head = 0;
 static uint8_t     pbuf_tail = 0;
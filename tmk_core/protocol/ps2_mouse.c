@@ -74,6 +74,80 @@ __attribute__((weak)) void ps2_mouse_init_user(void) {}
 
 __attribute__((weak)) void ps2_mouse_moved_user(report_mouse_t *mouse_report) {}
 
+#if defined(PS2_MOUSE_STREAM_BATCH) && !defined(PS2_MOUSE_USE_REMOTE_MODE)
+/* Stream mode: the device pushes packets into the ISR byte buffer on its
+ * own schedule, so when a long pass (an RGB flush, say) delays this task,
+ * several packets can be waiting. Drain and decode everything buffered,
+ * merging the deltas into a single report, instead of taking one packet
+ * per pass and letting the buffer overflow. */
+void ps2_mouse_task(void) {
+    static uint8_t buttons_prev = 0;
+    static uint8_t packet[4];
+    static uint8_t packet_pos = 0;
+    extern int     tp_buttons;
+
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+    const uint8_t packet_len = 4;
+#    else
+    const uint8_t packet_len = 3;
+#    endif
+
+    int16_t merged_x    = 0;
+    int16_t merged_y    = 0;
+    int16_t merged_v    = 0;
+    bool    have_packet = false;
+
+    for (;;) {
+        uint8_t data = ps2_host_recv();
+        if (ps2_error == PS2_ERR_NODATA) break;
+        /* bit 3 of the first packet byte is always set; anything else at
+         * packet position 0 means we lost sync, drop it and recover */
+        if (packet_pos == 0 && !(data & (1 << 3))) continue;
+        packet[packet_pos++] = data;
+        if (packet_pos < packet_len) continue;
+        packet_pos = 0;
+
+        /* decode one packet through the regular per-packet pipeline */
+        mouse_report.buttons = packet[0] | tp_buttons;
+        mouse_report.x       = packet[1] * PS2_MOUSE_X_MULTIPLIER;
+        mouse_report.y       = packet[2] * PS2_MOUSE_Y_MULTIPLIER;
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+        mouse_report.v = -(packet[3] & PS2_MOUSE_SCROLL_MASK) * PS2_MOUSE_V_MULTIPLIER;
+#    endif
+#    ifdef PS2_MOUSE_DEBUG_RAW
+        ps2_mouse_print_report(&mouse_report);
+#    endif
+        ps2_mouse_convert_report_to_hid(&mouse_report);
+        merged_x += mouse_report.x;
+        merged_y += mouse_report.y;
+        merged_v += mouse_report.v;
+        have_packet = true;
+    }
+
+    if (!have_packet) return;
+
+    /* buttons reflect the newest packet; merged deltas clamp to HID range */
+    mouse_report.x = merged_x > 127 ? 127 : merged_x < -127 ? -127 : merged_x;
+    mouse_report.y = merged_y > 127 ? 127 : merged_y < -127 ? -127 : merged_y;
+    mouse_report.v = merged_v > 127 ? 127 : merged_v < -127 ? -127 : merged_v;
+
+    if (mouse_report.x || mouse_report.y || mouse_report.v || ((mouse_report.buttons ^ buttons_prev) & PS2_MOUSE_BTN_MASK)) {
+        buttons_prev = mouse_report.buttons;
+#    if PS2_MOUSE_SCROLL_BTN_MASK
+        ps2_mouse_scroll_button_task(&mouse_report);
+#    endif
+        if (mouse_report.x || mouse_report.y || mouse_report.v) {
+            ps2_mouse_moved_user(&mouse_report);
+        }
+#    ifdef PS2_MOUSE_DEBUG_HID
+        ps2_mouse_print_report(&mouse_report);
+#    endif
+        host_mouse_send(&mouse_report);
+    }
+
+    ps2_mouse_clear_report(&mouse_report);
+}
+#else
 void ps2_mouse_task(void) {
     static uint8_t buttons_prev = 0;
     extern int     tp_buttons;
@@ -116,6 +190,7 @@ void ps2_mouse_task(void) {
 
     ps2_mouse_clear_report(&mouse_report);
 }
+#endif /* PS2_MOUSE_STREAM_BATCH */
 
 void ps2_mouse_disable_data_reporting(void) { PS2_MOUSE_SEND(PS2_MOUSE_DISABLE_DATA_REPORTING, "ps2 mouse disable data reporting"); }
 
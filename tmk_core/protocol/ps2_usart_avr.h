@@ -0,0 +1,137 @@
+/*
+Copyright 2021 Jun Wako <wakojun@gmail.com>
+
+This software is licensed with a Modified BSD License.
+All of this is supposed to be Free Software, Open Source, DFSG-free,
+GPL-compatible, and OK to use in both free and proprietary applications.
+Additions and corrections to this file are welcome.
+
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in
+  the documentation and/or other materials provided with the
+  distribution.
+
+* Neither the name of the copyright holders nor the names of
+  contributors may be used to endorse or promote products derived
+  from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+/*
+ * Default PS2_USART_* register macros for AVR targets.
+ *
+ * Hardware-USART PS/2 capture (synchronous slave mode, PS/2 clock on the
+ * XCKn pin, data on RXDn) costs one RX-complete interrupt per byte instead
+ * of the eleven pin-change interrupts per byte of the software decoder.
+ * Historically every keyboard had to paste the same register blob into its
+ * config.h with the USART number hand-edited in; this header derives that
+ * blob from PS2_USART_NUMBER instead (default: USART1 on parts that have
+ * one, else USART0).
+ *
+ * A keyboard now only defines the PS2_CLOCK_* and PS2_DATA_* pin macros (for
+ * the bit-banged ps2_host_send() path) and wires clock to XCKn, data to
+ * RXDn. Every macro below is individually overridable, so parts with
+ * unnumbered vector names (e.g. USART_RXC_vect on the ATmega32A) only
+ * need to override PS2_USART_RX_VECT, and existing config.h blobs keep
+ * working untouched.
+ */
+
+#define PS2_USART_CONCAT2_(a, b) a##b
+#define PS2_USART_CONCAT2(a, b) PS2_USART_CONCAT2_(a, b)
+#define PS2_USART_CONCAT3_(a, b, c) a##b##c
+#define PS2_USART_CONCAT3(a, b, c) PS2_USART_CONCAT3_(a, b, c)
+
+#ifndef PS2_USART_NUMBER
+#    if defined(UCSR1A)
+#        define PS2_USART_NUMBER 1
+#    else
+#        define PS2_USART_NUMBER 0
+#    endif
+#endif
+
+/* registers */
+#define PS2_UCSRA PS2_USART_CONCAT3(UCSR, PS2_USART_NUMBER, A)
+#define PS2_UCSRB PS2_USART_CONCAT3(UCSR, PS2_USART_NUMBER, B)
+#define PS2_UCSRC PS2_USART_CONCAT3(UCSR, PS2_USART_NUMBER, C)
+#define PS2_UBRRH PS2_USART_CONCAT3(UBRR, PS2_USART_NUMBER, H)
+#define PS2_UBRRL PS2_USART_CONCAT3(UBRR, PS2_USART_NUMBER, L)
+#define PS2_UDR PS2_USART_CONCAT2(UDR, PS2_USART_NUMBER)
+
+/* bit positions */
+#define PS2_UMSEL0 PS2_USART_CONCAT3(UMSEL, PS2_USART_NUMBER, 0)
+#define PS2_UPM0 PS2_USART_CONCAT3(UPM, PS2_USART_NUMBER, 0)
+#define PS2_USBS PS2_USART_CONCAT2(USBS, PS2_USART_NUMBER)
+#define PS2_UCSZ0 PS2_USART_CONCAT3(UCSZ, PS2_USART_NUMBER, 0)
+#define PS2_UCPOL PS2_USART_CONCAT2(UCPOL, PS2_USART_NUMBER)
+#define PS2_RXCIE PS2_USART_CONCAT2(RXCIE, PS2_USART_NUMBER)
+#define PS2_RXEN PS2_USART_CONCAT2(RXEN, PS2_USART_NUMBER)
+#define PS2_TXEN PS2_USART_CONCAT2(TXEN, PS2_USART_NUMBER)
+#define PS2_RXC PS2_USART_CONCAT2(RXC, PS2_USART_NUMBER)
+#define PS2_FE PS2_USART_CONCAT2(FE, PS2_USART_NUMBER)
+#define PS2_DOR PS2_USART_CONCAT2(DOR, PS2_USART_NUMBER)
+#define PS2_UPE PS2_USART_CONCAT2(UPE, PS2_USART_NUMBER)
+
+/* synchronous, odd parity, 1-bit stop, 8-bit data, sample at falling edge */
+/* set DDR of CLOCK as input to be slave */
+#ifndef PS2_USART_INIT
+#    define PS2_USART_INIT()                                                                                                      \
+        do {                                                                                                                      \
+            PS2_CLOCK_DDR &= ~(1 << PS2_CLOCK_BIT);                                                                               \
+            PS2_DATA_DDR &= ~(1 << PS2_DATA_BIT);                                                                                 \
+            PS2_UCSRC = ((1 << PS2_UMSEL0) | (3 << PS2_UPM0) | (0 << PS2_USBS) | (3 << PS2_UCSZ0) | (0 << PS2_UCPOL));            \
+            PS2_UCSRA = 0;                                                                                                        \
+            PS2_UBRRH = 0;                                                                                                        \
+            PS2_UBRRL = 0;                                                                                                        \
+        } while (0)
+#endif
+#ifndef PS2_USART_RX_INT_ON
+#    define PS2_USART_RX_INT_ON()                            \
+        do {                                                 \
+            PS2_UCSRB = ((1 << PS2_RXCIE) | (1 << PS2_RXEN)); \
+        } while (0)
+#endif
+#ifndef PS2_USART_RX_POLL_ON
+#    define PS2_USART_RX_POLL_ON()       \
+        do {                             \
+            PS2_UCSRB = (1 << PS2_RXEN); \
+        } while (0)
+#endif
+#ifndef PS2_USART_OFF
+#    define PS2_USART_OFF()                                      \
+        do {                                                     \
+            PS2_UCSRC = 0;                                       \
+            PS2_UCSRB &= ~((1 << PS2_RXEN) | (1 << PS2_TXEN));   \
+        } while (0)
+#endif
+#ifndef PS2_USART_RX_READY
+#    define PS2_USART_RX_READY (PS2_UCSRA & (1 << PS2_RXC))
+#endif
+#ifndef PS2_USART_RX_DATA
+#    define PS2_USART_RX_DATA PS2_UDR
+#endif
+#ifndef PS2_USART_ERROR
+#    define PS2_USART_ERROR (PS2_UCSRA & ((1 << PS2_FE) | (1 << PS2_DOR) | (1 << PS2_UPE)))
+#endif
+#ifndef PS2_USART_RX_VECT
+#    define PS2_USART_RX_VECT PS2_USART_CONCAT3(USART, PS2_USART_NUMBER, _RX_vect)
+#endif
@@ -94,31 +94,59 @@ static report_keyboard_t keyboard_report_sent;
 
 #define VUSB_TRANSFER_KEYBOARD_MAX_TRIES 10
 
+#ifdef VUSB_QUEUED_TRANSFER
+/* passes where a queued report found the interrupt endpoint busy (saturating) */
+static uint16_t kbuf_stalls = 0;
+/* reports dropped because the FIFO was full (saturating) */
+static uint16_t kbuf_drops = 0;
+
+uint16_t vusb_transfer_stall_count(void) { return kbuf_stalls; }
+
+uint16_t vusb_transfer_drop_count(void) { return kbuf_drops; }
+#endif
+
+/* hand the oldest queued report to V-USB; endpoint must be ready */
+static void vusb_transfer_keyboard_send(void) {
+#ifndef KEYBOARD_SHARED_EP
+    usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t));
+#else
+    // Ugly hack! :(
+    usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t) - 1);
+    while (!usbInterruptIsReady()) {
+        usbPoll();
+    }
+    usbSetInterrupt((void *)(&(kbuf[kbuf_tail].keys[5])), 1);
+#endif
+    kbuf_tail = (kbuf_tail + 1) % KBUF_SIZE;
+    if (debug_keyboard) {
+        dprintf("V-USB: kbuf[%d->%d](%02X)\n", kbuf_tail, kbuf_head, (kbuf_head < kbuf_tail) ? (KBUF_SIZE - kbuf_tail + kbuf_head) : (kbuf_head - kbuf_tail));
+    }
+}
+
 /* transfer keyboard report from buffer */
 void vusb_transfer_keyboard(void) {
+#ifdef VUSB_QUEUED_TRANSFER
+    /* non-blocking: protocol_task() pumps this every pass, so rather than
+     * spin in usbPoll/wait_ms when the endpoint is busy, leave queued
+     * reports for the next pass and count the stall */
+    if (kbuf_head == kbuf_tail) return;
+    if (!usbInterruptIsReady()) {
+        if (kbuf_stalls < UINT16_MAX) kbuf_stalls++;
+        return;
+    }
+    vusb_transfer_keyboard_send();
+#else
     for (int i = 0; i < VUSB_TRANSFER_KEYBOARD_MAX_TRIES; i++) {
         if (usbInterruptIsReady()) {
             if (kbuf_head != kbuf_tail) {
-#ifndef KEYBOARD_SHARED_EP
-                usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t));
-#else
-                // Ugly hack! :(
-                usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t) - 1);
-                while (!usbInterruptIsReady()) {
-                    usbPoll();
-                }
-                usbSetInterrupt((void *)(&(kbuf[kbuf_tail].keys[5])), 1);
-#endif
-                kbuf_tail = (kbuf_tail + 1) % KBUF_SIZE;
-                if (debug_keyboard) {
-                    dprintf("V-USB: kbuf[%d->%d](%02X)\n", kbuf_tail, kbuf_head, (kbuf_head < kbuf_tail) ? (KBUF_SIZE - kbuf_tail + kbuf_head) : (kbuf_head - kbuf_tail));
-                }
+                vusb_transfer_keyboard_send();
             }
             break;
         }
         usbPoll();
         wait_ms(1);
     }
+#endif
 }
 
 /*------------------------------------------------------------------*
@@ -239,6 +267,9 @@ static void send_keyboard(report_keyboard_t *report) {
         kbuf[kbuf_head] = *report;
         kbuf_head       = next;
     } else {
+#ifdef VUSB_QUEUED_TRANSFER
+        if (kbuf_drops < UINT16_MAX) kbuf_drops++;
+#endif
         dprint("kbuf: full\n");
     }
 
@@ -124,3 +124,10 @@ extern bool vusb_suspended;
 
 host_driver_t *vusb_driver(void);
 void           vusb_transfer_keyboard(void);
+
+#ifdef VUSB_QUEUED_TRANSFER
+/* passes where a queued report found the endpoint busy (saturating) */
+uint16_t vusb_transfer_stall_count(void);
+/* reports dropped because the FIFO was full (saturating) */
+uint16_t vusb_transfer_drop_count(void);
+#endif
@@ -461,6 +461,11 @@ dump_vars:
 objs-size:
 	for i in $(OBJ); do echo $$i; done | sort | xargs $(SIZE)
 
+# Per-subsystem RAM/flash map with deltas versus the previous build of the
+# same target; runs automatically after linking with SIZE_REPORT_ENABLE = yes.
+size-report:
+	for i in $(OBJ); do echo $$i; done | sort | xargs $(SIZE) | python3 $(TOP_DIR)/util/size_report.py --previous $(BUILD_DIR)/$(TARGET).sizes
+
 ifeq ($(findstring avr-gcc,$(CC)),avr-gcc)
 SIZE_MARGIN = 1024
 
@@ -501,7 +506,7 @@ $(eval $(foreach OUTPUT,$(OUTPUTS),$(shell mkdir -p $(OUTPUT) 2>/dev/null)))
 
 
 # Listing of phony targets.
-.PHONY : all dump_vars finish sizebefore sizeafter qmkversion \
+.PHONY : all dump_vars finish sizebefore sizeafter size-report qmkversion \
 gccversion build elf hex uf2 eep lss sym coff extcoff \
 clean clean_list debug gdb-config show_path \
 program teensy dfu dfu-ee dfu-start \
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# End-to-end latency harness for firmware built with MATRIX_INJECT_ENABLE.
+#
+# Injects a key event over the raw HID interface and measures the time
+# until the resulting keyboard report arrives on a hidraw node, giving
+# the full inject -> scan -> process -> USB IN path without an external
+# signal generator. The firmware must route packets with id 0xE4 to
+# matrix_inject_hid_receive() in raw_hid_receive_kb().
+#
+# The keyboard interface is read directly from /dev/hidrawN (the kernel
+# keeps delivering input reports alongside the HID driver), so this is
+# Linux-only and usually needs root or a udev rule. Find the node with
+#     grep -l "..." /sys/class/hidraw/hidraw*/device/uevent
+# or by diffing /dev/hidraw* while replugging.
+#
+# Usage:
+#     hid_latency_test.py --vid 0xFEED --pid 0x0000 --listen /dev/hidraw2 \
+#         --row 0 --col 0 [--count 500] [--gap-ms 30]
+
+import argparse
+import os
+import select
+import statistics
+import sys
+import time
+
+try:
+    import hid
+except ImportError:
+    sys.exit('missing dependency: pip install hid  (hidapi bindings)')
+
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE = 0x61
+RAW_EPSIZE = 32
+
+MATRIX_INJECT_HID_ID = 0xE4
+ID_INJECT_SET = 0x01
+ID_INJECT_CLEAR = 0x02
+
+
+def open_raw_interface(vid, pid):
+    for info in hid.enumerate(vid, pid):
+        if info['usage_page'] == RAW_USAGE_PAGE and info['usage'] == RAW_USAGE:
+            device = hid.Device(path=info['path'])
+            return device
+    sys.exit('no raw HID interface (usage page 0x%04X) on %04X:%04X' % (RAW_USAGE_PAGE, vid, pid))
+
+
+def inject(device, row, col, pressed):
+    packet = [0x00, MATRIX_INJECT_HID_ID, ID_INJECT_SET, row, col, 1 if pressed else 0]
+    packet += [0x00] * (RAW_EPSIZE + 1 - len(packet))
+    device.write(bytes(packet))
+
+
+def drain(fd):
+    while select.select([fd], [], [], 0)[0]:
+        os.read(fd, 64)
+
+
+def wait_for_report(fd, want_key, timeout):
+    """Wait for a keyboard report whose key-presence matches want_key."""
+    deadline = time.perf_counter() + timeout
+    while True:
+        remaining = deadline - time.perf_counter()
+        if remaining <= 0:
+            return None
+        if not select.select([fd], [], [], remaining)[0]:
+            return None
+        now = time.perf_counter()
+        report = os.read(fd, 64)
+        # boot/NKRO reports both have all key bytes zero when idle
+        has_key = any(report[2:])
+        if has_key == want_key:
+            return now
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measure inject-to-report latency of a MATRIX_INJECT_ENABLE build.')
+    parser.add_argument('--vid', type=lambda v: int(v, 0), required=True, help='USB vendor id')
+    parser.add_argument('--pid', type=lambda v: int(v, 0), required=True, help='USB product id')
+    parser.add_argument('--listen', required=True, help='hidraw node of the keyboard interface, e.g. /dev/hidraw2')
+    parser.add_argument('--row', type=int, required=True, help='matrix row to inject')
+    parser.add_argument('--col', type=int, required=True, help='matrix column to inject')
+    parser.add_argument('--count', type=int, default=500, help='number of press/release cycles (default 500)')
+    parser.add_argument('--gap-ms', type=float, default=30, help='settle time between events in ms (default 30)')
+    parser.add_argument('--timeout', type=float, default=1.0, help='per-event timeout in seconds (default 1.0)')
+    args = parser.parse_args()
+
+    raw = open_raw_interface(args.vid, args.pid)
+    fd = os.open(args.listen, os.O_RDONLY | os.O_NONBLOCK)
+
+    samples = []
+    timeouts = 0
+    try:
+        for _ in range(args.count):
+            for pressed in (True, False):
+                drain(fd)
+                start = time.perf_counter()
+                inject(raw, args.row, args.col, pressed)
+                arrival = wait_for_report(fd, pressed, args.timeout)
+                if arrival is None:
+                    timeouts += 1
+                elif pressed:
+                    # only press edges are scored; the release just re-arms
+                    samples.append((arrival - start) * 1e6)
+                time.sleep(args.gap_ms / 1000.0)
+    finally:
+        raw.write(bytes([0x00, MATRIX_INJECT_HID_ID, ID_INJECT_CLEAR] + [0x00] * (RAW_EPSIZE - 2)))
+        raw.close()
+        os.close(fd)
+
+    if not samples:
+        sys.exit('no samples collected (%d timeouts) - wrong hidraw node?' % timeouts)
+
+    samples.sort()
+
+    def pct(p):
+        return samples[min(len(samples) - 1, int(len(samples) * p / 100))]
+
+    print('samples: %d   timeouts: %d' % (len(samples), timeouts))
+    print('min: %7.0f us' % samples[0])
+    print('avg: %7.0f us' % statistics.mean(samples))
+    print('p50: %7.0f us' % pct(50))
+    print('p95: %7.0f us' % pct(95))
+    print('p99: %7.0f us' % pct(99))
+    print('max: %7.0f us' % samples[-1])
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Generate the keycode -> name lookup tables for the KEYCODE_NAMES feature.
+#
+# Parses the basic keycode enums out of quantum/keycode.h and emits
+# quantum/keycode_names_table.h: one PROGMEM character pool in which every
+# name is stored without its "KC_" prefix and names that are a suffix of a
+# longer name share its tail, plus parallel code/offset arrays sorted by
+# keycode for binary search. The canonical (first) enumerator for each code
+# wins; short aliases are preprocessor macros and never seen here.
+#
+# The emitted table is checked in; rerun this script when keycode.h changes:
+#
+#     util/keycode_name_gen.py quantum/keycode.h -o quantum/keycode_names_table.h
+#
+# Conditional blocks are resolved pessimistically: `#if 0` regions are
+# dropped and `#ifdef` regions keep their `#else` branch, so mouse keys get
+# their default (non-VIA) code assignment.
+
+import argparse
+import re
+import sys
+
+ENUMS = ['hid_keyboard_keypad_usage', 'internal_special_keycodes', 'mouse_keys']
+
+
+def strip_conditionals(lines):
+    """Drop `#if 0`/`#ifdef` branches, keeping `#else` branches."""
+    out = []
+    # each stack entry is True while the current branch is kept
+    stack = []
+    for line in lines:
+        stripped = line.strip()
+        if stripped.startswith('#if'):
+            stack.append(False)  # first branch of #if 0 / #ifdef X: dropped
+            continue
+        if stripped.startswith('#else'):
+            if stack:
+                stack[-1] = True
+            continue
+        if stripped.startswith('#endif'):
+            if stack:
+                stack.pop()
+            continue
+        if all(stack):
+            out.append(line)
+    return out
+
+
+def parse_enum(source, name):
+    """Return {code: canonical_name} for one enum."""
+    match = re.search(r'enum\s+%s\s*\{(.*?)\n\};' % re.escape(name), source, re.DOTALL)
+    if not match:
+        sys.exit('no enum %s found' % name)
+    body = strip_conditionals(match.group(1).split('\n'))
+    names = {}
+    by_name = {}
+    next_code = 0
+    for line in body:
+        line = re.sub(r'//.*', '', re.sub(r'/\*.*?\*/', '', line)).strip().rstrip(',')
+        entry = re.match(r'(KC_\w+)\s*(?:=\s*(\w+))?$', line)
+        if not entry:
+            continue
+        enum_name, value = entry.groups()
+        if value is None:
+            code = next_code
+        elif value.startswith('KC_'):
+            code = by_name[value]  # alias of an earlier enumerator
+        else:
+            code = int(value, 0)
+        by_name[enum_name] = code
+        next_code = code + 1
+        if code not in names:
+            names[code] = enum_name
+    return names
+
+
+def build_pool(names):
+    """Suffix-compress the names into one pool, return (pool_bytes, {name: offset})."""
+    pool = b''
+    offsets = {}
+    # longest first so suffixes land after their hosts; alphabetical
+    # tie-break keeps the output stable across runs (set iteration order
+    # is hash-randomized)
+    for name in sorted(set(names), key=lambda n: (-len(n), n)):
+        encoded = name.encode('ascii') + b'\0'
+        index = pool.find(encoded)
+        if index < 0:
+            index = len(pool)
+            pool += encoded
+        offsets[name] = index
+    return pool, offsets
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate keycode name lookup tables.')
+    parser.add_argument('keycode_h', help='path to quantum/keycode.h')
+    parser.add_argument('-o', '--output', help='output header (default stdout)')
+    args = parser.parse_args()
+
+    with open(args.keycode_h) as f:
+        source = f.read()
+
+    names = {}
+    for enum in ENUMS:
+        for code, name in parse_enum(source, enum).items():
+            if code > 0xFF:
+                sys.exit('%s = 0x%X does not fit the 8-bit table' % (name, code))
+            if code not in names:
+                names[code] = name[len('KC_'):]
+
+    pool, offsets = build_pool(names.values())
+    codes = sorted(names)
+
+    out = sys.stdout if args.output is None else open(args.output, 'w')
+    out.write('/* Generated by util/keycode_name_gen.py from %s - do not edit.\n' % args.keycode_h)
+    out.write(' *\n')
+    out.write(' * %d names, %d bytes of pool, names stored without the KC_ prefix.\n' % (len(codes), len(pool)))
+    out.write(' * Mouse keys carry their default (non-VIA) code assignment.\n')
+    out.write(' */\n\n')
+    out.write('#pragma once\n\n')
+    out.write('#define KEYCODE_NAMES_COUNT %d\n\n' % len(codes))
+    out.write('static const char keycode_names_pool[%d] PROGMEM =\n' % len(pool))
+    for segment in pool.decode('ascii').split('\0')[:-1]:
+        out.write('    "%s\\0"\n' % segment)
+    out.write(';\n\n')
+    out.write('static const uint8_t keycode_names_codes[KEYCODE_NAMES_COUNT] PROGMEM = {\n')
+    for i in range(0, len(codes), 12):
+        out.write('    %s,\n' % ', '.join('0x%02X' % c for c in codes[i:i + 12]))
+    out.write('};\n\n')
+    out.write('static const uint16_t keycode_names_offsets[KEYCODE_NAMES_COUNT] PROGMEM = {\n')
+    for i in range(0, len(codes), 12):
+        out.write('    %s,\n' % ', '.join('%d' % offsets[names[c]] for c in codes[i:i + 12]))
+    out.write('};\n')
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Generate the KEYMAP_COMPACT support header for one keyboard.
+#
+# Parses a LAYOUT macro from the keyboard's header, works out which
+# matrix positions carry a real key and which are KC_NO padding, and
+# emits a header with:
+#
+#   KEYMAP_COMPACT_SIZE    number of populated positions
+#   KEYMAP_COMPACT_INDEX   (row,col) -> dense index table initializer
+#   <macro>_compact(...)   layout macro producing a dense layer array
+#
+# With KEYMAP_COMPACT each stored layer is KEYMAP_COMPACT_SIZE keycodes
+# instead of MATRIX_ROWS*MATRIX_COLS, which on sparse matrices reclaims
+# two flash bytes per padding position per layer against a one-time
+# MATRIX_ROWS*MATRIX_COLS byte index table. To adopt, in the keyboard's
+# config.h add `#define KEYMAP_COMPACT` and include the generated
+# header, then build keymaps with the `_compact` layout macro; see
+# the KEYMAP_COMPACT entry in docs/config_options.md.
+#
+# Usage: keymap_compact_gen.py keyboards/foo/foo.h LAYOUT -o keyboards/foo/keymap_compact.h
+
+import argparse
+import re
+import sys
+
+
+def extract_macro(source, name):
+    """Return (args, body) of `#define name(args) body` with continuations folded."""
+    source = source.replace('\\\n', ' ')
+    match = re.search(r'#\s*define\s+%s\s*\(([^)]*)\)(.*)' % re.escape(name), source)
+    if not match:
+        sys.exit('no #define %s(...) found' % name)
+    args = [a.strip() for a in match.group(1).split(',') if a.strip()]
+    body = match.group(2).split('\n', 1)[0]
+    return args, body
+
+
+def parse_matrix(body, args):
+    """Return the row-major list of cells from the macro body initializer."""
+    body = body.strip()
+    if not (body.startswith('{') and body.endswith('}')):
+        sys.exit('macro body is not a brace initializer')
+    rows = re.findall(r'\{([^{}]*)\}', body[1:-1])
+    if not rows:
+        sys.exit('no row initializers found in macro body')
+    matrix = []
+    arg_set = set(args)
+    for row in rows:
+        cells = []
+        for cell in row.split(','):
+            cell = cell.strip()
+            if not cell:
+                continue
+            cells.append(args.index(cell) if cell in arg_set else None)
+        matrix.append(cells)
+    return matrix
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the KEYMAP_COMPACT header for one keyboard.')
+    parser.add_argument('header', help='keyboard header containing the layout macro')
+    parser.add_argument('macro', help='layout macro name, e.g. LAYOUT')
+    parser.add_argument('-o', '--output', help='output header (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.header) as f:
+        macro_args, body = extract_macro(f.read(), args.macro)
+
+    matrix = parse_matrix(body, macro_args)
+    rows = len(matrix)
+    cols = max(len(row) for row in matrix)
+    padding = sum(1 for row in matrix for cell in row if cell is None)
+
+    if len(macro_args) > 0xFE:
+        sys.exit('%d keys do not fit an 8-bit dense index' % len(macro_args))
+
+    # dense index per argument, in argument order
+    index = [[0xFF] * cols for _ in range(rows)]
+    seen = set()
+    for r, row in enumerate(matrix):
+        for c, cell in enumerate(row):
+            if cell is not None:
+                if cell in seen:
+                    sys.exit('argument %s appears twice in the matrix' % macro_args[cell])
+                seen.add(cell)
+                index[r][c] = cell
+    if len(seen) != len(macro_args):
+        missing = [a for i, a in enumerate(macro_args) if i not in seen]
+        sys.exit('arguments never placed in the matrix: %s' % ', '.join(missing))
+
+    out = sys.stdout if not args.output else open(args.output, 'w')
+    out.write('/* Generated by util/keymap_compact_gen.py from %s (%s) -- do not edit.\n' % (args.header, args.macro))
+    out.write(' * %d keys on a %dx%d matrix; saves %d flash bytes per stored layer.\n' % (len(macro_args), rows, cols, padding * 2))
+    out.write(' */\n')
+    out.write('#pragma once\n\n')
+    out.write('#define KEYMAP_COMPACT_SIZE %d\n' % len(macro_args))
+    out.write('#define KEYMAP_COMPACT_UNMAPPED 0xFF\n\n')
+    out.write('/* (row,col) -> index into a dense layer, KEYMAP_COMPACT_UNMAPPED for padding */\n')
+    out.write('#define KEYMAP_COMPACT_INDEX { \\\n')
+    for row in index:
+        out.write('    {%s}, \\\n' % ', '.join('0xFF' if i == 0xFF else '%d' % i for i in row))
+    out.write('}\n\n')
+    out.write('/* dense layer in %s argument order */\n' % args.macro)
+    out.write('#define %s_compact(%s) \\\n' % (args.macro, ', '.join(macro_args)))
+    out.write('    { %s }\n' % ', '.join(macro_args))
+    if args.output:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Compile an autocorrect dictionary into the flash trie the firmware walks.
+
+Input is a plain text file with one correction per line:
+
+    widht       -> width
+    :teh        -> the
+    :alot:      -> a lot
+
+Typos are lowercase a-z plus apostrophe. A leading ':' anchors the typo to
+the start of a word, a trailing ':' fires only when the word is finished
+(space, enter, punctuation); anchors match any word boundary. Lines starting
+with '#' and blank lines are ignored.
+
+The output header defines autocorrect_data[], a trie over the typos spelled
+backwards so the firmware matches from the newest keystroke outwards -- see
+quantum/process_keycode/process_autocorrect.c for the node encoding. Write
+it next to your keymap as autocorrect_data.h:
+
+    ./util/make_autocorrect_data.py mydict.txt > keyboards/.../keymaps/me/autocorrect_data.h
+"""
+
+import os
+import sys
+
+KC_SPC = 0x2C
+KC_QUOT = 0x34
+
+
+def char_to_keycode(char):
+    if "a" <= char <= "z":
+        return ord(char) - ord("a") + 4
+    if char == ":":
+        return KC_SPC
+    if char == "'":
+        return KC_QUOT
+    raise SystemExit(f"error: unsupported character {char!r} in typo")
+
+
+class Node:
+    def __init__(self):
+        self.children = {}  # keycode -> Node
+        self.leaf = None  # (flags, backspaces, suffix)
+
+
+def parse_dictionary(path):
+    entries = []
+    with open(path) as fh:
+        for lineno, line in enumerate(fh, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            if "->" not in line:
+                raise SystemExit(f"{path}:{lineno}: expected 'typo -> correction'")
+            typo, correction = (part.strip() for part in line.split("->", 1))
+            if not typo or not correction:
+                raise SystemExit(f"{path}:{lineno}: empty typo or correction")
+            if ":" in typo.strip(":"):
+                raise SystemExit(f"{path}:{lineno}: ':' is only valid at the ends of a typo")
+            entries.append((lineno, typo, correction))
+    if not entries:
+        raise SystemExit(f"{path}: no entries")
+    return entries
+
+
+def build_trie(path, entries):
+    root = Node()
+    for lineno, typo, correction in entries:
+        boundary = typo.endswith(":")
+        word = typo.strip(":")
+        # erase the typed typo back to where it diverges from the correction;
+        # with a letter trigger the final letter has not been output yet
+        prefix = os.path.commonprefix([word, correction])
+        backspaces = len(word) - len(prefix) - (0 if boundary else 1)
+        suffix = correction[len(prefix):]
+        if backspaces < 0 or backspaces > 0x3F:
+            raise SystemExit(f"{path}:{lineno}: typo/correction shape not encodable")
+        keys = [char_to_keycode(char) for char in reversed(typo)]
+        node = root
+        for key in keys:
+            if node.leaf is not None:
+                raise SystemExit(f"{path}:{lineno}: typo shadowed by a shorter entry ending the same way")
+            node = node.children.setdefault(key, Node())
+        if node.leaf is not None or node.children:
+            raise SystemExit(f"{path}:{lineno}: typo duplicates or shadows another entry")
+        node.leaf = (0x40 if boundary else 0x00, backspaces, suffix)
+    return root
+
+
+def serialize(node, data):
+    offset = len(data)
+    if node.leaf is not None:
+        flags, backspaces, suffix = node.leaf
+        data.append(0x80 | flags | backspaces)
+        data.extend(suffix.encode("ascii"))
+        data.append(0)
+        return offset
+    if len(node.children) == 1:
+        # chain: compress the single-child run into a byte string
+        data.append(0x40)
+        current = node
+        while current.leaf is None and len(current.children) == 1:
+            key, child = next(iter(current.children.items()))
+            data.append(key)
+            current = child
+        data.append(0)
+        serialize(current, data)  # continues directly after the NUL
+        return offset
+    # branch: entry table first, children behind it, offsets patched after
+    patches = []
+    for key in sorted(node.children):
+        data.append(key)
+        patches.append((len(data), node.children[key]))
+        data.extend((0, 0))
+    data.append(0)
+    for position, child in patches:
+        child_offset = serialize(child, data)
+        if child_offset > 0xFFFF:
+            raise SystemExit("error: dictionary too large for 16-bit trie offsets")
+        data[position] = child_offset & 0xFF
+        data[position + 1] = child_offset >> 8
+    return offset
+
+
+def main():
+    if len(sys.argv) != 2:
+        raise SystemExit(f"usage: {sys.argv[0]} <dictionary.txt>")
+    path = sys.argv[1]
+    entries = parse_dictionary(path)
+    data = bytearray()
+    serialize(build_trie(path, entries), data)
+
+    lengths = [len(typo) for _, typo, _ in entries]
+    print(f"// Generated by util/make_autocorrect_data.py from {os.path.basename(path)}")
+    print(f"// {len(entries)} entries, {len(data)} bytes. Do not edit by hand.")
+    print("#pragma once")
+    print()
+    print(f"#define AUTOCORRECT_MIN_LENGTH {min(lengths)}")
+    print(f"#define AUTOCORRECT_MAX_LENGTH {max(lengths)}")
+    print()
+    print(f"static const uint8_t autocorrect_data[{len(data)}] PROGMEM = {{")
+    for start in range(0, len(data), 12):
+        chunk = ", ".join(f"0x{byte:02X}" for byte in data[start : start + 12])
+        print(f"    {chunk},")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
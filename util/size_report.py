@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Aggregate per-object `size` output into a per-subsystem RAM/flash map.
+#
+# Reads Berkeley-format `size` output (text/data/bss columns, one object
+# file per line) on stdin, groups the objects by source subsystem
+# (quantum/rgb_matrix, quantum/process_keycode, drivers/oled, ...) and
+# prints flash (text+data) and RAM (data+bss) per subsystem, largest RAM
+# consumer first. With --previous FILE the numbers of the last run are
+# diffed and the file is updated, so the report shows which subsystem a
+# rules.mk or config.h change actually grew.
+#
+# Wired into the build as `make <keyboard>:<keymap> size-report` (see
+# tmk_core/rules.mk); runs automatically after linking when the build
+# sets SIZE_REPORT_ENABLE = yes.
+
+import argparse
+import os
+import sys
+
+
+def subsystem(path):
+    """Map an object path to a reporting bucket."""
+    # strip the build prefix: .build/obj_<target>/quantum/matrix.o
+    parts = path.replace('\\', '/').split('/')
+    while parts and (parts[0] in ('.', '..', '.build') or parts[0].startswith('obj_')):
+        parts = parts[1:]
+    if not parts:
+        return path
+    if len(parts) >= 3 and parts[0] in ('quantum', 'drivers', 'platforms', 'tmk_core', 'lib', 'keyboards'):
+        return '/'.join(parts[:2])
+    if len(parts) >= 2:
+        return parts[0]
+    return os.path.splitext(parts[0])[0]
+
+
+def parse_size_output(stream):
+    buckets = {}
+    for line in stream:
+        fields = line.split()
+        if len(fields) < 6 or not fields[0].isdigit():
+            continue  # header or blank
+        text, data, bss = int(fields[0]), int(fields[1]), int(fields[2])
+        name = subsystem(fields[5])
+        flash, ram = buckets.get(name, (0, 0))
+        buckets[name] = (flash + text + data, ram + data + bss)
+    return buckets
+
+
+def load_previous(path):
+    previous = {}
+    try:
+        with open(path) as f:
+            for line in f:
+                name, flash, ram = line.split('\t')
+                previous[name] = (int(flash), int(ram))
+    except (IOError, ValueError):
+        pass
+    return previous
+
+
+def save_current(path, buckets):
+    with open(path, 'w') as f:
+        for name, (flash, ram) in sorted(buckets.items()):
+            f.write('%s\t%d\t%d\n' % (name, flash, ram))
+
+
+def delta(current, previous):
+    if previous is None:
+        return ''
+    diff = current - previous
+    if diff == 0:
+        return ''
+    return '%+d' % diff
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Aggregate `size` output into a per-subsystem RAM/flash map.')
+    parser.add_argument('--previous', help='state file for build-over-build deltas; updated on each run')
+    args = parser.parse_args()
+
+    buckets = parse_size_output(sys.stdin)
+    if not buckets:
+        sys.exit('no size output on stdin (expected Berkeley format)')
+
+    previous = load_previous(args.previous) if args.previous else {}
+
+    print('%-36s %10s %8s %10s %8s' % ('subsystem', 'flash', 'delta', 'ram', 'delta'))
+    total_flash = total_ram = 0
+    for name, (flash, ram) in sorted(buckets.items(), key=lambda item: -item[1][1]):
+        prev = previous.get(name)
+        print('%-36s %10d %8s %10d %8s' % (name, flash, delta(flash, prev and prev[0]), ram, delta(ram, prev and prev[1])))
+        total_flash += flash
+        total_ram += ram
+    for name, (flash, ram) in sorted(previous.items()):
+        if name not in buckets:
+            print('%-36s %10s %8d %10s %8d' % (name + ' (removed)', '', -flash, '', -ram))
+    prev_totals = (sum(f for f, r in previous.values()), sum(r for f, r in previous.values())) if previous else (None, None)
+    print('%-36s %10d %8s %10d %8s' % ('total (objects)', total_flash, delta(total_flash, prev_totals[0]), total_ram, delta(total_ram, prev_totals[1])))
+    print('(flash = text+data, ram = data+bss; library and linker overhead not included)')
+
+    if args.previous:
+        save_current(args.previous, buckets)
+
+
+if __name__ == '__main__':
+    main()
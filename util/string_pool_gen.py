@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Generate a deduplicated PROGMEM string pool header from a list of strings.
+#
+# Input: a text file with one entry per line, formatted as
+#
+#     NAME<TAB>text of the string
+#
+# Blank lines and lines starting with '#' are ignored. The text may use the
+# C escapes \n \t \\ \" and \xNN.
+#
+# Output (stdout or -o file): a header defining one PROGMEM character pool
+# in which every distinct string is stored exactly once and strings that are
+# a suffix of a longer string share its tail, plus one STR_<NAME> handle per
+# entry. Handles are byte offsets into the pool and are used as
+#
+#     SEND_STRING_POOL(STR_HELLO);             // send_string feature
+#     oled_write_P(string_pool_ptr(STR_HELLO), false);
+#
+# Usage: string_pool_gen.py strings.txt [-o string_pool.h] [--name string_pool]
+
+import argparse
+import sys
+
+
+def unescape(text):
+    out = []
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == '\\' and i + 1 < len(text):
+            n = text[i + 1]
+            if n == 'n':
+                out.append('\n')
+                i += 2
+                continue
+            if n == 't':
+                out.append('\t')
+                i += 2
+                continue
+            if n == '\\':
+                out.append('\\')
+                i += 2
+                continue
+            if n == '"':
+                out.append('"')
+                i += 2
+                continue
+            if n == 'x' and i + 3 < len(text):
+                out.append(chr(int(text[i + 2:i + 4], 16)))
+                i += 4
+                continue
+        out.append(c)
+        i += 1
+    return ''.join(out)
+
+
+def escape(text):
+    out = []
+    for c in text:
+        if c == '\\':
+            out.append('\\\\')
+        elif c == '"':
+            out.append('\\"')
+        elif c == '\n':
+            out.append('\\n')
+        elif c == '\t':
+            out.append('\\t')
+        elif 32 <= ord(c) < 127:
+            out.append(c)
+        else:
+            out.append('\\x%02x' % ord(c))
+    return ''.join(out)
+
+
+def build_pool(entries):
+    """Return (pool_string, {name: offset}).
+
+    Exact duplicates collapse to one copy, and any string that is a suffix
+    of another is stored as the tail of the longer one (each stored string
+    is NUL-terminated in the pool, so a suffix shares the terminator too).
+    """
+    # longest first, so shorter strings can attach to already-stored ones
+    distinct = sorted(set(entries.values()), key=len, reverse=True)
+    pool = []
+    pool_len = 0
+    offsets = {}
+    for s in distinct:
+        placed = None
+        for t, off in offsets.items():
+            if t.endswith(s):
+                placed = off + len(t) - len(s)
+                break
+        if placed is None:
+            placed = pool_len
+            pool.append(s)
+            pool_len += len(s) + 1  # NUL terminator
+        offsets[s] = placed
+    return pool, {name: offsets[s] for name, s in entries.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate a deduplicated PROGMEM string pool header.')
+    parser.add_argument('input', help='text file with NAME<TAB>string lines')
+    parser.add_argument('-o', '--output', help='output header (default: stdout)')
+    parser.add_argument('--name', default='string_pool', help='pool symbol name (default: string_pool)')
+    args = parser.parse_args()
+
+    entries = {}
+    with open(args.input) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.rstrip('\n')
+            if not line.strip() or line.lstrip().startswith('#'):
+                continue
+            if '\t' not in line:
+                sys.exit('%s:%d: expected NAME<TAB>string' % (args.input, lineno))
+            name, text = line.split('\t', 1)
+            name = name.strip()
+            if not name.isidentifier():
+                sys.exit('%s:%d: "%s" is not a valid identifier' % (args.input, lineno, name))
+            if name in entries:
+                sys.exit('%s:%d: duplicate name "%s"' % (args.input, lineno, name))
+            entries[name] = unescape(text)
+
+    if not entries:
+        sys.exit('%s: no entries' % args.input)
+
+    pool, handles = build_pool(entries)
+    raw_total = sum(len(s) + 1 for s in entries.values())
+    pool_total = sum(len(s) + 1 for s in pool)
+
+    out = sys.stdout if not args.output else open(args.output, 'w')
+    out.write('/* Generated by util/string_pool_gen.py -- do not edit.\n')
+    out.write(' * %d strings, %d bytes raw, %d bytes pooled (%d saved).\n' % (len(entries), raw_total, pool_total, raw_total - pool_total))
+    out.write(' */\n')
+    out.write('#pragma once\n\n')
+    out.write('#include "progmem.h"\n\n')
+    out.write('static const char %s[] PROGMEM =\n' % args.name)
+    for s in pool:
+        out.write('    "%s\\0"\n' % escape(s))
+    out.write(';\n\n')
+    out.write('#define string_pool_ptr(handle) (&%s[handle])\n' % args.name)
+    out.write('#define SEND_STRING_POOL(handle) send_string_P(string_pool_ptr(handle))\n\n')
+    for name in entries:
+        out.write('#define STR_%s %d\n' % (name.upper(), handles[name]))
+    if args.output:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
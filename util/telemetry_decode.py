@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Decode QMK binary telemetry records from a console byte stream.
+
+The firmware (TELEMETRY_ENABLE) interleaves framed binary records with
+ordinary console text on the same endpoint. This reference parser reads
+the raw stream on stdin (e.g. piped from hid_listen or a hidraw node),
+passes the text through to stdout, and prints each valid record as one
+JSON line on stderr so a fleet agent can consume it cheaply:
+
+    hid_listen | ./util/telemetry_decode.py 2>> telemetry.jsonl
+
+Frame format: D7 A9, version<<4|type, u32 timestamp_ms, u8 length,
+payload, XOR checksum -- see quantum/logging/telemetry.h.
+"""
+
+import json
+import struct
+import sys
+
+MAGIC = b"\xd7\xa9"
+
+SCAN_PROFILE_PROBES = ["matrix", "debounce", "lighting", "oled", "encoder"]
+
+WATCHDOG_SUBSYSTEMS = [
+    "none",
+    "matrix",
+    "action",
+    "cosmetics",
+    "encoder",
+    "mouse",
+    "pointing",
+    "housekeeping",
+]
+
+PERF_COUNTER_NAMES = [
+    "scan_passes",
+    "key_events",
+    "rgb_frames",
+    "split_transactions",
+    "split_errors",
+    "i2c_transfers",
+    "i2c_errors",
+    "spi_transfers",
+]
+
+
+def decode_payload(rtype, payload):
+    if rtype == 0x1 and len(payload) == 17:
+        probe, pmin, pavg, pmax, samples = struct.unpack("<B4I", payload)
+        name = SCAN_PROFILE_PROBES[probe] if probe < len(SCAN_PROFILE_PROBES) else str(probe)
+        return {"record": "scan_profile", "probe": name, "min_us": pmin, "avg_us": pavg, "max_us": pmax, "samples": samples}
+    if rtype == 0x2 and payload and len(payload) == 1 + 4 * payload[0]:
+        counters = struct.unpack("<%dI" % payload[0], payload[1:])
+        named = {PERF_COUNTER_NAMES[i] if i < len(PERF_COUNTER_NAMES) else str(i): v for i, v in enumerate(counters)}
+        return {"record": "perf_counters", "counters": named}
+    if rtype == 0x3 and len(payload) == 4:
+        frames, reports = struct.unpack("<2H", payload)
+        return {"record": "link_quality", "frames": frames, "reports": reports}
+    if rtype == 0x4 and payload and len(payload) == 3 + 2 * payload[0]:
+        fired = struct.unpack("<H", payload[1:3])[0]
+        counts = struct.unpack("<%dH" % payload[0], payload[3:])
+        named = {WATCHDOG_SUBSYSTEMS[i] if i < len(WATCHDOG_SUBSYSTEMS) else str(i): v for i, v in enumerate(counts)}
+        return {"record": "watchdog", "fired": fired, "stalls": named}
+    return {"record": "unknown", "type": rtype, "payload": payload.hex()}
+
+
+def main():
+    stream = sys.stdin.buffer
+    buf = b""
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        buf += chunk
+        # flush anything that cannot be the start of a frame as text
+        while buf:
+            idx = buf.find(MAGIC[0:1])
+            if idx < 0:
+                sys.stdout.buffer.write(buf)
+                sys.stdout.flush()
+                buf = b""
+                break
+            if idx > 0:
+                sys.stdout.buffer.write(buf[:idx])
+                sys.stdout.flush()
+                buf = buf[idx:]
+            # shortest frame: magic(2) + header(6) + checksum(1)
+            if len(buf) < 8:
+                break
+            if buf[1] != MAGIC[1]:
+                sys.stdout.buffer.write(buf[0:1])
+                buf = buf[1:]
+                continue
+            length = buf[7]
+            total = 2 + 6 + length + 1
+            if len(buf) < total:
+                break
+            body = buf[2 : total - 1]
+            if buf[total - 1] != xor_all(body):
+                # bad checksum: treat the magic as text and resync
+                sys.stdout.buffer.write(buf[0:1])
+                buf = buf[1:]
+                continue
+            version = body[0] >> 4
+            rtype = body[0] & 0x0F
+            timestamp = struct.unpack("<I", body[1:5])[0]
+            record = decode_payload(rtype, bytes(body[6:]))
+            record.update({"version": version, "timestamp_ms": timestamp})
+            print(json.dumps(record), file=sys.stderr, flush=True)
+            buf = buf[total:]
+
+
+def xor_all(data):
+    checksum = 0
+    for b in data:
+        checksum ^= b
+    return checksum
+
+
+if __name__ == "__main__":
+    main()